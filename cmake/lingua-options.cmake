@@ -20,7 +20,16 @@ option(${PROJECT_NAME}_ENABLE_CLANG_TIDY "Builds with clang-tidy, if available.
 set(${PROJECT_NAME}_CLANG_TIDY_PATH "/usr/bin/clang-tidy" CACHE
    STRING "Sets the path for clang-tidy. Defaults to \"/usr/bin/clang-tidy\".")
 
+# I/O options
+option(${PROJECT_NAME}_ENABLE_IO_URING
+   "Lets load_files issue reads through io_uring on Linux, falling back to a thread pool when it is unavailable at runtime. Defaults to On."
+   On)
+
 # Options for sanitizers
+option(${PROJECT_NAME}_ENABLE_FUZZING
+   "Builds the fuzz targets in test/fuzz with libFuzzer, which needs a compiler that supports -fsanitize=fuzzer. When Off, they're built with a driver that replays their corpus as a test. Defaults to Off."
+   Off)
+
 set(valid_sanitizer_options
    ""
    Address              # see https://clang.llvm.org/docs/AddressSanitizer.html
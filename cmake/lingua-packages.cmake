@@ -20,6 +20,7 @@ if (LINGUA_ENABLE_CLANG_TIDY)
    find_package(ClangTidy REQUIRED)
 endif()
 find_package(CodeCoverage REQUIRED)
+find_package(Threads REQUIRED)
 include(lingua-sanitizers)
 
 # Library packages
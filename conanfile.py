@@ -24,7 +24,7 @@ class Lingua(ConanFile):
     author = "Christopher Di Bella"
     license = "Apache License, Version 2.0"
     url = "https://github.com/cjdb/lingua.git"
-    version = "0.1"
+    version = "0.1" # keep in sync with include/lingua/version.hpp
     topics = ("cpp", "c++", "cmake", "conan")
     settings = ("os", "compiler", "arch", "build_type")
     generators = ("cmake", "cmake_paths", "virtualrunenv")
@@ -34,7 +34,8 @@ class Lingua(ConanFile):
         "optional_sanitizers": "ANY",
         "sanitize_release": ["Off", "On"],
         "enable_clang_tidy": ["Off", "On"],
-        "clang_tidy_path": "ANY"
+        "clang_tidy_path": "ANY",
+        "enable_io_uring": ["Off", "On"]
     }
     default_options = {
         "code_coverage": "Off",
@@ -42,7 +43,8 @@ class Lingua(ConanFile):
         "optional_sanitizers": "Address;Undefined;ControlFlowIntegrity",
         "sanitize_release": "Off",
         "enable_clang_tidy": "On",
-        "clang_tidy_path": "/usr/bin/clang-tidy"
+        "clang_tidy_path": "/usr/bin/clang-tidy",
+        "enable_io_uring": "On"
     }
     requires = ("cjdb/0.1@cjdb/beta",
                 "doctest/2.2.0@bincrafters/stable",
@@ -61,6 +63,7 @@ class Lingua(ConanFile):
         cmake.definitions[f"{self.name}_SANITIZE_RELEASE"] = self.options.sanitize_release
         cmake.definitions[f"{self.name}_ENABLE_CLANG_TIDY"] = self.options.enable_clang_tidy
         cmake.definitions[f"{self.name}_CLANG_TIDY_PATH"] = self.options.clang_tidy_path
+        cmake.definitions[f"{self.name}_ENABLE_IO_URING"] = self.options.enable_io_uring
         return cmake
 
     def build(self):
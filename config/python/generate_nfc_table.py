@@ -0,0 +1,208 @@
+#!/usr/bin/python
+#
+#  Copyright Christopher Di Bella
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Generates include/lingua/lexer/detail/nfc_table.hpp.
+
+Usage: python config/python/generate_nfc_table.py config/ucd > \\
+          include/lingua/lexer/detail/nfc_table.hpp
+
+Reads DerivedNormalizationProps.txt, DerivedCombiningClass.txt, and CanonicalDecompositions.txt from
+the given directory, and writes three tables:
+
+ * Each code point's canonical combining class and NFC_Quick_Check value. The pairs that occur are
+   numbered, and the numbers are stored in a two-level table of 32-code-point chunks, in the same
+   way as the XID tables.
+ * The full canonical decomposition of each code point that has one, other than Hangul syllables.
+ * The primary composites: the pairs of code points that NFC composes, and what they compose to.
+"""
+
+import os
+import sys
+
+CHUNK_BITS = 5
+CHUNK_SIZE = 1 << CHUNK_BITS
+QUICK_CHECK = {"Y": 0, "M": 1, "N": 2}
+
+HEADER = """//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Generated by config/python/generate_nfc_table.py from {source}: don't edit by hand.
+//
+#ifndef LINGUA_LEXER_DETAIL_NFC_TABLE_HPP
+#define LINGUA_LEXER_DETAIL_NFC_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace lingua::detail_nfc {
+   /// \\brief A canonical combining class, and an NFC_Quick_Check value: 0 for Yes, 1 for Maybe,
+   ///        and 2 for No.
+   ///
+   struct normalization_class {
+      std::uint8_t combining_class;
+      std::uint8_t quick_check;
+   };
+
+   /// \\brief The full decomposition of `code_point` is `length` code points, starting at
+   ///        `decomposition_pool[offset]`.
+   ///
+   struct decomposition {
+      char32_t code_point;
+      std::uint16_t offset;
+      std::uint16_t length;
+   };
+
+   struct composition {
+      char32_t first;
+      char32_t second;
+      char32_t composite;
+   };
+
+   inline constexpr auto chunk_bits = {chunk_bits}U;
+
+   /// \\brief Every code point at or above this has class 0 and is NFC_Quick_Check=Yes, as does
+   ///        every code point below `table_start`.
+   ///
+   inline constexpr auto table_limit = char32_t{{{limit}}};
+   inline constexpr auto table_start = char32_t{{{start}}};
+"""
+
+FOOTER = """} // namespace lingua::detail_nfc
+
+#endif // LINGUA_LEXER_DETAIL_NFC_TABLE_HPP"""
+
+
+def data_lines(path):
+    """Yields the fields of each line of a UCD file that isn't a comment."""
+    with open(path, encoding="utf-8") as source:
+        for line in source:
+            data = line.split("#", 1)[0].strip()
+            if data:
+                yield [field.strip() for field in data.split(";")]
+
+
+def code_points(field):
+    first, _, last = field.partition("..")
+    return range(int(first, 16), int(last or first, 16) + 1)
+
+
+def read_ucd(directory):
+    """Returns the combining classes, quick check values, composition exclusions, and canonical
+    decompositions."""
+    combining_classes = {}
+    for fields in data_lines(os.path.join(directory, "DerivedCombiningClass.txt")):
+        for c in code_points(fields[0]):
+            combining_classes[c] = int(fields[1])
+
+    quick_checks = {}
+    exclusions = set()
+    for fields in data_lines(os.path.join(directory, "DerivedNormalizationProps.txt")):
+        if fields[1] == "NFC_QC":
+            for c in code_points(fields[0]):
+                quick_checks[c] = QUICK_CHECK[fields[2]]
+        elif fields[1] == "Full_Composition_Exclusion":
+            exclusions.update(code_points(fields[0]))
+
+    decompositions = {}
+    for fields in data_lines(os.path.join(directory, "CanonicalDecompositions.txt")):
+        decompositions[int(fields[0], 16)] = [int(c, 16) for c in fields[1].split()]
+    return combining_classes, quick_checks, exclusions, decompositions
+
+
+def full_decomposition(c, decompositions):
+    if c not in decompositions:
+        return [c]
+    return [d for part in decompositions[c] for d in full_decomposition(part, decompositions)]
+
+
+def print_array(type_name, name, description, values, per_line):
+    print("")
+    print("   /// \\brief {}".format(description))
+    print("   ///")
+    print("   inline constexpr auto {} = std::array<{}, {}>{{{{".format(name, type_name,
+                                                                    len(values)))
+    for row in range(0, len(values), per_line):
+        print("      " + " ".join("{},".format(x) for x in values[row:row + per_line]))
+    print("   }};")
+
+
+def main():
+    directory = sys.argv[1]
+    combining_classes, quick_checks, exclusions, decompositions = read_ucd(directory)
+    listed = set(combining_classes) | set(quick_checks)
+    start = min(listed) // CHUNK_SIZE * CHUNK_SIZE
+    limit = (max(listed) // CHUNK_SIZE + 1) * CHUNK_SIZE
+
+    classes = {(0, 0): 0}
+    chunks = []
+    leaves = {}
+    for chunk in range(start // CHUNK_SIZE, limit // CHUNK_SIZE):
+        leaf = []
+        for c in range(chunk * CHUNK_SIZE, (chunk + 1) * CHUNK_SIZE):
+            key = (combining_classes.get(c, 0), quick_checks.get(c, 0))
+            leaf.append(classes.setdefault(key, len(classes)))
+        chunks.append(leaves.setdefault(tuple(leaf), len(leaves)))
+    assert len(classes) <= 256 and len(leaves) <= 256
+
+    pool = []
+    entries = []
+    for c in sorted(decompositions):
+        decomposed = full_decomposition(c, decompositions)
+        entries.append("{{U'\\x{:X}', {}, {}}}".format(c, len(pool), len(decomposed)))
+        pool.extend(decomposed)
+    assert len(pool) < 1 << 16
+
+    compositions = sorted((d[0], d[1], c) for c, d in decompositions.items()
+                          if len(d) == 2 and c not in exclusions)
+
+    print(HEADER.replace("{source}", directory.rstrip("/\\").replace("\\", "/"))
+                .replace("{chunk_bits}", str(CHUNK_BITS))
+                .replace("{{{limit}}}", "{0x" + format(limit, "X") + "}")
+                .replace("{{{start}}}", "{0x" + format(start, "X") + "}"), end="")
+    print_array("normalization_class", "normalization_classes",
+                "The distinct pairs of a combining class and a quick check value.",
+                ["{{{}, {}}}".format(*key) for key in sorted(classes, key=classes.get)], 8)
+    print_array("std::uint8_t", "normalization_chunks",
+                "The leaf that holds each chunk's normalization classes, from table_start.",
+                chunks, 16)
+    print_array("std::uint8_t", "normalization_leaves",
+                "The distinct leaves, each of which is {} normalization classes.".format(
+                    CHUNK_SIZE),
+                [x for leaf in sorted(leaves, key=leaves.get) for x in leaf], 16)
+    print_array("decomposition", "decompositions",
+                "The code points with a canonical decomposition, in order.", entries, 4)
+    print_array("char32_t", "decomposition_pool", "The full decompositions, end to end.",
+                ["U'\\x{:X}'".format(c) for c in pool], 7)
+    print_array("composition", "compositions",
+                "The pairs that compose to a primary composite, in order.",
+                ["{{U'\\x{:X}', U'\\x{:X}', U'\\x{:X}'}}".format(*x) for x in compositions], 2)
+    print(FOOTER)
+
+
+if __name__ == "__main__":
+    main()
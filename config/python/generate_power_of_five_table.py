@@ -0,0 +1,101 @@
+#!/usr/bin/python
+#
+#  Copyright Christopher Di Bella
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Generates include/lingua/lexer/detail/power_of_five_table.hpp.
+
+Usage: python config/python/generate_power_of_five_table.py > \\
+          include/lingua/lexer/detail/power_of_five_table.hpp
+
+The table holds 5^q for q in [-342, 308], each normalised so that its most significant bit is bit
+127 of a 128-bit number. Positive powers are truncated, and negative powers are rounded up, which is
+what the Eisel-Lemire algorithm expects.
+"""
+
+SMALLEST_POWER = -342
+LARGEST_POWER = 308
+
+HEADER = """//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Generated by config/python/generate_power_of_five_table.py: don't edit by hand.
+//
+#ifndef LINGUA_LEXER_DETAIL_POWER_OF_FIVE_TABLE_HPP
+#define LINGUA_LEXER_DETAIL_POWER_OF_FIVE_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace lingua::detail_float_literal {
+   inline constexpr auto smallest_power_of_five = {smallest};
+   inline constexpr auto largest_power_of_five = {largest};
+
+   /// \\brief 128-bit approximations of 5^q, as pairs of the high and then the low 64 bits, for q
+   ///        from smallest_power_of_five to largest_power_of_five.
+   ///
+   inline constexpr auto power_of_five_128 = std::array<std::uint64_t, {size}>{{"""
+
+FOOTER = """   }};
+} // namespace lingua::detail_float_literal
+
+#endif // LINGUA_LEXER_DETAIL_POWER_OF_FIVE_TABLE_HPP"""
+
+
+def normalised_power_of_five(q):
+    """Returns 5^q as a 128-bit integer whose most significant bit is set."""
+    if q >= 0:
+        power = 5 ** q
+        while power < (1 << 127):
+            power *= 2
+        while power >= (1 << 128):
+            power //= 2
+        return power
+
+    power = 5 ** -q
+    z = power.bit_length()
+    b = z + 127 if q >= -27 else 2 * z + 2 * 64
+    c = 2 ** b // power + 1
+    while c >= (1 << 128):
+        c //= 2
+    return c
+
+
+def main():
+    count = LARGEST_POWER - SMALLEST_POWER + 1
+    print(HEADER.replace("{smallest}", str(SMALLEST_POWER))
+                .replace("{largest}", str(LARGEST_POWER))
+                .replace("{size}", str(2 * count)))
+    for q in range(SMALLEST_POWER, LARGEST_POWER + 1):
+        power = normalised_power_of_five(q)
+        high = power >> 64
+        low = power & ((1 << 64) - 1)
+        print("      0x{:016x}, 0x{:016x}, // 5^{}".format(high, low, q))
+    print(FOOTER)
+
+
+if __name__ == "__main__":
+    main()
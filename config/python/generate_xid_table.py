@@ -0,0 +1,155 @@
+#!/usr/bin/python
+#
+#  Copyright Christopher Di Bella
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Generates include/lingua/lexer/detail/xid_table.hpp.
+
+Usage: python config/python/generate_xid_table.py config/ucd/DerivedCoreProperties.txt > \\
+          include/lingua/lexer/detail/xid_table.hpp
+
+The code points below a limit are split into chunks of 256. Each chunk of each property is a
+256-bit leaf, and identical leaves are stored once, so that a lookup is an index into a per-property
+array of leaf numbers, followed by a bit test. Above the limit, the only identifier characters are
+the variation selectors U+E0100..U+E01EF, which are XID_Continue but not XID_Start; they're checked
+with a range test instead of being given thousands of empty chunks.
+"""
+
+import sys
+
+CHUNK_BITS = 8
+CHUNK_SIZE = 1 << CHUNK_BITS
+WORDS_PER_CHUNK = CHUNK_SIZE // 64
+VARIATION_SELECTORS = range(0xE0100, 0xE01F0)
+
+HEADER = """//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Generated by config/python/generate_xid_table.py from {source}:
+// don't edit by hand.
+//
+#ifndef LINGUA_LEXER_DETAIL_XID_TABLE_HPP
+#define LINGUA_LEXER_DETAIL_XID_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace lingua::detail_xid {
+   inline constexpr auto chunk_bits = {chunk_bits}U;
+   inline constexpr auto words_per_chunk = char32_t{{{words_per_chunk}}};
+
+   /// \\brief Every code point at or above this is outside the tables.
+   ///
+   inline constexpr auto table_limit = char32_t{{{limit}}};
+"""
+
+FOOTER = """} // namespace lingua::detail_xid
+
+#endif // LINGUA_LEXER_DETAIL_XID_TABLE_HPP"""
+
+
+def read_properties(path):
+    """Returns the sets of code points that have XID_Start and XID_Continue."""
+    properties = {"XID_Start": set(), "XID_Continue": set()}
+    with open(path, encoding="utf-8") as source:
+        for line in source:
+            data = line.split("#", 1)[0].strip()
+            if not data:
+                continue
+            code_points, name = (field.strip() for field in data.split(";"))
+            if name not in properties:
+                continue
+            first, _, last = code_points.partition("..")
+            properties[name].update(range(int(first, 16), int(last or first, 16) + 1))
+    return properties["XID_Start"], properties["XID_Continue"]
+
+
+def table_limit(start, cont):
+    """Returns the first multiple of CHUNK_SIZE above every code point that needs the tables."""
+    assert not any(c in start for c in VARIATION_SELECTORS)
+    largest = max(c for c in start | cont if c not in VARIATION_SELECTORS)
+    assert largest < VARIATION_SELECTORS.start
+    return (largest // CHUNK_SIZE + 1) * CHUNK_SIZE
+
+
+def leaf_of(code_points, chunk):
+    """Returns the bits of a chunk as WORDS_PER_CHUNK 64-bit words."""
+    words = [0] * WORDS_PER_CHUNK
+    for c in range(chunk * CHUNK_SIZE, (chunk + 1) * CHUNK_SIZE):
+        if c in code_points:
+            offset = c - chunk * CHUNK_SIZE
+            words[offset // 64] |= 1 << (offset % 64)
+    return tuple(words)
+
+
+def print_index(name, description, index):
+    print("")
+    print("   /// \\brief {}".format(description))
+    print("   ///")
+    print("   inline constexpr auto {} = std::array<std::uint8_t, {}>{{".format(name, len(index)))
+    for row in range(0, len(index), 16):
+        print("      " + " ".join("{},".format(x) for x in index[row:row + 16]))
+    print("   };")
+
+
+def main():
+    source = sys.argv[1]
+    start, cont = read_properties(source)
+    assert start <= cont
+    limit = table_limit(start, cont)
+
+    leaves = {}
+    indices = []
+    for code_points in (start, cont):
+        index = []
+        for chunk in range(limit // CHUNK_SIZE):
+            leaf = leaf_of(code_points, chunk)
+            index.append(leaves.setdefault(leaf, len(leaves)))
+        indices.append(index)
+    assert len(leaves) <= 256
+
+    print(HEADER.replace("{source}", source.replace("\\", "/"))
+                .replace("{chunk_bits}", str(CHUNK_BITS))
+                .replace("{{{words_per_chunk}}}", "{" + str(WORDS_PER_CHUNK) + "}")
+                .replace("{{{limit}}}", "{0x" + format(limit, "X") + "}"), end="")
+    print_index("xid_start_chunks", "The leaf that holds each chunk's XID_Start bits.", indices[0])
+    print_index("xid_continue_chunks", "The leaf that holds each chunk's XID_Continue bits.",
+                indices[1])
+
+    print("")
+    print("   /// \\brief The distinct leaves, each of which is {} words of bits.".format(
+        WORDS_PER_CHUNK))
+    print("   ///")
+    print("   inline constexpr auto xid_leaves = std::array<std::uint64_t, {}>{{".format(
+        len(leaves) * WORDS_PER_CHUNK))
+    for leaf in sorted(leaves, key=leaves.get):
+        print("      " + " ".join("0x{:016x},".format(word) for word in leaf))
+    print("   };")
+    print(FOOTER)
+
+
+if __name__ == "__main__":
+    main()
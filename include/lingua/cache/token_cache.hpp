@@ -0,0 +1,189 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_CACHE_TOKEN_CACHE_HPP
+#define LINGUA_CACHE_TOKEN_CACHE_HPP
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/lexer/lex.hpp"
+#include "lingua/lexer/token.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua/utility/hash_source.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace lingua {
+   /// \brief The parts of a lexical diagnostic that survive being cached.
+   ///
+   struct cached_diagnostic {
+      diagnostic_level level;
+      source_coordinate_range coordinates;
+      std::u8string_view help_message;
+   };
+
+   /// \brief Converts any lexical diagnostic into a cached_diagnostic.
+   /// \note The result refers to `diagnostic`'s help message, and so must not outlive it.
+   ///
+   template<class Diagnostic>
+   [[nodiscard]] cached_diagnostic make_cached_diagnostic(Diagnostic const& diagnostic) noexcept
+   { return cached_diagnostic{diagnostic.level, diagnostic.coordinates(), diagnostic.help_message()}; }
+
+   /// \brief Identifies a source file's contents in the cache.
+   ///
+   struct token_cache_key {
+      source_digest hash;
+      std::uint64_t size;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(token_cache_key const&, token_cache_key const&) noexcept = default;
+   };
+
+   /// \brief How much of an entry token_cache::load checks before it returns the entry.
+   ///
+   enum class cache_verification : std::uint8_t {
+      /// \brief Checks the header only. Each record is checked against the source as it's read.
+      ///
+      header,
+
+      /// \brief Also hashes the entry's body, so that an entry that has been changed since it was
+      ///        stored is a miss. This costs a second hash, over the whole entry.
+      ///
+      digest,
+   };
+
+   /// \brief Reads a cached token, replacing one that lies outside the source with an unknown
+   ///        token that runs to the end of the source.
+   ///
+   struct clamp_to_source {
+      std::uint32_t source_size;
+
+      [[nodiscard]] constexpr token operator()(token const t) const noexcept
+      {
+         if (t.kind <= token_kind::unknown and t.offset <= source_size
+             and t.length <= source_size - t.offset) {
+            return t;
+         }
+         auto const offset = t.offset <= source_size ? t.offset : source_size;
+         return token{token_kind::unknown, offset, source_size - offset};
+      }
+   };
+
+   /// \brief The tokens of a token_cache_entry, read out of the mapping one at a time.
+   ///
+   using cached_tokens = std::ranges::transform_view<std::span<token const>, clamp_to_source>;
+
+   /// \brief A cached token stream, read directly out of a memory-mapped cache file.
+   ///
+   class [[nodiscard]] token_cache_entry {
+   public:
+      /// \brief Returns the cached tokens. No decoding takes place: each token is read out of the
+      ///        mapping, and checked against the source, when it's accessed.
+      ///
+      [[nodiscard]] cached_tokens tokens() const noexcept
+      { return cached_tokens{tokens_, clamp_to_source{source_size_}}; }
+
+      /// \brief Returns the cached lexer checkpoints. Like the tokens, they refer to the mapping.
+      /// \returns The checkpoints, or an empty span if any of them doesn't describe a position in
+      ///          the source.
+      ///
+      [[nodiscard]] std::span<lexer_checkpoint const> checkpoints() const noexcept;
+
+      /// \brief Returns the cached diagnostics. The help messages refer to the mapping.
+      ///
+      /// A record that doesn't describe a diagnostic, which only a corrupt entry has, is skipped.
+      ///
+      [[nodiscard]] std::vector<cached_diagnostic> diagnostics() const;
+
+   private:
+      friend class token_cache;
+
+      std::shared_ptr<void const> mapping_;
+      std::uint32_t source_size_ = 0;
+      std::span<token const> tokens_;
+      std::span<lexer_checkpoint const> checkpoints_;
+      std::span<std::byte const> diagnostics_;
+      std::u8string_view strings_;
+   };
+
+   /// \brief A directory of token streams and lexical diagnostics, keyed by the contents of the
+   ///        source that they were lexed from.
+   ///
+   /// Entries are written to a temporary file and then renamed into place, so several processes may
+   /// share a directory: a reader sees either a whole entry or none at all. Once the directory
+   /// grows beyond its size bound, the least-recently-used entries are removed.
+   ///
+   class token_cache {
+   public:
+      /// \brief Opens (and if necessary creates) a cache in `directory`.
+      /// \param max_size The number of bytes that the cache may occupy before it evicts entries.
+      ///
+      explicit token_cache(std::filesystem::path directory, std::uintmax_t max_size);
+
+      /// \brief Computes the key for `source`.
+      ///
+      [[nodiscard]] static token_cache_key make_key(std::u8string_view source) noexcept;
+
+      /// \brief Looks up the entry for `key`, and marks it as recently used.
+      ///
+      /// A hit maps the entry and checks its header; the records themselves aren't decoded, or even
+      /// read, until the consumer asks for them.
+      ///
+      /// \param verification Whether to also hash the entry's body, to detect an entry that has been
+      ///        corrupted since it was stored.
+      /// \returns The entry, or std::nullopt if there is no complete entry for this version of
+      ///          lingua.
+      ///
+      [[nodiscard]] std::optional<token_cache_entry>
+      load(token_cache_key key, cache_verification verification = cache_verification::header) const
+         noexcept;
+
+      /// \brief Writes an entry for `key`, replacing any existing entry.
+      /// \param checkpoints Lexer checkpoints for the source, from make_checkpoints. A source that is
+      ///        too large to keep the tokens of may be cached with only its checkpoints.
+      /// \returns true if the entry was written, false otherwise. A failure to write leaves the
+      ///          cache as it was.
+      ///
+      bool store(token_cache_key key, std::span<token const> tokens,
+         std::span<cached_diagnostic const> diagnostics,
+         std::span<lexer_checkpoint const> checkpoints = {}) noexcept;
+
+      /// \brief Removes the least-recently-used entries until the cache is no larger than
+      ///        `target_size` bytes. An entry is used when it's stored or loaded.
+      ///
+      void evict(std::uintmax_t target_size) noexcept;
+
+      /// \brief Returns the directory that holds the cache.
+      ///
+      [[nodiscard]] std::filesystem::path const& directory() const noexcept
+      { return directory_; }
+
+   private:
+      std::filesystem::path directory_;
+      std::uintmax_t max_size_;
+      std::uintmax_t estimated_size_ = 0;
+
+      [[nodiscard]] std::filesystem::path entry_path(token_cache_key key) const;
+      [[nodiscard]] std::uintmax_t measure() const noexcept;
+   };
+} // namespace lingua
+
+#endif // LINGUA_CACHE_TOKEN_CACHE_HPP
@@ -0,0 +1,84 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_DIAGNOSTIC_DIAGNOSTIC_LIMITS_HPP
+#define LINGUA_DIAGNOSTIC_DIAGNOSTIC_LIMITS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+
+namespace lingua {
+   /// \brief A cap on the number of diagnostics made across many files, which may be shared
+   ///        between threads.
+   ///
+   class diagnostic_budget {
+   public:
+      explicit diagnostic_budget(std::size_t const capacity) noexcept
+         : remaining_{capacity}
+      {}
+
+      /// \brief Takes up to `wanted` diagnostics from the budget.
+      /// \returns How many were taken.
+      ///
+      [[nodiscard]] std::size_t take(std::size_t const wanted) noexcept
+      {
+         auto remaining = remaining_.load(std::memory_order_relaxed);
+         auto taken = std::min(remaining, wanted);
+         while (taken != 0
+                and not remaining_.compare_exchange_weak(remaining, remaining - taken,
+                   std::memory_order_relaxed))
+         {
+            taken = std::min(remaining, wanted);
+         }
+         return taken;
+      }
+
+      /// \brief Returns how many diagnostics are left.
+      ///
+      [[nodiscard]] std::size_t remaining() const noexcept
+      { return remaining_.load(std::memory_order_relaxed); }
+
+   private:
+      std::atomic<std::size_t> remaining_;
+   };
+
+   /// \brief Bounds on the diagnostics made for a file, so that a corrupt or binary file costs
+   ///        about as much to report as a good one. Nothing is bounded or collapsed by default.
+   ///
+   /// A capped file ends with one diagnostics_suppressed saying how many were left out, which
+   /// doesn't count against either cap. So across n files, there are at most `budget->remaining()`
+   /// diagnostics plus n of those.
+   ///
+   struct diagnostic_limits {
+      static constexpr auto unbounded = std::numeric_limits<std::size_t>::max();
+
+      /// \brief The most diagnostics made for one file.
+      ///
+      std::size_t max_per_file = unbounded;
+
+      /// \brief Runs of at least this many identical diagnostics in a row become the first of them
+      ///        and a repeated_diagnostic that stands for the rest.
+      ///
+      std::size_t collapse_runs_of = unbounded;
+
+      /// \brief The budget shared by every file, or nullptr to leave the total uncapped.
+      ///
+      diagnostic_budget* budget = nullptr;
+   };
+} // namespace lingua
+
+#endif // LINGUA_DIAGNOSTIC_DIAGNOSTIC_LIMITS_HPP
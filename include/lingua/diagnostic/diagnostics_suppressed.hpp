@@ -0,0 +1,55 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_DIAGNOSTIC_DIAGNOSTICS_SUPPRESSED_HPP
+#define LINGUA_DIAGNOSTIC_DIAGNOSTICS_SUPPRESSED_HPP
+
+#include "lingua/diagnostic/detail/diagnostic_base.hpp"
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua/utility/contract.hpp"
+#include <cstddef>
+#include <fmt/format.h>
+#include <string>
+
+namespace lingua {
+   /// \brief Says how many diagnostics were left out once a diagnostic_limits cap was reached.
+   ///
+   class diagnostics_suppressed
+   : private detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed> {
+      using base_t = detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed>;
+
+   public:
+      using base_t::coordinates;
+      using base_t::help_message;
+      using base_t::level;
+
+      /// \param suppressed How many errors weren't turned into diagnostics.
+      /// \param coordinates Where the first of them starts.
+      ///
+      explicit diagnostics_suppressed(std::size_t const suppressed,
+         source_coordinate_range const coordinates) noexcept
+         : base_t{coordinates, generate_message(suppressed)}
+      { LINGUA_EXPECTS(suppressed > 0); }
+   private:
+      static std::u8string generate_message(std::size_t const suppressed) noexcept
+      {
+         return fmt::format(u8"too many diagnostics: stopped reporting here, with {} error{} left",
+            suppressed, suppressed == 1 ? u8"" : u8"s");
+      }
+   };
+} // namespace lingua
+
+#endif // LINGUA_DIAGNOSTIC_DIAGNOSTICS_SUPPRESSED_HPP
@@ -0,0 +1,84 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_DIAGNOSTIC_LEXICAL_INTEGER_LITERAL_OVERFLOW_HPP
+#define LINGUA_DIAGNOSTIC_LEXICAL_INTEGER_LITERAL_OVERFLOW_HPP
+
+#include "lingua/diagnostic/detail/diagnostic_base.hpp"
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/lexer/integer_literal.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua/utility/contract.hpp"
+#include <array>
+#include <cstddef>
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+
+namespace lingua {
+   class integer_literal_overflow
+   : private detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed> {
+      using base_t = detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed>;
+      using u8string_view = std::u8string_view;
+
+   public:
+      using base_t::coordinates;
+      using base_t::help_message;
+      using base_t::level;
+
+      /// \param literal The text of the literal, including its suffix.
+      /// \param negated Whether the literal is the operand of a unary `-`.
+      ///
+      explicit integer_literal_overflow(u8string_view const literal, bool const negated,
+         source_coordinate_range const coordinates) noexcept
+         : base_t{coordinates, generate_message(literal, negated)}
+      {
+         LINGUA_EXPECTS(parse_integer_literal(literal, negated).error
+                        == integer_literal_error::overflow);
+      }
+   private:
+      static std::u8string
+      generate_message(u8string_view const literal, bool const negated) noexcept
+      {
+         using namespace std::string_view_literals;
+
+         auto const type = parse_integer_literal(literal, negated).type;
+         if (type == integer_type::unsuffixed) {
+            return fmt::format(u8"integer literal `{}` doesn't fit in 128 bits.", literal);
+         }
+
+         constexpr auto message = u8"integer literal `{}{}` is out of range for `{}`, whose values "
+                                  u8"are from `{}` to `{}`\n"
+                                  u8"                 {}"sv;
+         auto const name = integer_type_name(type);
+         auto const arrow = std::u8string(std::size_t{negated} + literal.size() - name.size(), u8' ')
+                          + u8'^';
+         auto const i = static_cast<std::size_t>(type);
+         return fmt::format(message, negated ? u8"-" : u8"", literal, name, minimums[i],
+            maximums[i], arrow);
+      }
+
+      static constexpr auto minimums = std::array<u8string_view, 13>{u8"", u8"0", u8"0", u8"0",
+         u8"0", u8"0", u8"0", u8"-128", u8"-32768", u8"-2147483648", u8"-9223372036854775808",
+         u8"-170141183460469231731687303715884105728", u8"-9223372036854775808"};
+
+      static constexpr auto maximums = std::array<u8string_view, 13>{u8"", u8"255", u8"65535",
+         u8"4294967295", u8"18446744073709551615", u8"340282366920938463463374607431768211455",
+         u8"18446744073709551615", u8"127", u8"32767", u8"2147483647", u8"9223372036854775807",
+         u8"170141183460469231731687303715884105727", u8"9223372036854775807"};
+   };
+} // namespace lingua
+
+#endif // LINGUA_DIAGNOSTIC_LEXICAL_INTEGER_LITERAL_OVERFLOW_HPP
@@ -18,6 +18,7 @@
 
 #include "lingua/diagnostic/detail/diagnostic_base.hpp"
 #include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/lexer/nfc.hpp"
 #include "lingua/source_coordinate_range.hpp"
 #include "lingua/utility/contract.hpp"
 #include <array>
@@ -54,10 +55,9 @@ namespace lingua {
             , u8"super"sv
             , u8"Self"sv
          };
-         return ranges::any_of(expected, [identifier](auto const c) {
-            constexpr auto skip_prefix = u8"r#"sv;
-            return c == identifier.substr(skip_prefix.size());
-         });
+         constexpr auto skip_prefix = u8"r#"sv;
+         auto const name = to_nfc(identifier.substr(skip_prefix.size()));
+         return ranges::any_of(expected, [&name](auto const c) { return c == name; });
       }
    };
 } // namespace lingua
@@ -0,0 +1,90 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_DIAGNOSTIC_LEXICAL_INVALID_UNICODE_ESCAPE_HPP
+#define LINGUA_DIAGNOSTIC_LEXICAL_INVALID_UNICODE_ESCAPE_HPP
+
+#include "lingua/diagnostic/detail/diagnostic_base.hpp"
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/lexer/is_escape.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua/utility/contract.hpp"
+#include <cstddef>
+#include <fmt/format.h>
+#include <range/v3/view/subrange.hpp>
+#include <string>
+#include <string_view>
+
+namespace lingua::detail_invalid_unicode_escape {
+   /// \brief A diagnostic for a Unicode escape that's spelt correctly, but whose value isn't a
+   ///        Unicode scalar value. Escapes that are spelt incorrectly are unknown_escape_unicode.
+   ///
+   template<unicode_escape_error error>
+   class invalid_unicode_escape_impl
+   : private detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed> {
+      static_assert(error == unicode_escape_error::surrogate
+                    or error == unicode_escape_error::out_of_range);
+
+      using base_t = detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed>;
+      using u8string_view = std::u8string_view;
+   public:
+      using base_t::coordinates;
+      using base_t::help_message;
+      using base_t::level;
+
+      /// \param lexeme The text of the literal that contains the escape.
+      /// \param escape The escape, which is a part of `lexeme`.
+      ///
+      explicit invalid_unicode_escape_impl(u8string_view const lexeme,
+         ranges::subrange<u8string_view::iterator> const escape,
+         source_coordinate_range const coordinates) noexcept
+         : base_t{coordinates, generate_message(lexeme, to_view(escape))}
+      {
+         LINGUA_EXPECTS(decode_unicode_escape(to_view(escape)).error == error);
+         LINGUA_EXPECTS(decode_unicode_escape(to_view(escape)).length == escape.size());
+      }
+   private:
+      static u8string_view to_view(ranges::subrange<u8string_view::iterator> const escape) noexcept
+      { return u8string_view{escape.begin(), escape.end()}; }
+
+      static std::u8string
+      generate_message(u8string_view const lexeme, u8string_view const escape) noexcept
+      {
+         auto top_line = std::u8string{};
+         if constexpr (error == unicode_escape_error::surrogate) {
+            top_line = fmt::format(u8"Unicode escape '{}' names a surrogate, which isn't a "
+                                   u8"character, in literal `", escape);
+         }
+         else {
+            top_line = fmt::format(u8"Unicode escape '{}' is above '\\u{{10FFFF}}', the largest "
+                                   u8"character, in literal `", escape);
+         }
+
+         auto const padding = top_line.size()
+                            + static_cast<std::size_t>(escape.data() - lexeme.data());
+         return fmt::format(u8"{}{}`\n{}^{}", top_line, lexeme, std::u8string(padding, u8' '),
+            std::u8string(escape.size() - 1, u8'~'));
+      }
+   };
+} // namespace lingua::detail_invalid_unicode_escape
+
+namespace lingua {
+   using unicode_escape_surrogate = detail_invalid_unicode_escape::invalid_unicode_escape_impl<
+      unicode_escape_error::surrogate>;
+   using unicode_escape_out_of_range = detail_invalid_unicode_escape::invalid_unicode_escape_impl<
+      unicode_escape_error::out_of_range>;
+} // namespace lingua
+
+#endif // LINGUA_DIAGNOSTIC_LEXICAL_INVALID_UNICODE_ESCAPE_HPP
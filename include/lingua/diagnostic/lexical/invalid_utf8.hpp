@@ -0,0 +1,76 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_DIAGNOSTIC_LEXICAL_INVALID_UTF8_HPP
+#define LINGUA_DIAGNOSTIC_LEXICAL_INVALID_UTF8_HPP
+
+#include "lingua/diagnostic/detail/diagnostic_base.hpp"
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua/utility/contract.hpp"
+#include "lingua/utility/validate_utf8.hpp"
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+
+namespace lingua {
+   /// \brief A diagnostic for a source file that isn't well-formed UTF-8. Only the first invalid
+   ///        sequence is reported, since nothing after it can be trusted to be lexed correctly.
+   ///
+   class invalid_utf8
+   : private detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed> {
+      using base_t = detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed>;
+      using u8string_view = std::u8string_view;
+   public:
+      using base_t::coordinates;
+      using base_t::help_message;
+      using base_t::level;
+
+      /// \param source The contents of the file.
+      /// \param error The result of validating `source`, such as loaded_file::utf8, so that the
+      ///              file needn't be validated again.
+      /// \param coordinates The position of the first invalid sequence.
+      ///
+      explicit invalid_utf8(u8string_view const source, utf8_validation const error,
+         source_coordinate_range const coordinates) noexcept
+         : base_t{coordinates, generate_message(source, error)}
+      {
+         LINGUA_EXPECTS(not error.valid());
+         LINGUA_EXPECTS(error.error_offset + error.error_length <= source.size());
+      }
+   private:
+      static std::u8string generate_message(u8string_view const source,
+         utf8_validation const error) noexcept
+      {
+         auto const [offset, length] = error;
+         auto bytes = std::u8string{};
+         for (auto const c : source.substr(offset, length)) {
+            constexpr auto digits = u8string_view{u8"0123456789ABCDEF"};
+            bytes += u8"\\x";
+            bytes += digits[static_cast<unsigned char>(c) >> 4U];
+            bytes += digits[static_cast<unsigned char>(c) & 0xfU];
+         }
+
+         // A valid prefix that runs into the end of the file is only missing its continuations.
+         auto const lead = source[offset];
+         auto const truncated = offset + length == source.size() and lead >= 0xc2 and lead <= 0xf4;
+         return fmt::format(u8"invalid UTF-8 at byte {}: `{}` {}", offset, bytes,
+            truncated ? u8"is an unfinished character at the end of the file"
+                      : u8"doesn't begin a valid character");
+      }
+   };
+} // namespace lingua
+
+#endif // LINGUA_DIAGNOSTIC_LEXICAL_INVALID_UTF8_HPP
@@ -0,0 +1,66 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_DIAGNOSTIC_LEXICAL_LEX_LIMIT_EXCEEDED_HPP
+#define LINGUA_DIAGNOSTIC_LEXICAL_LEX_LIMIT_EXCEEDED_HPP
+
+#include "lingua/diagnostic/detail/diagnostic_base.hpp"
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/lexer/lex_limits.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include <cstdint>
+#include <fmt/format.h>
+#include <string>
+
+namespace lingua {
+   class lex_limit_exceeded
+   : private detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed> {
+      using base_t = detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed>;
+
+   public:
+      using base_t::coordinates;
+      using base_t::help_message;
+      using base_t::level;
+
+      /// \param value The limit's value, as recorded in exceeded_lex_limit.
+      ///
+      explicit lex_limit_exceeded(lex_limit const limit, std::uint64_t const value,
+         source_coordinate_range const coordinates) noexcept
+         : base_t{coordinates, generate_message(limit, value)}
+      {}
+   private:
+      static std::u8string
+      generate_message(lex_limit const limit, std::uint64_t const value) noexcept
+      {
+         switch (limit) {
+         case lex_limit::bytes:
+            return fmt::format(u8"lexing stopped: the file is larger than {} bytes", value);
+         case lex_limit::tokens:
+            return fmt::format(u8"lexing stopped: the file has more than {} tokens", value);
+         case lex_limit::errors:
+            return fmt::format(u8"lexing stopped: the file has more than {} lexical errors", value);
+         case lex_limit::literal_length:
+            return fmt::format(u8"lexing stopped: literal is longer than {} bytes", value);
+         case lex_limit::comment_depth:
+            return fmt::format(u8"lexing stopped: comment nests more than {} deep", value);
+         case lex_limit::time:
+            return fmt::format(u8"lexing stopped: the file took more than {} ms to lex", value);
+         }
+         return u8"lexing stopped: a limit was exceeded";
+      }
+   };
+} // namespace lingua
+
+#endif // LINGUA_DIAGNOSTIC_LEXICAL_LEX_LIMIT_EXCEEDED_HPP
@@ -0,0 +1,55 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_DIAGNOSTIC_REPEATED_DIAGNOSTIC_HPP
+#define LINGUA_DIAGNOSTIC_REPEATED_DIAGNOSTIC_HPP
+
+#include "lingua/diagnostic/detail/diagnostic_base.hpp"
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua/utility/contract.hpp"
+#include <cstddef>
+#include <fmt/format.h>
+#include <string>
+
+namespace lingua {
+   /// \brief Stands for copies of the diagnostic before it, which were collapsed into this one.
+   ///
+   class repeated_diagnostic
+   : private detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed> {
+      using base_t = detail_diagnostic::diagnostic_base<diagnostic_level::ill_formed>;
+
+   public:
+      using base_t::coordinates;
+      using base_t::help_message;
+      using base_t::level;
+
+      /// \param repeats How many copies this stands for.
+      /// \param coordinates From the start of the first copy to the end of the last.
+      ///
+      explicit repeated_diagnostic(std::size_t const repeats,
+         source_coordinate_range const coordinates) noexcept
+         : base_t{coordinates, generate_message(repeats)}
+      { LINGUA_EXPECTS(repeats > 0); }
+   private:
+      static std::u8string generate_message(std::size_t const repeats) noexcept
+      {
+         return fmt::format(u8"the previous diagnostic is repeated {} more time{}", repeats,
+            repeats == 1 ? u8"" : u8"s");
+      }
+   };
+} // namespace lingua
+
+#endif // LINGUA_DIAGNOSTIC_REPEATED_DIAGNOSTIC_HPP
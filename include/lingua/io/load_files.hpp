@@ -0,0 +1,129 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_IO_LOAD_FILES_HPP
+#define LINGUA_IO_LOAD_FILES_HPP
+
+#include "lingua/utility/transcode.hpp"
+#include "lingua/utility/validate_utf8.hpp"
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+#include <system_error>
+
+namespace lingua {
+   /// \brief A file that has been read into memory by load_files.
+   ///
+   struct loaded_file {
+      std::filesystem::path path;
+      /// \brief The file's text, in UTF-8 whatever encoding it was stored in, so offsets into it
+      ///        are offsets into the UTF-8.
+      ///
+      std::u8string contents;
+      std::error_code error;
+
+      /// \brief The encoding that the file was stored in, and was transcoded from.
+      ///
+      source_encoding encoding = source_encoding::utf8;
+
+      /// \brief Where `contents` first stops being valid UTF-8. Only meaningful if the file was
+      ///        read without error and file_loader_options::validate_utf8 was set.
+      ///
+      utf8_validation utf8;
+   };
+
+   enum class file_loader_backend { automatic, io_uring, thread_pool };
+
+   struct file_loader_options {
+      /// \brief Selects how reads are issued. `automatic` prefers io_uring and falls back to the
+      ///        thread pool when io_uring is unavailable, or can't open, size and read files (before
+      ///        Linux 5.6). The io_uring backend issues the opens as well as the reads.
+      ///
+      file_loader_backend backend = file_loader_backend::automatic;
+
+      /// \brief The maximum number of files that may be read ahead of the consumer. This bounds the
+      ///        memory held by the pipeline.
+      ///
+      std::size_t max_in_flight = 64;
+
+      /// \brief The number of reader threads used by the thread-pool backend.
+      ///
+      std::size_t threads = 4;
+
+      /// \brief Whether each file is checked for well-formed UTF-8 as soon as it's read. The thread
+      ///        pool's readers do the check, so it overlaps with the consumer; the io_uring backend
+      ///        has no threads of its own, so it checks each file on the consumer's thread.
+      ///
+      bool validate_utf8 = true;
+
+      /// \brief The encoding that files are stored in. `automatic` recognises UTF-16 by its byte
+      ///        order mark and otherwise assumes UTF-8. Files that aren't UTF-8 are transcoded to
+      ///        it before they're validated, and in the same place: by a reader thread in the thread
+      ///        pool, and on the consumer's thread with io_uring.
+      ///
+      source_encoding encoding = source_encoding::automatic;
+   };
+
+   struct file_loader_statistics {
+      /// \brief The backend that actually serviced the reads.
+      ///
+      file_loader_backend backend = file_loader_backend::thread_pool;
+      std::size_t files = 0;
+      std::size_t bytes = 0;
+
+      /// \brief The sum of the time spent reading each file, from the moment its read was issued
+      ///        until it was observed to complete.
+      ///
+      /// The io_uring backend only observes completions between calls to `consume`, so a read that
+      /// finishes while `consume` runs is timed until `consume` returns. On that backend, io_time is
+      /// an upper bound.
+      ///
+      std::chrono::nanoseconds io_time{0};
+
+      /// \brief The time the consumer spent blocked, waiting for a file to finish loading.
+      ///
+      std::chrono::nanoseconds wait_time{0};
+
+      /// \brief Returns the portion of io_time that was overlapped with the consumer's work.
+      ///
+      [[nodiscard]] std::chrono::nanoseconds hidden_io_time() const noexcept
+      { return io_time > wait_time ? io_time - wait_time : std::chrono::nanoseconds{0}; }
+   };
+
+   /// \brief Checks if the io_uring backend can be used: lingua was built with it, and the kernel
+   ///        can open, size, and read files through io_uring. When it can't, load_files uses the
+   ///        thread pool instead.
+   ///
+   [[nodiscard]] bool io_uring_available() noexcept;
+
+   /// \brief Reads every file in `paths` and passes each one to `consume`, in the order that the
+   ///        paths are listed.
+   /// \param paths The files to read.
+   /// \param consume Called on the calling thread once per file. Reads for later files continue
+   ///                while `consume` runs, so lexing one file overlaps with loading the next.
+   /// \param options Controls the backend and how far the pipeline may read ahead.
+   /// \returns Statistics describing how much of the I/O was hidden behind `consume`.
+   /// \note A file that cannot be read is still passed to `consume`, with `error` set.
+   ///
+   file_loader_statistics load_files(std::span<std::filesystem::path const> paths,
+      std::function<void(loaded_file)> const& consume, file_loader_options const& options = {});
+   // [[expects: options.max_in_flight > 0]]
+   // [[expects: options.threads > 0]]
+} // namespace lingua
+
+#endif // LINGUA_IO_LOAD_FILES_HPP
@@ -0,0 +1,215 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_DELIMITER_TABLE_HPP
+#define LINGUA_LEXER_DELIMITER_TABLE_HPP
+
+#include "lingua/lexer/lexical_error.hpp"
+#include "lingua/lexer/token.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace lingua {
+   /// \brief Pairs each `(`, `[`, and `{` with the token that closes it, so that skipping a
+   ///        parenthesised expression or a function body doesn't require scanning it.
+   ///
+   /// The table is built while lexing by feeding it each token in turn: openers are pushed onto a
+   /// stack, and each closer is paired with the nearest unclosed opener of the same kind. Openers
+   /// that are skipped over to find that match, closers with no match, and openers that are never
+   /// closed are all recorded as lexical_error_kind::unbalanced_delimiter.
+   ///
+   /// Each delimiter has an entry, numbered in token order, so a consumer that walks the tokens can
+   /// count the delimiters it passes (see is_delimiter) to know its entry. An entry's partner is
+   /// then one lookup in partners(), which holds one int32 per delimiter, and skipping to the
+   /// partner's token is one more in delimiters().
+   ///
+   class delimiter_table {
+   public:
+      static constexpr auto unmatched = std::int32_t{-1};
+
+      /// \brief The number of delimiters that the table can pair. Any after these are ignored, but a
+      ///        source would need to be more than half delimiters to have that many.
+      ///
+      static constexpr auto max_delimiters = std::size_t{std::numeric_limits<std::int32_t>::max()};
+
+      /// \brief Checks if `kind` has an entry in the table.
+      ///
+      [[nodiscard]] static constexpr bool is_delimiter(token_kind const kind) noexcept
+      {
+         switch (kind) {
+         case token_kind::open_paren:
+         case token_kind::open_bracket:
+         case token_kind::open_brace:
+         case token_kind::close_paren:
+         case token_kind::close_bracket:
+         case token_kind::close_brace:
+            return true;
+         default:
+            return false;
+         }
+      }
+
+      /// \brief Records the token at `index`, if it's a delimiter.
+      ///
+      void add(std::uint32_t const index, token const t)
+      {
+         if (delimiters_.size() == max_delimiters) {
+            return;
+         }
+
+         switch (t.kind) {
+         case token_kind::open_paren:
+         case token_kind::open_bracket:
+         case token_kind::open_brace:
+            open_.push_back(open_delimiter{delimiters_.size(), t});
+            ++open_count(t.kind);
+            delimiters_.push_back(index);
+            partners_.push_back(unmatched);
+            return;
+         case token_kind::close_paren:
+            close(index, t, token_kind::open_paren);
+            return;
+         case token_kind::close_bracket:
+            close(index, t, token_kind::open_bracket);
+            return;
+         case token_kind::close_brace:
+            close(index, t, token_kind::open_brace);
+            return;
+         default:
+            return;
+         }
+      }
+
+      /// \brief Reports the delimiters that were never closed. Called after the last token.
+      ///
+      void finish()
+      {
+         for (auto const& unclosed : open_) {
+            report(unclosed.lexeme);
+         }
+         open_.clear();
+         open_counts_ = {};
+         std::ranges::sort(errors_, {}, &lexical_error::offset);
+      }
+
+      /// \brief Returns the entry of the delimiter that pairs with entry `delimiter`, or
+      ///        std::nullopt if it's unbalanced.
+      ///
+      [[nodiscard]] std::optional<std::size_t> partner(std::size_t const delimiter) const noexcept
+      {
+         auto const partner = partners_[delimiter];
+         return partner == unmatched ? std::nullopt : std::optional{static_cast<std::size_t>(partner)};
+      }
+      // [[expects: delimiter < size(delimiters())]]
+
+      /// \brief Returns the index of the token that pairs with the token at `token_index`, or
+      ///        std::nullopt if it's an unbalanced delimiter or not a delimiter at all.
+      ///
+      /// The token's entry isn't known here, so this is a binary search over delimiters(). Code that
+      /// walks the tokens in order can instead count its way to each entry and use partner().
+      ///
+      [[nodiscard]] std::optional<std::uint32_t> match(std::uint32_t const token_index) const noexcept
+      {
+         auto const i = std::ranges::lower_bound(delimiters_, token_index);
+         if (i == delimiters_.end() or *i != token_index) {
+            return std::nullopt;
+         }
+
+         auto const entry = partner(static_cast<std::size_t>(i - delimiters_.begin()));
+         return entry ? std::optional{delimiters_[*entry]} : std::nullopt;
+      }
+
+      /// \brief Returns the index of each delimiter's token, in order.
+      ///
+      [[nodiscard]] std::span<std::uint32_t const> delimiters() const noexcept
+      { return delimiters_; }
+
+      /// \brief Returns the entry of the delimiter that pairs with each delimiter, or unmatched.
+      ///
+      [[nodiscard]] std::span<std::int32_t const> partners() const noexcept
+      { return partners_; }
+
+      /// \brief Returns the unbalanced delimiters, ordered by offset.
+      ///
+      [[nodiscard]] std::span<lexical_error const> errors() const noexcept
+      { return errors_; }
+
+   private:
+      struct open_delimiter {
+         std::size_t position;
+         token lexeme;
+      };
+
+      std::vector<std::uint32_t> delimiters_;
+      std::vector<std::int32_t> partners_;
+      std::vector<open_delimiter> open_;
+      std::array<std::size_t, 3> open_counts_ = {};
+      std::vector<lexical_error> errors_;
+
+      /// \brief Returns how many openers of `opener`'s kind are on the stack.
+      ///
+      [[nodiscard]] std::size_t& open_count(token_kind const opener) noexcept
+      {
+         switch (opener) {
+         case token_kind::open_paren:
+            return open_counts_[0];
+         case token_kind::open_bracket:
+            return open_counts_[1];
+         default:
+            return open_counts_[2];
+         }
+      }
+      // [[expects: opener is open_paren, open_bracket, or open_brace]]
+
+      void close(std::uint32_t const index, token const t, token_kind const opener)
+      {
+         auto const position = delimiters_.size();
+         delimiters_.push_back(index);
+         partners_.push_back(unmatched);
+
+         // Without the count, a closer with no opener would scan the whole stack, which makes
+         // `((((...]]]]` quadratic. With it, every opener passed over here is then removed, so
+         // the scans cost no more than the pushes.
+         if (open_count(opener) == 0) {
+            report(t);
+            return;
+         }
+         auto const match = std::ranges::find(open_.rbegin(), open_.rend(), opener,
+            [](open_delimiter const& x) { return x.lexeme.kind; });
+
+         // Anything opened since the match can no longer be closed.
+         for (auto i = open_.rbegin(); i != match; ++i) {
+            report(i->lexeme);
+            --open_count(i->lexeme.kind);
+         }
+         --open_count(opener);
+         partners_[match->position] = static_cast<std::int32_t>(position);
+         partners_[position] = static_cast<std::int32_t>(match->position);
+         open_.erase(std::prev(match.base()), open_.end());
+      }
+
+      void report(token const t)
+      { errors_.push_back(lexical_error{lexical_error_kind::unbalanced_delimiter, t.offset, t.length}); }
+   };
+} // namespace lingua
+
+#endif // LINGUA_LEXER_DELIMITER_TABLE_HPP
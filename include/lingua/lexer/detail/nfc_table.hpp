@@ -0,0 +1,2278 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Generated by config/python/generate_nfc_table.py from config/ucd: don't edit by hand.
+//
+#ifndef LINGUA_LEXER_DETAIL_NFC_TABLE_HPP
+#define LINGUA_LEXER_DETAIL_NFC_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace lingua::detail_nfc {
+   /// \brief A canonical combining class, and an NFC_Quick_Check value: 0 for Yes, 1 for Maybe,
+   ///        and 2 for No.
+   ///
+   struct normalization_class {
+      std::uint8_t combining_class;
+      std::uint8_t quick_check;
+   };
+
+   /// \brief The full decomposition of `code_point` is `length` code points, starting at
+   ///        `decomposition_pool[offset]`.
+   ///
+   struct decomposition {
+      char32_t code_point;
+      std::uint16_t offset;
+      std::uint16_t length;
+   };
+
+   struct composition {
+      char32_t first;
+      char32_t second;
+      char32_t composite;
+   };
+
+   inline constexpr auto chunk_bits = 5U;
+
+   /// \brief Every code point at or above this has class 0 and is NFC_Quick_Check=Yes, as does
+   ///        every code point below `table_start`.
+   ///
+   inline constexpr auto table_limit = char32_t{0x2FA20};
+   inline constexpr auto table_start = char32_t{0x300};
+
+   /// \brief The distinct pairs of a combining class and a quick check value.
+   ///
+   inline constexpr auto normalization_classes = std::array<normalization_class, 66>{{
+      {0, 0}, {230, 1}, {230, 0}, {232, 0}, {220, 0}, {216, 1}, {202, 0}, {220, 1},
+      {202, 1}, {1, 0}, {1, 1}, {230, 2}, {240, 1}, {233, 0}, {234, 0}, {0, 2},
+      {222, 0}, {228, 0}, {10, 0}, {11, 0}, {12, 0}, {13, 0}, {14, 0}, {15, 0},
+      {16, 0}, {17, 0}, {18, 0}, {19, 0}, {20, 0}, {21, 0}, {22, 0}, {23, 0},
+      {24, 0}, {25, 0}, {30, 0}, {31, 0}, {32, 0}, {27, 0}, {28, 0}, {29, 0},
+      {33, 0}, {34, 0}, {35, 0}, {36, 0}, {7, 1}, {9, 0}, {7, 0}, {0, 1},
+      {84, 0}, {91, 1}, {9, 1}, {103, 0}, {107, 0}, {118, 0}, {122, 0}, {216, 0},
+      {129, 0}, {130, 0}, {132, 0}, {214, 0}, {218, 0}, {224, 0}, {8, 1}, {26, 0},
+      {6, 0}, {226, 0},
+   }};
+
+   /// \brief The leaf that holds each chunk's normalization classes, from table_start.
+   ///
+   inline constexpr auto normalization_chunks = std::array<std::uint8_t, 6073>{{
+      0, 1, 2, 3, 4, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5,
+      5, 5, 5, 5, 7, 8, 9, 5, 10, 5, 11, 12, 5, 5, 13, 14,
+      15, 16, 17, 5, 5, 5, 5, 18, 19, 20, 21, 5, 22, 5, 23, 24,
+      5, 25, 26, 5, 5, 27, 28, 29, 5, 30, 31, 5, 5, 32, 33, 5,
+      5, 27, 34, 5, 5, 35, 36, 5, 5, 32, 37, 5, 5, 32, 38, 5,
+      5, 39, 36, 5, 5, 5, 40, 5, 5, 41, 42, 5, 5, 43, 44, 5,
+      45, 46, 47, 48, 49, 50, 51, 5, 5, 52, 5, 5, 53, 5, 5, 5,
+      5, 5, 5, 54, 5, 55, 56, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 57, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      58, 59, 5, 5, 5, 5, 60, 5, 5, 5, 5, 5, 5, 61, 5, 5,
+      5, 62, 5, 5, 5, 5, 5, 5, 63, 5, 5, 64, 5, 65, 66, 5,
+      5, 67, 68, 69, 5, 70, 5, 71, 5, 72, 5, 5, 5, 5, 73, 74,
+      5, 5, 5, 5, 5, 5, 75, 76, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 77, 5, 78, 79, 80, 81, 5, 5, 5, 5, 5, 82, 83,
+      5, 84, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 85, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 86, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 87,
+      5, 5, 5, 88, 5, 5, 5, 89, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 90, 5, 5, 91, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 92, 93, 5, 5, 94,
+      5, 5, 5, 5, 5, 5, 5, 5, 95, 96, 5, 5, 5, 5, 68, 97,
+      5, 98, 99, 5, 5, 100, 101, 5, 5, 5, 5, 5, 5, 102, 103, 104,
+      5, 5, 5, 5, 5, 5, 5, 33, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      105, 105, 105, 105, 105, 105, 105, 105, 106, 107, 105, 108, 105, 105, 109, 5,
+      110, 111, 112, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 113, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 114, 5, 5, 5, 5, 5, 5, 5, 115,
+      5, 5, 5, 116, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 117, 118, 5, 5, 5, 5, 5, 119,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 120, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 121, 5, 5,
+      5, 5, 122, 5, 123, 5, 5, 5, 5, 5, 95, 124, 5, 125, 5, 5,
+      126, 127, 5, 100, 5, 5, 128, 5, 5, 129, 5, 5, 5, 5, 5, 130,
+      5, 131, 36, 132, 5, 5, 5, 5, 5, 5, 133, 5, 5, 134, 135, 5,
+      5, 5, 5, 5, 5, 136, 137, 5, 5, 88, 5, 5, 5, 138, 5, 5,
+      5, 139, 5, 5, 5, 5, 5, 5, 5, 140, 5, 5, 5, 5, 5, 5,
+      5, 141, 142, 5, 5, 5, 5, 101, 5, 59, 143, 5, 144, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 88, 5, 5, 5, 5, 5, 5,
+      5, 5, 145, 5, 146, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 147,
+      5, 148, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 149, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 150, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 151, 152, 153, 154, 155, 5, 5, 5, 156, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 157, 158, 5, 5, 5, 5, 5, 5,
+      5, 148, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 159, 5, 160,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 161, 5,
+      5, 5, 162, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      5, 5, 5, 5, 5, 5, 5, 5, 105, 105, 105, 105, 105, 105, 105, 105,
+      105, 105, 105, 105, 105, 105, 105, 105, 163,
+   }};
+
+   /// \brief The distinct leaves, each of which is 32 normalization classes.
+   ///
+   inline constexpr auto normalization_leaves = std::array<std::uint8_t, 5248>{{
+      1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1,
+      2, 1, 2, 1, 1, 3, 4, 4, 4, 4, 3, 5, 4, 4, 4, 4,
+      4, 6, 6, 7, 7, 7, 7, 8, 8, 4, 4, 4, 4, 7, 7, 4,
+      7, 7, 4, 4, 9, 9, 9, 9, 10, 4, 4, 4, 4, 2, 2, 2,
+      11, 11, 1, 11, 11, 12, 2, 4, 4, 4, 2, 2, 2, 4, 4, 0,
+      2, 2, 2, 4, 4, 4, 4, 2, 3, 4, 4, 2, 13, 14, 14, 13,
+      14, 14, 13, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0,
+      0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 4, 2, 2, 2, 2, 4, 2, 2, 2, 16, 4, 2, 2, 2, 2,
+      2, 2, 4, 4, 4, 4, 4, 4, 2, 2, 4, 2, 2, 16, 17, 2,
+      18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 0, 31,
+      0, 32, 33, 0, 2, 4, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 2, 2, 2, 2, 2, 2, 34, 35, 36, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 38, 39, 34, 35,
+      36, 40, 41, 1, 1, 7, 4, 2, 2, 2, 2, 2, 4, 2, 2, 4,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+      2, 2, 2, 4, 2, 0, 0, 2, 2, 0, 4, 2, 2, 4, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 4, 2, 2, 4, 2, 2, 4, 4, 4, 2, 4, 4, 2, 4, 2,
+      2, 2, 4, 2, 4, 2, 4, 2, 4, 2, 2, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+      2, 2, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+      2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 2, 2, 2, 2,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 4,
+      4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      2, 2, 0, 4, 2, 2, 4, 2, 2, 4, 2, 2, 2, 4, 4, 4,
+      37, 38, 39, 2, 2, 2, 4, 2, 2, 4, 4, 2, 2, 2, 2, 2,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+      0, 2, 4, 2, 2, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 47, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 15, 15, 0, 15,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 15, 0, 0, 15, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 0, 0, 15, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+      0, 0, 0, 0, 0, 0, 47, 47, 0, 0, 0, 0, 15, 15, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+      0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+      0, 0, 0, 0, 0, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0, 47, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 47,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 45, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 52, 52, 52, 52, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 45, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 4, 0, 4, 0, 55, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0,
+      0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+      0, 56, 57, 15, 58, 15, 15, 0, 15, 0, 57, 57, 57, 57, 0, 0,
+      57, 15, 2, 2, 45, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0,
+      0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0,
+      0, 0, 0, 0, 0, 0, 0, 46, 0, 45, 45, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+      47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47,
+      47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+      47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, 4, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0,
+      45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 4,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 2, 2, 4, 0, 4,
+      4, 2, 2, 4, 4, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 2, 2, 2,
+      2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 2, 0, 9, 4, 4, 4, 4, 4, 2, 2, 4, 4, 4, 4,
+      2, 0, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 4, 0, 0,
+      0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+      2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 14, 59, 4,
+      6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      2, 2, 2, 2, 2, 2, 3, 17, 17, 4, 60, 2, 13, 4, 2, 4,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 15, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 15, 0, 0, 0, 0,
+      0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0,
+      0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 15, 15,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 15, 0, 15, 0, 0,
+      15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 9, 9, 2, 2, 2, 2, 9, 9, 9, 2, 2, 0, 0, 0,
+      0, 2, 0, 0, 0, 9, 9, 2, 4, 2, 9, 9, 4, 4, 4, 4,
+      2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 15, 15, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+      2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+      2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 17, 3, 16, 61, 61,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+      0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 0, 2, 2, 4, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 2,
+      0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+      15, 0, 15, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+      15, 0, 15, 0, 0, 15, 15, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 63, 15,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 0, 15, 0,
+      15, 15, 0, 15, 15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 2, 2,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+      4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 2,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 2, 9, 4, 0, 0, 0, 0, 45,
+      0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 4, 4, 2, 2, 2, 4, 2, 4, 4, 4,
+      4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 2, 4, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 44, 0, 0, 0, 0, 0,
+      2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 45, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 46, 0, 47, 0,
+      0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+      2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 45, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 47, 0, 0,
+      0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+      46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0,
+      0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0,
+      0, 0, 46, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15,
+      15, 15, 15, 15, 15, 55, 55, 9, 9, 9, 0, 0, 0, 65, 55, 55,
+      55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+      4, 4, 4, 0, 0, 2, 2, 2, 2, 2, 4, 4, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15,
+      15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+      2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2,
+      2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 46, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+   }};
+
+   /// \brief The code points with a canonical decomposition, in order.
+   ///
+   inline constexpr auto decompositions = std::array<decomposition, 2061>{{
+      {U'\xC0', 0, 2}, {U'\xC1', 2, 2}, {U'\xC2', 4, 2}, {U'\xC3', 6, 2},
+      {U'\xC4', 8, 2}, {U'\xC5', 10, 2}, {U'\xC7', 12, 2}, {U'\xC8', 14, 2},
+      {U'\xC9', 16, 2}, {U'\xCA', 18, 2}, {U'\xCB', 20, 2}, {U'\xCC', 22, 2},
+      {U'\xCD', 24, 2}, {U'\xCE', 26, 2}, {U'\xCF', 28, 2}, {U'\xD1', 30, 2},
+      {U'\xD2', 32, 2}, {U'\xD3', 34, 2}, {U'\xD4', 36, 2}, {U'\xD5', 38, 2},
+      {U'\xD6', 40, 2}, {U'\xD9', 42, 2}, {U'\xDA', 44, 2}, {U'\xDB', 46, 2},
+      {U'\xDC', 48, 2}, {U'\xDD', 50, 2}, {U'\xE0', 52, 2}, {U'\xE1', 54, 2},
+      {U'\xE2', 56, 2}, {U'\xE3', 58, 2}, {U'\xE4', 60, 2}, {U'\xE5', 62, 2},
+      {U'\xE7', 64, 2}, {U'\xE8', 66, 2}, {U'\xE9', 68, 2}, {U'\xEA', 70, 2},
+      {U'\xEB', 72, 2}, {U'\xEC', 74, 2}, {U'\xED', 76, 2}, {U'\xEE', 78, 2},
+      {U'\xEF', 80, 2}, {U'\xF1', 82, 2}, {U'\xF2', 84, 2}, {U'\xF3', 86, 2},
+      {U'\xF4', 88, 2}, {U'\xF5', 90, 2}, {U'\xF6', 92, 2}, {U'\xF9', 94, 2},
+      {U'\xFA', 96, 2}, {U'\xFB', 98, 2}, {U'\xFC', 100, 2}, {U'\xFD', 102, 2},
+      {U'\xFF', 104, 2}, {U'\x100', 106, 2}, {U'\x101', 108, 2}, {U'\x102', 110, 2},
+      {U'\x103', 112, 2}, {U'\x104', 114, 2}, {U'\x105', 116, 2}, {U'\x106', 118, 2},
+      {U'\x107', 120, 2}, {U'\x108', 122, 2}, {U'\x109', 124, 2}, {U'\x10A', 126, 2},
+      {U'\x10B', 128, 2}, {U'\x10C', 130, 2}, {U'\x10D', 132, 2}, {U'\x10E', 134, 2},
+      {U'\x10F', 136, 2}, {U'\x112', 138, 2}, {U'\x113', 140, 2}, {U'\x114', 142, 2},
+      {U'\x115', 144, 2}, {U'\x116', 146, 2}, {U'\x117', 148, 2}, {U'\x118', 150, 2},
+      {U'\x119', 152, 2}, {U'\x11A', 154, 2}, {U'\x11B', 156, 2}, {U'\x11C', 158, 2},
+      {U'\x11D', 160, 2}, {U'\x11E', 162, 2}, {U'\x11F', 164, 2}, {U'\x120', 166, 2},
+      {U'\x121', 168, 2}, {U'\x122', 170, 2}, {U'\x123', 172, 2}, {U'\x124', 174, 2},
+      {U'\x125', 176, 2}, {U'\x128', 178, 2}, {U'\x129', 180, 2}, {U'\x12A', 182, 2},
+      {U'\x12B', 184, 2}, {U'\x12C', 186, 2}, {U'\x12D', 188, 2}, {U'\x12E', 190, 2},
+      {U'\x12F', 192, 2}, {U'\x130', 194, 2}, {U'\x134', 196, 2}, {U'\x135', 198, 2},
+      {U'\x136', 200, 2}, {U'\x137', 202, 2}, {U'\x139', 204, 2}, {U'\x13A', 206, 2},
+      {U'\x13B', 208, 2}, {U'\x13C', 210, 2}, {U'\x13D', 212, 2}, {U'\x13E', 214, 2},
+      {U'\x143', 216, 2}, {U'\x144', 218, 2}, {U'\x145', 220, 2}, {U'\x146', 222, 2},
+      {U'\x147', 224, 2}, {U'\x148', 226, 2}, {U'\x14C', 228, 2}, {U'\x14D', 230, 2},
+      {U'\x14E', 232, 2}, {U'\x14F', 234, 2}, {U'\x150', 236, 2}, {U'\x151', 238, 2},
+      {U'\x154', 240, 2}, {U'\x155', 242, 2}, {U'\x156', 244, 2}, {U'\x157', 246, 2},
+      {U'\x158', 248, 2}, {U'\x159', 250, 2}, {U'\x15A', 252, 2}, {U'\x15B', 254, 2},
+      {U'\x15C', 256, 2}, {U'\x15D', 258, 2}, {U'\x15E', 260, 2}, {U'\x15F', 262, 2},
+      {U'\x160', 264, 2}, {U'\x161', 266, 2}, {U'\x162', 268, 2}, {U'\x163', 270, 2},
+      {U'\x164', 272, 2}, {U'\x165', 274, 2}, {U'\x168', 276, 2}, {U'\x169', 278, 2},
+      {U'\x16A', 280, 2}, {U'\x16B', 282, 2}, {U'\x16C', 284, 2}, {U'\x16D', 286, 2},
+      {U'\x16E', 288, 2}, {U'\x16F', 290, 2}, {U'\x170', 292, 2}, {U'\x171', 294, 2},
+      {U'\x172', 296, 2}, {U'\x173', 298, 2}, {U'\x174', 300, 2}, {U'\x175', 302, 2},
+      {U'\x176', 304, 2}, {U'\x177', 306, 2}, {U'\x178', 308, 2}, {U'\x179', 310, 2},
+      {U'\x17A', 312, 2}, {U'\x17B', 314, 2}, {U'\x17C', 316, 2}, {U'\x17D', 318, 2},
+      {U'\x17E', 320, 2}, {U'\x1A0', 322, 2}, {U'\x1A1', 324, 2}, {U'\x1AF', 326, 2},
+      {U'\x1B0', 328, 2}, {U'\x1CD', 330, 2}, {U'\x1CE', 332, 2}, {U'\x1CF', 334, 2},
+      {U'\x1D0', 336, 2}, {U'\x1D1', 338, 2}, {U'\x1D2', 340, 2}, {U'\x1D3', 342, 2},
+      {U'\x1D4', 344, 2}, {U'\x1D5', 346, 3}, {U'\x1D6', 349, 3}, {U'\x1D7', 352, 3},
+      {U'\x1D8', 355, 3}, {U'\x1D9', 358, 3}, {U'\x1DA', 361, 3}, {U'\x1DB', 364, 3},
+      {U'\x1DC', 367, 3}, {U'\x1DE', 370, 3}, {U'\x1DF', 373, 3}, {U'\x1E0', 376, 3},
+      {U'\x1E1', 379, 3}, {U'\x1E2', 382, 2}, {U'\x1E3', 384, 2}, {U'\x1E6', 386, 2},
+      {U'\x1E7', 388, 2}, {U'\x1E8', 390, 2}, {U'\x1E9', 392, 2}, {U'\x1EA', 394, 2},
+      {U'\x1EB', 396, 2}, {U'\x1EC', 398, 3}, {U'\x1ED', 401, 3}, {U'\x1EE', 404, 2},
+      {U'\x1EF', 406, 2}, {U'\x1F0', 408, 2}, {U'\x1F4', 410, 2}, {U'\x1F5', 412, 2},
+      {U'\x1F8', 414, 2}, {U'\x1F9', 416, 2}, {U'\x1FA', 418, 3}, {U'\x1FB', 421, 3},
+      {U'\x1FC', 424, 2}, {U'\x1FD', 426, 2}, {U'\x1FE', 428, 2}, {U'\x1FF', 430, 2},
+      {U'\x200', 432, 2}, {U'\x201', 434, 2}, {U'\x202', 436, 2}, {U'\x203', 438, 2},
+      {U'\x204', 440, 2}, {U'\x205', 442, 2}, {U'\x206', 444, 2}, {U'\x207', 446, 2},
+      {U'\x208', 448, 2}, {U'\x209', 450, 2}, {U'\x20A', 452, 2}, {U'\x20B', 454, 2},
+      {U'\x20C', 456, 2}, {U'\x20D', 458, 2}, {U'\x20E', 460, 2}, {U'\x20F', 462, 2},
+      {U'\x210', 464, 2}, {U'\x211', 466, 2}, {U'\x212', 468, 2}, {U'\x213', 470, 2},
+      {U'\x214', 472, 2}, {U'\x215', 474, 2}, {U'\x216', 476, 2}, {U'\x217', 478, 2},
+      {U'\x218', 480, 2}, {U'\x219', 482, 2}, {U'\x21A', 484, 2}, {U'\x21B', 486, 2},
+      {U'\x21E', 488, 2}, {U'\x21F', 490, 2}, {U'\x226', 492, 2}, {U'\x227', 494, 2},
+      {U'\x228', 496, 2}, {U'\x229', 498, 2}, {U'\x22A', 500, 3}, {U'\x22B', 503, 3},
+      {U'\x22C', 506, 3}, {U'\x22D', 509, 3}, {U'\x22E', 512, 2}, {U'\x22F', 514, 2},
+      {U'\x230', 516, 3}, {U'\x231', 519, 3}, {U'\x232', 522, 2}, {U'\x233', 524, 2},
+      {U'\x340', 526, 1}, {U'\x341', 527, 1}, {U'\x343', 528, 1}, {U'\x344', 529, 2},
+      {U'\x374', 531, 1}, {U'\x37E', 532, 1}, {U'\x385', 533, 2}, {U'\x386', 535, 2},
+      {U'\x387', 537, 1}, {U'\x388', 538, 2}, {U'\x389', 540, 2}, {U'\x38A', 542, 2},
+      {U'\x38C', 544, 2}, {U'\x38E', 546, 2}, {U'\x38F', 548, 2}, {U'\x390', 550, 3},
+      {U'\x3AA', 553, 2}, {U'\x3AB', 555, 2}, {U'\x3AC', 557, 2}, {U'\x3AD', 559, 2},
+      {U'\x3AE', 561, 2}, {U'\x3AF', 563, 2}, {U'\x3B0', 565, 3}, {U'\x3CA', 568, 2},
+      {U'\x3CB', 570, 2}, {U'\x3CC', 572, 2}, {U'\x3CD', 574, 2}, {U'\x3CE', 576, 2},
+      {U'\x3D3', 578, 2}, {U'\x3D4', 580, 2}, {U'\x400', 582, 2}, {U'\x401', 584, 2},
+      {U'\x403', 586, 2}, {U'\x407', 588, 2}, {U'\x40C', 590, 2}, {U'\x40D', 592, 2},
+      {U'\x40E', 594, 2}, {U'\x419', 596, 2}, {U'\x439', 598, 2}, {U'\x450', 600, 2},
+      {U'\x451', 602, 2}, {U'\x453', 604, 2}, {U'\x457', 606, 2}, {U'\x45C', 608, 2},
+      {U'\x45D', 610, 2}, {U'\x45E', 612, 2}, {U'\x476', 614, 2}, {U'\x477', 616, 2},
+      {U'\x4C1', 618, 2}, {U'\x4C2', 620, 2}, {U'\x4D0', 622, 2}, {U'\x4D1', 624, 2},
+      {U'\x4D2', 626, 2}, {U'\x4D3', 628, 2}, {U'\x4D6', 630, 2}, {U'\x4D7', 632, 2},
+      {U'\x4DA', 634, 2}, {U'\x4DB', 636, 2}, {U'\x4DC', 638, 2}, {U'\x4DD', 640, 2},
+      {U'\x4DE', 642, 2}, {U'\x4DF', 644, 2}, {U'\x4E2', 646, 2}, {U'\x4E3', 648, 2},
+      {U'\x4E4', 650, 2}, {U'\x4E5', 652, 2}, {U'\x4E6', 654, 2}, {U'\x4E7', 656, 2},
+      {U'\x4EA', 658, 2}, {U'\x4EB', 660, 2}, {U'\x4EC', 662, 2}, {U'\x4ED', 664, 2},
+      {U'\x4EE', 666, 2}, {U'\x4EF', 668, 2}, {U'\x4F0', 670, 2}, {U'\x4F1', 672, 2},
+      {U'\x4F2', 674, 2}, {U'\x4F3', 676, 2}, {U'\x4F4', 678, 2}, {U'\x4F5', 680, 2},
+      {U'\x4F8', 682, 2}, {U'\x4F9', 684, 2}, {U'\x622', 686, 2}, {U'\x623', 688, 2},
+      {U'\x624', 690, 2}, {U'\x625', 692, 2}, {U'\x626', 694, 2}, {U'\x6C0', 696, 2},
+      {U'\x6C2', 698, 2}, {U'\x6D3', 700, 2}, {U'\x929', 702, 2}, {U'\x931', 704, 2},
+      {U'\x934', 706, 2}, {U'\x958', 708, 2}, {U'\x959', 710, 2}, {U'\x95A', 712, 2},
+      {U'\x95B', 714, 2}, {U'\x95C', 716, 2}, {U'\x95D', 718, 2}, {U'\x95E', 720, 2},
+      {U'\x95F', 722, 2}, {U'\x9CB', 724, 2}, {U'\x9CC', 726, 2}, {U'\x9DC', 728, 2},
+      {U'\x9DD', 730, 2}, {U'\x9DF', 732, 2}, {U'\xA33', 734, 2}, {U'\xA36', 736, 2},
+      {U'\xA59', 738, 2}, {U'\xA5A', 740, 2}, {U'\xA5B', 742, 2}, {U'\xA5E', 744, 2},
+      {U'\xB48', 746, 2}, {U'\xB4B', 748, 2}, {U'\xB4C', 750, 2}, {U'\xB5C', 752, 2},
+      {U'\xB5D', 754, 2}, {U'\xB94', 756, 2}, {U'\xBCA', 758, 2}, {U'\xBCB', 760, 2},
+      {U'\xBCC', 762, 2}, {U'\xC48', 764, 2}, {U'\xCC0', 766, 2}, {U'\xCC7', 768, 2},
+      {U'\xCC8', 770, 2}, {U'\xCCA', 772, 2}, {U'\xCCB', 774, 3}, {U'\xD4A', 777, 2},
+      {U'\xD4B', 779, 2}, {U'\xD4C', 781, 2}, {U'\xDDA', 783, 2}, {U'\xDDC', 785, 2},
+      {U'\xDDD', 787, 3}, {U'\xDDE', 790, 2}, {U'\xF43', 792, 2}, {U'\xF4D', 794, 2},
+      {U'\xF52', 796, 2}, {U'\xF57', 798, 2}, {U'\xF5C', 800, 2}, {U'\xF69', 802, 2},
+      {U'\xF73', 804, 2}, {U'\xF75', 806, 2}, {U'\xF76', 808, 2}, {U'\xF78', 810, 2},
+      {U'\xF81', 812, 2}, {U'\xF93', 814, 2}, {U'\xF9D', 816, 2}, {U'\xFA2', 818, 2},
+      {U'\xFA7', 820, 2}, {U'\xFAC', 822, 2}, {U'\xFB9', 824, 2}, {U'\x1026', 826, 2},
+      {U'\x1B06', 828, 2}, {U'\x1B08', 830, 2}, {U'\x1B0A', 832, 2}, {U'\x1B0C', 834, 2},
+      {U'\x1B0E', 836, 2}, {U'\x1B12', 838, 2}, {U'\x1B3B', 840, 2}, {U'\x1B3D', 842, 2},
+      {U'\x1B40', 844, 2}, {U'\x1B41', 846, 2}, {U'\x1B43', 848, 2}, {U'\x1E00', 850, 2},
+      {U'\x1E01', 852, 2}, {U'\x1E02', 854, 2}, {U'\x1E03', 856, 2}, {U'\x1E04', 858, 2},
+      {U'\x1E05', 860, 2}, {U'\x1E06', 862, 2}, {U'\x1E07', 864, 2}, {U'\x1E08', 866, 3},
+      {U'\x1E09', 869, 3}, {U'\x1E0A', 872, 2}, {U'\x1E0B', 874, 2}, {U'\x1E0C', 876, 2},
+      {U'\x1E0D', 878, 2}, {U'\x1E0E', 880, 2}, {U'\x1E0F', 882, 2}, {U'\x1E10', 884, 2},
+      {U'\x1E11', 886, 2}, {U'\x1E12', 888, 2}, {U'\x1E13', 890, 2}, {U'\x1E14', 892, 3},
+      {U'\x1E15', 895, 3}, {U'\x1E16', 898, 3}, {U'\x1E17', 901, 3}, {U'\x1E18', 904, 2},
+      {U'\x1E19', 906, 2}, {U'\x1E1A', 908, 2}, {U'\x1E1B', 910, 2}, {U'\x1E1C', 912, 3},
+      {U'\x1E1D', 915, 3}, {U'\x1E1E', 918, 2}, {U'\x1E1F', 920, 2}, {U'\x1E20', 922, 2},
+      {U'\x1E21', 924, 2}, {U'\x1E22', 926, 2}, {U'\x1E23', 928, 2}, {U'\x1E24', 930, 2},
+      {U'\x1E25', 932, 2}, {U'\x1E26', 934, 2}, {U'\x1E27', 936, 2}, {U'\x1E28', 938, 2},
+      {U'\x1E29', 940, 2}, {U'\x1E2A', 942, 2}, {U'\x1E2B', 944, 2}, {U'\x1E2C', 946, 2},
+      {U'\x1E2D', 948, 2}, {U'\x1E2E', 950, 3}, {U'\x1E2F', 953, 3}, {U'\x1E30', 956, 2},
+      {U'\x1E31', 958, 2}, {U'\x1E32', 960, 2}, {U'\x1E33', 962, 2}, {U'\x1E34', 964, 2},
+      {U'\x1E35', 966, 2}, {U'\x1E36', 968, 2}, {U'\x1E37', 970, 2}, {U'\x1E38', 972, 3},
+      {U'\x1E39', 975, 3}, {U'\x1E3A', 978, 2}, {U'\x1E3B', 980, 2}, {U'\x1E3C', 982, 2},
+      {U'\x1E3D', 984, 2}, {U'\x1E3E', 986, 2}, {U'\x1E3F', 988, 2}, {U'\x1E40', 990, 2},
+      {U'\x1E41', 992, 2}, {U'\x1E42', 994, 2}, {U'\x1E43', 996, 2}, {U'\x1E44', 998, 2},
+      {U'\x1E45', 1000, 2}, {U'\x1E46', 1002, 2}, {U'\x1E47', 1004, 2}, {U'\x1E48', 1006, 2},
+      {U'\x1E49', 1008, 2}, {U'\x1E4A', 1010, 2}, {U'\x1E4B', 1012, 2}, {U'\x1E4C', 1014, 3},
+      {U'\x1E4D', 1017, 3}, {U'\x1E4E', 1020, 3}, {U'\x1E4F', 1023, 3}, {U'\x1E50', 1026, 3},
+      {U'\x1E51', 1029, 3}, {U'\x1E52', 1032, 3}, {U'\x1E53', 1035, 3}, {U'\x1E54', 1038, 2},
+      {U'\x1E55', 1040, 2}, {U'\x1E56', 1042, 2}, {U'\x1E57', 1044, 2}, {U'\x1E58', 1046, 2},
+      {U'\x1E59', 1048, 2}, {U'\x1E5A', 1050, 2}, {U'\x1E5B', 1052, 2}, {U'\x1E5C', 1054, 3},
+      {U'\x1E5D', 1057, 3}, {U'\x1E5E', 1060, 2}, {U'\x1E5F', 1062, 2}, {U'\x1E60', 1064, 2},
+      {U'\x1E61', 1066, 2}, {U'\x1E62', 1068, 2}, {U'\x1E63', 1070, 2}, {U'\x1E64', 1072, 3},
+      {U'\x1E65', 1075, 3}, {U'\x1E66', 1078, 3}, {U'\x1E67', 1081, 3}, {U'\x1E68', 1084, 3},
+      {U'\x1E69', 1087, 3}, {U'\x1E6A', 1090, 2}, {U'\x1E6B', 1092, 2}, {U'\x1E6C', 1094, 2},
+      {U'\x1E6D', 1096, 2}, {U'\x1E6E', 1098, 2}, {U'\x1E6F', 1100, 2}, {U'\x1E70', 1102, 2},
+      {U'\x1E71', 1104, 2}, {U'\x1E72', 1106, 2}, {U'\x1E73', 1108, 2}, {U'\x1E74', 1110, 2},
+      {U'\x1E75', 1112, 2}, {U'\x1E76', 1114, 2}, {U'\x1E77', 1116, 2}, {U'\x1E78', 1118, 3},
+      {U'\x1E79', 1121, 3}, {U'\x1E7A', 1124, 3}, {U'\x1E7B', 1127, 3}, {U'\x1E7C', 1130, 2},
+      {U'\x1E7D', 1132, 2}, {U'\x1E7E', 1134, 2}, {U'\x1E7F', 1136, 2}, {U'\x1E80', 1138, 2},
+      {U'\x1E81', 1140, 2}, {U'\x1E82', 1142, 2}, {U'\x1E83', 1144, 2}, {U'\x1E84', 1146, 2},
+      {U'\x1E85', 1148, 2}, {U'\x1E86', 1150, 2}, {U'\x1E87', 1152, 2}, {U'\x1E88', 1154, 2},
+      {U'\x1E89', 1156, 2}, {U'\x1E8A', 1158, 2}, {U'\x1E8B', 1160, 2}, {U'\x1E8C', 1162, 2},
+      {U'\x1E8D', 1164, 2}, {U'\x1E8E', 1166, 2}, {U'\x1E8F', 1168, 2}, {U'\x1E90', 1170, 2},
+      {U'\x1E91', 1172, 2}, {U'\x1E92', 1174, 2}, {U'\x1E93', 1176, 2}, {U'\x1E94', 1178, 2},
+      {U'\x1E95', 1180, 2}, {U'\x1E96', 1182, 2}, {U'\x1E97', 1184, 2}, {U'\x1E98', 1186, 2},
+      {U'\x1E99', 1188, 2}, {U'\x1E9B', 1190, 2}, {U'\x1EA0', 1192, 2}, {U'\x1EA1', 1194, 2},
+      {U'\x1EA2', 1196, 2}, {U'\x1EA3', 1198, 2}, {U'\x1EA4', 1200, 3}, {U'\x1EA5', 1203, 3},
+      {U'\x1EA6', 1206, 3}, {U'\x1EA7', 1209, 3}, {U'\x1EA8', 1212, 3}, {U'\x1EA9', 1215, 3},
+      {U'\x1EAA', 1218, 3}, {U'\x1EAB', 1221, 3}, {U'\x1EAC', 1224, 3}, {U'\x1EAD', 1227, 3},
+      {U'\x1EAE', 1230, 3}, {U'\x1EAF', 1233, 3}, {U'\x1EB0', 1236, 3}, {U'\x1EB1', 1239, 3},
+      {U'\x1EB2', 1242, 3}, {U'\x1EB3', 1245, 3}, {U'\x1EB4', 1248, 3}, {U'\x1EB5', 1251, 3},
+      {U'\x1EB6', 1254, 3}, {U'\x1EB7', 1257, 3}, {U'\x1EB8', 1260, 2}, {U'\x1EB9', 1262, 2},
+      {U'\x1EBA', 1264, 2}, {U'\x1EBB', 1266, 2}, {U'\x1EBC', 1268, 2}, {U'\x1EBD', 1270, 2},
+      {U'\x1EBE', 1272, 3}, {U'\x1EBF', 1275, 3}, {U'\x1EC0', 1278, 3}, {U'\x1EC1', 1281, 3},
+      {U'\x1EC2', 1284, 3}, {U'\x1EC3', 1287, 3}, {U'\x1EC4', 1290, 3}, {U'\x1EC5', 1293, 3},
+      {U'\x1EC6', 1296, 3}, {U'\x1EC7', 1299, 3}, {U'\x1EC8', 1302, 2}, {U'\x1EC9', 1304, 2},
+      {U'\x1ECA', 1306, 2}, {U'\x1ECB', 1308, 2}, {U'\x1ECC', 1310, 2}, {U'\x1ECD', 1312, 2},
+      {U'\x1ECE', 1314, 2}, {U'\x1ECF', 1316, 2}, {U'\x1ED0', 1318, 3}, {U'\x1ED1', 1321, 3},
+      {U'\x1ED2', 1324, 3}, {U'\x1ED3', 1327, 3}, {U'\x1ED4', 1330, 3}, {U'\x1ED5', 1333, 3},
+      {U'\x1ED6', 1336, 3}, {U'\x1ED7', 1339, 3}, {U'\x1ED8', 1342, 3}, {U'\x1ED9', 1345, 3},
+      {U'\x1EDA', 1348, 3}, {U'\x1EDB', 1351, 3}, {U'\x1EDC', 1354, 3}, {U'\x1EDD', 1357, 3},
+      {U'\x1EDE', 1360, 3}, {U'\x1EDF', 1363, 3}, {U'\x1EE0', 1366, 3}, {U'\x1EE1', 1369, 3},
+      {U'\x1EE2', 1372, 3}, {U'\x1EE3', 1375, 3}, {U'\x1EE4', 1378, 2}, {U'\x1EE5', 1380, 2},
+      {U'\x1EE6', 1382, 2}, {U'\x1EE7', 1384, 2}, {U'\x1EE8', 1386, 3}, {U'\x1EE9', 1389, 3},
+      {U'\x1EEA', 1392, 3}, {U'\x1EEB', 1395, 3}, {U'\x1EEC', 1398, 3}, {U'\x1EED', 1401, 3},
+      {U'\x1EEE', 1404, 3}, {U'\x1EEF', 1407, 3}, {U'\x1EF0', 1410, 3}, {U'\x1EF1', 1413, 3},
+      {U'\x1EF2', 1416, 2}, {U'\x1EF3', 1418, 2}, {U'\x1EF4', 1420, 2}, {U'\x1EF5', 1422, 2},
+      {U'\x1EF6', 1424, 2}, {U'\x1EF7', 1426, 2}, {U'\x1EF8', 1428, 2}, {U'\x1EF9', 1430, 2},
+      {U'\x1F00', 1432, 2}, {U'\x1F01', 1434, 2}, {U'\x1F02', 1436, 3}, {U'\x1F03', 1439, 3},
+      {U'\x1F04', 1442, 3}, {U'\x1F05', 1445, 3}, {U'\x1F06', 1448, 3}, {U'\x1F07', 1451, 3},
+      {U'\x1F08', 1454, 2}, {U'\x1F09', 1456, 2}, {U'\x1F0A', 1458, 3}, {U'\x1F0B', 1461, 3},
+      {U'\x1F0C', 1464, 3}, {U'\x1F0D', 1467, 3}, {U'\x1F0E', 1470, 3}, {U'\x1F0F', 1473, 3},
+      {U'\x1F10', 1476, 2}, {U'\x1F11', 1478, 2}, {U'\x1F12', 1480, 3}, {U'\x1F13', 1483, 3},
+      {U'\x1F14', 1486, 3}, {U'\x1F15', 1489, 3}, {U'\x1F18', 1492, 2}, {U'\x1F19', 1494, 2},
+      {U'\x1F1A', 1496, 3}, {U'\x1F1B', 1499, 3}, {U'\x1F1C', 1502, 3}, {U'\x1F1D', 1505, 3},
+      {U'\x1F20', 1508, 2}, {U'\x1F21', 1510, 2}, {U'\x1F22', 1512, 3}, {U'\x1F23', 1515, 3},
+      {U'\x1F24', 1518, 3}, {U'\x1F25', 1521, 3}, {U'\x1F26', 1524, 3}, {U'\x1F27', 1527, 3},
+      {U'\x1F28', 1530, 2}, {U'\x1F29', 1532, 2}, {U'\x1F2A', 1534, 3}, {U'\x1F2B', 1537, 3},
+      {U'\x1F2C', 1540, 3}, {U'\x1F2D', 1543, 3}, {U'\x1F2E', 1546, 3}, {U'\x1F2F', 1549, 3},
+      {U'\x1F30', 1552, 2}, {U'\x1F31', 1554, 2}, {U'\x1F32', 1556, 3}, {U'\x1F33', 1559, 3},
+      {U'\x1F34', 1562, 3}, {U'\x1F35', 1565, 3}, {U'\x1F36', 1568, 3}, {U'\x1F37', 1571, 3},
+      {U'\x1F38', 1574, 2}, {U'\x1F39', 1576, 2}, {U'\x1F3A', 1578, 3}, {U'\x1F3B', 1581, 3},
+      {U'\x1F3C', 1584, 3}, {U'\x1F3D', 1587, 3}, {U'\x1F3E', 1590, 3}, {U'\x1F3F', 1593, 3},
+      {U'\x1F40', 1596, 2}, {U'\x1F41', 1598, 2}, {U'\x1F42', 1600, 3}, {U'\x1F43', 1603, 3},
+      {U'\x1F44', 1606, 3}, {U'\x1F45', 1609, 3}, {U'\x1F48', 1612, 2}, {U'\x1F49', 1614, 2},
+      {U'\x1F4A', 1616, 3}, {U'\x1F4B', 1619, 3}, {U'\x1F4C', 1622, 3}, {U'\x1F4D', 1625, 3},
+      {U'\x1F50', 1628, 2}, {U'\x1F51', 1630, 2}, {U'\x1F52', 1632, 3}, {U'\x1F53', 1635, 3},
+      {U'\x1F54', 1638, 3}, {U'\x1F55', 1641, 3}, {U'\x1F56', 1644, 3}, {U'\x1F57', 1647, 3},
+      {U'\x1F59', 1650, 2}, {U'\x1F5B', 1652, 3}, {U'\x1F5D', 1655, 3}, {U'\x1F5F', 1658, 3},
+      {U'\x1F60', 1661, 2}, {U'\x1F61', 1663, 2}, {U'\x1F62', 1665, 3}, {U'\x1F63', 1668, 3},
+      {U'\x1F64', 1671, 3}, {U'\x1F65', 1674, 3}, {U'\x1F66', 1677, 3}, {U'\x1F67', 1680, 3},
+      {U'\x1F68', 1683, 2}, {U'\x1F69', 1685, 2}, {U'\x1F6A', 1687, 3}, {U'\x1F6B', 1690, 3},
+      {U'\x1F6C', 1693, 3}, {U'\x1F6D', 1696, 3}, {U'\x1F6E', 1699, 3}, {U'\x1F6F', 1702, 3},
+      {U'\x1F70', 1705, 2}, {U'\x1F71', 1707, 2}, {U'\x1F72', 1709, 2}, {U'\x1F73', 1711, 2},
+      {U'\x1F74', 1713, 2}, {U'\x1F75', 1715, 2}, {U'\x1F76', 1717, 2}, {U'\x1F77', 1719, 2},
+      {U'\x1F78', 1721, 2}, {U'\x1F79', 1723, 2}, {U'\x1F7A', 1725, 2}, {U'\x1F7B', 1727, 2},
+      {U'\x1F7C', 1729, 2}, {U'\x1F7D', 1731, 2}, {U'\x1F80', 1733, 3}, {U'\x1F81', 1736, 3},
+      {U'\x1F82', 1739, 4}, {U'\x1F83', 1743, 4}, {U'\x1F84', 1747, 4}, {U'\x1F85', 1751, 4},
+      {U'\x1F86', 1755, 4}, {U'\x1F87', 1759, 4}, {U'\x1F88', 1763, 3}, {U'\x1F89', 1766, 3},
+      {U'\x1F8A', 1769, 4}, {U'\x1F8B', 1773, 4}, {U'\x1F8C', 1777, 4}, {U'\x1F8D', 1781, 4},
+      {U'\x1F8E', 1785, 4}, {U'\x1F8F', 1789, 4}, {U'\x1F90', 1793, 3}, {U'\x1F91', 1796, 3},
+      {U'\x1F92', 1799, 4}, {U'\x1F93', 1803, 4}, {U'\x1F94', 1807, 4}, {U'\x1F95', 1811, 4},
+      {U'\x1F96', 1815, 4}, {U'\x1F97', 1819, 4}, {U'\x1F98', 1823, 3}, {U'\x1F99', 1826, 3},
+      {U'\x1F9A', 1829, 4}, {U'\x1F9B', 1833, 4}, {U'\x1F9C', 1837, 4}, {U'\x1F9D', 1841, 4},
+      {U'\x1F9E', 1845, 4}, {U'\x1F9F', 1849, 4}, {U'\x1FA0', 1853, 3}, {U'\x1FA1', 1856, 3},
+      {U'\x1FA2', 1859, 4}, {U'\x1FA3', 1863, 4}, {U'\x1FA4', 1867, 4}, {U'\x1FA5', 1871, 4},
+      {U'\x1FA6', 1875, 4}, {U'\x1FA7', 1879, 4}, {U'\x1FA8', 1883, 3}, {U'\x1FA9', 1886, 3},
+      {U'\x1FAA', 1889, 4}, {U'\x1FAB', 1893, 4}, {U'\x1FAC', 1897, 4}, {U'\x1FAD', 1901, 4},
+      {U'\x1FAE', 1905, 4}, {U'\x1FAF', 1909, 4}, {U'\x1FB0', 1913, 2}, {U'\x1FB1', 1915, 2},
+      {U'\x1FB2', 1917, 3}, {U'\x1FB3', 1920, 2}, {U'\x1FB4', 1922, 3}, {U'\x1FB6', 1925, 2},
+      {U'\x1FB7', 1927, 3}, {U'\x1FB8', 1930, 2}, {U'\x1FB9', 1932, 2}, {U'\x1FBA', 1934, 2},
+      {U'\x1FBB', 1936, 2}, {U'\x1FBC', 1938, 2}, {U'\x1FBE', 1940, 1}, {U'\x1FC1', 1941, 2},
+      {U'\x1FC2', 1943, 3}, {U'\x1FC3', 1946, 2}, {U'\x1FC4', 1948, 3}, {U'\x1FC6', 1951, 2},
+      {U'\x1FC7', 1953, 3}, {U'\x1FC8', 1956, 2}, {U'\x1FC9', 1958, 2}, {U'\x1FCA', 1960, 2},
+      {U'\x1FCB', 1962, 2}, {U'\x1FCC', 1964, 2}, {U'\x1FCD', 1966, 2}, {U'\x1FCE', 1968, 2},
+      {U'\x1FCF', 1970, 2}, {U'\x1FD0', 1972, 2}, {U'\x1FD1', 1974, 2}, {U'\x1FD2', 1976, 3},
+      {U'\x1FD3', 1979, 3}, {U'\x1FD6', 1982, 2}, {U'\x1FD7', 1984, 3}, {U'\x1FD8', 1987, 2},
+      {U'\x1FD9', 1989, 2}, {U'\x1FDA', 1991, 2}, {U'\x1FDB', 1993, 2}, {U'\x1FDD', 1995, 2},
+      {U'\x1FDE', 1997, 2}, {U'\x1FDF', 1999, 2}, {U'\x1FE0', 2001, 2}, {U'\x1FE1', 2003, 2},
+      {U'\x1FE2', 2005, 3}, {U'\x1FE3', 2008, 3}, {U'\x1FE4', 2011, 2}, {U'\x1FE5', 2013, 2},
+      {U'\x1FE6', 2015, 2}, {U'\x1FE7', 2017, 3}, {U'\x1FE8', 2020, 2}, {U'\x1FE9', 2022, 2},
+      {U'\x1FEA', 2024, 2}, {U'\x1FEB', 2026, 2}, {U'\x1FEC', 2028, 2}, {U'\x1FED', 2030, 2},
+      {U'\x1FEE', 2032, 2}, {U'\x1FEF', 2034, 1}, {U'\x1FF2', 2035, 3}, {U'\x1FF3', 2038, 2},
+      {U'\x1FF4', 2040, 3}, {U'\x1FF6', 2043, 2}, {U'\x1FF7', 2045, 3}, {U'\x1FF8', 2048, 2},
+      {U'\x1FF9', 2050, 2}, {U'\x1FFA', 2052, 2}, {U'\x1FFB', 2054, 2}, {U'\x1FFC', 2056, 2},
+      {U'\x1FFD', 2058, 1}, {U'\x2000', 2059, 1}, {U'\x2001', 2060, 1}, {U'\x2126', 2061, 1},
+      {U'\x212A', 2062, 1}, {U'\x212B', 2063, 2}, {U'\x219A', 2065, 2}, {U'\x219B', 2067, 2},
+      {U'\x21AE', 2069, 2}, {U'\x21CD', 2071, 2}, {U'\x21CE', 2073, 2}, {U'\x21CF', 2075, 2},
+      {U'\x2204', 2077, 2}, {U'\x2209', 2079, 2}, {U'\x220C', 2081, 2}, {U'\x2224', 2083, 2},
+      {U'\x2226', 2085, 2}, {U'\x2241', 2087, 2}, {U'\x2244', 2089, 2}, {U'\x2247', 2091, 2},
+      {U'\x2249', 2093, 2}, {U'\x2260', 2095, 2}, {U'\x2262', 2097, 2}, {U'\x226D', 2099, 2},
+      {U'\x226E', 2101, 2}, {U'\x226F', 2103, 2}, {U'\x2270', 2105, 2}, {U'\x2271', 2107, 2},
+      {U'\x2274', 2109, 2}, {U'\x2275', 2111, 2}, {U'\x2278', 2113, 2}, {U'\x2279', 2115, 2},
+      {U'\x2280', 2117, 2}, {U'\x2281', 2119, 2}, {U'\x2284', 2121, 2}, {U'\x2285', 2123, 2},
+      {U'\x2288', 2125, 2}, {U'\x2289', 2127, 2}, {U'\x22AC', 2129, 2}, {U'\x22AD', 2131, 2},
+      {U'\x22AE', 2133, 2}, {U'\x22AF', 2135, 2}, {U'\x22E0', 2137, 2}, {U'\x22E1', 2139, 2},
+      {U'\x22E2', 2141, 2}, {U'\x22E3', 2143, 2}, {U'\x22EA', 2145, 2}, {U'\x22EB', 2147, 2},
+      {U'\x22EC', 2149, 2}, {U'\x22ED', 2151, 2}, {U'\x2329', 2153, 1}, {U'\x232A', 2154, 1},
+      {U'\x2ADC', 2155, 2}, {U'\x304C', 2157, 2}, {U'\x304E', 2159, 2}, {U'\x3050', 2161, 2},
+      {U'\x3052', 2163, 2}, {U'\x3054', 2165, 2}, {U'\x3056', 2167, 2}, {U'\x3058', 2169, 2},
+      {U'\x305A', 2171, 2}, {U'\x305C', 2173, 2}, {U'\x305E', 2175, 2}, {U'\x3060', 2177, 2},
+      {U'\x3062', 2179, 2}, {U'\x3065', 2181, 2}, {U'\x3067', 2183, 2}, {U'\x3069', 2185, 2},
+      {U'\x3070', 2187, 2}, {U'\x3071', 2189, 2}, {U'\x3073', 2191, 2}, {U'\x3074', 2193, 2},
+      {U'\x3076', 2195, 2}, {U'\x3077', 2197, 2}, {U'\x3079', 2199, 2}, {U'\x307A', 2201, 2},
+      {U'\x307C', 2203, 2}, {U'\x307D', 2205, 2}, {U'\x3094', 2207, 2}, {U'\x309E', 2209, 2},
+      {U'\x30AC', 2211, 2}, {U'\x30AE', 2213, 2}, {U'\x30B0', 2215, 2}, {U'\x30B2', 2217, 2},
+      {U'\x30B4', 2219, 2}, {U'\x30B6', 2221, 2}, {U'\x30B8', 2223, 2}, {U'\x30BA', 2225, 2},
+      {U'\x30BC', 2227, 2}, {U'\x30BE', 2229, 2}, {U'\x30C0', 2231, 2}, {U'\x30C2', 2233, 2},
+      {U'\x30C5', 2235, 2}, {U'\x30C7', 2237, 2}, {U'\x30C9', 2239, 2}, {U'\x30D0', 2241, 2},
+      {U'\x30D1', 2243, 2}, {U'\x30D3', 2245, 2}, {U'\x30D4', 2247, 2}, {U'\x30D6', 2249, 2},
+      {U'\x30D7', 2251, 2}, {U'\x30D9', 2253, 2}, {U'\x30DA', 2255, 2}, {U'\x30DC', 2257, 2},
+      {U'\x30DD', 2259, 2}, {U'\x30F4', 2261, 2}, {U'\x30F7', 2263, 2}, {U'\x30F8', 2265, 2},
+      {U'\x30F9', 2267, 2}, {U'\x30FA', 2269, 2}, {U'\x30FE', 2271, 2}, {U'\xF900', 2273, 1},
+      {U'\xF901', 2274, 1}, {U'\xF902', 2275, 1}, {U'\xF903', 2276, 1}, {U'\xF904', 2277, 1},
+      {U'\xF905', 2278, 1}, {U'\xF906', 2279, 1}, {U'\xF907', 2280, 1}, {U'\xF908', 2281, 1},
+      {U'\xF909', 2282, 1}, {U'\xF90A', 2283, 1}, {U'\xF90B', 2284, 1}, {U'\xF90C', 2285, 1},
+      {U'\xF90D', 2286, 1}, {U'\xF90E', 2287, 1}, {U'\xF90F', 2288, 1}, {U'\xF910', 2289, 1},
+      {U'\xF911', 2290, 1}, {U'\xF912', 2291, 1}, {U'\xF913', 2292, 1}, {U'\xF914', 2293, 1},
+      {U'\xF915', 2294, 1}, {U'\xF916', 2295, 1}, {U'\xF917', 2296, 1}, {U'\xF918', 2297, 1},
+      {U'\xF919', 2298, 1}, {U'\xF91A', 2299, 1}, {U'\xF91B', 2300, 1}, {U'\xF91C', 2301, 1},
+      {U'\xF91D', 2302, 1}, {U'\xF91E', 2303, 1}, {U'\xF91F', 2304, 1}, {U'\xF920', 2305, 1},
+      {U'\xF921', 2306, 1}, {U'\xF922', 2307, 1}, {U'\xF923', 2308, 1}, {U'\xF924', 2309, 1},
+      {U'\xF925', 2310, 1}, {U'\xF926', 2311, 1}, {U'\xF927', 2312, 1}, {U'\xF928', 2313, 1},
+      {U'\xF929', 2314, 1}, {U'\xF92A', 2315, 1}, {U'\xF92B', 2316, 1}, {U'\xF92C', 2317, 1},
+      {U'\xF92D', 2318, 1}, {U'\xF92E', 2319, 1}, {U'\xF92F', 2320, 1}, {U'\xF930', 2321, 1},
+      {U'\xF931', 2322, 1}, {U'\xF932', 2323, 1}, {U'\xF933', 2324, 1}, {U'\xF934', 2325, 1},
+      {U'\xF935', 2326, 1}, {U'\xF936', 2327, 1}, {U'\xF937', 2328, 1}, {U'\xF938', 2329, 1},
+      {U'\xF939', 2330, 1}, {U'\xF93A', 2331, 1}, {U'\xF93B', 2332, 1}, {U'\xF93C', 2333, 1},
+      {U'\xF93D', 2334, 1}, {U'\xF93E', 2335, 1}, {U'\xF93F', 2336, 1}, {U'\xF940', 2337, 1},
+      {U'\xF941', 2338, 1}, {U'\xF942', 2339, 1}, {U'\xF943', 2340, 1}, {U'\xF944', 2341, 1},
+      {U'\xF945', 2342, 1}, {U'\xF946', 2343, 1}, {U'\xF947', 2344, 1}, {U'\xF948', 2345, 1},
+      {U'\xF949', 2346, 1}, {U'\xF94A', 2347, 1}, {U'\xF94B', 2348, 1}, {U'\xF94C', 2349, 1},
+      {U'\xF94D', 2350, 1}, {U'\xF94E', 2351, 1}, {U'\xF94F', 2352, 1}, {U'\xF950', 2353, 1},
+      {U'\xF951', 2354, 1}, {U'\xF952', 2355, 1}, {U'\xF953', 2356, 1}, {U'\xF954', 2357, 1},
+      {U'\xF955', 2358, 1}, {U'\xF956', 2359, 1}, {U'\xF957', 2360, 1}, {U'\xF958', 2361, 1},
+      {U'\xF959', 2362, 1}, {U'\xF95A', 2363, 1}, {U'\xF95B', 2364, 1}, {U'\xF95C', 2365, 1},
+      {U'\xF95D', 2366, 1}, {U'\xF95E', 2367, 1}, {U'\xF95F', 2368, 1}, {U'\xF960', 2369, 1},
+      {U'\xF961', 2370, 1}, {U'\xF962', 2371, 1}, {U'\xF963', 2372, 1}, {U'\xF964', 2373, 1},
+      {U'\xF965', 2374, 1}, {U'\xF966', 2375, 1}, {U'\xF967', 2376, 1}, {U'\xF968', 2377, 1},
+      {U'\xF969', 2378, 1}, {U'\xF96A', 2379, 1}, {U'\xF96B', 2380, 1}, {U'\xF96C', 2381, 1},
+      {U'\xF96D', 2382, 1}, {U'\xF96E', 2383, 1}, {U'\xF96F', 2384, 1}, {U'\xF970', 2385, 1},
+      {U'\xF971', 2386, 1}, {U'\xF972', 2387, 1}, {U'\xF973', 2388, 1}, {U'\xF974', 2389, 1},
+      {U'\xF975', 2390, 1}, {U'\xF976', 2391, 1}, {U'\xF977', 2392, 1}, {U'\xF978', 2393, 1},
+      {U'\xF979', 2394, 1}, {U'\xF97A', 2395, 1}, {U'\xF97B', 2396, 1}, {U'\xF97C', 2397, 1},
+      {U'\xF97D', 2398, 1}, {U'\xF97E', 2399, 1}, {U'\xF97F', 2400, 1}, {U'\xF980', 2401, 1},
+      {U'\xF981', 2402, 1}, {U'\xF982', 2403, 1}, {U'\xF983', 2404, 1}, {U'\xF984', 2405, 1},
+      {U'\xF985', 2406, 1}, {U'\xF986', 2407, 1}, {U'\xF987', 2408, 1}, {U'\xF988', 2409, 1},
+      {U'\xF989', 2410, 1}, {U'\xF98A', 2411, 1}, {U'\xF98B', 2412, 1}, {U'\xF98C', 2413, 1},
+      {U'\xF98D', 2414, 1}, {U'\xF98E', 2415, 1}, {U'\xF98F', 2416, 1}, {U'\xF990', 2417, 1},
+      {U'\xF991', 2418, 1}, {U'\xF992', 2419, 1}, {U'\xF993', 2420, 1}, {U'\xF994', 2421, 1},
+      {U'\xF995', 2422, 1}, {U'\xF996', 2423, 1}, {U'\xF997', 2424, 1}, {U'\xF998', 2425, 1},
+      {U'\xF999', 2426, 1}, {U'\xF99A', 2427, 1}, {U'\xF99B', 2428, 1}, {U'\xF99C', 2429, 1},
+      {U'\xF99D', 2430, 1}, {U'\xF99E', 2431, 1}, {U'\xF99F', 2432, 1}, {U'\xF9A0', 2433, 1},
+      {U'\xF9A1', 2434, 1}, {U'\xF9A2', 2435, 1}, {U'\xF9A3', 2436, 1}, {U'\xF9A4', 2437, 1},
+      {U'\xF9A5', 2438, 1}, {U'\xF9A6', 2439, 1}, {U'\xF9A7', 2440, 1}, {U'\xF9A8', 2441, 1},
+      {U'\xF9A9', 2442, 1}, {U'\xF9AA', 2443, 1}, {U'\xF9AB', 2444, 1}, {U'\xF9AC', 2445, 1},
+      {U'\xF9AD', 2446, 1}, {U'\xF9AE', 2447, 1}, {U'\xF9AF', 2448, 1}, {U'\xF9B0', 2449, 1},
+      {U'\xF9B1', 2450, 1}, {U'\xF9B2', 2451, 1}, {U'\xF9B3', 2452, 1}, {U'\xF9B4', 2453, 1},
+      {U'\xF9B5', 2454, 1}, {U'\xF9B6', 2455, 1}, {U'\xF9B7', 2456, 1}, {U'\xF9B8', 2457, 1},
+      {U'\xF9B9', 2458, 1}, {U'\xF9BA', 2459, 1}, {U'\xF9BB', 2460, 1}, {U'\xF9BC', 2461, 1},
+      {U'\xF9BD', 2462, 1}, {U'\xF9BE', 2463, 1}, {U'\xF9BF', 2464, 1}, {U'\xF9C0', 2465, 1},
+      {U'\xF9C1', 2466, 1}, {U'\xF9C2', 2467, 1}, {U'\xF9C3', 2468, 1}, {U'\xF9C4', 2469, 1},
+      {U'\xF9C5', 2470, 1}, {U'\xF9C6', 2471, 1}, {U'\xF9C7', 2472, 1}, {U'\xF9C8', 2473, 1},
+      {U'\xF9C9', 2474, 1}, {U'\xF9CA', 2475, 1}, {U'\xF9CB', 2476, 1}, {U'\xF9CC', 2477, 1},
+      {U'\xF9CD', 2478, 1}, {U'\xF9CE', 2479, 1}, {U'\xF9CF', 2480, 1}, {U'\xF9D0', 2481, 1},
+      {U'\xF9D1', 2482, 1}, {U'\xF9D2', 2483, 1}, {U'\xF9D3', 2484, 1}, {U'\xF9D4', 2485, 1},
+      {U'\xF9D5', 2486, 1}, {U'\xF9D6', 2487, 1}, {U'\xF9D7', 2488, 1}, {U'\xF9D8', 2489, 1},
+      {U'\xF9D9', 2490, 1}, {U'\xF9DA', 2491, 1}, {U'\xF9DB', 2492, 1}, {U'\xF9DC', 2493, 1},
+      {U'\xF9DD', 2494, 1}, {U'\xF9DE', 2495, 1}, {U'\xF9DF', 2496, 1}, {U'\xF9E0', 2497, 1},
+      {U'\xF9E1', 2498, 1}, {U'\xF9E2', 2499, 1}, {U'\xF9E3', 2500, 1}, {U'\xF9E4', 2501, 1},
+      {U'\xF9E5', 2502, 1}, {U'\xF9E6', 2503, 1}, {U'\xF9E7', 2504, 1}, {U'\xF9E8', 2505, 1},
+      {U'\xF9E9', 2506, 1}, {U'\xF9EA', 2507, 1}, {U'\xF9EB', 2508, 1}, {U'\xF9EC', 2509, 1},
+      {U'\xF9ED', 2510, 1}, {U'\xF9EE', 2511, 1}, {U'\xF9EF', 2512, 1}, {U'\xF9F0', 2513, 1},
+      {U'\xF9F1', 2514, 1}, {U'\xF9F2', 2515, 1}, {U'\xF9F3', 2516, 1}, {U'\xF9F4', 2517, 1},
+      {U'\xF9F5', 2518, 1}, {U'\xF9F6', 2519, 1}, {U'\xF9F7', 2520, 1}, {U'\xF9F8', 2521, 1},
+      {U'\xF9F9', 2522, 1}, {U'\xF9FA', 2523, 1}, {U'\xF9FB', 2524, 1}, {U'\xF9FC', 2525, 1},
+      {U'\xF9FD', 2526, 1}, {U'\xF9FE', 2527, 1}, {U'\xF9FF', 2528, 1}, {U'\xFA00', 2529, 1},
+      {U'\xFA01', 2530, 1}, {U'\xFA02', 2531, 1}, {U'\xFA03', 2532, 1}, {U'\xFA04', 2533, 1},
+      {U'\xFA05', 2534, 1}, {U'\xFA06', 2535, 1}, {U'\xFA07', 2536, 1}, {U'\xFA08', 2537, 1},
+      {U'\xFA09', 2538, 1}, {U'\xFA0A', 2539, 1}, {U'\xFA0B', 2540, 1}, {U'\xFA0C', 2541, 1},
+      {U'\xFA0D', 2542, 1}, {U'\xFA10', 2543, 1}, {U'\xFA12', 2544, 1}, {U'\xFA15', 2545, 1},
+      {U'\xFA16', 2546, 1}, {U'\xFA17', 2547, 1}, {U'\xFA18', 2548, 1}, {U'\xFA19', 2549, 1},
+      {U'\xFA1A', 2550, 1}, {U'\xFA1B', 2551, 1}, {U'\xFA1C', 2552, 1}, {U'\xFA1D', 2553, 1},
+      {U'\xFA1E', 2554, 1}, {U'\xFA20', 2555, 1}, {U'\xFA22', 2556, 1}, {U'\xFA25', 2557, 1},
+      {U'\xFA26', 2558, 1}, {U'\xFA2A', 2559, 1}, {U'\xFA2B', 2560, 1}, {U'\xFA2C', 2561, 1},
+      {U'\xFA2D', 2562, 1}, {U'\xFA2E', 2563, 1}, {U'\xFA2F', 2564, 1}, {U'\xFA30', 2565, 1},
+      {U'\xFA31', 2566, 1}, {U'\xFA32', 2567, 1}, {U'\xFA33', 2568, 1}, {U'\xFA34', 2569, 1},
+      {U'\xFA35', 2570, 1}, {U'\xFA36', 2571, 1}, {U'\xFA37', 2572, 1}, {U'\xFA38', 2573, 1},
+      {U'\xFA39', 2574, 1}, {U'\xFA3A', 2575, 1}, {U'\xFA3B', 2576, 1}, {U'\xFA3C', 2577, 1},
+      {U'\xFA3D', 2578, 1}, {U'\xFA3E', 2579, 1}, {U'\xFA3F', 2580, 1}, {U'\xFA40', 2581, 1},
+      {U'\xFA41', 2582, 1}, {U'\xFA42', 2583, 1}, {U'\xFA43', 2584, 1}, {U'\xFA44', 2585, 1},
+      {U'\xFA45', 2586, 1}, {U'\xFA46', 2587, 1}, {U'\xFA47', 2588, 1}, {U'\xFA48', 2589, 1},
+      {U'\xFA49', 2590, 1}, {U'\xFA4A', 2591, 1}, {U'\xFA4B', 2592, 1}, {U'\xFA4C', 2593, 1},
+      {U'\xFA4D', 2594, 1}, {U'\xFA4E', 2595, 1}, {U'\xFA4F', 2596, 1}, {U'\xFA50', 2597, 1},
+      {U'\xFA51', 2598, 1}, {U'\xFA52', 2599, 1}, {U'\xFA53', 2600, 1}, {U'\xFA54', 2601, 1},
+      {U'\xFA55', 2602, 1}, {U'\xFA56', 2603, 1}, {U'\xFA57', 2604, 1}, {U'\xFA58', 2605, 1},
+      {U'\xFA59', 2606, 1}, {U'\xFA5A', 2607, 1}, {U'\xFA5B', 2608, 1}, {U'\xFA5C', 2609, 1},
+      {U'\xFA5D', 2610, 1}, {U'\xFA5E', 2611, 1}, {U'\xFA5F', 2612, 1}, {U'\xFA60', 2613, 1},
+      {U'\xFA61', 2614, 1}, {U'\xFA62', 2615, 1}, {U'\xFA63', 2616, 1}, {U'\xFA64', 2617, 1},
+      {U'\xFA65', 2618, 1}, {U'\xFA66', 2619, 1}, {U'\xFA67', 2620, 1}, {U'\xFA68', 2621, 1},
+      {U'\xFA69', 2622, 1}, {U'\xFA6A', 2623, 1}, {U'\xFA6B', 2624, 1}, {U'\xFA6C', 2625, 1},
+      {U'\xFA6D', 2626, 1}, {U'\xFA70', 2627, 1}, {U'\xFA71', 2628, 1}, {U'\xFA72', 2629, 1},
+      {U'\xFA73', 2630, 1}, {U'\xFA74', 2631, 1}, {U'\xFA75', 2632, 1}, {U'\xFA76', 2633, 1},
+      {U'\xFA77', 2634, 1}, {U'\xFA78', 2635, 1}, {U'\xFA79', 2636, 1}, {U'\xFA7A', 2637, 1},
+      {U'\xFA7B', 2638, 1}, {U'\xFA7C', 2639, 1}, {U'\xFA7D', 2640, 1}, {U'\xFA7E', 2641, 1},
+      {U'\xFA7F', 2642, 1}, {U'\xFA80', 2643, 1}, {U'\xFA81', 2644, 1}, {U'\xFA82', 2645, 1},
+      {U'\xFA83', 2646, 1}, {U'\xFA84', 2647, 1}, {U'\xFA85', 2648, 1}, {U'\xFA86', 2649, 1},
+      {U'\xFA87', 2650, 1}, {U'\xFA88', 2651, 1}, {U'\xFA89', 2652, 1}, {U'\xFA8A', 2653, 1},
+      {U'\xFA8B', 2654, 1}, {U'\xFA8C', 2655, 1}, {U'\xFA8D', 2656, 1}, {U'\xFA8E', 2657, 1},
+      {U'\xFA8F', 2658, 1}, {U'\xFA90', 2659, 1}, {U'\xFA91', 2660, 1}, {U'\xFA92', 2661, 1},
+      {U'\xFA93', 2662, 1}, {U'\xFA94', 2663, 1}, {U'\xFA95', 2664, 1}, {U'\xFA96', 2665, 1},
+      {U'\xFA97', 2666, 1}, {U'\xFA98', 2667, 1}, {U'\xFA99', 2668, 1}, {U'\xFA9A', 2669, 1},
+      {U'\xFA9B', 2670, 1}, {U'\xFA9C', 2671, 1}, {U'\xFA9D', 2672, 1}, {U'\xFA9E', 2673, 1},
+      {U'\xFA9F', 2674, 1}, {U'\xFAA0', 2675, 1}, {U'\xFAA1', 2676, 1}, {U'\xFAA2', 2677, 1},
+      {U'\xFAA3', 2678, 1}, {U'\xFAA4', 2679, 1}, {U'\xFAA5', 2680, 1}, {U'\xFAA6', 2681, 1},
+      {U'\xFAA7', 2682, 1}, {U'\xFAA8', 2683, 1}, {U'\xFAA9', 2684, 1}, {U'\xFAAA', 2685, 1},
+      {U'\xFAAB', 2686, 1}, {U'\xFAAC', 2687, 1}, {U'\xFAAD', 2688, 1}, {U'\xFAAE', 2689, 1},
+      {U'\xFAAF', 2690, 1}, {U'\xFAB0', 2691, 1}, {U'\xFAB1', 2692, 1}, {U'\xFAB2', 2693, 1},
+      {U'\xFAB3', 2694, 1}, {U'\xFAB4', 2695, 1}, {U'\xFAB5', 2696, 1}, {U'\xFAB6', 2697, 1},
+      {U'\xFAB7', 2698, 1}, {U'\xFAB8', 2699, 1}, {U'\xFAB9', 2700, 1}, {U'\xFABA', 2701, 1},
+      {U'\xFABB', 2702, 1}, {U'\xFABC', 2703, 1}, {U'\xFABD', 2704, 1}, {U'\xFABE', 2705, 1},
+      {U'\xFABF', 2706, 1}, {U'\xFAC0', 2707, 1}, {U'\xFAC1', 2708, 1}, {U'\xFAC2', 2709, 1},
+      {U'\xFAC3', 2710, 1}, {U'\xFAC4', 2711, 1}, {U'\xFAC5', 2712, 1}, {U'\xFAC6', 2713, 1},
+      {U'\xFAC7', 2714, 1}, {U'\xFAC8', 2715, 1}, {U'\xFAC9', 2716, 1}, {U'\xFACA', 2717, 1},
+      {U'\xFACB', 2718, 1}, {U'\xFACC', 2719, 1}, {U'\xFACD', 2720, 1}, {U'\xFACE', 2721, 1},
+      {U'\xFACF', 2722, 1}, {U'\xFAD0', 2723, 1}, {U'\xFAD1', 2724, 1}, {U'\xFAD2', 2725, 1},
+      {U'\xFAD3', 2726, 1}, {U'\xFAD4', 2727, 1}, {U'\xFAD5', 2728, 1}, {U'\xFAD6', 2729, 1},
+      {U'\xFAD7', 2730, 1}, {U'\xFAD8', 2731, 1}, {U'\xFAD9', 2732, 1}, {U'\xFB1D', 2733, 2},
+      {U'\xFB1F', 2735, 2}, {U'\xFB2A', 2737, 2}, {U'\xFB2B', 2739, 2}, {U'\xFB2C', 2741, 3},
+      {U'\xFB2D', 2744, 3}, {U'\xFB2E', 2747, 2}, {U'\xFB2F', 2749, 2}, {U'\xFB30', 2751, 2},
+      {U'\xFB31', 2753, 2}, {U'\xFB32', 2755, 2}, {U'\xFB33', 2757, 2}, {U'\xFB34', 2759, 2},
+      {U'\xFB35', 2761, 2}, {U'\xFB36', 2763, 2}, {U'\xFB38', 2765, 2}, {U'\xFB39', 2767, 2},
+      {U'\xFB3A', 2769, 2}, {U'\xFB3B', 2771, 2}, {U'\xFB3C', 2773, 2}, {U'\xFB3E', 2775, 2},
+      {U'\xFB40', 2777, 2}, {U'\xFB41', 2779, 2}, {U'\xFB43', 2781, 2}, {U'\xFB44', 2783, 2},
+      {U'\xFB46', 2785, 2}, {U'\xFB47', 2787, 2}, {U'\xFB48', 2789, 2}, {U'\xFB49', 2791, 2},
+      {U'\xFB4A', 2793, 2}, {U'\xFB4B', 2795, 2}, {U'\xFB4C', 2797, 2}, {U'\xFB4D', 2799, 2},
+      {U'\xFB4E', 2801, 2}, {U'\x1109A', 2803, 2}, {U'\x1109C', 2805, 2}, {U'\x110AB', 2807, 2},
+      {U'\x1112E', 2809, 2}, {U'\x1112F', 2811, 2}, {U'\x1134B', 2813, 2}, {U'\x1134C', 2815, 2},
+      {U'\x114BB', 2817, 2}, {U'\x114BC', 2819, 2}, {U'\x114BE', 2821, 2}, {U'\x115BA', 2823, 2},
+      {U'\x115BB', 2825, 2}, {U'\x11938', 2827, 2}, {U'\x1D15E', 2829, 2}, {U'\x1D15F', 2831, 2},
+      {U'\x1D160', 2833, 3}, {U'\x1D161', 2836, 3}, {U'\x1D162', 2839, 3}, {U'\x1D163', 2842, 3},
+      {U'\x1D164', 2845, 3}, {U'\x1D1BB', 2848, 2}, {U'\x1D1BC', 2850, 2}, {U'\x1D1BD', 2852, 3},
+      {U'\x1D1BE', 2855, 3}, {U'\x1D1BF', 2858, 3}, {U'\x1D1C0', 2861, 3}, {U'\x2F800', 2864, 1},
+      {U'\x2F801', 2865, 1}, {U'\x2F802', 2866, 1}, {U'\x2F803', 2867, 1}, {U'\x2F804', 2868, 1},
+      {U'\x2F805', 2869, 1}, {U'\x2F806', 2870, 1}, {U'\x2F807', 2871, 1}, {U'\x2F808', 2872, 1},
+      {U'\x2F809', 2873, 1}, {U'\x2F80A', 2874, 1}, {U'\x2F80B', 2875, 1}, {U'\x2F80C', 2876, 1},
+      {U'\x2F80D', 2877, 1}, {U'\x2F80E', 2878, 1}, {U'\x2F80F', 2879, 1}, {U'\x2F810', 2880, 1},
+      {U'\x2F811', 2881, 1}, {U'\x2F812', 2882, 1}, {U'\x2F813', 2883, 1}, {U'\x2F814', 2884, 1},
+      {U'\x2F815', 2885, 1}, {U'\x2F816', 2886, 1}, {U'\x2F817', 2887, 1}, {U'\x2F818', 2888, 1},
+      {U'\x2F819', 2889, 1}, {U'\x2F81A', 2890, 1}, {U'\x2F81B', 2891, 1}, {U'\x2F81C', 2892, 1},
+      {U'\x2F81D', 2893, 1}, {U'\x2F81E', 2894, 1}, {U'\x2F81F', 2895, 1}, {U'\x2F820', 2896, 1},
+      {U'\x2F821', 2897, 1}, {U'\x2F822', 2898, 1}, {U'\x2F823', 2899, 1}, {U'\x2F824', 2900, 1},
+      {U'\x2F825', 2901, 1}, {U'\x2F826', 2902, 1}, {U'\x2F827', 2903, 1}, {U'\x2F828', 2904, 1},
+      {U'\x2F829', 2905, 1}, {U'\x2F82A', 2906, 1}, {U'\x2F82B', 2907, 1}, {U'\x2F82C', 2908, 1},
+      {U'\x2F82D', 2909, 1}, {U'\x2F82E', 2910, 1}, {U'\x2F82F', 2911, 1}, {U'\x2F830', 2912, 1},
+      {U'\x2F831', 2913, 1}, {U'\x2F832', 2914, 1}, {U'\x2F833', 2915, 1}, {U'\x2F834', 2916, 1},
+      {U'\x2F835', 2917, 1}, {U'\x2F836', 2918, 1}, {U'\x2F837', 2919, 1}, {U'\x2F838', 2920, 1},
+      {U'\x2F839', 2921, 1}, {U'\x2F83A', 2922, 1}, {U'\x2F83B', 2923, 1}, {U'\x2F83C', 2924, 1},
+      {U'\x2F83D', 2925, 1}, {U'\x2F83E', 2926, 1}, {U'\x2F83F', 2927, 1}, {U'\x2F840', 2928, 1},
+      {U'\x2F841', 2929, 1}, {U'\x2F842', 2930, 1}, {U'\x2F843', 2931, 1}, {U'\x2F844', 2932, 1},
+      {U'\x2F845', 2933, 1}, {U'\x2F846', 2934, 1}, {U'\x2F847', 2935, 1}, {U'\x2F848', 2936, 1},
+      {U'\x2F849', 2937, 1}, {U'\x2F84A', 2938, 1}, {U'\x2F84B', 2939, 1}, {U'\x2F84C', 2940, 1},
+      {U'\x2F84D', 2941, 1}, {U'\x2F84E', 2942, 1}, {U'\x2F84F', 2943, 1}, {U'\x2F850', 2944, 1},
+      {U'\x2F851', 2945, 1}, {U'\x2F852', 2946, 1}, {U'\x2F853', 2947, 1}, {U'\x2F854', 2948, 1},
+      {U'\x2F855', 2949, 1}, {U'\x2F856', 2950, 1}, {U'\x2F857', 2951, 1}, {U'\x2F858', 2952, 1},
+      {U'\x2F859', 2953, 1}, {U'\x2F85A', 2954, 1}, {U'\x2F85B', 2955, 1}, {U'\x2F85C', 2956, 1},
+      {U'\x2F85D', 2957, 1}, {U'\x2F85E', 2958, 1}, {U'\x2F85F', 2959, 1}, {U'\x2F860', 2960, 1},
+      {U'\x2F861', 2961, 1}, {U'\x2F862', 2962, 1}, {U'\x2F863', 2963, 1}, {U'\x2F864', 2964, 1},
+      {U'\x2F865', 2965, 1}, {U'\x2F866', 2966, 1}, {U'\x2F867', 2967, 1}, {U'\x2F868', 2968, 1},
+      {U'\x2F869', 2969, 1}, {U'\x2F86A', 2970, 1}, {U'\x2F86B', 2971, 1}, {U'\x2F86C', 2972, 1},
+      {U'\x2F86D', 2973, 1}, {U'\x2F86E', 2974, 1}, {U'\x2F86F', 2975, 1}, {U'\x2F870', 2976, 1},
+      {U'\x2F871', 2977, 1}, {U'\x2F872', 2978, 1}, {U'\x2F873', 2979, 1}, {U'\x2F874', 2980, 1},
+      {U'\x2F875', 2981, 1}, {U'\x2F876', 2982, 1}, {U'\x2F877', 2983, 1}, {U'\x2F878', 2984, 1},
+      {U'\x2F879', 2985, 1}, {U'\x2F87A', 2986, 1}, {U'\x2F87B', 2987, 1}, {U'\x2F87C', 2988, 1},
+      {U'\x2F87D', 2989, 1}, {U'\x2F87E', 2990, 1}, {U'\x2F87F', 2991, 1}, {U'\x2F880', 2992, 1},
+      {U'\x2F881', 2993, 1}, {U'\x2F882', 2994, 1}, {U'\x2F883', 2995, 1}, {U'\x2F884', 2996, 1},
+      {U'\x2F885', 2997, 1}, {U'\x2F886', 2998, 1}, {U'\x2F887', 2999, 1}, {U'\x2F888', 3000, 1},
+      {U'\x2F889', 3001, 1}, {U'\x2F88A', 3002, 1}, {U'\x2F88B', 3003, 1}, {U'\x2F88C', 3004, 1},
+      {U'\x2F88D', 3005, 1}, {U'\x2F88E', 3006, 1}, {U'\x2F88F', 3007, 1}, {U'\x2F890', 3008, 1},
+      {U'\x2F891', 3009, 1}, {U'\x2F892', 3010, 1}, {U'\x2F893', 3011, 1}, {U'\x2F894', 3012, 1},
+      {U'\x2F895', 3013, 1}, {U'\x2F896', 3014, 1}, {U'\x2F897', 3015, 1}, {U'\x2F898', 3016, 1},
+      {U'\x2F899', 3017, 1}, {U'\x2F89A', 3018, 1}, {U'\x2F89B', 3019, 1}, {U'\x2F89C', 3020, 1},
+      {U'\x2F89D', 3021, 1}, {U'\x2F89E', 3022, 1}, {U'\x2F89F', 3023, 1}, {U'\x2F8A0', 3024, 1},
+      {U'\x2F8A1', 3025, 1}, {U'\x2F8A2', 3026, 1}, {U'\x2F8A3', 3027, 1}, {U'\x2F8A4', 3028, 1},
+      {U'\x2F8A5', 3029, 1}, {U'\x2F8A6', 3030, 1}, {U'\x2F8A7', 3031, 1}, {U'\x2F8A8', 3032, 1},
+      {U'\x2F8A9', 3033, 1}, {U'\x2F8AA', 3034, 1}, {U'\x2F8AB', 3035, 1}, {U'\x2F8AC', 3036, 1},
+      {U'\x2F8AD', 3037, 1}, {U'\x2F8AE', 3038, 1}, {U'\x2F8AF', 3039, 1}, {U'\x2F8B0', 3040, 1},
+      {U'\x2F8B1', 3041, 1}, {U'\x2F8B2', 3042, 1}, {U'\x2F8B3', 3043, 1}, {U'\x2F8B4', 3044, 1},
+      {U'\x2F8B5', 3045, 1}, {U'\x2F8B6', 3046, 1}, {U'\x2F8B7', 3047, 1}, {U'\x2F8B8', 3048, 1},
+      {U'\x2F8B9', 3049, 1}, {U'\x2F8BA', 3050, 1}, {U'\x2F8BB', 3051, 1}, {U'\x2F8BC', 3052, 1},
+      {U'\x2F8BD', 3053, 1}, {U'\x2F8BE', 3054, 1}, {U'\x2F8BF', 3055, 1}, {U'\x2F8C0', 3056, 1},
+      {U'\x2F8C1', 3057, 1}, {U'\x2F8C2', 3058, 1}, {U'\x2F8C3', 3059, 1}, {U'\x2F8C4', 3060, 1},
+      {U'\x2F8C5', 3061, 1}, {U'\x2F8C6', 3062, 1}, {U'\x2F8C7', 3063, 1}, {U'\x2F8C8', 3064, 1},
+      {U'\x2F8C9', 3065, 1}, {U'\x2F8CA', 3066, 1}, {U'\x2F8CB', 3067, 1}, {U'\x2F8CC', 3068, 1},
+      {U'\x2F8CD', 3069, 1}, {U'\x2F8CE', 3070, 1}, {U'\x2F8CF', 3071, 1}, {U'\x2F8D0', 3072, 1},
+      {U'\x2F8D1', 3073, 1}, {U'\x2F8D2', 3074, 1}, {U'\x2F8D3', 3075, 1}, {U'\x2F8D4', 3076, 1},
+      {U'\x2F8D5', 3077, 1}, {U'\x2F8D6', 3078, 1}, {U'\x2F8D7', 3079, 1}, {U'\x2F8D8', 3080, 1},
+      {U'\x2F8D9', 3081, 1}, {U'\x2F8DA', 3082, 1}, {U'\x2F8DB', 3083, 1}, {U'\x2F8DC', 3084, 1},
+      {U'\x2F8DD', 3085, 1}, {U'\x2F8DE', 3086, 1}, {U'\x2F8DF', 3087, 1}, {U'\x2F8E0', 3088, 1},
+      {U'\x2F8E1', 3089, 1}, {U'\x2F8E2', 3090, 1}, {U'\x2F8E3', 3091, 1}, {U'\x2F8E4', 3092, 1},
+      {U'\x2F8E5', 3093, 1}, {U'\x2F8E6', 3094, 1}, {U'\x2F8E7', 3095, 1}, {U'\x2F8E8', 3096, 1},
+      {U'\x2F8E9', 3097, 1}, {U'\x2F8EA', 3098, 1}, {U'\x2F8EB', 3099, 1}, {U'\x2F8EC', 3100, 1},
+      {U'\x2F8ED', 3101, 1}, {U'\x2F8EE', 3102, 1}, {U'\x2F8EF', 3103, 1}, {U'\x2F8F0', 3104, 1},
+      {U'\x2F8F1', 3105, 1}, {U'\x2F8F2', 3106, 1}, {U'\x2F8F3', 3107, 1}, {U'\x2F8F4', 3108, 1},
+      {U'\x2F8F5', 3109, 1}, {U'\x2F8F6', 3110, 1}, {U'\x2F8F7', 3111, 1}, {U'\x2F8F8', 3112, 1},
+      {U'\x2F8F9', 3113, 1}, {U'\x2F8FA', 3114, 1}, {U'\x2F8FB', 3115, 1}, {U'\x2F8FC', 3116, 1},
+      {U'\x2F8FD', 3117, 1}, {U'\x2F8FE', 3118, 1}, {U'\x2F8FF', 3119, 1}, {U'\x2F900', 3120, 1},
+      {U'\x2F901', 3121, 1}, {U'\x2F902', 3122, 1}, {U'\x2F903', 3123, 1}, {U'\x2F904', 3124, 1},
+      {U'\x2F905', 3125, 1}, {U'\x2F906', 3126, 1}, {U'\x2F907', 3127, 1}, {U'\x2F908', 3128, 1},
+      {U'\x2F909', 3129, 1}, {U'\x2F90A', 3130, 1}, {U'\x2F90B', 3131, 1}, {U'\x2F90C', 3132, 1},
+      {U'\x2F90D', 3133, 1}, {U'\x2F90E', 3134, 1}, {U'\x2F90F', 3135, 1}, {U'\x2F910', 3136, 1},
+      {U'\x2F911', 3137, 1}, {U'\x2F912', 3138, 1}, {U'\x2F913', 3139, 1}, {U'\x2F914', 3140, 1},
+      {U'\x2F915', 3141, 1}, {U'\x2F916', 3142, 1}, {U'\x2F917', 3143, 1}, {U'\x2F918', 3144, 1},
+      {U'\x2F919', 3145, 1}, {U'\x2F91A', 3146, 1}, {U'\x2F91B', 3147, 1}, {U'\x2F91C', 3148, 1},
+      {U'\x2F91D', 3149, 1}, {U'\x2F91E', 3150, 1}, {U'\x2F91F', 3151, 1}, {U'\x2F920', 3152, 1},
+      {U'\x2F921', 3153, 1}, {U'\x2F922', 3154, 1}, {U'\x2F923', 3155, 1}, {U'\x2F924', 3156, 1},
+      {U'\x2F925', 3157, 1}, {U'\x2F926', 3158, 1}, {U'\x2F927', 3159, 1}, {U'\x2F928', 3160, 1},
+      {U'\x2F929', 3161, 1}, {U'\x2F92A', 3162, 1}, {U'\x2F92B', 3163, 1}, {U'\x2F92C', 3164, 1},
+      {U'\x2F92D', 3165, 1}, {U'\x2F92E', 3166, 1}, {U'\x2F92F', 3167, 1}, {U'\x2F930', 3168, 1},
+      {U'\x2F931', 3169, 1}, {U'\x2F932', 3170, 1}, {U'\x2F933', 3171, 1}, {U'\x2F934', 3172, 1},
+      {U'\x2F935', 3173, 1}, {U'\x2F936', 3174, 1}, {U'\x2F937', 3175, 1}, {U'\x2F938', 3176, 1},
+      {U'\x2F939', 3177, 1}, {U'\x2F93A', 3178, 1}, {U'\x2F93B', 3179, 1}, {U'\x2F93C', 3180, 1},
+      {U'\x2F93D', 3181, 1}, {U'\x2F93E', 3182, 1}, {U'\x2F93F', 3183, 1}, {U'\x2F940', 3184, 1},
+      {U'\x2F941', 3185, 1}, {U'\x2F942', 3186, 1}, {U'\x2F943', 3187, 1}, {U'\x2F944', 3188, 1},
+      {U'\x2F945', 3189, 1}, {U'\x2F946', 3190, 1}, {U'\x2F947', 3191, 1}, {U'\x2F948', 3192, 1},
+      {U'\x2F949', 3193, 1}, {U'\x2F94A', 3194, 1}, {U'\x2F94B', 3195, 1}, {U'\x2F94C', 3196, 1},
+      {U'\x2F94D', 3197, 1}, {U'\x2F94E', 3198, 1}, {U'\x2F94F', 3199, 1}, {U'\x2F950', 3200, 1},
+      {U'\x2F951', 3201, 1}, {U'\x2F952', 3202, 1}, {U'\x2F953', 3203, 1}, {U'\x2F954', 3204, 1},
+      {U'\x2F955', 3205, 1}, {U'\x2F956', 3206, 1}, {U'\x2F957', 3207, 1}, {U'\x2F958', 3208, 1},
+      {U'\x2F959', 3209, 1}, {U'\x2F95A', 3210, 1}, {U'\x2F95B', 3211, 1}, {U'\x2F95C', 3212, 1},
+      {U'\x2F95D', 3213, 1}, {U'\x2F95E', 3214, 1}, {U'\x2F95F', 3215, 1}, {U'\x2F960', 3216, 1},
+      {U'\x2F961', 3217, 1}, {U'\x2F962', 3218, 1}, {U'\x2F963', 3219, 1}, {U'\x2F964', 3220, 1},
+      {U'\x2F965', 3221, 1}, {U'\x2F966', 3222, 1}, {U'\x2F967', 3223, 1}, {U'\x2F968', 3224, 1},
+      {U'\x2F969', 3225, 1}, {U'\x2F96A', 3226, 1}, {U'\x2F96B', 3227, 1}, {U'\x2F96C', 3228, 1},
+      {U'\x2F96D', 3229, 1}, {U'\x2F96E', 3230, 1}, {U'\x2F96F', 3231, 1}, {U'\x2F970', 3232, 1},
+      {U'\x2F971', 3233, 1}, {U'\x2F972', 3234, 1}, {U'\x2F973', 3235, 1}, {U'\x2F974', 3236, 1},
+      {U'\x2F975', 3237, 1}, {U'\x2F976', 3238, 1}, {U'\x2F977', 3239, 1}, {U'\x2F978', 3240, 1},
+      {U'\x2F979', 3241, 1}, {U'\x2F97A', 3242, 1}, {U'\x2F97B', 3243, 1}, {U'\x2F97C', 3244, 1},
+      {U'\x2F97D', 3245, 1}, {U'\x2F97E', 3246, 1}, {U'\x2F97F', 3247, 1}, {U'\x2F980', 3248, 1},
+      {U'\x2F981', 3249, 1}, {U'\x2F982', 3250, 1}, {U'\x2F983', 3251, 1}, {U'\x2F984', 3252, 1},
+      {U'\x2F985', 3253, 1}, {U'\x2F986', 3254, 1}, {U'\x2F987', 3255, 1}, {U'\x2F988', 3256, 1},
+      {U'\x2F989', 3257, 1}, {U'\x2F98A', 3258, 1}, {U'\x2F98B', 3259, 1}, {U'\x2F98C', 3260, 1},
+      {U'\x2F98D', 3261, 1}, {U'\x2F98E', 3262, 1}, {U'\x2F98F', 3263, 1}, {U'\x2F990', 3264, 1},
+      {U'\x2F991', 3265, 1}, {U'\x2F992', 3266, 1}, {U'\x2F993', 3267, 1}, {U'\x2F994', 3268, 1},
+      {U'\x2F995', 3269, 1}, {U'\x2F996', 3270, 1}, {U'\x2F997', 3271, 1}, {U'\x2F998', 3272, 1},
+      {U'\x2F999', 3273, 1}, {U'\x2F99A', 3274, 1}, {U'\x2F99B', 3275, 1}, {U'\x2F99C', 3276, 1},
+      {U'\x2F99D', 3277, 1}, {U'\x2F99E', 3278, 1}, {U'\x2F99F', 3279, 1}, {U'\x2F9A0', 3280, 1},
+      {U'\x2F9A1', 3281, 1}, {U'\x2F9A2', 3282, 1}, {U'\x2F9A3', 3283, 1}, {U'\x2F9A4', 3284, 1},
+      {U'\x2F9A5', 3285, 1}, {U'\x2F9A6', 3286, 1}, {U'\x2F9A7', 3287, 1}, {U'\x2F9A8', 3288, 1},
+      {U'\x2F9A9', 3289, 1}, {U'\x2F9AA', 3290, 1}, {U'\x2F9AB', 3291, 1}, {U'\x2F9AC', 3292, 1},
+      {U'\x2F9AD', 3293, 1}, {U'\x2F9AE', 3294, 1}, {U'\x2F9AF', 3295, 1}, {U'\x2F9B0', 3296, 1},
+      {U'\x2F9B1', 3297, 1}, {U'\x2F9B2', 3298, 1}, {U'\x2F9B3', 3299, 1}, {U'\x2F9B4', 3300, 1},
+      {U'\x2F9B5', 3301, 1}, {U'\x2F9B6', 3302, 1}, {U'\x2F9B7', 3303, 1}, {U'\x2F9B8', 3304, 1},
+      {U'\x2F9B9', 3305, 1}, {U'\x2F9BA', 3306, 1}, {U'\x2F9BB', 3307, 1}, {U'\x2F9BC', 3308, 1},
+      {U'\x2F9BD', 3309, 1}, {U'\x2F9BE', 3310, 1}, {U'\x2F9BF', 3311, 1}, {U'\x2F9C0', 3312, 1},
+      {U'\x2F9C1', 3313, 1}, {U'\x2F9C2', 3314, 1}, {U'\x2F9C3', 3315, 1}, {U'\x2F9C4', 3316, 1},
+      {U'\x2F9C5', 3317, 1}, {U'\x2F9C6', 3318, 1}, {U'\x2F9C7', 3319, 1}, {U'\x2F9C8', 3320, 1},
+      {U'\x2F9C9', 3321, 1}, {U'\x2F9CA', 3322, 1}, {U'\x2F9CB', 3323, 1}, {U'\x2F9CC', 3324, 1},
+      {U'\x2F9CD', 3325, 1}, {U'\x2F9CE', 3326, 1}, {U'\x2F9CF', 3327, 1}, {U'\x2F9D0', 3328, 1},
+      {U'\x2F9D1', 3329, 1}, {U'\x2F9D2', 3330, 1}, {U'\x2F9D3', 3331, 1}, {U'\x2F9D4', 3332, 1},
+      {U'\x2F9D5', 3333, 1}, {U'\x2F9D6', 3334, 1}, {U'\x2F9D7', 3335, 1}, {U'\x2F9D8', 3336, 1},
+      {U'\x2F9D9', 3337, 1}, {U'\x2F9DA', 3338, 1}, {U'\x2F9DB', 3339, 1}, {U'\x2F9DC', 3340, 1},
+      {U'\x2F9DD', 3341, 1}, {U'\x2F9DE', 3342, 1}, {U'\x2F9DF', 3343, 1}, {U'\x2F9E0', 3344, 1},
+      {U'\x2F9E1', 3345, 1}, {U'\x2F9E2', 3346, 1}, {U'\x2F9E3', 3347, 1}, {U'\x2F9E4', 3348, 1},
+      {U'\x2F9E5', 3349, 1}, {U'\x2F9E6', 3350, 1}, {U'\x2F9E7', 3351, 1}, {U'\x2F9E8', 3352, 1},
+      {U'\x2F9E9', 3353, 1}, {U'\x2F9EA', 3354, 1}, {U'\x2F9EB', 3355, 1}, {U'\x2F9EC', 3356, 1},
+      {U'\x2F9ED', 3357, 1}, {U'\x2F9EE', 3358, 1}, {U'\x2F9EF', 3359, 1}, {U'\x2F9F0', 3360, 1},
+      {U'\x2F9F1', 3361, 1}, {U'\x2F9F2', 3362, 1}, {U'\x2F9F3', 3363, 1}, {U'\x2F9F4', 3364, 1},
+      {U'\x2F9F5', 3365, 1}, {U'\x2F9F6', 3366, 1}, {U'\x2F9F7', 3367, 1}, {U'\x2F9F8', 3368, 1},
+      {U'\x2F9F9', 3369, 1}, {U'\x2F9FA', 3370, 1}, {U'\x2F9FB', 3371, 1}, {U'\x2F9FC', 3372, 1},
+      {U'\x2F9FD', 3373, 1}, {U'\x2F9FE', 3374, 1}, {U'\x2F9FF', 3375, 1}, {U'\x2FA00', 3376, 1},
+      {U'\x2FA01', 3377, 1}, {U'\x2FA02', 3378, 1}, {U'\x2FA03', 3379, 1}, {U'\x2FA04', 3380, 1},
+      {U'\x2FA05', 3381, 1}, {U'\x2FA06', 3382, 1}, {U'\x2FA07', 3383, 1}, {U'\x2FA08', 3384, 1},
+      {U'\x2FA09', 3385, 1}, {U'\x2FA0A', 3386, 1}, {U'\x2FA0B', 3387, 1}, {U'\x2FA0C', 3388, 1},
+      {U'\x2FA0D', 3389, 1}, {U'\x2FA0E', 3390, 1}, {U'\x2FA0F', 3391, 1}, {U'\x2FA10', 3392, 1},
+      {U'\x2FA11', 3393, 1}, {U'\x2FA12', 3394, 1}, {U'\x2FA13', 3395, 1}, {U'\x2FA14', 3396, 1},
+      {U'\x2FA15', 3397, 1}, {U'\x2FA16', 3398, 1}, {U'\x2FA17', 3399, 1}, {U'\x2FA18', 3400, 1},
+      {U'\x2FA19', 3401, 1}, {U'\x2FA1A', 3402, 1}, {U'\x2FA1B', 3403, 1}, {U'\x2FA1C', 3404, 1},
+      {U'\x2FA1D', 3405, 1},
+   }};
+
+   /// \brief The full decompositions, end to end.
+   ///
+   inline constexpr auto decomposition_pool = std::array<char32_t, 3406>{{
+      U'\x41', U'\x300', U'\x41', U'\x301', U'\x41', U'\x302', U'\x41',
+      U'\x303', U'\x41', U'\x308', U'\x41', U'\x30A', U'\x43', U'\x327',
+      U'\x45', U'\x300', U'\x45', U'\x301', U'\x45', U'\x302', U'\x45',
+      U'\x308', U'\x49', U'\x300', U'\x49', U'\x301', U'\x49', U'\x302',
+      U'\x49', U'\x308', U'\x4E', U'\x303', U'\x4F', U'\x300', U'\x4F',
+      U'\x301', U'\x4F', U'\x302', U'\x4F', U'\x303', U'\x4F', U'\x308',
+      U'\x55', U'\x300', U'\x55', U'\x301', U'\x55', U'\x302', U'\x55',
+      U'\x308', U'\x59', U'\x301', U'\x61', U'\x300', U'\x61', U'\x301',
+      U'\x61', U'\x302', U'\x61', U'\x303', U'\x61', U'\x308', U'\x61',
+      U'\x30A', U'\x63', U'\x327', U'\x65', U'\x300', U'\x65', U'\x301',
+      U'\x65', U'\x302', U'\x65', U'\x308', U'\x69', U'\x300', U'\x69',
+      U'\x301', U'\x69', U'\x302', U'\x69', U'\x308', U'\x6E', U'\x303',
+      U'\x6F', U'\x300', U'\x6F', U'\x301', U'\x6F', U'\x302', U'\x6F',
+      U'\x303', U'\x6F', U'\x308', U'\x75', U'\x300', U'\x75', U'\x301',
+      U'\x75', U'\x302', U'\x75', U'\x308', U'\x79', U'\x301', U'\x79',
+      U'\x308', U'\x41', U'\x304', U'\x61', U'\x304', U'\x41', U'\x306',
+      U'\x61', U'\x306', U'\x41', U'\x328', U'\x61', U'\x328', U'\x43',
+      U'\x301', U'\x63', U'\x301', U'\x43', U'\x302', U'\x63', U'\x302',
+      U'\x43', U'\x307', U'\x63', U'\x307', U'\x43', U'\x30C', U'\x63',
+      U'\x30C', U'\x44', U'\x30C', U'\x64', U'\x30C', U'\x45', U'\x304',
+      U'\x65', U'\x304', U'\x45', U'\x306', U'\x65', U'\x306', U'\x45',
+      U'\x307', U'\x65', U'\x307', U'\x45', U'\x328', U'\x65', U'\x328',
+      U'\x45', U'\x30C', U'\x65', U'\x30C', U'\x47', U'\x302', U'\x67',
+      U'\x302', U'\x47', U'\x306', U'\x67', U'\x306', U'\x47', U'\x307',
+      U'\x67', U'\x307', U'\x47', U'\x327', U'\x67', U'\x327', U'\x48',
+      U'\x302', U'\x68', U'\x302', U'\x49', U'\x303', U'\x69', U'\x303',
+      U'\x49', U'\x304', U'\x69', U'\x304', U'\x49', U'\x306', U'\x69',
+      U'\x306', U'\x49', U'\x328', U'\x69', U'\x328', U'\x49', U'\x307',
+      U'\x4A', U'\x302', U'\x6A', U'\x302', U'\x4B', U'\x327', U'\x6B',
+      U'\x327', U'\x4C', U'\x301', U'\x6C', U'\x301', U'\x4C', U'\x327',
+      U'\x6C', U'\x327', U'\x4C', U'\x30C', U'\x6C', U'\x30C', U'\x4E',
+      U'\x301', U'\x6E', U'\x301', U'\x4E', U'\x327', U'\x6E', U'\x327',
+      U'\x4E', U'\x30C', U'\x6E', U'\x30C', U'\x4F', U'\x304', U'\x6F',
+      U'\x304', U'\x4F', U'\x306', U'\x6F', U'\x306', U'\x4F', U'\x30B',
+      U'\x6F', U'\x30B', U'\x52', U'\x301', U'\x72', U'\x301', U'\x52',
+      U'\x327', U'\x72', U'\x327', U'\x52', U'\x30C', U'\x72', U'\x30C',
+      U'\x53', U'\x301', U'\x73', U'\x301', U'\x53', U'\x302', U'\x73',
+      U'\x302', U'\x53', U'\x327', U'\x73', U'\x327', U'\x53', U'\x30C',
+      U'\x73', U'\x30C', U'\x54', U'\x327', U'\x74', U'\x327', U'\x54',
+      U'\x30C', U'\x74', U'\x30C', U'\x55', U'\x303', U'\x75', U'\x303',
+      U'\x55', U'\x304', U'\x75', U'\x304', U'\x55', U'\x306', U'\x75',
+      U'\x306', U'\x55', U'\x30A', U'\x75', U'\x30A', U'\x55', U'\x30B',
+      U'\x75', U'\x30B', U'\x55', U'\x328', U'\x75', U'\x328', U'\x57',
+      U'\x302', U'\x77', U'\x302', U'\x59', U'\x302', U'\x79', U'\x302',
+      U'\x59', U'\x308', U'\x5A', U'\x301', U'\x7A', U'\x301', U'\x5A',
+      U'\x307', U'\x7A', U'\x307', U'\x5A', U'\x30C', U'\x7A', U'\x30C',
+      U'\x4F', U'\x31B', U'\x6F', U'\x31B', U'\x55', U'\x31B', U'\x75',
+      U'\x31B', U'\x41', U'\x30C', U'\x61', U'\x30C', U'\x49', U'\x30C',
+      U'\x69', U'\x30C', U'\x4F', U'\x30C', U'\x6F', U'\x30C', U'\x55',
+      U'\x30C', U'\x75', U'\x30C', U'\x55', U'\x308', U'\x304', U'\x75',
+      U'\x308', U'\x304', U'\x55', U'\x308', U'\x301', U'\x75', U'\x308',
+      U'\x301', U'\x55', U'\x308', U'\x30C', U'\x75', U'\x308', U'\x30C',
+      U'\x55', U'\x308', U'\x300', U'\x75', U'\x308', U'\x300', U'\x41',
+      U'\x308', U'\x304', U'\x61', U'\x308', U'\x304', U'\x41', U'\x307',
+      U'\x304', U'\x61', U'\x307', U'\x304', U'\xC6', U'\x304', U'\xE6',
+      U'\x304', U'\x47', U'\x30C', U'\x67', U'\x30C', U'\x4B', U'\x30C',
+      U'\x6B', U'\x30C', U'\x4F', U'\x328', U'\x6F', U'\x328', U'\x4F',
+      U'\x328', U'\x304', U'\x6F', U'\x328', U'\x304', U'\x1B7', U'\x30C',
+      U'\x292', U'\x30C', U'\x6A', U'\x30C', U'\x47', U'\x301', U'\x67',
+      U'\x301', U'\x4E', U'\x300', U'\x6E', U'\x300', U'\x41', U'\x30A',
+      U'\x301', U'\x61', U'\x30A', U'\x301', U'\xC6', U'\x301', U'\xE6',
+      U'\x301', U'\xD8', U'\x301', U'\xF8', U'\x301', U'\x41', U'\x30F',
+      U'\x61', U'\x30F', U'\x41', U'\x311', U'\x61', U'\x311', U'\x45',
+      U'\x30F', U'\x65', U'\x30F', U'\x45', U'\x311', U'\x65', U'\x311',
+      U'\x49', U'\x30F', U'\x69', U'\x30F', U'\x49', U'\x311', U'\x69',
+      U'\x311', U'\x4F', U'\x30F', U'\x6F', U'\x30F', U'\x4F', U'\x311',
+      U'\x6F', U'\x311', U'\x52', U'\x30F', U'\x72', U'\x30F', U'\x52',
+      U'\x311', U'\x72', U'\x311', U'\x55', U'\x30F', U'\x75', U'\x30F',
+      U'\x55', U'\x311', U'\x75', U'\x311', U'\x53', U'\x326', U'\x73',
+      U'\x326', U'\x54', U'\x326', U'\x74', U'\x326', U'\x48', U'\x30C',
+      U'\x68', U'\x30C', U'\x41', U'\x307', U'\x61', U'\x307', U'\x45',
+      U'\x327', U'\x65', U'\x327', U'\x4F', U'\x308', U'\x304', U'\x6F',
+      U'\x308', U'\x304', U'\x4F', U'\x303', U'\x304', U'\x6F', U'\x303',
+      U'\x304', U'\x4F', U'\x307', U'\x6F', U'\x307', U'\x4F', U'\x307',
+      U'\x304', U'\x6F', U'\x307', U'\x304', U'\x59', U'\x304', U'\x79',
+      U'\x304', U'\x300', U'\x301', U'\x313', U'\x308', U'\x301', U'\x2B9',
+      U'\x3B', U'\xA8', U'\x301', U'\x391', U'\x301', U'\xB7', U'\x395',
+      U'\x301', U'\x397', U'\x301', U'\x399', U'\x301', U'\x39F', U'\x301',
+      U'\x3A5', U'\x301', U'\x3A9', U'\x301', U'\x3B9', U'\x308', U'\x301',
+      U'\x399', U'\x308', U'\x3A5', U'\x308', U'\x3B1', U'\x301', U'\x3B5',
+      U'\x301', U'\x3B7', U'\x301', U'\x3B9', U'\x301', U'\x3C5', U'\x308',
+      U'\x301', U'\x3B9', U'\x308', U'\x3C5', U'\x308', U'\x3BF', U'\x301',
+      U'\x3C5', U'\x301', U'\x3C9', U'\x301', U'\x3D2', U'\x301', U'\x3D2',
+      U'\x308', U'\x415', U'\x300', U'\x415', U'\x308', U'\x413', U'\x301',
+      U'\x406', U'\x308', U'\x41A', U'\x301', U'\x418', U'\x300', U'\x423',
+      U'\x306', U'\x418', U'\x306', U'\x438', U'\x306', U'\x435', U'\x300',
+      U'\x435', U'\x308', U'\x433', U'\x301', U'\x456', U'\x308', U'\x43A',
+      U'\x301', U'\x438', U'\x300', U'\x443', U'\x306', U'\x474', U'\x30F',
+      U'\x475', U'\x30F', U'\x416', U'\x306', U'\x436', U'\x306', U'\x410',
+      U'\x306', U'\x430', U'\x306', U'\x410', U'\x308', U'\x430', U'\x308',
+      U'\x415', U'\x306', U'\x435', U'\x306', U'\x4D8', U'\x308', U'\x4D9',
+      U'\x308', U'\x416', U'\x308', U'\x436', U'\x308', U'\x417', U'\x308',
+      U'\x437', U'\x308', U'\x418', U'\x304', U'\x438', U'\x304', U'\x418',
+      U'\x308', U'\x438', U'\x308', U'\x41E', U'\x308', U'\x43E', U'\x308',
+      U'\x4E8', U'\x308', U'\x4E9', U'\x308', U'\x42D', U'\x308', U'\x44D',
+      U'\x308', U'\x423', U'\x304', U'\x443', U'\x304', U'\x423', U'\x308',
+      U'\x443', U'\x308', U'\x423', U'\x30B', U'\x443', U'\x30B', U'\x427',
+      U'\x308', U'\x447', U'\x308', U'\x42B', U'\x308', U'\x44B', U'\x308',
+      U'\x627', U'\x653', U'\x627', U'\x654', U'\x648', U'\x654', U'\x627',
+      U'\x655', U'\x64A', U'\x654', U'\x6D5', U'\x654', U'\x6C1', U'\x654',
+      U'\x6D2', U'\x654', U'\x928', U'\x93C', U'\x930', U'\x93C', U'\x933',
+      U'\x93C', U'\x915', U'\x93C', U'\x916', U'\x93C', U'\x917', U'\x93C',
+      U'\x91C', U'\x93C', U'\x921', U'\x93C', U'\x922', U'\x93C', U'\x92B',
+      U'\x93C', U'\x92F', U'\x93C', U'\x9C7', U'\x9BE', U'\x9C7', U'\x9D7',
+      U'\x9A1', U'\x9BC', U'\x9A2', U'\x9BC', U'\x9AF', U'\x9BC', U'\xA32',
+      U'\xA3C', U'\xA38', U'\xA3C', U'\xA16', U'\xA3C', U'\xA17', U'\xA3C',
+      U'\xA1C', U'\xA3C', U'\xA2B', U'\xA3C', U'\xB47', U'\xB56', U'\xB47',
+      U'\xB3E', U'\xB47', U'\xB57', U'\xB21', U'\xB3C', U'\xB22', U'\xB3C',
+      U'\xB92', U'\xBD7', U'\xBC6', U'\xBBE', U'\xBC7', U'\xBBE', U'\xBC6',
+      U'\xBD7', U'\xC46', U'\xC56', U'\xCBF', U'\xCD5', U'\xCC6', U'\xCD5',
+      U'\xCC6', U'\xCD6', U'\xCC6', U'\xCC2', U'\xCC6', U'\xCC2', U'\xCD5',
+      U'\xD46', U'\xD3E', U'\xD47', U'\xD3E', U'\xD46', U'\xD57', U'\xDD9',
+      U'\xDCA', U'\xDD9', U'\xDCF', U'\xDD9', U'\xDCF', U'\xDCA', U'\xDD9',
+      U'\xDDF', U'\xF42', U'\xFB7', U'\xF4C', U'\xFB7', U'\xF51', U'\xFB7',
+      U'\xF56', U'\xFB7', U'\xF5B', U'\xFB7', U'\xF40', U'\xFB5', U'\xF71',
+      U'\xF72', U'\xF71', U'\xF74', U'\xFB2', U'\xF80', U'\xFB3', U'\xF80',
+      U'\xF71', U'\xF80', U'\xF92', U'\xFB7', U'\xF9C', U'\xFB7', U'\xFA1',
+      U'\xFB7', U'\xFA6', U'\xFB7', U'\xFAB', U'\xFB7', U'\xF90', U'\xFB5',
+      U'\x1025', U'\x102E', U'\x1B05', U'\x1B35', U'\x1B07', U'\x1B35', U'\x1B09',
+      U'\x1B35', U'\x1B0B', U'\x1B35', U'\x1B0D', U'\x1B35', U'\x1B11', U'\x1B35',
+      U'\x1B3A', U'\x1B35', U'\x1B3C', U'\x1B35', U'\x1B3E', U'\x1B35', U'\x1B3F',
+      U'\x1B35', U'\x1B42', U'\x1B35', U'\x41', U'\x325', U'\x61', U'\x325',
+      U'\x42', U'\x307', U'\x62', U'\x307', U'\x42', U'\x323', U'\x62',
+      U'\x323', U'\x42', U'\x331', U'\x62', U'\x331', U'\x43', U'\x327',
+      U'\x301', U'\x63', U'\x327', U'\x301', U'\x44', U'\x307', U'\x64',
+      U'\x307', U'\x44', U'\x323', U'\x64', U'\x323', U'\x44', U'\x331',
+      U'\x64', U'\x331', U'\x44', U'\x327', U'\x64', U'\x327', U'\x44',
+      U'\x32D', U'\x64', U'\x32D', U'\x45', U'\x304', U'\x300', U'\x65',
+      U'\x304', U'\x300', U'\x45', U'\x304', U'\x301', U'\x65', U'\x304',
+      U'\x301', U'\x45', U'\x32D', U'\x65', U'\x32D', U'\x45', U'\x330',
+      U'\x65', U'\x330', U'\x45', U'\x327', U'\x306', U'\x65', U'\x327',
+      U'\x306', U'\x46', U'\x307', U'\x66', U'\x307', U'\x47', U'\x304',
+      U'\x67', U'\x304', U'\x48', U'\x307', U'\x68', U'\x307', U'\x48',
+      U'\x323', U'\x68', U'\x323', U'\x48', U'\x308', U'\x68', U'\x308',
+      U'\x48', U'\x327', U'\x68', U'\x327', U'\x48', U'\x32E', U'\x68',
+      U'\x32E', U'\x49', U'\x330', U'\x69', U'\x330', U'\x49', U'\x308',
+      U'\x301', U'\x69', U'\x308', U'\x301', U'\x4B', U'\x301', U'\x6B',
+      U'\x301', U'\x4B', U'\x323', U'\x6B', U'\x323', U'\x4B', U'\x331',
+      U'\x6B', U'\x331', U'\x4C', U'\x323', U'\x6C', U'\x323', U'\x4C',
+      U'\x323', U'\x304', U'\x6C', U'\x323', U'\x304', U'\x4C', U'\x331',
+      U'\x6C', U'\x331', U'\x4C', U'\x32D', U'\x6C', U'\x32D', U'\x4D',
+      U'\x301', U'\x6D', U'\x301', U'\x4D', U'\x307', U'\x6D', U'\x307',
+      U'\x4D', U'\x323', U'\x6D', U'\x323', U'\x4E', U'\x307', U'\x6E',
+      U'\x307', U'\x4E', U'\x323', U'\x6E', U'\x323', U'\x4E', U'\x331',
+      U'\x6E', U'\x331', U'\x4E', U'\x32D', U'\x6E', U'\x32D', U'\x4F',
+      U'\x303', U'\x301', U'\x6F', U'\x303', U'\x301', U'\x4F', U'\x303',
+      U'\x308', U'\x6F', U'\x303', U'\x308', U'\x4F', U'\x304', U'\x300',
+      U'\x6F', U'\x304', U'\x300', U'\x4F', U'\x304', U'\x301', U'\x6F',
+      U'\x304', U'\x301', U'\x50', U'\x301', U'\x70', U'\x301', U'\x50',
+      U'\x307', U'\x70', U'\x307', U'\x52', U'\x307', U'\x72', U'\x307',
+      U'\x52', U'\x323', U'\x72', U'\x323', U'\x52', U'\x323', U'\x304',
+      U'\x72', U'\x323', U'\x304', U'\x52', U'\x331', U'\x72', U'\x331',
+      U'\x53', U'\x307', U'\x73', U'\x307', U'\x53', U'\x323', U'\x73',
+      U'\x323', U'\x53', U'\x301', U'\x307', U'\x73', U'\x301', U'\x307',
+      U'\x53', U'\x30C', U'\x307', U'\x73', U'\x30C', U'\x307', U'\x53',
+      U'\x323', U'\x307', U'\x73', U'\x323', U'\x307', U'\x54', U'\x307',
+      U'\x74', U'\x307', U'\x54', U'\x323', U'\x74', U'\x323', U'\x54',
+      U'\x331', U'\x74', U'\x331', U'\x54', U'\x32D', U'\x74', U'\x32D',
+      U'\x55', U'\x324', U'\x75', U'\x324', U'\x55', U'\x330', U'\x75',
+      U'\x330', U'\x55', U'\x32D', U'\x75', U'\x32D', U'\x55', U'\x303',
+      U'\x301', U'\x75', U'\x303', U'\x301', U'\x55', U'\x304', U'\x308',
+      U'\x75', U'\x304', U'\x308', U'\x56', U'\x303', U'\x76', U'\x303',
+      U'\x56', U'\x323', U'\x76', U'\x323', U'\x57', U'\x300', U'\x77',
+      U'\x300', U'\x57', U'\x301', U'\x77', U'\x301', U'\x57', U'\x308',
+      U'\x77', U'\x308', U'\x57', U'\x307', U'\x77', U'\x307', U'\x57',
+      U'\x323', U'\x77', U'\x323', U'\x58', U'\x307', U'\x78', U'\x307',
+      U'\x58', U'\x308', U'\x78', U'\x308', U'\x59', U'\x307', U'\x79',
+      U'\x307', U'\x5A', U'\x302', U'\x7A', U'\x302', U'\x5A', U'\x323',
+      U'\x7A', U'\x323', U'\x5A', U'\x331', U'\x7A', U'\x331', U'\x68',
+      U'\x331', U'\x74', U'\x308', U'\x77', U'\x30A', U'\x79', U'\x30A',
+      U'\x17F', U'\x307', U'\x41', U'\x323', U'\x61', U'\x323', U'\x41',
+      U'\x309', U'\x61', U'\x309', U'\x41', U'\x302', U'\x301', U'\x61',
+      U'\x302', U'\x301', U'\x41', U'\x302', U'\x300', U'\x61', U'\x302',
+      U'\x300', U'\x41', U'\x302', U'\x309', U'\x61', U'\x302', U'\x309',
+      U'\x41', U'\x302', U'\x303', U'\x61', U'\x302', U'\x303', U'\x41',
+      U'\x323', U'\x302', U'\x61', U'\x323', U'\x302', U'\x41', U'\x306',
+      U'\x301', U'\x61', U'\x306', U'\x301', U'\x41', U'\x306', U'\x300',
+      U'\x61', U'\x306', U'\x300', U'\x41', U'\x306', U'\x309', U'\x61',
+      U'\x306', U'\x309', U'\x41', U'\x306', U'\x303', U'\x61', U'\x306',
+      U'\x303', U'\x41', U'\x323', U'\x306', U'\x61', U'\x323', U'\x306',
+      U'\x45', U'\x323', U'\x65', U'\x323', U'\x45', U'\x309', U'\x65',
+      U'\x309', U'\x45', U'\x303', U'\x65', U'\x303', U'\x45', U'\x302',
+      U'\x301', U'\x65', U'\x302', U'\x301', U'\x45', U'\x302', U'\x300',
+      U'\x65', U'\x302', U'\x300', U'\x45', U'\x302', U'\x309', U'\x65',
+      U'\x302', U'\x309', U'\x45', U'\x302', U'\x303', U'\x65', U'\x302',
+      U'\x303', U'\x45', U'\x323', U'\x302', U'\x65', U'\x323', U'\x302',
+      U'\x49', U'\x309', U'\x69', U'\x309', U'\x49', U'\x323', U'\x69',
+      U'\x323', U'\x4F', U'\x323', U'\x6F', U'\x323', U'\x4F', U'\x309',
+      U'\x6F', U'\x309', U'\x4F', U'\x302', U'\x301', U'\x6F', U'\x302',
+      U'\x301', U'\x4F', U'\x302', U'\x300', U'\x6F', U'\x302', U'\x300',
+      U'\x4F', U'\x302', U'\x309', U'\x6F', U'\x302', U'\x309', U'\x4F',
+      U'\x302', U'\x303', U'\x6F', U'\x302', U'\x303', U'\x4F', U'\x323',
+      U'\x302', U'\x6F', U'\x323', U'\x302', U'\x4F', U'\x31B', U'\x301',
+      U'\x6F', U'\x31B', U'\x301', U'\x4F', U'\x31B', U'\x300', U'\x6F',
+      U'\x31B', U'\x300', U'\x4F', U'\x31B', U'\x309', U'\x6F', U'\x31B',
+      U'\x309', U'\x4F', U'\x31B', U'\x303', U'\x6F', U'\x31B', U'\x303',
+      U'\x4F', U'\x31B', U'\x323', U'\x6F', U'\x31B', U'\x323', U'\x55',
+      U'\x323', U'\x75', U'\x323', U'\x55', U'\x309', U'\x75', U'\x309',
+      U'\x55', U'\x31B', U'\x301', U'\x75', U'\x31B', U'\x301', U'\x55',
+      U'\x31B', U'\x300', U'\x75', U'\x31B', U'\x300', U'\x55', U'\x31B',
+      U'\x309', U'\x75', U'\x31B', U'\x309', U'\x55', U'\x31B', U'\x303',
+      U'\x75', U'\x31B', U'\x303', U'\x55', U'\x31B', U'\x323', U'\x75',
+      U'\x31B', U'\x323', U'\x59', U'\x300', U'\x79', U'\x300', U'\x59',
+      U'\x323', U'\x79', U'\x323', U'\x59', U'\x309', U'\x79', U'\x309',
+      U'\x59', U'\x303', U'\x79', U'\x303', U'\x3B1', U'\x313', U'\x3B1',
+      U'\x314', U'\x3B1', U'\x313', U'\x300', U'\x3B1', U'\x314', U'\x300',
+      U'\x3B1', U'\x313', U'\x301', U'\x3B1', U'\x314', U'\x301', U'\x3B1',
+      U'\x313', U'\x342', U'\x3B1', U'\x314', U'\x342', U'\x391', U'\x313',
+      U'\x391', U'\x314', U'\x391', U'\x313', U'\x300', U'\x391', U'\x314',
+      U'\x300', U'\x391', U'\x313', U'\x301', U'\x391', U'\x314', U'\x301',
+      U'\x391', U'\x313', U'\x342', U'\x391', U'\x314', U'\x342', U'\x3B5',
+      U'\x313', U'\x3B5', U'\x314', U'\x3B5', U'\x313', U'\x300', U'\x3B5',
+      U'\x314', U'\x300', U'\x3B5', U'\x313', U'\x301', U'\x3B5', U'\x314',
+      U'\x301', U'\x395', U'\x313', U'\x395', U'\x314', U'\x395', U'\x313',
+      U'\x300', U'\x395', U'\x314', U'\x300', U'\x395', U'\x313', U'\x301',
+      U'\x395', U'\x314', U'\x301', U'\x3B7', U'\x313', U'\x3B7', U'\x314',
+      U'\x3B7', U'\x313', U'\x300', U'\x3B7', U'\x314', U'\x300', U'\x3B7',
+      U'\x313', U'\x301', U'\x3B7', U'\x314', U'\x301', U'\x3B7', U'\x313',
+      U'\x342', U'\x3B7', U'\x314', U'\x342', U'\x397', U'\x313', U'\x397',
+      U'\x314', U'\x397', U'\x313', U'\x300', U'\x397', U'\x314', U'\x300',
+      U'\x397', U'\x313', U'\x301', U'\x397', U'\x314', U'\x301', U'\x397',
+      U'\x313', U'\x342', U'\x397', U'\x314', U'\x342', U'\x3B9', U'\x313',
+      U'\x3B9', U'\x314', U'\x3B9', U'\x313', U'\x300', U'\x3B9', U'\x314',
+      U'\x300', U'\x3B9', U'\x313', U'\x301', U'\x3B9', U'\x314', U'\x301',
+      U'\x3B9', U'\x313', U'\x342', U'\x3B9', U'\x314', U'\x342', U'\x399',
+      U'\x313', U'\x399', U'\x314', U'\x399', U'\x313', U'\x300', U'\x399',
+      U'\x314', U'\x300', U'\x399', U'\x313', U'\x301', U'\x399', U'\x314',
+      U'\x301', U'\x399', U'\x313', U'\x342', U'\x399', U'\x314', U'\x342',
+      U'\x3BF', U'\x313', U'\x3BF', U'\x314', U'\x3BF', U'\x313', U'\x300',
+      U'\x3BF', U'\x314', U'\x300', U'\x3BF', U'\x313', U'\x301', U'\x3BF',
+      U'\x314', U'\x301', U'\x39F', U'\x313', U'\x39F', U'\x314', U'\x39F',
+      U'\x313', U'\x300', U'\x39F', U'\x314', U'\x300', U'\x39F', U'\x313',
+      U'\x301', U'\x39F', U'\x314', U'\x301', U'\x3C5', U'\x313', U'\x3C5',
+      U'\x314', U'\x3C5', U'\x313', U'\x300', U'\x3C5', U'\x314', U'\x300',
+      U'\x3C5', U'\x313', U'\x301', U'\x3C5', U'\x314', U'\x301', U'\x3C5',
+      U'\x313', U'\x342', U'\x3C5', U'\x314', U'\x342', U'\x3A5', U'\x314',
+      U'\x3A5', U'\x314', U'\x300', U'\x3A5', U'\x314', U'\x301', U'\x3A5',
+      U'\x314', U'\x342', U'\x3C9', U'\x313', U'\x3C9', U'\x314', U'\x3C9',
+      U'\x313', U'\x300', U'\x3C9', U'\x314', U'\x300', U'\x3C9', U'\x313',
+      U'\x301', U'\x3C9', U'\x314', U'\x301', U'\x3C9', U'\x313', U'\x342',
+      U'\x3C9', U'\x314', U'\x342', U'\x3A9', U'\x313', U'\x3A9', U'\x314',
+      U'\x3A9', U'\x313', U'\x300', U'\x3A9', U'\x314', U'\x300', U'\x3A9',
+      U'\x313', U'\x301', U'\x3A9', U'\x314', U'\x301', U'\x3A9', U'\x313',
+      U'\x342', U'\x3A9', U'\x314', U'\x342', U'\x3B1', U'\x300', U'\x3B1',
+      U'\x301', U'\x3B5', U'\x300', U'\x3B5', U'\x301', U'\x3B7', U'\x300',
+      U'\x3B7', U'\x301', U'\x3B9', U'\x300', U'\x3B9', U'\x301', U'\x3BF',
+      U'\x300', U'\x3BF', U'\x301', U'\x3C5', U'\x300', U'\x3C5', U'\x301',
+      U'\x3C9', U'\x300', U'\x3C9', U'\x301', U'\x3B1', U'\x313', U'\x345',
+      U'\x3B1', U'\x314', U'\x345', U'\x3B1', U'\x313', U'\x300', U'\x345',
+      U'\x3B1', U'\x314', U'\x300', U'\x345', U'\x3B1', U'\x313', U'\x301',
+      U'\x345', U'\x3B1', U'\x314', U'\x301', U'\x345', U'\x3B1', U'\x313',
+      U'\x342', U'\x345', U'\x3B1', U'\x314', U'\x342', U'\x345', U'\x391',
+      U'\x313', U'\x345', U'\x391', U'\x314', U'\x345', U'\x391', U'\x313',
+      U'\x300', U'\x345', U'\x391', U'\x314', U'\x300', U'\x345', U'\x391',
+      U'\x313', U'\x301', U'\x345', U'\x391', U'\x314', U'\x301', U'\x345',
+      U'\x391', U'\x313', U'\x342', U'\x345', U'\x391', U'\x314', U'\x342',
+      U'\x345', U'\x3B7', U'\x313', U'\x345', U'\x3B7', U'\x314', U'\x345',
+      U'\x3B7', U'\x313', U'\x300', U'\x345', U'\x3B7', U'\x314', U'\x300',
+      U'\x345', U'\x3B7', U'\x313', U'\x301', U'\x345', U'\x3B7', U'\x314',
+      U'\x301', U'\x345', U'\x3B7', U'\x313', U'\x342', U'\x345', U'\x3B7',
+      U'\x314', U'\x342', U'\x345', U'\x397', U'\x313', U'\x345', U'\x397',
+      U'\x314', U'\x345', U'\x397', U'\x313', U'\x300', U'\x345', U'\x397',
+      U'\x314', U'\x300', U'\x345', U'\x397', U'\x313', U'\x301', U'\x345',
+      U'\x397', U'\x314', U'\x301', U'\x345', U'\x397', U'\x313', U'\x342',
+      U'\x345', U'\x397', U'\x314', U'\x342', U'\x345', U'\x3C9', U'\x313',
+      U'\x345', U'\x3C9', U'\x314', U'\x345', U'\x3C9', U'\x313', U'\x300',
+      U'\x345', U'\x3C9', U'\x314', U'\x300', U'\x345', U'\x3C9', U'\x313',
+      U'\x301', U'\x345', U'\x3C9', U'\x314', U'\x301', U'\x345', U'\x3C9',
+      U'\x313', U'\x342', U'\x345', U'\x3C9', U'\x314', U'\x342', U'\x345',
+      U'\x3A9', U'\x313', U'\x345', U'\x3A9', U'\x314', U'\x345', U'\x3A9',
+      U'\x313', U'\x300', U'\x345', U'\x3A9', U'\x314', U'\x300', U'\x345',
+      U'\x3A9', U'\x313', U'\x301', U'\x345', U'\x3A9', U'\x314', U'\x301',
+      U'\x345', U'\x3A9', U'\x313', U'\x342', U'\x345', U'\x3A9', U'\x314',
+      U'\x342', U'\x345', U'\x3B1', U'\x306', U'\x3B1', U'\x304', U'\x3B1',
+      U'\x300', U'\x345', U'\x3B1', U'\x345', U'\x3B1', U'\x301', U'\x345',
+      U'\x3B1', U'\x342', U'\x3B1', U'\x342', U'\x345', U'\x391', U'\x306',
+      U'\x391', U'\x304', U'\x391', U'\x300', U'\x391', U'\x301', U'\x391',
+      U'\x345', U'\x3B9', U'\xA8', U'\x342', U'\x3B7', U'\x300', U'\x345',
+      U'\x3B7', U'\x345', U'\x3B7', U'\x301', U'\x345', U'\x3B7', U'\x342',
+      U'\x3B7', U'\x342', U'\x345', U'\x395', U'\x300', U'\x395', U'\x301',
+      U'\x397', U'\x300', U'\x397', U'\x301', U'\x397', U'\x345', U'\x1FBF',
+      U'\x300', U'\x1FBF', U'\x301', U'\x1FBF', U'\x342', U'\x3B9', U'\x306',
+      U'\x3B9', U'\x304', U'\x3B9', U'\x308', U'\x300', U'\x3B9', U'\x308',
+      U'\x301', U'\x3B9', U'\x342', U'\x3B9', U'\x308', U'\x342', U'\x399',
+      U'\x306', U'\x399', U'\x304', U'\x399', U'\x300', U'\x399', U'\x301',
+      U'\x1FFE', U'\x300', U'\x1FFE', U'\x301', U'\x1FFE', U'\x342', U'\x3C5',
+      U'\x306', U'\x3C5', U'\x304', U'\x3C5', U'\x308', U'\x300', U'\x3C5',
+      U'\x308', U'\x301', U'\x3C1', U'\x313', U'\x3C1', U'\x314', U'\x3C5',
+      U'\x342', U'\x3C5', U'\x308', U'\x342', U'\x3A5', U'\x306', U'\x3A5',
+      U'\x304', U'\x3A5', U'\x300', U'\x3A5', U'\x301', U'\x3A1', U'\x314',
+      U'\xA8', U'\x300', U'\xA8', U'\x301', U'\x60', U'\x3C9', U'\x300',
+      U'\x345', U'\x3C9', U'\x345', U'\x3C9', U'\x301', U'\x345', U'\x3C9',
+      U'\x342', U'\x3C9', U'\x342', U'\x345', U'\x39F', U'\x300', U'\x39F',
+      U'\x301', U'\x3A9', U'\x300', U'\x3A9', U'\x301', U'\x3A9', U'\x345',
+      U'\xB4', U'\x2002', U'\x2003', U'\x3A9', U'\x4B', U'\x41', U'\x30A',
+      U'\x2190', U'\x338', U'\x2192', U'\x338', U'\x2194', U'\x338', U'\x21D0',
+      U'\x338', U'\x21D4', U'\x338', U'\x21D2', U'\x338', U'\x2203', U'\x338',
+      U'\x2208', U'\x338', U'\x220B', U'\x338', U'\x2223', U'\x338', U'\x2225',
+      U'\x338', U'\x223C', U'\x338', U'\x2243', U'\x338', U'\x2245', U'\x338',
+      U'\x2248', U'\x338', U'\x3D', U'\x338', U'\x2261', U'\x338', U'\x224D',
+      U'\x338', U'\x3C', U'\x338', U'\x3E', U'\x338', U'\x2264', U'\x338',
+      U'\x2265', U'\x338', U'\x2272', U'\x338', U'\x2273', U'\x338', U'\x2276',
+      U'\x338', U'\x2277', U'\x338', U'\x227A', U'\x338', U'\x227B', U'\x338',
+      U'\x2282', U'\x338', U'\x2283', U'\x338', U'\x2286', U'\x338', U'\x2287',
+      U'\x338', U'\x22A2', U'\x338', U'\x22A8', U'\x338', U'\x22A9', U'\x338',
+      U'\x22AB', U'\x338', U'\x227C', U'\x338', U'\x227D', U'\x338', U'\x2291',
+      U'\x338', U'\x2292', U'\x338', U'\x22B2', U'\x338', U'\x22B3', U'\x338',
+      U'\x22B4', U'\x338', U'\x22B5', U'\x338', U'\x3008', U'\x3009', U'\x2ADD',
+      U'\x338', U'\x304B', U'\x3099', U'\x304D', U'\x3099', U'\x304F', U'\x3099',
+      U'\x3051', U'\x3099', U'\x3053', U'\x3099', U'\x3055', U'\x3099', U'\x3057',
+      U'\x3099', U'\x3059', U'\x3099', U'\x305B', U'\x3099', U'\x305D', U'\x3099',
+      U'\x305F', U'\x3099', U'\x3061', U'\x3099', U'\x3064', U'\x3099', U'\x3066',
+      U'\x3099', U'\x3068', U'\x3099', U'\x306F', U'\x3099', U'\x306F', U'\x309A',
+      U'\x3072', U'\x3099', U'\x3072', U'\x309A', U'\x3075', U'\x3099', U'\x3075',
+      U'\x309A', U'\x3078', U'\x3099', U'\x3078', U'\x309A', U'\x307B', U'\x3099',
+      U'\x307B', U'\x309A', U'\x3046', U'\x3099', U'\x309D', U'\x3099', U'\x30AB',
+      U'\x3099', U'\x30AD', U'\x3099', U'\x30AF', U'\x3099', U'\x30B1', U'\x3099',
+      U'\x30B3', U'\x3099', U'\x30B5', U'\x3099', U'\x30B7', U'\x3099', U'\x30B9',
+      U'\x3099', U'\x30BB', U'\x3099', U'\x30BD', U'\x3099', U'\x30BF', U'\x3099',
+      U'\x30C1', U'\x3099', U'\x30C4', U'\x3099', U'\x30C6', U'\x3099', U'\x30C8',
+      U'\x3099', U'\x30CF', U'\x3099', U'\x30CF', U'\x309A', U'\x30D2', U'\x3099',
+      U'\x30D2', U'\x309A', U'\x30D5', U'\x3099', U'\x30D5', U'\x309A', U'\x30D8',
+      U'\x3099', U'\x30D8', U'\x309A', U'\x30DB', U'\x3099', U'\x30DB', U'\x309A',
+      U'\x30A6', U'\x3099', U'\x30EF', U'\x3099', U'\x30F0', U'\x3099', U'\x30F1',
+      U'\x3099', U'\x30F2', U'\x3099', U'\x30FD', U'\x3099', U'\x8C48', U'\x66F4',
+      U'\x8ECA', U'\x8CC8', U'\x6ED1', U'\x4E32', U'\x53E5', U'\x9F9C', U'\x9F9C',
+      U'\x5951', U'\x91D1', U'\x5587', U'\x5948', U'\x61F6', U'\x7669', U'\x7F85',
+      U'\x863F', U'\x87BA', U'\x88F8', U'\x908F', U'\x6A02', U'\x6D1B', U'\x70D9',
+      U'\x73DE', U'\x843D', U'\x916A', U'\x99F1', U'\x4E82', U'\x5375', U'\x6B04',
+      U'\x721B', U'\x862D', U'\x9E1E', U'\x5D50', U'\x6FEB', U'\x85CD', U'\x8964',
+      U'\x62C9', U'\x81D8', U'\x881F', U'\x5ECA', U'\x6717', U'\x6D6A', U'\x72FC',
+      U'\x90CE', U'\x4F86', U'\x51B7', U'\x52DE', U'\x64C4', U'\x6AD3', U'\x7210',
+      U'\x76E7', U'\x8001', U'\x8606', U'\x865C', U'\x8DEF', U'\x9732', U'\x9B6F',
+      U'\x9DFA', U'\x788C', U'\x797F', U'\x7DA0', U'\x83C9', U'\x9304', U'\x9E7F',
+      U'\x8AD6', U'\x58DF', U'\x5F04', U'\x7C60', U'\x807E', U'\x7262', U'\x78CA',
+      U'\x8CC2', U'\x96F7', U'\x58D8', U'\x5C62', U'\x6A13', U'\x6DDA', U'\x6F0F',
+      U'\x7D2F', U'\x7E37', U'\x964B', U'\x52D2', U'\x808B', U'\x51DC', U'\x51CC',
+      U'\x7A1C', U'\x7DBE', U'\x83F1', U'\x9675', U'\x8B80', U'\x62CF', U'\x6A02',
+      U'\x8AFE', U'\x4E39', U'\x5BE7', U'\x6012', U'\x7387', U'\x7570', U'\x5317',
+      U'\x78FB', U'\x4FBF', U'\x5FA9', U'\x4E0D', U'\x6CCC', U'\x6578', U'\x7D22',
+      U'\x53C3', U'\x585E', U'\x7701', U'\x8449', U'\x8AAA', U'\x6BBA', U'\x8FB0',
+      U'\x6C88', U'\x62FE', U'\x82E5', U'\x63A0', U'\x7565', U'\x4EAE', U'\x5169',
+      U'\x51C9', U'\x6881', U'\x7CE7', U'\x826F', U'\x8AD2', U'\x91CF', U'\x52F5',
+      U'\x5442', U'\x5973', U'\x5EEC', U'\x65C5', U'\x6FFE', U'\x792A', U'\x95AD',
+      U'\x9A6A', U'\x9E97', U'\x9ECE', U'\x529B', U'\x66C6', U'\x6B77', U'\x8F62',
+      U'\x5E74', U'\x6190', U'\x6200', U'\x649A', U'\x6F23', U'\x7149', U'\x7489',
+      U'\x79CA', U'\x7DF4', U'\x806F', U'\x8F26', U'\x84EE', U'\x9023', U'\x934A',
+      U'\x5217', U'\x52A3', U'\x54BD', U'\x70C8', U'\x88C2', U'\x8AAA', U'\x5EC9',
+      U'\x5FF5', U'\x637B', U'\x6BAE', U'\x7C3E', U'\x7375', U'\x4EE4', U'\x56F9',
+      U'\x5BE7', U'\x5DBA', U'\x601C', U'\x73B2', U'\x7469', U'\x7F9A', U'\x8046',
+      U'\x9234', U'\x96F6', U'\x9748', U'\x9818', U'\x4F8B', U'\x79AE', U'\x91B4',
+      U'\x96B8', U'\x60E1', U'\x4E86', U'\x50DA', U'\x5BEE', U'\x5C3F', U'\x6599',
+      U'\x6A02', U'\x71CE', U'\x7642', U'\x84FC', U'\x907C', U'\x9F8D', U'\x6688',
+      U'\x962E', U'\x5289', U'\x677B', U'\x67F3', U'\x6D41', U'\x6E9C', U'\x7409',
+      U'\x7559', U'\x786B', U'\x7D10', U'\x985E', U'\x516D', U'\x622E', U'\x9678',
+      U'\x502B', U'\x5D19', U'\x6DEA', U'\x8F2A', U'\x5F8B', U'\x6144', U'\x6817',
+      U'\x7387', U'\x9686', U'\x5229', U'\x540F', U'\x5C65', U'\x6613', U'\x674E',
+      U'\x68A8', U'\x6CE5', U'\x7406', U'\x75E2', U'\x7F79', U'\x88CF', U'\x88E1',
+      U'\x91CC', U'\x96E2', U'\x533F', U'\x6EBA', U'\x541D', U'\x71D0', U'\x7498',
+      U'\x85FA', U'\x96A3', U'\x9C57', U'\x9E9F', U'\x6797', U'\x6DCB', U'\x81E8',
+      U'\x7ACB', U'\x7B20', U'\x7C92', U'\x72C0', U'\x7099', U'\x8B58', U'\x4EC0',
+      U'\x8336', U'\x523A', U'\x5207', U'\x5EA6', U'\x62D3', U'\x7CD6', U'\x5B85',
+      U'\x6D1E', U'\x66B4', U'\x8F3B', U'\x884C', U'\x964D', U'\x898B', U'\x5ED3',
+      U'\x5140', U'\x55C0', U'\x585A', U'\x6674', U'\x51DE', U'\x732A', U'\x76CA',
+      U'\x793C', U'\x795E', U'\x7965', U'\x798F', U'\x9756', U'\x7CBE', U'\x7FBD',
+      U'\x8612', U'\x8AF8', U'\x9038', U'\x90FD', U'\x98EF', U'\x98FC', U'\x9928',
+      U'\x9DB4', U'\x90DE', U'\x96B7', U'\x4FAE', U'\x50E7', U'\x514D', U'\x52C9',
+      U'\x52E4', U'\x5351', U'\x559D', U'\x5606', U'\x5668', U'\x5840', U'\x58A8',
+      U'\x5C64', U'\x5C6E', U'\x6094', U'\x6168', U'\x618E', U'\x61F2', U'\x654F',
+      U'\x65E2', U'\x6691', U'\x6885', U'\x6D77', U'\x6E1A', U'\x6F22', U'\x716E',
+      U'\x722B', U'\x7422', U'\x7891', U'\x793E', U'\x7949', U'\x7948', U'\x7950',
+      U'\x7956', U'\x795D', U'\x798D', U'\x798E', U'\x7A40', U'\x7A81', U'\x7BC0',
+      U'\x7DF4', U'\x7E09', U'\x7E41', U'\x7F72', U'\x8005', U'\x81ED', U'\x8279',
+      U'\x8279', U'\x8457', U'\x8910', U'\x8996', U'\x8B01', U'\x8B39', U'\x8CD3',
+      U'\x8D08', U'\x8FB6', U'\x9038', U'\x96E3', U'\x97FF', U'\x983B', U'\x6075',
+      U'\x242EE', U'\x8218', U'\x4E26', U'\x51B5', U'\x5168', U'\x4F80', U'\x5145',
+      U'\x5180', U'\x52C7', U'\x52FA', U'\x559D', U'\x5555', U'\x5599', U'\x55E2',
+      U'\x585A', U'\x58B3', U'\x5944', U'\x5954', U'\x5A62', U'\x5B28', U'\x5ED2',
+      U'\x5ED9', U'\x5F69', U'\x5FAD', U'\x60D8', U'\x614E', U'\x6108', U'\x618E',
+      U'\x6160', U'\x61F2', U'\x6234', U'\x63C4', U'\x641C', U'\x6452', U'\x6556',
+      U'\x6674', U'\x6717', U'\x671B', U'\x6756', U'\x6B79', U'\x6BBA', U'\x6D41',
+      U'\x6EDB', U'\x6ECB', U'\x6F22', U'\x701E', U'\x716E', U'\x77A7', U'\x7235',
+      U'\x72AF', U'\x732A', U'\x7471', U'\x7506', U'\x753B', U'\x761D', U'\x761F',
+      U'\x76CA', U'\x76DB', U'\x76F4', U'\x774A', U'\x7740', U'\x78CC', U'\x7AB1',
+      U'\x7BC0', U'\x7C7B', U'\x7D5B', U'\x7DF4', U'\x7F3E', U'\x8005', U'\x8352',
+      U'\x83EF', U'\x8779', U'\x8941', U'\x8986', U'\x8996', U'\x8ABF', U'\x8AF8',
+      U'\x8ACB', U'\x8B01', U'\x8AFE', U'\x8AED', U'\x8B39', U'\x8B8A', U'\x8D08',
+      U'\x8F38', U'\x9072', U'\x9199', U'\x9276', U'\x967C', U'\x96E3', U'\x9756',
+      U'\x97DB', U'\x97FF', U'\x980B', U'\x983B', U'\x9B12', U'\x9F9C', U'\x2284A',
+      U'\x22844', U'\x233D5', U'\x3B9D', U'\x4018', U'\x4039', U'\x25249', U'\x25CD0',
+      U'\x27ED3', U'\x9F43', U'\x9F8E', U'\x5D9', U'\x5B4', U'\x5F2', U'\x5B7',
+      U'\x5E9', U'\x5C1', U'\x5E9', U'\x5C2', U'\x5E9', U'\x5BC', U'\x5C1',
+      U'\x5E9', U'\x5BC', U'\x5C2', U'\x5D0', U'\x5B7', U'\x5D0', U'\x5B8',
+      U'\x5D0', U'\x5BC', U'\x5D1', U'\x5BC', U'\x5D2', U'\x5BC', U'\x5D3',
+      U'\x5BC', U'\x5D4', U'\x5BC', U'\x5D5', U'\x5BC', U'\x5D6', U'\x5BC',
+      U'\x5D8', U'\x5BC', U'\x5D9', U'\x5BC', U'\x5DA', U'\x5BC', U'\x5DB',
+      U'\x5BC', U'\x5DC', U'\x5BC', U'\x5DE', U'\x5BC', U'\x5E0', U'\x5BC',
+      U'\x5E1', U'\x5BC', U'\x5E3', U'\x5BC', U'\x5E4', U'\x5BC', U'\x5E6',
+      U'\x5BC', U'\x5E7', U'\x5BC', U'\x5E8', U'\x5BC', U'\x5E9', U'\x5BC',
+      U'\x5EA', U'\x5BC', U'\x5D5', U'\x5B9', U'\x5D1', U'\x5BF', U'\x5DB',
+      U'\x5BF', U'\x5E4', U'\x5BF', U'\x11099', U'\x110BA', U'\x1109B', U'\x110BA',
+      U'\x110A5', U'\x110BA', U'\x11131', U'\x11127', U'\x11132', U'\x11127', U'\x11347',
+      U'\x1133E', U'\x11347', U'\x11357', U'\x114B9', U'\x114BA', U'\x114B9', U'\x114B0',
+      U'\x114B9', U'\x114BD', U'\x115B8', U'\x115AF', U'\x115B9', U'\x115AF', U'\x11935',
+      U'\x11930', U'\x1D157', U'\x1D165', U'\x1D158', U'\x1D165', U'\x1D158', U'\x1D165',
+      U'\x1D16E', U'\x1D158', U'\x1D165', U'\x1D16F', U'\x1D158', U'\x1D165', U'\x1D170',
+      U'\x1D158', U'\x1D165', U'\x1D171', U'\x1D158', U'\x1D165', U'\x1D172', U'\x1D1B9',
+      U'\x1D165', U'\x1D1BA', U'\x1D165', U'\x1D1B9', U'\x1D165', U'\x1D16E', U'\x1D1BA',
+      U'\x1D165', U'\x1D16E', U'\x1D1B9', U'\x1D165', U'\x1D16F', U'\x1D1BA', U'\x1D165',
+      U'\x1D16F', U'\x4E3D', U'\x4E38', U'\x4E41', U'\x20122', U'\x4F60', U'\x4FAE',
+      U'\x4FBB', U'\x5002', U'\x507A', U'\x5099', U'\x50E7', U'\x50CF', U'\x349E',
+      U'\x2063A', U'\x514D', U'\x5154', U'\x5164', U'\x5177', U'\x2051C', U'\x34B9',
+      U'\x5167', U'\x518D', U'\x2054B', U'\x5197', U'\x51A4', U'\x4ECC', U'\x51AC',
+      U'\x51B5', U'\x291DF', U'\x51F5', U'\x5203', U'\x34DF', U'\x523B', U'\x5246',
+      U'\x5272', U'\x5277', U'\x3515', U'\x52C7', U'\x52C9', U'\x52E4', U'\x52FA',
+      U'\x5305', U'\x5306', U'\x5317', U'\x5349', U'\x5351', U'\x535A', U'\x5373',
+      U'\x537D', U'\x537F', U'\x537F', U'\x537F', U'\x20A2C', U'\x7070', U'\x53CA',
+      U'\x53DF', U'\x20B63', U'\x53EB', U'\x53F1', U'\x5406', U'\x549E', U'\x5438',
+      U'\x5448', U'\x5468', U'\x54A2', U'\x54F6', U'\x5510', U'\x5553', U'\x5563',
+      U'\x5584', U'\x5584', U'\x5599', U'\x55AB', U'\x55B3', U'\x55C2', U'\x5716',
+      U'\x5606', U'\x5717', U'\x5651', U'\x5674', U'\x5207', U'\x58EE', U'\x57CE',
+      U'\x57F4', U'\x580D', U'\x578B', U'\x5832', U'\x5831', U'\x58AC', U'\x214E4',
+      U'\x58F2', U'\x58F7', U'\x5906', U'\x591A', U'\x5922', U'\x5962', U'\x216A8',
+      U'\x216EA', U'\x59EC', U'\x5A1B', U'\x5A27', U'\x59D8', U'\x5A66', U'\x36EE',
+      U'\x36FC', U'\x5B08', U'\x5B3E', U'\x5B3E', U'\x219C8', U'\x5BC3', U'\x5BD8',
+      U'\x5BE7', U'\x5BF3', U'\x21B18', U'\x5BFF', U'\x5C06', U'\x5F53', U'\x5C22',
+      U'\x3781', U'\x5C60', U'\x5C6E', U'\x5CC0', U'\x5C8D', U'\x21DE4', U'\x5D43',
+      U'\x21DE6', U'\x5D6E', U'\x5D6B', U'\x5D7C', U'\x5DE1', U'\x5DE2', U'\x382F',
+      U'\x5DFD', U'\x5E28', U'\x5E3D', U'\x5E69', U'\x3862', U'\x22183', U'\x387C',
+      U'\x5EB0', U'\x5EB3', U'\x5EB6', U'\x5ECA', U'\x2A392', U'\x5EFE', U'\x22331',
+      U'\x22331', U'\x8201', U'\x5F22', U'\x5F22', U'\x38C7', U'\x232B8', U'\x261DA',
+      U'\x5F62', U'\x5F6B', U'\x38E3', U'\x5F9A', U'\x5FCD', U'\x5FD7', U'\x5FF9',
+      U'\x6081', U'\x393A', U'\x391C', U'\x6094', U'\x226D4', U'\x60C7', U'\x6148',
+      U'\x614C', U'\x614E', U'\x614C', U'\x617A', U'\x618E', U'\x61B2', U'\x61A4',
+      U'\x61AF', U'\x61DE', U'\x61F2', U'\x61F6', U'\x6210', U'\x621B', U'\x625D',
+      U'\x62B1', U'\x62D4', U'\x6350', U'\x22B0C', U'\x633D', U'\x62FC', U'\x6368',
+      U'\x6383', U'\x63E4', U'\x22BF1', U'\x6422', U'\x63C5', U'\x63A9', U'\x3A2E',
+      U'\x6469', U'\x647E', U'\x649D', U'\x6477', U'\x3A6C', U'\x654F', U'\x656C',
+      U'\x2300A', U'\x65E3', U'\x66F8', U'\x6649', U'\x3B19', U'\x6691', U'\x3B08',
+      U'\x3AE4', U'\x5192', U'\x5195', U'\x6700', U'\x669C', U'\x80AD', U'\x43D9',
+      U'\x6717', U'\x671B', U'\x6721', U'\x675E', U'\x6753', U'\x233C3', U'\x3B49',
+      U'\x67FA', U'\x6785', U'\x6852', U'\x6885', U'\x2346D', U'\x688E', U'\x681F',
+      U'\x6914', U'\x3B9D', U'\x6942', U'\x69A3', U'\x69EA', U'\x6AA8', U'\x236A3',
+      U'\x6ADB', U'\x3C18', U'\x6B21', U'\x238A7', U'\x6B54', U'\x3C4E', U'\x6B72',
+      U'\x6B9F', U'\x6BBA', U'\x6BBB', U'\x23A8D', U'\x21D0B', U'\x23AFA', U'\x6C4E',
+      U'\x23CBC', U'\x6CBF', U'\x6CCD', U'\x6C67', U'\x6D16', U'\x6D3E', U'\x6D77',
+      U'\x6D41', U'\x6D69', U'\x6D78', U'\x6D85', U'\x23D1E', U'\x6D34', U'\x6E2F',
+      U'\x6E6E', U'\x3D33', U'\x6ECB', U'\x6EC7', U'\x23ED1', U'\x6DF9', U'\x6F6E',
+      U'\x23F5E', U'\x23F8E', U'\x6FC6', U'\x7039', U'\x701E', U'\x701B', U'\x3D96',
+      U'\x704A', U'\x707D', U'\x7077', U'\x70AD', U'\x20525', U'\x7145', U'\x24263',
+      U'\x719C', U'\x243AB', U'\x7228', U'\x7235', U'\x7250', U'\x24608', U'\x7280',
+      U'\x7295', U'\x24735', U'\x24814', U'\x737A', U'\x738B', U'\x3EAC', U'\x73A5',
+      U'\x3EB8', U'\x3EB8', U'\x7447', U'\x745C', U'\x7471', U'\x7485', U'\x74CA',
+      U'\x3F1B', U'\x7524', U'\x24C36', U'\x753E', U'\x24C92', U'\x7570', U'\x2219F',
+      U'\x7610', U'\x24FA1', U'\x24FB8', U'\x25044', U'\x3FFC', U'\x4008', U'\x76F4',
+      U'\x250F3', U'\x250F2', U'\x25119', U'\x25133', U'\x771E', U'\x771F', U'\x771F',
+      U'\x774A', U'\x4039', U'\x778B', U'\x4046', U'\x4096', U'\x2541D', U'\x784E',
+      U'\x788C', U'\x78CC', U'\x40E3', U'\x25626', U'\x7956', U'\x2569A', U'\x256C5',
+      U'\x798F', U'\x79EB', U'\x412F', U'\x7A40', U'\x7A4A', U'\x7A4F', U'\x2597C',
+      U'\x25AA7', U'\x25AA7', U'\x7AEE', U'\x4202', U'\x25BAB', U'\x7BC6', U'\x7BC9',
+      U'\x4227', U'\x25C80', U'\x7CD2', U'\x42A0', U'\x7CE8', U'\x7CE3', U'\x7D00',
+      U'\x25F86', U'\x7D63', U'\x4301', U'\x7DC7', U'\x7E02', U'\x7E45', U'\x4334',
+      U'\x26228', U'\x26247', U'\x4359', U'\x262D9', U'\x7F7A', U'\x2633E', U'\x7F95',
+      U'\x7FFA', U'\x8005', U'\x264DA', U'\x26523', U'\x8060', U'\x265A8', U'\x8070',
+      U'\x2335F', U'\x43D5', U'\x80B2', U'\x8103', U'\x440B', U'\x813E', U'\x5AB5',
+      U'\x267A7', U'\x267B5', U'\x23393', U'\x2339C', U'\x8201', U'\x8204', U'\x8F9E',
+      U'\x446B', U'\x8291', U'\x828B', U'\x829D', U'\x52B3', U'\x82B1', U'\x82B3',
+      U'\x82BD', U'\x82E6', U'\x26B3C', U'\x82E5', U'\x831D', U'\x8363', U'\x83AD',
+      U'\x8323', U'\x83BD', U'\x83E7', U'\x8457', U'\x8353', U'\x83CA', U'\x83CC',
+      U'\x83DC', U'\x26C36', U'\x26D6B', U'\x26CD5', U'\x452B', U'\x84F1', U'\x84F3',
+      U'\x8516', U'\x273CA', U'\x8564', U'\x26F2C', U'\x455D', U'\x4561', U'\x26FB1',
+      U'\x270D2', U'\x456B', U'\x8650', U'\x865C', U'\x8667', U'\x8669', U'\x86A9',
+      U'\x8688', U'\x870E', U'\x86E2', U'\x8779', U'\x8728', U'\x876B', U'\x8786',
+      U'\x45D7', U'\x87E1', U'\x8801', U'\x45F9', U'\x8860', U'\x8863', U'\x27667',
+      U'\x88D7', U'\x88DE', U'\x4635', U'\x88FA', U'\x34BB', U'\x278AE', U'\x27966',
+      U'\x46BE', U'\x46C7', U'\x8AA0', U'\x8AED', U'\x8B8A', U'\x8C55', U'\x27CA8',
+      U'\x8CAB', U'\x8CC1', U'\x8D1B', U'\x8D77', U'\x27F2F', U'\x20804', U'\x8DCB',
+      U'\x8DBC', U'\x8DF0', U'\x208DE', U'\x8ED4', U'\x8F38', U'\x285D2', U'\x285ED',
+      U'\x9094', U'\x90F1', U'\x9111', U'\x2872E', U'\x911B', U'\x9238', U'\x92D7',
+      U'\x92D8', U'\x927C', U'\x93F9', U'\x9415', U'\x28BFA', U'\x958B', U'\x4995',
+      U'\x95B7', U'\x28D77', U'\x49E6', U'\x96C3', U'\x5DB2', U'\x9723', U'\x29145',
+      U'\x2921A', U'\x4A6E', U'\x4A76', U'\x97E0', U'\x2940A', U'\x4AB2', U'\x29496',
+      U'\x980B', U'\x980B', U'\x9829', U'\x295B6', U'\x98E2', U'\x4B33', U'\x9929',
+      U'\x99A7', U'\x99C2', U'\x99FE', U'\x4BCE', U'\x29B30', U'\x9B12', U'\x9C40',
+      U'\x9CFD', U'\x4CCE', U'\x4CED', U'\x9D67', U'\x2A0CE', U'\x4CF8', U'\x2A105',
+      U'\x2A20E', U'\x2A291', U'\x9EBB', U'\x4D56', U'\x9EF9', U'\x9EFE', U'\x9F05',
+      U'\x9F0F', U'\x9F16', U'\x9F3B', U'\x2A600',
+   }};
+
+   /// \brief The pairs that compose to a primary composite, in order.
+   ///
+   inline constexpr auto compositions = std::array<composition, 941>{{
+      {U'\x3C', U'\x338', U'\x226E'}, {U'\x3D', U'\x338', U'\x2260'},
+      {U'\x3E', U'\x338', U'\x226F'}, {U'\x41', U'\x300', U'\xC0'},
+      {U'\x41', U'\x301', U'\xC1'}, {U'\x41', U'\x302', U'\xC2'},
+      {U'\x41', U'\x303', U'\xC3'}, {U'\x41', U'\x304', U'\x100'},
+      {U'\x41', U'\x306', U'\x102'}, {U'\x41', U'\x307', U'\x226'},
+      {U'\x41', U'\x308', U'\xC4'}, {U'\x41', U'\x309', U'\x1EA2'},
+      {U'\x41', U'\x30A', U'\xC5'}, {U'\x41', U'\x30C', U'\x1CD'},
+      {U'\x41', U'\x30F', U'\x200'}, {U'\x41', U'\x311', U'\x202'},
+      {U'\x41', U'\x323', U'\x1EA0'}, {U'\x41', U'\x325', U'\x1E00'},
+      {U'\x41', U'\x328', U'\x104'}, {U'\x42', U'\x307', U'\x1E02'},
+      {U'\x42', U'\x323', U'\x1E04'}, {U'\x42', U'\x331', U'\x1E06'},
+      {U'\x43', U'\x301', U'\x106'}, {U'\x43', U'\x302', U'\x108'},
+      {U'\x43', U'\x307', U'\x10A'}, {U'\x43', U'\x30C', U'\x10C'},
+      {U'\x43', U'\x327', U'\xC7'}, {U'\x44', U'\x307', U'\x1E0A'},
+      {U'\x44', U'\x30C', U'\x10E'}, {U'\x44', U'\x323', U'\x1E0C'},
+      {U'\x44', U'\x327', U'\x1E10'}, {U'\x44', U'\x32D', U'\x1E12'},
+      {U'\x44', U'\x331', U'\x1E0E'}, {U'\x45', U'\x300', U'\xC8'},
+      {U'\x45', U'\x301', U'\xC9'}, {U'\x45', U'\x302', U'\xCA'},
+      {U'\x45', U'\x303', U'\x1EBC'}, {U'\x45', U'\x304', U'\x112'},
+      {U'\x45', U'\x306', U'\x114'}, {U'\x45', U'\x307', U'\x116'},
+      {U'\x45', U'\x308', U'\xCB'}, {U'\x45', U'\x309', U'\x1EBA'},
+      {U'\x45', U'\x30C', U'\x11A'}, {U'\x45', U'\x30F', U'\x204'},
+      {U'\x45', U'\x311', U'\x206'}, {U'\x45', U'\x323', U'\x1EB8'},
+      {U'\x45', U'\x327', U'\x228'}, {U'\x45', U'\x328', U'\x118'},
+      {U'\x45', U'\x32D', U'\x1E18'}, {U'\x45', U'\x330', U'\x1E1A'},
+      {U'\x46', U'\x307', U'\x1E1E'}, {U'\x47', U'\x301', U'\x1F4'},
+      {U'\x47', U'\x302', U'\x11C'}, {U'\x47', U'\x304', U'\x1E20'},
+      {U'\x47', U'\x306', U'\x11E'}, {U'\x47', U'\x307', U'\x120'},
+      {U'\x47', U'\x30C', U'\x1E6'}, {U'\x47', U'\x327', U'\x122'},
+      {U'\x48', U'\x302', U'\x124'}, {U'\x48', U'\x307', U'\x1E22'},
+      {U'\x48', U'\x308', U'\x1E26'}, {U'\x48', U'\x30C', U'\x21E'},
+      {U'\x48', U'\x323', U'\x1E24'}, {U'\x48', U'\x327', U'\x1E28'},
+      {U'\x48', U'\x32E', U'\x1E2A'}, {U'\x49', U'\x300', U'\xCC'},
+      {U'\x49', U'\x301', U'\xCD'}, {U'\x49', U'\x302', U'\xCE'},
+      {U'\x49', U'\x303', U'\x128'}, {U'\x49', U'\x304', U'\x12A'},
+      {U'\x49', U'\x306', U'\x12C'}, {U'\x49', U'\x307', U'\x130'},
+      {U'\x49', U'\x308', U'\xCF'}, {U'\x49', U'\x309', U'\x1EC8'},
+      {U'\x49', U'\x30C', U'\x1CF'}, {U'\x49', U'\x30F', U'\x208'},
+      {U'\x49', U'\x311', U'\x20A'}, {U'\x49', U'\x323', U'\x1ECA'},
+      {U'\x49', U'\x328', U'\x12E'}, {U'\x49', U'\x330', U'\x1E2C'},
+      {U'\x4A', U'\x302', U'\x134'}, {U'\x4B', U'\x301', U'\x1E30'},
+      {U'\x4B', U'\x30C', U'\x1E8'}, {U'\x4B', U'\x323', U'\x1E32'},
+      {U'\x4B', U'\x327', U'\x136'}, {U'\x4B', U'\x331', U'\x1E34'},
+      {U'\x4C', U'\x301', U'\x139'}, {U'\x4C', U'\x30C', U'\x13D'},
+      {U'\x4C', U'\x323', U'\x1E36'}, {U'\x4C', U'\x327', U'\x13B'},
+      {U'\x4C', U'\x32D', U'\x1E3C'}, {U'\x4C', U'\x331', U'\x1E3A'},
+      {U'\x4D', U'\x301', U'\x1E3E'}, {U'\x4D', U'\x307', U'\x1E40'},
+      {U'\x4D', U'\x323', U'\x1E42'}, {U'\x4E', U'\x300', U'\x1F8'},
+      {U'\x4E', U'\x301', U'\x143'}, {U'\x4E', U'\x303', U'\xD1'},
+      {U'\x4E', U'\x307', U'\x1E44'}, {U'\x4E', U'\x30C', U'\x147'},
+      {U'\x4E', U'\x323', U'\x1E46'}, {U'\x4E', U'\x327', U'\x145'},
+      {U'\x4E', U'\x32D', U'\x1E4A'}, {U'\x4E', U'\x331', U'\x1E48'},
+      {U'\x4F', U'\x300', U'\xD2'}, {U'\x4F', U'\x301', U'\xD3'},
+      {U'\x4F', U'\x302', U'\xD4'}, {U'\x4F', U'\x303', U'\xD5'},
+      {U'\x4F', U'\x304', U'\x14C'}, {U'\x4F', U'\x306', U'\x14E'},
+      {U'\x4F', U'\x307', U'\x22E'}, {U'\x4F', U'\x308', U'\xD6'},
+      {U'\x4F', U'\x309', U'\x1ECE'}, {U'\x4F', U'\x30B', U'\x150'},
+      {U'\x4F', U'\x30C', U'\x1D1'}, {U'\x4F', U'\x30F', U'\x20C'},
+      {U'\x4F', U'\x311', U'\x20E'}, {U'\x4F', U'\x31B', U'\x1A0'},
+      {U'\x4F', U'\x323', U'\x1ECC'}, {U'\x4F', U'\x328', U'\x1EA'},
+      {U'\x50', U'\x301', U'\x1E54'}, {U'\x50', U'\x307', U'\x1E56'},
+      {U'\x52', U'\x301', U'\x154'}, {U'\x52', U'\x307', U'\x1E58'},
+      {U'\x52', U'\x30C', U'\x158'}, {U'\x52', U'\x30F', U'\x210'},
+      {U'\x52', U'\x311', U'\x212'}, {U'\x52', U'\x323', U'\x1E5A'},
+      {U'\x52', U'\x327', U'\x156'}, {U'\x52', U'\x331', U'\x1E5E'},
+      {U'\x53', U'\x301', U'\x15A'}, {U'\x53', U'\x302', U'\x15C'},
+      {U'\x53', U'\x307', U'\x1E60'}, {U'\x53', U'\x30C', U'\x160'},
+      {U'\x53', U'\x323', U'\x1E62'}, {U'\x53', U'\x326', U'\x218'},
+      {U'\x53', U'\x327', U'\x15E'}, {U'\x54', U'\x307', U'\x1E6A'},
+      {U'\x54', U'\x30C', U'\x164'}, {U'\x54', U'\x323', U'\x1E6C'},
+      {U'\x54', U'\x326', U'\x21A'}, {U'\x54', U'\x327', U'\x162'},
+      {U'\x54', U'\x32D', U'\x1E70'}, {U'\x54', U'\x331', U'\x1E6E'},
+      {U'\x55', U'\x300', U'\xD9'}, {U'\x55', U'\x301', U'\xDA'},
+      {U'\x55', U'\x302', U'\xDB'}, {U'\x55', U'\x303', U'\x168'},
+      {U'\x55', U'\x304', U'\x16A'}, {U'\x55', U'\x306', U'\x16C'},
+      {U'\x55', U'\x308', U'\xDC'}, {U'\x55', U'\x309', U'\x1EE6'},
+      {U'\x55', U'\x30A', U'\x16E'}, {U'\x55', U'\x30B', U'\x170'},
+      {U'\x55', U'\x30C', U'\x1D3'}, {U'\x55', U'\x30F', U'\x214'},
+      {U'\x55', U'\x311', U'\x216'}, {U'\x55', U'\x31B', U'\x1AF'},
+      {U'\x55', U'\x323', U'\x1EE4'}, {U'\x55', U'\x324', U'\x1E72'},
+      {U'\x55', U'\x328', U'\x172'}, {U'\x55', U'\x32D', U'\x1E76'},
+      {U'\x55', U'\x330', U'\x1E74'}, {U'\x56', U'\x303', U'\x1E7C'},
+      {U'\x56', U'\x323', U'\x1E7E'}, {U'\x57', U'\x300', U'\x1E80'},
+      {U'\x57', U'\x301', U'\x1E82'}, {U'\x57', U'\x302', U'\x174'},
+      {U'\x57', U'\x307', U'\x1E86'}, {U'\x57', U'\x308', U'\x1E84'},
+      {U'\x57', U'\x323', U'\x1E88'}, {U'\x58', U'\x307', U'\x1E8A'},
+      {U'\x58', U'\x308', U'\x1E8C'}, {U'\x59', U'\x300', U'\x1EF2'},
+      {U'\x59', U'\x301', U'\xDD'}, {U'\x59', U'\x302', U'\x176'},
+      {U'\x59', U'\x303', U'\x1EF8'}, {U'\x59', U'\x304', U'\x232'},
+      {U'\x59', U'\x307', U'\x1E8E'}, {U'\x59', U'\x308', U'\x178'},
+      {U'\x59', U'\x309', U'\x1EF6'}, {U'\x59', U'\x323', U'\x1EF4'},
+      {U'\x5A', U'\x301', U'\x179'}, {U'\x5A', U'\x302', U'\x1E90'},
+      {U'\x5A', U'\x307', U'\x17B'}, {U'\x5A', U'\x30C', U'\x17D'},
+      {U'\x5A', U'\x323', U'\x1E92'}, {U'\x5A', U'\x331', U'\x1E94'},
+      {U'\x61', U'\x300', U'\xE0'}, {U'\x61', U'\x301', U'\xE1'},
+      {U'\x61', U'\x302', U'\xE2'}, {U'\x61', U'\x303', U'\xE3'},
+      {U'\x61', U'\x304', U'\x101'}, {U'\x61', U'\x306', U'\x103'},
+      {U'\x61', U'\x307', U'\x227'}, {U'\x61', U'\x308', U'\xE4'},
+      {U'\x61', U'\x309', U'\x1EA3'}, {U'\x61', U'\x30A', U'\xE5'},
+      {U'\x61', U'\x30C', U'\x1CE'}, {U'\x61', U'\x30F', U'\x201'},
+      {U'\x61', U'\x311', U'\x203'}, {U'\x61', U'\x323', U'\x1EA1'},
+      {U'\x61', U'\x325', U'\x1E01'}, {U'\x61', U'\x328', U'\x105'},
+      {U'\x62', U'\x307', U'\x1E03'}, {U'\x62', U'\x323', U'\x1E05'},
+      {U'\x62', U'\x331', U'\x1E07'}, {U'\x63', U'\x301', U'\x107'},
+      {U'\x63', U'\x302', U'\x109'}, {U'\x63', U'\x307', U'\x10B'},
+      {U'\x63', U'\x30C', U'\x10D'}, {U'\x63', U'\x327', U'\xE7'},
+      {U'\x64', U'\x307', U'\x1E0B'}, {U'\x64', U'\x30C', U'\x10F'},
+      {U'\x64', U'\x323', U'\x1E0D'}, {U'\x64', U'\x327', U'\x1E11'},
+      {U'\x64', U'\x32D', U'\x1E13'}, {U'\x64', U'\x331', U'\x1E0F'},
+      {U'\x65', U'\x300', U'\xE8'}, {U'\x65', U'\x301', U'\xE9'},
+      {U'\x65', U'\x302', U'\xEA'}, {U'\x65', U'\x303', U'\x1EBD'},
+      {U'\x65', U'\x304', U'\x113'}, {U'\x65', U'\x306', U'\x115'},
+      {U'\x65', U'\x307', U'\x117'}, {U'\x65', U'\x308', U'\xEB'},
+      {U'\x65', U'\x309', U'\x1EBB'}, {U'\x65', U'\x30C', U'\x11B'},
+      {U'\x65', U'\x30F', U'\x205'}, {U'\x65', U'\x311', U'\x207'},
+      {U'\x65', U'\x323', U'\x1EB9'}, {U'\x65', U'\x327', U'\x229'},
+      {U'\x65', U'\x328', U'\x119'}, {U'\x65', U'\x32D', U'\x1E19'},
+      {U'\x65', U'\x330', U'\x1E1B'}, {U'\x66', U'\x307', U'\x1E1F'},
+      {U'\x67', U'\x301', U'\x1F5'}, {U'\x67', U'\x302', U'\x11D'},
+      {U'\x67', U'\x304', U'\x1E21'}, {U'\x67', U'\x306', U'\x11F'},
+      {U'\x67', U'\x307', U'\x121'}, {U'\x67', U'\x30C', U'\x1E7'},
+      {U'\x67', U'\x327', U'\x123'}, {U'\x68', U'\x302', U'\x125'},
+      {U'\x68', U'\x307', U'\x1E23'}, {U'\x68', U'\x308', U'\x1E27'},
+      {U'\x68', U'\x30C', U'\x21F'}, {U'\x68', U'\x323', U'\x1E25'},
+      {U'\x68', U'\x327', U'\x1E29'}, {U'\x68', U'\x32E', U'\x1E2B'},
+      {U'\x68', U'\x331', U'\x1E96'}, {U'\x69', U'\x300', U'\xEC'},
+      {U'\x69', U'\x301', U'\xED'}, {U'\x69', U'\x302', U'\xEE'},
+      {U'\x69', U'\x303', U'\x129'}, {U'\x69', U'\x304', U'\x12B'},
+      {U'\x69', U'\x306', U'\x12D'}, {U'\x69', U'\x308', U'\xEF'},
+      {U'\x69', U'\x309', U'\x1EC9'}, {U'\x69', U'\x30C', U'\x1D0'},
+      {U'\x69', U'\x30F', U'\x209'}, {U'\x69', U'\x311', U'\x20B'},
+      {U'\x69', U'\x323', U'\x1ECB'}, {U'\x69', U'\x328', U'\x12F'},
+      {U'\x69', U'\x330', U'\x1E2D'}, {U'\x6A', U'\x302', U'\x135'},
+      {U'\x6A', U'\x30C', U'\x1F0'}, {U'\x6B', U'\x301', U'\x1E31'},
+      {U'\x6B', U'\x30C', U'\x1E9'}, {U'\x6B', U'\x323', U'\x1E33'},
+      {U'\x6B', U'\x327', U'\x137'}, {U'\x6B', U'\x331', U'\x1E35'},
+      {U'\x6C', U'\x301', U'\x13A'}, {U'\x6C', U'\x30C', U'\x13E'},
+      {U'\x6C', U'\x323', U'\x1E37'}, {U'\x6C', U'\x327', U'\x13C'},
+      {U'\x6C', U'\x32D', U'\x1E3D'}, {U'\x6C', U'\x331', U'\x1E3B'},
+      {U'\x6D', U'\x301', U'\x1E3F'}, {U'\x6D', U'\x307', U'\x1E41'},
+      {U'\x6D', U'\x323', U'\x1E43'}, {U'\x6E', U'\x300', U'\x1F9'},
+      {U'\x6E', U'\x301', U'\x144'}, {U'\x6E', U'\x303', U'\xF1'},
+      {U'\x6E', U'\x307', U'\x1E45'}, {U'\x6E', U'\x30C', U'\x148'},
+      {U'\x6E', U'\x323', U'\x1E47'}, {U'\x6E', U'\x327', U'\x146'},
+      {U'\x6E', U'\x32D', U'\x1E4B'}, {U'\x6E', U'\x331', U'\x1E49'},
+      {U'\x6F', U'\x300', U'\xF2'}, {U'\x6F', U'\x301', U'\xF3'},
+      {U'\x6F', U'\x302', U'\xF4'}, {U'\x6F', U'\x303', U'\xF5'},
+      {U'\x6F', U'\x304', U'\x14D'}, {U'\x6F', U'\x306', U'\x14F'},
+      {U'\x6F', U'\x307', U'\x22F'}, {U'\x6F', U'\x308', U'\xF6'},
+      {U'\x6F', U'\x309', U'\x1ECF'}, {U'\x6F', U'\x30B', U'\x151'},
+      {U'\x6F', U'\x30C', U'\x1D2'}, {U'\x6F', U'\x30F', U'\x20D'},
+      {U'\x6F', U'\x311', U'\x20F'}, {U'\x6F', U'\x31B', U'\x1A1'},
+      {U'\x6F', U'\x323', U'\x1ECD'}, {U'\x6F', U'\x328', U'\x1EB'},
+      {U'\x70', U'\x301', U'\x1E55'}, {U'\x70', U'\x307', U'\x1E57'},
+      {U'\x72', U'\x301', U'\x155'}, {U'\x72', U'\x307', U'\x1E59'},
+      {U'\x72', U'\x30C', U'\x159'}, {U'\x72', U'\x30F', U'\x211'},
+      {U'\x72', U'\x311', U'\x213'}, {U'\x72', U'\x323', U'\x1E5B'},
+      {U'\x72', U'\x327', U'\x157'}, {U'\x72', U'\x331', U'\x1E5F'},
+      {U'\x73', U'\x301', U'\x15B'}, {U'\x73', U'\x302', U'\x15D'},
+      {U'\x73', U'\x307', U'\x1E61'}, {U'\x73', U'\x30C', U'\x161'},
+      {U'\x73', U'\x323', U'\x1E63'}, {U'\x73', U'\x326', U'\x219'},
+      {U'\x73', U'\x327', U'\x15F'}, {U'\x74', U'\x307', U'\x1E6B'},
+      {U'\x74', U'\x308', U'\x1E97'}, {U'\x74', U'\x30C', U'\x165'},
+      {U'\x74', U'\x323', U'\x1E6D'}, {U'\x74', U'\x326', U'\x21B'},
+      {U'\x74', U'\x327', U'\x163'}, {U'\x74', U'\x32D', U'\x1E71'},
+      {U'\x74', U'\x331', U'\x1E6F'}, {U'\x75', U'\x300', U'\xF9'},
+      {U'\x75', U'\x301', U'\xFA'}, {U'\x75', U'\x302', U'\xFB'},
+      {U'\x75', U'\x303', U'\x169'}, {U'\x75', U'\x304', U'\x16B'},
+      {U'\x75', U'\x306', U'\x16D'}, {U'\x75', U'\x308', U'\xFC'},
+      {U'\x75', U'\x309', U'\x1EE7'}, {U'\x75', U'\x30A', U'\x16F'},
+      {U'\x75', U'\x30B', U'\x171'}, {U'\x75', U'\x30C', U'\x1D4'},
+      {U'\x75', U'\x30F', U'\x215'}, {U'\x75', U'\x311', U'\x217'},
+      {U'\x75', U'\x31B', U'\x1B0'}, {U'\x75', U'\x323', U'\x1EE5'},
+      {U'\x75', U'\x324', U'\x1E73'}, {U'\x75', U'\x328', U'\x173'},
+      {U'\x75', U'\x32D', U'\x1E77'}, {U'\x75', U'\x330', U'\x1E75'},
+      {U'\x76', U'\x303', U'\x1E7D'}, {U'\x76', U'\x323', U'\x1E7F'},
+      {U'\x77', U'\x300', U'\x1E81'}, {U'\x77', U'\x301', U'\x1E83'},
+      {U'\x77', U'\x302', U'\x175'}, {U'\x77', U'\x307', U'\x1E87'},
+      {U'\x77', U'\x308', U'\x1E85'}, {U'\x77', U'\x30A', U'\x1E98'},
+      {U'\x77', U'\x323', U'\x1E89'}, {U'\x78', U'\x307', U'\x1E8B'},
+      {U'\x78', U'\x308', U'\x1E8D'}, {U'\x79', U'\x300', U'\x1EF3'},
+      {U'\x79', U'\x301', U'\xFD'}, {U'\x79', U'\x302', U'\x177'},
+      {U'\x79', U'\x303', U'\x1EF9'}, {U'\x79', U'\x304', U'\x233'},
+      {U'\x79', U'\x307', U'\x1E8F'}, {U'\x79', U'\x308', U'\xFF'},
+      {U'\x79', U'\x309', U'\x1EF7'}, {U'\x79', U'\x30A', U'\x1E99'},
+      {U'\x79', U'\x323', U'\x1EF5'}, {U'\x7A', U'\x301', U'\x17A'},
+      {U'\x7A', U'\x302', U'\x1E91'}, {U'\x7A', U'\x307', U'\x17C'},
+      {U'\x7A', U'\x30C', U'\x17E'}, {U'\x7A', U'\x323', U'\x1E93'},
+      {U'\x7A', U'\x331', U'\x1E95'}, {U'\xA8', U'\x300', U'\x1FED'},
+      {U'\xA8', U'\x301', U'\x385'}, {U'\xA8', U'\x342', U'\x1FC1'},
+      {U'\xC2', U'\x300', U'\x1EA6'}, {U'\xC2', U'\x301', U'\x1EA4'},
+      {U'\xC2', U'\x303', U'\x1EAA'}, {U'\xC2', U'\x309', U'\x1EA8'},
+      {U'\xC4', U'\x304', U'\x1DE'}, {U'\xC5', U'\x301', U'\x1FA'},
+      {U'\xC6', U'\x301', U'\x1FC'}, {U'\xC6', U'\x304', U'\x1E2'},
+      {U'\xC7', U'\x301', U'\x1E08'}, {U'\xCA', U'\x300', U'\x1EC0'},
+      {U'\xCA', U'\x301', U'\x1EBE'}, {U'\xCA', U'\x303', U'\x1EC4'},
+      {U'\xCA', U'\x309', U'\x1EC2'}, {U'\xCF', U'\x301', U'\x1E2E'},
+      {U'\xD4', U'\x300', U'\x1ED2'}, {U'\xD4', U'\x301', U'\x1ED0'},
+      {U'\xD4', U'\x303', U'\x1ED6'}, {U'\xD4', U'\x309', U'\x1ED4'},
+      {U'\xD5', U'\x301', U'\x1E4C'}, {U'\xD5', U'\x304', U'\x22C'},
+      {U'\xD5', U'\x308', U'\x1E4E'}, {U'\xD6', U'\x304', U'\x22A'},
+      {U'\xD8', U'\x301', U'\x1FE'}, {U'\xDC', U'\x300', U'\x1DB'},
+      {U'\xDC', U'\x301', U'\x1D7'}, {U'\xDC', U'\x304', U'\x1D5'},
+      {U'\xDC', U'\x30C', U'\x1D9'}, {U'\xE2', U'\x300', U'\x1EA7'},
+      {U'\xE2', U'\x301', U'\x1EA5'}, {U'\xE2', U'\x303', U'\x1EAB'},
+      {U'\xE2', U'\x309', U'\x1EA9'}, {U'\xE4', U'\x304', U'\x1DF'},
+      {U'\xE5', U'\x301', U'\x1FB'}, {U'\xE6', U'\x301', U'\x1FD'},
+      {U'\xE6', U'\x304', U'\x1E3'}, {U'\xE7', U'\x301', U'\x1E09'},
+      {U'\xEA', U'\x300', U'\x1EC1'}, {U'\xEA', U'\x301', U'\x1EBF'},
+      {U'\xEA', U'\x303', U'\x1EC5'}, {U'\xEA', U'\x309', U'\x1EC3'},
+      {U'\xEF', U'\x301', U'\x1E2F'}, {U'\xF4', U'\x300', U'\x1ED3'},
+      {U'\xF4', U'\x301', U'\x1ED1'}, {U'\xF4', U'\x303', U'\x1ED7'},
+      {U'\xF4', U'\x309', U'\x1ED5'}, {U'\xF5', U'\x301', U'\x1E4D'},
+      {U'\xF5', U'\x304', U'\x22D'}, {U'\xF5', U'\x308', U'\x1E4F'},
+      {U'\xF6', U'\x304', U'\x22B'}, {U'\xF8', U'\x301', U'\x1FF'},
+      {U'\xFC', U'\x300', U'\x1DC'}, {U'\xFC', U'\x301', U'\x1D8'},
+      {U'\xFC', U'\x304', U'\x1D6'}, {U'\xFC', U'\x30C', U'\x1DA'},
+      {U'\x102', U'\x300', U'\x1EB0'}, {U'\x102', U'\x301', U'\x1EAE'},
+      {U'\x102', U'\x303', U'\x1EB4'}, {U'\x102', U'\x309', U'\x1EB2'},
+      {U'\x103', U'\x300', U'\x1EB1'}, {U'\x103', U'\x301', U'\x1EAF'},
+      {U'\x103', U'\x303', U'\x1EB5'}, {U'\x103', U'\x309', U'\x1EB3'},
+      {U'\x112', U'\x300', U'\x1E14'}, {U'\x112', U'\x301', U'\x1E16'},
+      {U'\x113', U'\x300', U'\x1E15'}, {U'\x113', U'\x301', U'\x1E17'},
+      {U'\x14C', U'\x300', U'\x1E50'}, {U'\x14C', U'\x301', U'\x1E52'},
+      {U'\x14D', U'\x300', U'\x1E51'}, {U'\x14D', U'\x301', U'\x1E53'},
+      {U'\x15A', U'\x307', U'\x1E64'}, {U'\x15B', U'\x307', U'\x1E65'},
+      {U'\x160', U'\x307', U'\x1E66'}, {U'\x161', U'\x307', U'\x1E67'},
+      {U'\x168', U'\x301', U'\x1E78'}, {U'\x169', U'\x301', U'\x1E79'},
+      {U'\x16A', U'\x308', U'\x1E7A'}, {U'\x16B', U'\x308', U'\x1E7B'},
+      {U'\x17F', U'\x307', U'\x1E9B'}, {U'\x1A0', U'\x300', U'\x1EDC'},
+      {U'\x1A0', U'\x301', U'\x1EDA'}, {U'\x1A0', U'\x303', U'\x1EE0'},
+      {U'\x1A0', U'\x309', U'\x1EDE'}, {U'\x1A0', U'\x323', U'\x1EE2'},
+      {U'\x1A1', U'\x300', U'\x1EDD'}, {U'\x1A1', U'\x301', U'\x1EDB'},
+      {U'\x1A1', U'\x303', U'\x1EE1'}, {U'\x1A1', U'\x309', U'\x1EDF'},
+      {U'\x1A1', U'\x323', U'\x1EE3'}, {U'\x1AF', U'\x300', U'\x1EEA'},
+      {U'\x1AF', U'\x301', U'\x1EE8'}, {U'\x1AF', U'\x303', U'\x1EEE'},
+      {U'\x1AF', U'\x309', U'\x1EEC'}, {U'\x1AF', U'\x323', U'\x1EF0'},
+      {U'\x1B0', U'\x300', U'\x1EEB'}, {U'\x1B0', U'\x301', U'\x1EE9'},
+      {U'\x1B0', U'\x303', U'\x1EEF'}, {U'\x1B0', U'\x309', U'\x1EED'},
+      {U'\x1B0', U'\x323', U'\x1EF1'}, {U'\x1B7', U'\x30C', U'\x1EE'},
+      {U'\x1EA', U'\x304', U'\x1EC'}, {U'\x1EB', U'\x304', U'\x1ED'},
+      {U'\x226', U'\x304', U'\x1E0'}, {U'\x227', U'\x304', U'\x1E1'},
+      {U'\x228', U'\x306', U'\x1E1C'}, {U'\x229', U'\x306', U'\x1E1D'},
+      {U'\x22E', U'\x304', U'\x230'}, {U'\x22F', U'\x304', U'\x231'},
+      {U'\x292', U'\x30C', U'\x1EF'}, {U'\x391', U'\x300', U'\x1FBA'},
+      {U'\x391', U'\x301', U'\x386'}, {U'\x391', U'\x304', U'\x1FB9'},
+      {U'\x391', U'\x306', U'\x1FB8'}, {U'\x391', U'\x313', U'\x1F08'},
+      {U'\x391', U'\x314', U'\x1F09'}, {U'\x391', U'\x345', U'\x1FBC'},
+      {U'\x395', U'\x300', U'\x1FC8'}, {U'\x395', U'\x301', U'\x388'},
+      {U'\x395', U'\x313', U'\x1F18'}, {U'\x395', U'\x314', U'\x1F19'},
+      {U'\x397', U'\x300', U'\x1FCA'}, {U'\x397', U'\x301', U'\x389'},
+      {U'\x397', U'\x313', U'\x1F28'}, {U'\x397', U'\x314', U'\x1F29'},
+      {U'\x397', U'\x345', U'\x1FCC'}, {U'\x399', U'\x300', U'\x1FDA'},
+      {U'\x399', U'\x301', U'\x38A'}, {U'\x399', U'\x304', U'\x1FD9'},
+      {U'\x399', U'\x306', U'\x1FD8'}, {U'\x399', U'\x308', U'\x3AA'},
+      {U'\x399', U'\x313', U'\x1F38'}, {U'\x399', U'\x314', U'\x1F39'},
+      {U'\x39F', U'\x300', U'\x1FF8'}, {U'\x39F', U'\x301', U'\x38C'},
+      {U'\x39F', U'\x313', U'\x1F48'}, {U'\x39F', U'\x314', U'\x1F49'},
+      {U'\x3A1', U'\x314', U'\x1FEC'}, {U'\x3A5', U'\x300', U'\x1FEA'},
+      {U'\x3A5', U'\x301', U'\x38E'}, {U'\x3A5', U'\x304', U'\x1FE9'},
+      {U'\x3A5', U'\x306', U'\x1FE8'}, {U'\x3A5', U'\x308', U'\x3AB'},
+      {U'\x3A5', U'\x314', U'\x1F59'}, {U'\x3A9', U'\x300', U'\x1FFA'},
+      {U'\x3A9', U'\x301', U'\x38F'}, {U'\x3A9', U'\x313', U'\x1F68'},
+      {U'\x3A9', U'\x314', U'\x1F69'}, {U'\x3A9', U'\x345', U'\x1FFC'},
+      {U'\x3AC', U'\x345', U'\x1FB4'}, {U'\x3AE', U'\x345', U'\x1FC4'},
+      {U'\x3B1', U'\x300', U'\x1F70'}, {U'\x3B1', U'\x301', U'\x3AC'},
+      {U'\x3B1', U'\x304', U'\x1FB1'}, {U'\x3B1', U'\x306', U'\x1FB0'},
+      {U'\x3B1', U'\x313', U'\x1F00'}, {U'\x3B1', U'\x314', U'\x1F01'},
+      {U'\x3B1', U'\x342', U'\x1FB6'}, {U'\x3B1', U'\x345', U'\x1FB3'},
+      {U'\x3B5', U'\x300', U'\x1F72'}, {U'\x3B5', U'\x301', U'\x3AD'},
+      {U'\x3B5', U'\x313', U'\x1F10'}, {U'\x3B5', U'\x314', U'\x1F11'},
+      {U'\x3B7', U'\x300', U'\x1F74'}, {U'\x3B7', U'\x301', U'\x3AE'},
+      {U'\x3B7', U'\x313', U'\x1F20'}, {U'\x3B7', U'\x314', U'\x1F21'},
+      {U'\x3B7', U'\x342', U'\x1FC6'}, {U'\x3B7', U'\x345', U'\x1FC3'},
+      {U'\x3B9', U'\x300', U'\x1F76'}, {U'\x3B9', U'\x301', U'\x3AF'},
+      {U'\x3B9', U'\x304', U'\x1FD1'}, {U'\x3B9', U'\x306', U'\x1FD0'},
+      {U'\x3B9', U'\x308', U'\x3CA'}, {U'\x3B9', U'\x313', U'\x1F30'},
+      {U'\x3B9', U'\x314', U'\x1F31'}, {U'\x3B9', U'\x342', U'\x1FD6'},
+      {U'\x3BF', U'\x300', U'\x1F78'}, {U'\x3BF', U'\x301', U'\x3CC'},
+      {U'\x3BF', U'\x313', U'\x1F40'}, {U'\x3BF', U'\x314', U'\x1F41'},
+      {U'\x3C1', U'\x313', U'\x1FE4'}, {U'\x3C1', U'\x314', U'\x1FE5'},
+      {U'\x3C5', U'\x300', U'\x1F7A'}, {U'\x3C5', U'\x301', U'\x3CD'},
+      {U'\x3C5', U'\x304', U'\x1FE1'}, {U'\x3C5', U'\x306', U'\x1FE0'},
+      {U'\x3C5', U'\x308', U'\x3CB'}, {U'\x3C5', U'\x313', U'\x1F50'},
+      {U'\x3C5', U'\x314', U'\x1F51'}, {U'\x3C5', U'\x342', U'\x1FE6'},
+      {U'\x3C9', U'\x300', U'\x1F7C'}, {U'\x3C9', U'\x301', U'\x3CE'},
+      {U'\x3C9', U'\x313', U'\x1F60'}, {U'\x3C9', U'\x314', U'\x1F61'},
+      {U'\x3C9', U'\x342', U'\x1FF6'}, {U'\x3C9', U'\x345', U'\x1FF3'},
+      {U'\x3CA', U'\x300', U'\x1FD2'}, {U'\x3CA', U'\x301', U'\x390'},
+      {U'\x3CA', U'\x342', U'\x1FD7'}, {U'\x3CB', U'\x300', U'\x1FE2'},
+      {U'\x3CB', U'\x301', U'\x3B0'}, {U'\x3CB', U'\x342', U'\x1FE7'},
+      {U'\x3CE', U'\x345', U'\x1FF4'}, {U'\x3D2', U'\x301', U'\x3D3'},
+      {U'\x3D2', U'\x308', U'\x3D4'}, {U'\x406', U'\x308', U'\x407'},
+      {U'\x410', U'\x306', U'\x4D0'}, {U'\x410', U'\x308', U'\x4D2'},
+      {U'\x413', U'\x301', U'\x403'}, {U'\x415', U'\x300', U'\x400'},
+      {U'\x415', U'\x306', U'\x4D6'}, {U'\x415', U'\x308', U'\x401'},
+      {U'\x416', U'\x306', U'\x4C1'}, {U'\x416', U'\x308', U'\x4DC'},
+      {U'\x417', U'\x308', U'\x4DE'}, {U'\x418', U'\x300', U'\x40D'},
+      {U'\x418', U'\x304', U'\x4E2'}, {U'\x418', U'\x306', U'\x419'},
+      {U'\x418', U'\x308', U'\x4E4'}, {U'\x41A', U'\x301', U'\x40C'},
+      {U'\x41E', U'\x308', U'\x4E6'}, {U'\x423', U'\x304', U'\x4EE'},
+      {U'\x423', U'\x306', U'\x40E'}, {U'\x423', U'\x308', U'\x4F0'},
+      {U'\x423', U'\x30B', U'\x4F2'}, {U'\x427', U'\x308', U'\x4F4'},
+      {U'\x42B', U'\x308', U'\x4F8'}, {U'\x42D', U'\x308', U'\x4EC'},
+      {U'\x430', U'\x306', U'\x4D1'}, {U'\x430', U'\x308', U'\x4D3'},
+      {U'\x433', U'\x301', U'\x453'}, {U'\x435', U'\x300', U'\x450'},
+      {U'\x435', U'\x306', U'\x4D7'}, {U'\x435', U'\x308', U'\x451'},
+      {U'\x436', U'\x306', U'\x4C2'}, {U'\x436', U'\x308', U'\x4DD'},
+      {U'\x437', U'\x308', U'\x4DF'}, {U'\x438', U'\x300', U'\x45D'},
+      {U'\x438', U'\x304', U'\x4E3'}, {U'\x438', U'\x306', U'\x439'},
+      {U'\x438', U'\x308', U'\x4E5'}, {U'\x43A', U'\x301', U'\x45C'},
+      {U'\x43E', U'\x308', U'\x4E7'}, {U'\x443', U'\x304', U'\x4EF'},
+      {U'\x443', U'\x306', U'\x45E'}, {U'\x443', U'\x308', U'\x4F1'},
+      {U'\x443', U'\x30B', U'\x4F3'}, {U'\x447', U'\x308', U'\x4F5'},
+      {U'\x44B', U'\x308', U'\x4F9'}, {U'\x44D', U'\x308', U'\x4ED'},
+      {U'\x456', U'\x308', U'\x457'}, {U'\x474', U'\x30F', U'\x476'},
+      {U'\x475', U'\x30F', U'\x477'}, {U'\x4D8', U'\x308', U'\x4DA'},
+      {U'\x4D9', U'\x308', U'\x4DB'}, {U'\x4E8', U'\x308', U'\x4EA'},
+      {U'\x4E9', U'\x308', U'\x4EB'}, {U'\x627', U'\x653', U'\x622'},
+      {U'\x627', U'\x654', U'\x623'}, {U'\x627', U'\x655', U'\x625'},
+      {U'\x648', U'\x654', U'\x624'}, {U'\x64A', U'\x654', U'\x626'},
+      {U'\x6C1', U'\x654', U'\x6C2'}, {U'\x6D2', U'\x654', U'\x6D3'},
+      {U'\x6D5', U'\x654', U'\x6C0'}, {U'\x928', U'\x93C', U'\x929'},
+      {U'\x930', U'\x93C', U'\x931'}, {U'\x933', U'\x93C', U'\x934'},
+      {U'\x9C7', U'\x9BE', U'\x9CB'}, {U'\x9C7', U'\x9D7', U'\x9CC'},
+      {U'\xB47', U'\xB3E', U'\xB4B'}, {U'\xB47', U'\xB56', U'\xB48'},
+      {U'\xB47', U'\xB57', U'\xB4C'}, {U'\xB92', U'\xBD7', U'\xB94'},
+      {U'\xBC6', U'\xBBE', U'\xBCA'}, {U'\xBC6', U'\xBD7', U'\xBCC'},
+      {U'\xBC7', U'\xBBE', U'\xBCB'}, {U'\xC46', U'\xC56', U'\xC48'},
+      {U'\xCBF', U'\xCD5', U'\xCC0'}, {U'\xCC6', U'\xCC2', U'\xCCA'},
+      {U'\xCC6', U'\xCD5', U'\xCC7'}, {U'\xCC6', U'\xCD6', U'\xCC8'},
+      {U'\xCCA', U'\xCD5', U'\xCCB'}, {U'\xD46', U'\xD3E', U'\xD4A'},
+      {U'\xD46', U'\xD57', U'\xD4C'}, {U'\xD47', U'\xD3E', U'\xD4B'},
+      {U'\xDD9', U'\xDCA', U'\xDDA'}, {U'\xDD9', U'\xDCF', U'\xDDC'},
+      {U'\xDD9', U'\xDDF', U'\xDDE'}, {U'\xDDC', U'\xDCA', U'\xDDD'},
+      {U'\x1025', U'\x102E', U'\x1026'}, {U'\x1B05', U'\x1B35', U'\x1B06'},
+      {U'\x1B07', U'\x1B35', U'\x1B08'}, {U'\x1B09', U'\x1B35', U'\x1B0A'},
+      {U'\x1B0B', U'\x1B35', U'\x1B0C'}, {U'\x1B0D', U'\x1B35', U'\x1B0E'},
+      {U'\x1B11', U'\x1B35', U'\x1B12'}, {U'\x1B3A', U'\x1B35', U'\x1B3B'},
+      {U'\x1B3C', U'\x1B35', U'\x1B3D'}, {U'\x1B3E', U'\x1B35', U'\x1B40'},
+      {U'\x1B3F', U'\x1B35', U'\x1B41'}, {U'\x1B42', U'\x1B35', U'\x1B43'},
+      {U'\x1E36', U'\x304', U'\x1E38'}, {U'\x1E37', U'\x304', U'\x1E39'},
+      {U'\x1E5A', U'\x304', U'\x1E5C'}, {U'\x1E5B', U'\x304', U'\x1E5D'},
+      {U'\x1E62', U'\x307', U'\x1E68'}, {U'\x1E63', U'\x307', U'\x1E69'},
+      {U'\x1EA0', U'\x302', U'\x1EAC'}, {U'\x1EA0', U'\x306', U'\x1EB6'},
+      {U'\x1EA1', U'\x302', U'\x1EAD'}, {U'\x1EA1', U'\x306', U'\x1EB7'},
+      {U'\x1EB8', U'\x302', U'\x1EC6'}, {U'\x1EB9', U'\x302', U'\x1EC7'},
+      {U'\x1ECC', U'\x302', U'\x1ED8'}, {U'\x1ECD', U'\x302', U'\x1ED9'},
+      {U'\x1F00', U'\x300', U'\x1F02'}, {U'\x1F00', U'\x301', U'\x1F04'},
+      {U'\x1F00', U'\x342', U'\x1F06'}, {U'\x1F00', U'\x345', U'\x1F80'},
+      {U'\x1F01', U'\x300', U'\x1F03'}, {U'\x1F01', U'\x301', U'\x1F05'},
+      {U'\x1F01', U'\x342', U'\x1F07'}, {U'\x1F01', U'\x345', U'\x1F81'},
+      {U'\x1F02', U'\x345', U'\x1F82'}, {U'\x1F03', U'\x345', U'\x1F83'},
+      {U'\x1F04', U'\x345', U'\x1F84'}, {U'\x1F05', U'\x345', U'\x1F85'},
+      {U'\x1F06', U'\x345', U'\x1F86'}, {U'\x1F07', U'\x345', U'\x1F87'},
+      {U'\x1F08', U'\x300', U'\x1F0A'}, {U'\x1F08', U'\x301', U'\x1F0C'},
+      {U'\x1F08', U'\x342', U'\x1F0E'}, {U'\x1F08', U'\x345', U'\x1F88'},
+      {U'\x1F09', U'\x300', U'\x1F0B'}, {U'\x1F09', U'\x301', U'\x1F0D'},
+      {U'\x1F09', U'\x342', U'\x1F0F'}, {U'\x1F09', U'\x345', U'\x1F89'},
+      {U'\x1F0A', U'\x345', U'\x1F8A'}, {U'\x1F0B', U'\x345', U'\x1F8B'},
+      {U'\x1F0C', U'\x345', U'\x1F8C'}, {U'\x1F0D', U'\x345', U'\x1F8D'},
+      {U'\x1F0E', U'\x345', U'\x1F8E'}, {U'\x1F0F', U'\x345', U'\x1F8F'},
+      {U'\x1F10', U'\x300', U'\x1F12'}, {U'\x1F10', U'\x301', U'\x1F14'},
+      {U'\x1F11', U'\x300', U'\x1F13'}, {U'\x1F11', U'\x301', U'\x1F15'},
+      {U'\x1F18', U'\x300', U'\x1F1A'}, {U'\x1F18', U'\x301', U'\x1F1C'},
+      {U'\x1F19', U'\x300', U'\x1F1B'}, {U'\x1F19', U'\x301', U'\x1F1D'},
+      {U'\x1F20', U'\x300', U'\x1F22'}, {U'\x1F20', U'\x301', U'\x1F24'},
+      {U'\x1F20', U'\x342', U'\x1F26'}, {U'\x1F20', U'\x345', U'\x1F90'},
+      {U'\x1F21', U'\x300', U'\x1F23'}, {U'\x1F21', U'\x301', U'\x1F25'},
+      {U'\x1F21', U'\x342', U'\x1F27'}, {U'\x1F21', U'\x345', U'\x1F91'},
+      {U'\x1F22', U'\x345', U'\x1F92'}, {U'\x1F23', U'\x345', U'\x1F93'},
+      {U'\x1F24', U'\x345', U'\x1F94'}, {U'\x1F25', U'\x345', U'\x1F95'},
+      {U'\x1F26', U'\x345', U'\x1F96'}, {U'\x1F27', U'\x345', U'\x1F97'},
+      {U'\x1F28', U'\x300', U'\x1F2A'}, {U'\x1F28', U'\x301', U'\x1F2C'},
+      {U'\x1F28', U'\x342', U'\x1F2E'}, {U'\x1F28', U'\x345', U'\x1F98'},
+      {U'\x1F29', U'\x300', U'\x1F2B'}, {U'\x1F29', U'\x301', U'\x1F2D'},
+      {U'\x1F29', U'\x342', U'\x1F2F'}, {U'\x1F29', U'\x345', U'\x1F99'},
+      {U'\x1F2A', U'\x345', U'\x1F9A'}, {U'\x1F2B', U'\x345', U'\x1F9B'},
+      {U'\x1F2C', U'\x345', U'\x1F9C'}, {U'\x1F2D', U'\x345', U'\x1F9D'},
+      {U'\x1F2E', U'\x345', U'\x1F9E'}, {U'\x1F2F', U'\x345', U'\x1F9F'},
+      {U'\x1F30', U'\x300', U'\x1F32'}, {U'\x1F30', U'\x301', U'\x1F34'},
+      {U'\x1F30', U'\x342', U'\x1F36'}, {U'\x1F31', U'\x300', U'\x1F33'},
+      {U'\x1F31', U'\x301', U'\x1F35'}, {U'\x1F31', U'\x342', U'\x1F37'},
+      {U'\x1F38', U'\x300', U'\x1F3A'}, {U'\x1F38', U'\x301', U'\x1F3C'},
+      {U'\x1F38', U'\x342', U'\x1F3E'}, {U'\x1F39', U'\x300', U'\x1F3B'},
+      {U'\x1F39', U'\x301', U'\x1F3D'}, {U'\x1F39', U'\x342', U'\x1F3F'},
+      {U'\x1F40', U'\x300', U'\x1F42'}, {U'\x1F40', U'\x301', U'\x1F44'},
+      {U'\x1F41', U'\x300', U'\x1F43'}, {U'\x1F41', U'\x301', U'\x1F45'},
+      {U'\x1F48', U'\x300', U'\x1F4A'}, {U'\x1F48', U'\x301', U'\x1F4C'},
+      {U'\x1F49', U'\x300', U'\x1F4B'}, {U'\x1F49', U'\x301', U'\x1F4D'},
+      {U'\x1F50', U'\x300', U'\x1F52'}, {U'\x1F50', U'\x301', U'\x1F54'},
+      {U'\x1F50', U'\x342', U'\x1F56'}, {U'\x1F51', U'\x300', U'\x1F53'},
+      {U'\x1F51', U'\x301', U'\x1F55'}, {U'\x1F51', U'\x342', U'\x1F57'},
+      {U'\x1F59', U'\x300', U'\x1F5B'}, {U'\x1F59', U'\x301', U'\x1F5D'},
+      {U'\x1F59', U'\x342', U'\x1F5F'}, {U'\x1F60', U'\x300', U'\x1F62'},
+      {U'\x1F60', U'\x301', U'\x1F64'}, {U'\x1F60', U'\x342', U'\x1F66'},
+      {U'\x1F60', U'\x345', U'\x1FA0'}, {U'\x1F61', U'\x300', U'\x1F63'},
+      {U'\x1F61', U'\x301', U'\x1F65'}, {U'\x1F61', U'\x342', U'\x1F67'},
+      {U'\x1F61', U'\x345', U'\x1FA1'}, {U'\x1F62', U'\x345', U'\x1FA2'},
+      {U'\x1F63', U'\x345', U'\x1FA3'}, {U'\x1F64', U'\x345', U'\x1FA4'},
+      {U'\x1F65', U'\x345', U'\x1FA5'}, {U'\x1F66', U'\x345', U'\x1FA6'},
+      {U'\x1F67', U'\x345', U'\x1FA7'}, {U'\x1F68', U'\x300', U'\x1F6A'},
+      {U'\x1F68', U'\x301', U'\x1F6C'}, {U'\x1F68', U'\x342', U'\x1F6E'},
+      {U'\x1F68', U'\x345', U'\x1FA8'}, {U'\x1F69', U'\x300', U'\x1F6B'},
+      {U'\x1F69', U'\x301', U'\x1F6D'}, {U'\x1F69', U'\x342', U'\x1F6F'},
+      {U'\x1F69', U'\x345', U'\x1FA9'}, {U'\x1F6A', U'\x345', U'\x1FAA'},
+      {U'\x1F6B', U'\x345', U'\x1FAB'}, {U'\x1F6C', U'\x345', U'\x1FAC'},
+      {U'\x1F6D', U'\x345', U'\x1FAD'}, {U'\x1F6E', U'\x345', U'\x1FAE'},
+      {U'\x1F6F', U'\x345', U'\x1FAF'}, {U'\x1F70', U'\x345', U'\x1FB2'},
+      {U'\x1F74', U'\x345', U'\x1FC2'}, {U'\x1F7C', U'\x345', U'\x1FF2'},
+      {U'\x1FB6', U'\x345', U'\x1FB7'}, {U'\x1FBF', U'\x300', U'\x1FCD'},
+      {U'\x1FBF', U'\x301', U'\x1FCE'}, {U'\x1FBF', U'\x342', U'\x1FCF'},
+      {U'\x1FC6', U'\x345', U'\x1FC7'}, {U'\x1FF6', U'\x345', U'\x1FF7'},
+      {U'\x1FFE', U'\x300', U'\x1FDD'}, {U'\x1FFE', U'\x301', U'\x1FDE'},
+      {U'\x1FFE', U'\x342', U'\x1FDF'}, {U'\x2190', U'\x338', U'\x219A'},
+      {U'\x2192', U'\x338', U'\x219B'}, {U'\x2194', U'\x338', U'\x21AE'},
+      {U'\x21D0', U'\x338', U'\x21CD'}, {U'\x21D2', U'\x338', U'\x21CF'},
+      {U'\x21D4', U'\x338', U'\x21CE'}, {U'\x2203', U'\x338', U'\x2204'},
+      {U'\x2208', U'\x338', U'\x2209'}, {U'\x220B', U'\x338', U'\x220C'},
+      {U'\x2223', U'\x338', U'\x2224'}, {U'\x2225', U'\x338', U'\x2226'},
+      {U'\x223C', U'\x338', U'\x2241'}, {U'\x2243', U'\x338', U'\x2244'},
+      {U'\x2245', U'\x338', U'\x2247'}, {U'\x2248', U'\x338', U'\x2249'},
+      {U'\x224D', U'\x338', U'\x226D'}, {U'\x2261', U'\x338', U'\x2262'},
+      {U'\x2264', U'\x338', U'\x2270'}, {U'\x2265', U'\x338', U'\x2271'},
+      {U'\x2272', U'\x338', U'\x2274'}, {U'\x2273', U'\x338', U'\x2275'},
+      {U'\x2276', U'\x338', U'\x2278'}, {U'\x2277', U'\x338', U'\x2279'},
+      {U'\x227A', U'\x338', U'\x2280'}, {U'\x227B', U'\x338', U'\x2281'},
+      {U'\x227C', U'\x338', U'\x22E0'}, {U'\x227D', U'\x338', U'\x22E1'},
+      {U'\x2282', U'\x338', U'\x2284'}, {U'\x2283', U'\x338', U'\x2285'},
+      {U'\x2286', U'\x338', U'\x2288'}, {U'\x2287', U'\x338', U'\x2289'},
+      {U'\x2291', U'\x338', U'\x22E2'}, {U'\x2292', U'\x338', U'\x22E3'},
+      {U'\x22A2', U'\x338', U'\x22AC'}, {U'\x22A8', U'\x338', U'\x22AD'},
+      {U'\x22A9', U'\x338', U'\x22AE'}, {U'\x22AB', U'\x338', U'\x22AF'},
+      {U'\x22B2', U'\x338', U'\x22EA'}, {U'\x22B3', U'\x338', U'\x22EB'},
+      {U'\x22B4', U'\x338', U'\x22EC'}, {U'\x22B5', U'\x338', U'\x22ED'},
+      {U'\x3046', U'\x3099', U'\x3094'}, {U'\x304B', U'\x3099', U'\x304C'},
+      {U'\x304D', U'\x3099', U'\x304E'}, {U'\x304F', U'\x3099', U'\x3050'},
+      {U'\x3051', U'\x3099', U'\x3052'}, {U'\x3053', U'\x3099', U'\x3054'},
+      {U'\x3055', U'\x3099', U'\x3056'}, {U'\x3057', U'\x3099', U'\x3058'},
+      {U'\x3059', U'\x3099', U'\x305A'}, {U'\x305B', U'\x3099', U'\x305C'},
+      {U'\x305D', U'\x3099', U'\x305E'}, {U'\x305F', U'\x3099', U'\x3060'},
+      {U'\x3061', U'\x3099', U'\x3062'}, {U'\x3064', U'\x3099', U'\x3065'},
+      {U'\x3066', U'\x3099', U'\x3067'}, {U'\x3068', U'\x3099', U'\x3069'},
+      {U'\x306F', U'\x3099', U'\x3070'}, {U'\x306F', U'\x309A', U'\x3071'},
+      {U'\x3072', U'\x3099', U'\x3073'}, {U'\x3072', U'\x309A', U'\x3074'},
+      {U'\x3075', U'\x3099', U'\x3076'}, {U'\x3075', U'\x309A', U'\x3077'},
+      {U'\x3078', U'\x3099', U'\x3079'}, {U'\x3078', U'\x309A', U'\x307A'},
+      {U'\x307B', U'\x3099', U'\x307C'}, {U'\x307B', U'\x309A', U'\x307D'},
+      {U'\x309D', U'\x3099', U'\x309E'}, {U'\x30A6', U'\x3099', U'\x30F4'},
+      {U'\x30AB', U'\x3099', U'\x30AC'}, {U'\x30AD', U'\x3099', U'\x30AE'},
+      {U'\x30AF', U'\x3099', U'\x30B0'}, {U'\x30B1', U'\x3099', U'\x30B2'},
+      {U'\x30B3', U'\x3099', U'\x30B4'}, {U'\x30B5', U'\x3099', U'\x30B6'},
+      {U'\x30B7', U'\x3099', U'\x30B8'}, {U'\x30B9', U'\x3099', U'\x30BA'},
+      {U'\x30BB', U'\x3099', U'\x30BC'}, {U'\x30BD', U'\x3099', U'\x30BE'},
+      {U'\x30BF', U'\x3099', U'\x30C0'}, {U'\x30C1', U'\x3099', U'\x30C2'},
+      {U'\x30C4', U'\x3099', U'\x30C5'}, {U'\x30C6', U'\x3099', U'\x30C7'},
+      {U'\x30C8', U'\x3099', U'\x30C9'}, {U'\x30CF', U'\x3099', U'\x30D0'},
+      {U'\x30CF', U'\x309A', U'\x30D1'}, {U'\x30D2', U'\x3099', U'\x30D3'},
+      {U'\x30D2', U'\x309A', U'\x30D4'}, {U'\x30D5', U'\x3099', U'\x30D6'},
+      {U'\x30D5', U'\x309A', U'\x30D7'}, {U'\x30D8', U'\x3099', U'\x30D9'},
+      {U'\x30D8', U'\x309A', U'\x30DA'}, {U'\x30DB', U'\x3099', U'\x30DC'},
+      {U'\x30DB', U'\x309A', U'\x30DD'}, {U'\x30EF', U'\x3099', U'\x30F7'},
+      {U'\x30F0', U'\x3099', U'\x30F8'}, {U'\x30F1', U'\x3099', U'\x30F9'},
+      {U'\x30F2', U'\x3099', U'\x30FA'}, {U'\x30FD', U'\x3099', U'\x30FE'},
+      {U'\x11099', U'\x110BA', U'\x1109A'}, {U'\x1109B', U'\x110BA', U'\x1109C'},
+      {U'\x110A5', U'\x110BA', U'\x110AB'}, {U'\x11131', U'\x11127', U'\x1112E'},
+      {U'\x11132', U'\x11127', U'\x1112F'}, {U'\x11347', U'\x1133E', U'\x1134B'},
+      {U'\x11347', U'\x11357', U'\x1134C'}, {U'\x114B9', U'\x114B0', U'\x114BC'},
+      {U'\x114B9', U'\x114BA', U'\x114BB'}, {U'\x114B9', U'\x114BD', U'\x114BE'},
+      {U'\x115B8', U'\x115AF', U'\x115BA'}, {U'\x115B9', U'\x115AF', U'\x115BB'},
+      {U'\x11935', U'\x11930', U'\x11938'},
+   }};
+} // namespace lingua::detail_nfc
+
+#endif // LINGUA_LEXER_DETAIL_NFC_TABLE_HPP
@@ -0,0 +1,92 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_DETAIL_SWAR_DIGITS_HPP
+#define LINGUA_LEXER_DETAIL_SWAR_DIGITS_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+// Eight digits are combined in a single 64-bit word, with the first digit in the lowest byte.
+// Each step multiplies every lane by a power of the base and adds in its neighbour, halving the
+// number of lanes: pairs of digits, then groups of four, then all eight. A lane never exceeds the
+// range of the next step's lane, so no lane carries into another.
+namespace lingua::detail_swar_digits {
+   constexpr auto ones = std::uint64_t{0x0101010101010101};
+   constexpr auto high_bits = std::uint64_t{0x8080808080808080};
+
+   /// \brief Reads eight bytes, with the first in the lowest byte of the result.
+   ///
+   [[nodiscard]] inline std::uint64_t load64(char8_t const* const p) noexcept
+   {
+      auto word = std::uint64_t{};
+      std::memcpy(&word, p, sizeof(word));
+      if constexpr (std::endian::native == std::endian::big) {
+         auto swapped = std::uint64_t{0};
+         for (auto i = 0U; i < 8U; ++i) {
+            swapped = (swapped << 8U) | ((word >> (8U * i)) & 0xffU);
+         }
+         word = swapped;
+      }
+      return word;
+   }
+
+   /// \brief Sets the high bit of each byte of `word` that is in [first, last], and clears the
+   ///        others.
+   ///
+   [[nodiscard]] constexpr std::uint64_t
+   in_range(std::uint64_t const word, char8_t const first, char8_t const last) noexcept
+   // [[expects: (word & high_bits) == 0]]
+   {
+      // Neither addition can carry out of a byte, since every byte is below 0x80.
+      auto const at_least_first = word + ones * (0x80U - first);
+      auto const above_last = word + ones * (0x7fU - last);
+      return at_least_first & ~above_last & high_bits;
+   }
+
+   /// \brief Checks if all eight bytes of `word` are digits in base `radix`.
+   ///
+   [[nodiscard]] constexpr bool all_digits(std::uint64_t const word, unsigned const radix) noexcept
+   {
+      if ((word & high_bits) != 0) {
+         return false;
+      }
+
+      if (radix != 16) {
+         return in_range(word, u8'0', static_cast<char8_t>(u8'0' + radix - 1)) == high_bits;
+      }
+
+      auto const lowercase = word | (ones * 0x20U);
+      return (in_range(word, u8'0', u8'9') | in_range(lowercase, u8'a', u8'f')) == high_bits;
+   }
+
+   /// \brief Returns the value of the eight digits in `word`.
+   ///
+   [[nodiscard]] constexpr std::uint64_t
+   combine_digits(std::uint64_t const word, std::uint64_t const radix) noexcept
+   // [[expects: all_digits(word, radix)]]
+   {
+      // '0'-'9' have bit 6 clear and 'A'-'F' and 'a'-'f' have it set, and the low nibble of a
+      // letter is nine less than its value.
+      auto digits = radix == 16 ? (word & (ones * 0x0fU)) + 9 * ((word >> 6U) & ones)
+                                : word - ones * u8'0';
+      digits = (digits * radix + (digits >> 8U)) & 0x00ff00ff00ff00ff;
+      digits = (digits * (radix * radix) + (digits >> 16U)) & 0x0000ffff0000ffff;
+      return (digits * (radix * radix * radix * radix) + (digits >> 32U)) & 0xffffffff;
+   }
+} // namespace lingua::detail_swar_digits
+
+#endif // LINGUA_LEXER_DETAIL_SWAR_DIGITS_HPP
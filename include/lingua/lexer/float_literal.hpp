@@ -0,0 +1,75 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_FLOAT_LITERAL_HPP
+#define LINGUA_LEXER_FLOAT_LITERAL_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace lingua {
+   /// \brief The type that a float literal's suffix names.
+   ///
+   enum class float_type : std::uint8_t {
+      unsuffixed,
+      f32,
+      f64,
+   };
+
+   enum class float_literal_error : std::uint8_t {
+      none,
+      /// \brief An `e` or `E` isn't followed by any digits (e.g. `1e+_`).
+      ///
+      missing_exponent_digits,
+      unknown_suffix,
+      /// \brief The value rounds to infinity in the suffix's type, or in f64 if there's no suffix.
+      ///
+      overflow,
+   };
+
+   /// \brief The value of a float literal, or the first error found while computing it.
+   ///
+   struct float_literal_value {
+      /// \brief The literal's value, correctly rounded to the suffix's type (f64 if there's no
+      ///        suffix). An f32 value is exactly representable as a double, so it's widened
+      ///        without changing it. The value is infinity for float_literal_error::overflow, and
+      ///        unspecified for other errors.
+      ///
+      double value;
+      float_type type;
+      float_literal_error error;
+
+      /// \brief The offset in the literal of the exponent or suffix that `error` refers to.
+      ///
+      std::uint32_t error_offset;
+   };
+
+   /// \brief Computes the correctly rounded value of a decimal float literal.
+   /// \param literal The text of a float_literal token, or of a decimal integer_literal token with
+   ///        an `f32` or `f64` suffix (e.g. `1f32`), including its suffix.
+   ///
+   /// The first nineteen significant digits are gathered into a 64-bit integer, eight at a time
+   /// where no `_` gets in the way. Small values that are exact in the target type are computed
+   /// with a single multiplication or division. Everything else uses the Eisel-Lemire algorithm,
+   /// which rounds a 128-bit product of the digits and a tabulated power of five. When digits
+   /// beyond the nineteenth leave the rounding in doubt, the literal is compared exactly against
+   /// the halfway point between the two candidates using big integers. Nothing depends on the
+   /// locale.
+   ///
+   [[nodiscard]] float_literal_value parse_float_literal(std::u8string_view literal) noexcept;
+   // [[expects: literal is the text of a decimal float_literal or integer_literal token]]
+} // namespace lingua
+
+#endif // LINGUA_LEXER_FLOAT_LITERAL_HPP
@@ -0,0 +1,106 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_INTEGER_LITERAL_HPP
+#define LINGUA_LEXER_INTEGER_LITERAL_HPP
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace lingua {
+   /// \brief The type that an integer literal's suffix names.
+   ///
+   enum class integer_type : std::uint8_t {
+      unsuffixed,
+      u8,
+      u16,
+      u32,
+      u64,
+      u128,
+      usize,
+      i8,
+      i16,
+      i32,
+      i64,
+      i128,
+      isize,
+   };
+
+   /// \brief Returns the suffix that names `type`, or an empty string for integer_type::unsuffixed.
+   ///
+   [[nodiscard]] constexpr std::u8string_view integer_type_name(integer_type const type) noexcept
+   {
+      using namespace std::string_view_literals;
+      constexpr auto names = std::array{u8""sv, u8"u8"sv, u8"u16"sv, u8"u32"sv, u8"u64"sv,
+         u8"u128"sv, u8"usize"sv, u8"i8"sv, u8"i16"sv, u8"i32"sv, u8"i64"sv, u8"i128"sv,
+         u8"isize"sv};
+      return names[static_cast<std::size_t>(type)];
+   }
+
+   /// \brief An unsigned 128-bit integer, stored as two halves since `__int128` isn't standard C++.
+   ///
+   struct uint128 {
+      std::uint64_t low;
+      std::uint64_t high;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(uint128 const&, uint128 const&) noexcept = default;
+   };
+
+   enum class integer_literal_error : std::uint8_t {
+      none,
+      /// \brief A prefix (e.g. `0x`) isn't followed by any digits.
+      ///
+      missing_digits,
+      /// \brief A digit is out of range for the literal's base (e.g. the `2` in `0b102`).
+      ///
+      unknown_digit,
+      unknown_suffix,
+      /// \brief The value doesn't fit in the suffix's type, or in 128 bits if there's no suffix.
+      ///
+      overflow,
+   };
+
+   /// \brief The value of an integer literal, or the first error found while computing it.
+   ///
+   struct integer_literal_value {
+      /// \brief The literal's value. If `error` is integer_literal_error::overflow, this is the
+      ///        value modulo 2^128; it's unspecified for other errors.
+      ///
+      uint128 value;
+      integer_type type;
+      integer_literal_error error;
+
+      /// \brief The offset in the literal of the digit or suffix that `error` refers to.
+      ///
+      std::uint32_t error_offset;
+   };
+
+   /// \brief Computes the value of a decimal, hexadecimal, octal, or binary integer literal.
+   /// \param literal The text of an integer_literal token, including its prefix and suffix.
+   /// \param negated Whether the literal is the operand of a unary `-`, which lets a signed
+   ///        literal reach its type's minimum (e.g. `-128i8`).
+   ///
+   /// Digits are consumed eight at a time wherever eight in a row are free of `_`s: the eight
+   /// bytes are checked and combined into a number with a handful of 64-bit operations, rather than
+   /// eight rounds of multiplying by the base. usize and isize are taken to be 64 bits wide.
+   ///
+   [[nodiscard]] integer_literal_value
+   parse_integer_literal(std::u8string_view literal, bool negated = false) noexcept;
+   // [[expects: literal is the text of an integer_literal token]]
+} // namespace lingua
+
+#endif // LINGUA_LEXER_INTEGER_LITERAL_HPP
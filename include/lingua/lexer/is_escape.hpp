@@ -16,12 +16,64 @@
 #ifndef LINGUA_LEXER_IS_ESCAPE_HPP
 #define LINGUA_LEXER_IS_ESCAPE_HPP
 
+#include <cstdint>
 #include <string_view>
 
 namespace lingua {
    [[nodiscard]] bool is_ascii_escape(std::u8string_view escape) noexcept;
    [[nodiscard]] bool is_byte_escape(std::u8string_view escape) noexcept;
+
+   /// \brief Checks if `escape` is spelt like a Unicode escape: `\u{`, one to six hexadecimal
+   ///        digits, and `}`. Escapes that are spelt correctly but don't name a Unicode scalar
+   ///        value are accepted, and are told apart by decode_unicode_escape.
+   ///
    [[nodiscard]] bool is_unicode_escape(std::u8string_view escape) noexcept;
+
+   enum class unicode_escape_error : std::uint8_t {
+      none,
+      /// \brief `\u` isn't followed by `{`.
+      ///
+      missing_open_brace,
+      /// \brief There's nothing between the braces.
+      ///
+      missing_digits,
+      /// \brief A character between the braces isn't a hexadecimal digit.
+      ///
+      unknown_digit,
+      /// \brief There are more than six digits.
+      ///
+      too_many_digits,
+      /// \brief The digits aren't followed by `}`.
+      ///
+      missing_close_brace,
+      /// \brief The value is from U+D800 to U+DFFF, which are reserved for UTF-16 surrogates.
+      ///
+      surrogate,
+      /// \brief The value is above U+10FFFF.
+      ///
+      out_of_range,
+   };
+
+   /// \brief The value of a Unicode escape, or the first error found while computing it.
+   ///
+   struct decoded_unicode_escape {
+      /// \brief The escape's value. It's a Unicode scalar value if `error` is
+      ///        unicode_escape_error::none, and unspecified for errors other than surrogate and
+      ///        out_of_range.
+      ///
+      char32_t code_point;
+      unicode_escape_error error;
+
+      /// \brief The number of characters read: the whole escape if it's spelt correctly, and
+      ///        otherwise up to and including the character that `error` refers to.
+      ///
+      std::uint32_t length;
+   };
+
+   /// \brief Decodes and validates the Unicode escape at the start of `text` in a single pass.
+   /// \param text Text that starts with `\u`. It may continue past the end of the escape.
+   ///
+   [[nodiscard]] decoded_unicode_escape decode_unicode_escape(std::u8string_view text) noexcept;
 } // namespace lingua
 
 #endif // LINGUA_LEXER_IS_ESCAPE_HPP
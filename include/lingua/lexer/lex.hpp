@@ -0,0 +1,215 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_LEX_HPP
+#define LINGUA_LEXER_LEX_HPP
+
+#include "lingua/lexer/delimiter_table.hpp"
+#include "lingua/lexer/lex_limits.hpp"
+#include "lingua/lexer/lexical_error.hpp"
+#include "lingua/lexer/token.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace lingua {
+   /// \brief The largest source that can be lexed, so that every offset fits in a token.
+   ///
+   inline constexpr auto max_source_size = std::size_t{std::numeric_limits<std::uint32_t>::max()};
+
+   /// \brief The most `#`s that a raw string literal may be delimited by.
+   ///
+   inline constexpr auto max_raw_string_hashes = std::size_t{255};
+
+   /// \brief The furthest past the end of a token that the lexer reads when deciding where the
+   ///        token ends.
+   ///
+   /// Bytes beyond this can't change a token, which is what lets a lexer restart at any token
+   /// boundary that is at least this far in front of an edit.
+   ///
+   inline constexpr auto max_lookahead = max_raw_string_hashes + 3;
+
+   /// \brief What the lexer is in the middle of at a lexer_checkpoint.
+   ///
+   enum class lexer_mode : std::uint8_t {
+      code,
+      string,
+      raw_string,
+      block_comment,
+   };
+
+   /// \brief A snapshot of the lexer's state, from which lexing can resume without looking at
+   ///        anything in front of it.
+   ///
+   /// Between tokens, the lexer has no state beyond its offset. A checkpoint may also fall inside a
+   /// long string or block comment, in which case it records what is needed to carry on scanning
+   /// that token: the number of `#`s that delimit a raw string, or how deeply a comment is nested.
+   ///
+   struct lexer_checkpoint {
+      /// \brief Where scanning resumes.
+      ///
+      std::uint32_t offset = 0;
+
+      /// \brief The index of the token that contains `offset`.
+      ///
+      std::uint32_t token_index = 0;
+
+      /// \brief Where that token starts. Equal to `offset` in lexer_mode::code.
+      ///
+      std::uint32_t token_offset = 0;
+
+      /// \brief The comment's nesting depth, or the number of `#`s that delimit the raw string.
+      ///
+      std::uint32_t state = 0;
+
+      lexer_mode mode = lexer_mode::code;
+
+      /// \brief The kind of the token that contains `offset`, unless in lexer_mode::code.
+      ///
+      token_kind kind = token_kind::whitespace;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(lexer_checkpoint const&, lexer_checkpoint const&) noexcept = default;
+   };
+
+   static_assert(std::is_trivially_copyable_v<lexer_checkpoint>);
+   static_assert(std::is_standard_layout_v<lexer_checkpoint>);
+
+   /// \brief Splits a source into tokens, one at a time.
+   ///
+   /// Every byte of the source belongs to exactly one token, so the tokens are contiguous. Whether
+   /// a token starts at some offset depends only on the bytes after it, so a lexer may start at
+   /// any token boundary and produce the same tokens as one that started at the top of the file.
+   ///
+   class lexer {
+   public:
+      explicit lexer(std::u8string_view const source, std::uint32_t const offset = 0) noexcept
+         : source_{source}
+         , offset_{offset}
+      {}
+      // [[expects: size(source) <= max_source_size]]
+      // [[expects: offset <= size(source)]]
+
+      /// \brief Resumes lexing from `checkpoint`, which make_checkpoints recorded for `source`. If
+      ///        the checkpoint is inside a token, the first call to next returns that whole token.
+      ///
+      explicit lexer(std::u8string_view const source, lexer_checkpoint const& checkpoint) noexcept
+         : source_{source}
+         , offset_{checkpoint.token_offset}
+      {
+         if (checkpoint.mode != lexer_mode::code) {
+            resume_ = checkpoint;
+         }
+      }
+      // [[expects: size(source) <= max_source_size]]
+      // [[expects: checkpoint.offset <= size(source)]]
+
+      /// \brief Checks if every token has been lexed.
+      ///
+      [[nodiscard]] bool done() const noexcept
+      { return offset_ == source_.size(); }
+
+      /// \brief Returns the offset of the next token.
+      ///
+      [[nodiscard]] std::uint32_t offset() const noexcept
+      { return offset_; }
+
+      /// \brief Lexes the next token.
+      ///
+      [[nodiscard]] token next() noexcept;
+      // [[expects: not done()]]
+
+      /// \brief Returns the error in the token most recently returned by next, if there was one.
+      ///
+      [[nodiscard]] std::optional<lexical_error> const& error() const noexcept
+      { return error_; }
+
+   private:
+      std::u8string_view source_;
+      std::uint32_t offset_;
+      std::optional<lexical_error> error_;
+      std::optional<lexer_checkpoint> resume_;
+   };
+
+   struct lexed_source {
+      std::vector<token> tokens;
+      std::vector<lexical_error> errors;
+      delimiter_table delimiters;
+
+      /// \brief The limit that stopped lexing early, if lex was given limits and one was exceeded.
+      ///
+      std::optional<exceeded_lex_limit> exceeded_limit;
+   };
+
+   /// \brief Lexes all of `source`.
+   ///
+   [[nodiscard]] lexed_source lex(std::u8string_view source);
+   // [[expects: size(source) <= max_source_size]]
+
+   /// \brief Lexes `source` until it's done or one of `limits` is exceeded.
+   ///
+   /// When a limit is exceeded, lexing stops at the start of the token that exceeded it, and the
+   /// rest of the source becomes a single unknown token without an error, so that the tokens still
+   /// cover the whole source. Delimiters that are open at that point are reported as unbalanced.
+   ///
+   [[nodiscard]] lexed_source lex(std::u8string_view source, lex_limits const& limits);
+   // [[expects: size(source) <= max_source_size]]
+   // [[expects: limits.time_check_interval > 0 and limits.time_check_tokens > 0]]
+
+   /// \brief The distance between checkpoints that make_checkpoints aims for.
+   ///
+   inline constexpr auto default_checkpoint_interval = std::size_t{64} * 1024;
+
+   /// \brief Lexes `source`, keeping a checkpoint roughly every `interval` bytes instead of the
+   ///        tokens.
+   ///
+   /// The first checkpoint is at the top of the file. After that, each multiple of `interval` gets a
+   /// checkpoint at the nearest token boundary at or before it, unless it falls inside a string, raw
+   /// string, or block comment: those can be resumed anywhere inside, so the checkpoint goes at the
+   /// first resumable position inside that token after the multiple.
+   ///
+   [[nodiscard]] std::vector<lexer_checkpoint>
+   make_checkpoints(std::u8string_view source, std::size_t interval = default_checkpoint_interval);
+   // [[expects: size(source) <= max_source_size]]
+   // [[expects: interval > 0]]
+
+   /// \brief The tokens from part of a source.
+   ///
+   struct lexed_region {
+      /// \brief The index of the first token in the region, counting from the top of the file.
+      ///
+      std::size_t first_token = 0;
+      std::vector<token> tokens;
+      std::vector<lexical_error> errors;
+   };
+
+   /// \brief Lexes the tokens that overlap the bytes [begin, end) of `source`.
+   /// \param checkpoints The checkpoints that make_checkpoints recorded for `source`.
+   ///
+   /// Lexing starts at the last checkpoint at or before `begin`, so the cost depends on the size of
+   /// the region and the distance between checkpoints rather than on where the region is.
+   ///
+   [[nodiscard]] lexed_region lex_region(std::u8string_view source,
+      std::span<lexer_checkpoint const> checkpoints, std::size_t begin, std::size_t end);
+   // [[expects: not empty(checkpoints) and checkpoints are ordered by offset]]
+   // [[expects: begin <= end and end <= size(source)]]
+} // namespace lingua
+
+#endif // LINGUA_LEXER_LEX_HPP
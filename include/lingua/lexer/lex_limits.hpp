@@ -0,0 +1,106 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_LEX_LIMITS_HPP
+#define LINGUA_LEXER_LEX_LIMITS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace lingua {
+   /// \brief The limits in lex_limits.
+   ///
+   enum class lex_limit : std::uint8_t {
+      bytes,
+      tokens,
+      errors,
+      literal_length,
+      comment_depth,
+      time,
+   };
+
+   /// \brief Bounds on the work that lexing a single source may do, for sources that can't be
+   ///        trusted. Every limit is unbounded by default.
+   ///
+   struct lex_limits {
+      static constexpr auto unbounded = std::numeric_limits<std::size_t>::max();
+
+      /// \brief The largest source that will be lexed at all.
+      ///
+      std::size_t max_bytes = unbounded;
+
+      /// \brief The most tokens that may be lexed. When lexing stops early, the rest of the source
+      ///        becomes one more token, so there may be `max_tokens + 1` tokens in all.
+      ///
+      std::size_t max_tokens = unbounded;
+
+      /// \brief The most lexical errors that may be found. Unbalanced delimiters are found after
+      ///        lexing, so they don't count.
+      ///
+      std::size_t max_errors = unbounded;
+
+      /// \brief The longest literal, in bytes. The scanner stops a few bytes past this, so an
+      ///        unterminated literal doesn't have to be read to the end of the source.
+      ///
+      std::size_t max_literal_length = unbounded;
+
+      /// \brief How deeply block comments may nest. The scanner stops at the first `/*` that is
+      ///        too deep, rather than at the end of the comment.
+      ///
+      std::size_t max_comment_depth = unbounded;
+
+      /// \brief How long lexing may take. The clock is read between tokens, so a single token is
+      ///        always scanned to its end: bound the tokens that can be arbitrarily long with
+      ///        max_literal_length and max_bytes.
+      ///
+      std::chrono::milliseconds max_time = std::chrono::milliseconds::max();
+
+      /// \brief How many bytes are lexed between looks at the clock.
+      ///
+      /// Counts are compared as each token is made, which costs next to nothing. Reading the clock
+      /// costs about as much as lexing a few tokens, so it's only read this often, or after
+      /// time_check_tokens tokens, whichever comes first.
+      ///
+      std::size_t time_check_interval = std::size_t{16} * 1024;
+
+      /// \brief How many tokens are lexed between looks at the clock.
+      ///
+      /// Checking by tokens as well as bytes bounds the time between checks even when each token
+      /// is a single byte whose bookkeeping costs more than usual.
+      ///
+      std::size_t time_check_tokens = 4096;
+   };
+
+   /// \brief The limit that stopped lexing, and where.
+   ///
+   struct exceeded_lex_limit {
+      lex_limit limit;
+
+      /// \brief The limit's value, in the units lex_limits uses (e.g. milliseconds for time).
+      ///
+      std::uint64_t value;
+
+      /// \brief Where lexing stopped.
+      ///
+      std::uint32_t offset;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(exceeded_lex_limit const&, exceeded_lex_limit const&) noexcept = default;
+   };
+} // namespace lingua
+
+#endif // LINGUA_LEXER_LEX_LIMITS_HPP
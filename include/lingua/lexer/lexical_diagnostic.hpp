@@ -0,0 +1,81 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_LEXICAL_DIAGNOSTIC_HPP
+#define LINGUA_LEXER_LEXICAL_DIAGNOSTIC_HPP
+
+#include "lingua/diagnostic/diagnostic_limits.hpp"
+#include "lingua/diagnostic/diagnostics_suppressed.hpp"
+#include "lingua/diagnostic/lexical/invalid_identifier.hpp"
+#include "lingua/diagnostic/lexical/lex_limit_exceeded.hpp"
+#include "lingua/diagnostic/lexical/unbalanced_delimiter.hpp"
+#include "lingua/diagnostic/lexical/unknown_token.hpp"
+#include "lingua/diagnostic/lexical/unterminated_char_literal.hpp"
+#include "lingua/diagnostic/lexical/unterminated_comment.hpp"
+#include "lingua/diagnostic/lexical/unterminated_string_literal.hpp"
+#include "lingua/diagnostic/repeated_diagnostic.hpp"
+#include "lingua/lexer/lex.hpp"
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace lingua {
+   using lexical_diagnostic = std::variant<
+      unknown_token,
+      unterminated_comment,
+      unterminated_string_literal,
+      unterminated_char_literal,
+      invalid_identifier,
+      unbalanced_delimiter,
+      lex_limit_exceeded,
+      repeated_diagnostic,
+      diagnostics_suppressed>;
+
+   /// \brief Turns lexical errors into diagnostics.
+   /// \param source The source that the errors were found in.
+   /// \param errors The errors to report, ordered by offset.
+   ///
+   /// Coordinates are computed in a single pass over the source, so the cost doesn't depend on the
+   /// number of errors.
+   ///
+   [[nodiscard]] std::vector<lexical_diagnostic>
+   make_diagnostics(std::u8string_view source, std::span<lexical_error const> errors);
+
+   /// \brief Turns lexical errors into no more diagnostics than `limits` allows.
+   ///
+   /// Runs of errors with the same kind and text are collapsed before anything is formatted, and
+   /// once a cap is reached, the rest of the errors become a single diagnostics_suppressed.
+   ///
+   [[nodiscard]] std::vector<lexical_diagnostic> make_diagnostics(std::u8string_view source,
+      std::span<lexical_error const> errors, diagnostic_limits const& limits);
+   // [[expects: limits.collapse_runs_of >= 2]]
+
+   /// \brief Turns the errors found by lex, including unbalanced delimiters, into diagnostics
+   ///        ordered by position.
+   ///
+   /// If lex stopped early, the last diagnostic is a lex_limit_exceeded where it stopped.
+   ///
+   [[nodiscard]] std::vector<lexical_diagnostic>
+   make_diagnostics(std::u8string_view source, lexed_source const& lexed);
+
+   /// \brief Turns the errors found by lex into no more diagnostics than `limits` allows.
+   ///
+   [[nodiscard]] std::vector<lexical_diagnostic> make_diagnostics(std::u8string_view source,
+      lexed_source const& lexed, diagnostic_limits const& limits);
+   // [[expects: limits.collapse_runs_of >= 2]]
+} // namespace lingua
+
+#endif // LINGUA_LEXER_LEXICAL_DIAGNOSTIC_HPP
@@ -0,0 +1,51 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_LEXICAL_ERROR_HPP
+#define LINGUA_LEXER_LEXICAL_ERROR_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace lingua {
+   enum class lexical_error_kind : std::uint8_t {
+      unknown_token,
+      unterminated_comment,
+      unterminated_string_literal,
+      unterminated_char_literal,
+      invalid_identifier,
+      unbalanced_delimiter,
+   };
+
+   /// \brief A lexical error, recorded by position so that lexing never has to format a message.
+   ///        Use make_diagnostics to turn errors into diagnostics.
+   ///
+   struct lexical_error {
+      lexical_error_kind kind;
+      std::uint32_t offset;
+      std::uint32_t length;
+
+      /// \brief Returns the text that the error refers to.
+      /// \param source The source that the error was found in.
+      ///
+      [[nodiscard]] constexpr std::u8string_view text(std::u8string_view const source) const noexcept
+      { return source.substr(offset, length); }
+
+      [[nodiscard]] constexpr friend bool
+      operator==(lexical_error const&, lexical_error const&) noexcept = default;
+   };
+} // namespace lingua
+
+#endif // LINGUA_LEXER_LEXICAL_ERROR_HPP
@@ -0,0 +1,64 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_NFC_HPP
+#define LINGUA_LEXER_NFC_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace lingua {
+   enum class nfc_quick_check_result : std::uint8_t { yes, maybe, no };
+
+   /// \brief Runs the NFC quick check from UAX #15 over `text`.
+   /// \returns `yes` if `text` is in NFC, `no` if it isn't, and `maybe` if only normalizing it will
+   ///          tell.
+   ///
+   /// Nothing below U+0300 can change under NFC, so ASCII and Latin-1 text is answered without
+   /// looking anything up. Nearly every real identifier is answered `yes` this way.
+   ///
+   [[nodiscard]] nfc_quick_check_result nfc_quick_check(std::u8string_view text) noexcept;
+   // [[expects: text is well-formed UTF-8]]
+
+   /// \brief Returns the NFC form of `text`: its canonical decomposition, put in canonical order,
+   ///        and then canonically composed.
+   ///
+   [[nodiscard]] std::u8string to_nfc(std::u8string_view text);
+   // [[expects: text is well-formed UTF-8]]
+
+   /// \brief The number of code points that `text`'s canonical decomposition may have when it's
+   ///        normalized into a buffer.
+   ///
+   inline constexpr auto max_buffered_decomposition = std::size_t{128};
+
+   /// \brief Writes the NFC form of `text` into `buffer`, without allocating.
+   /// \returns The NFC form, which refers to `buffer`, or std::nullopt if it doesn't fit in
+   ///          `buffer` or its decomposition is longer than max_buffered_decomposition.
+   ///
+   [[nodiscard]] std::optional<std::u8string_view>
+   to_nfc(std::u8string_view text, std::span<char8_t> buffer) noexcept;
+   // [[expects: text is well-formed UTF-8]]
+
+   /// \brief Checks if `text` is in NFC, normalizing it only if the quick check can't tell.
+   ///
+   [[nodiscard]] bool is_nfc(std::u8string_view text);
+   // [[expects: text is well-formed UTF-8]]
+} // namespace lingua
+
+#endif // LINGUA_LEXER_NFC_HPP
@@ -0,0 +1,130 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_TOKEN_HPP
+#define LINGUA_LEXER_TOKEN_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace lingua {
+   enum class token_kind : std::uint8_t {
+      // trivia
+      whitespace,
+      line_comment,
+      block_comment,
+
+      // identifiers
+      identifier,
+      raw_identifier,
+      keyword,
+      lifetime,
+
+      // literals
+      integer_literal,
+      float_literal,
+      char_literal,
+      byte_literal,
+      string_literal,
+      byte_string_literal,
+      raw_string_literal,
+      raw_byte_string_literal,
+
+      // delimiters
+      open_paren,
+      close_paren,
+      open_bracket,
+      close_bracket,
+      open_brace,
+      close_brace,
+
+      // punctuation
+      plus,
+      minus,
+      star,
+      slash,
+      percent,
+      caret,
+      bang,
+      ampersand,
+      pipe,
+      ampersand_ampersand,
+      pipe_pipe,
+      shl,
+      shr,
+      plus_eq,
+      minus_eq,
+      star_eq,
+      slash_eq,
+      percent_eq,
+      caret_eq,
+      ampersand_eq,
+      pipe_eq,
+      shl_eq,
+      shr_eq,
+      eq,
+      eq_eq,
+      ne,
+      gt,
+      lt,
+      ge,
+      le,
+      at,
+      dot,
+      dot_dot,
+      dot_dot_dot,
+      dot_dot_eq,
+      comma,
+      semicolon,
+      colon,
+      path_separator,
+      right_arrow,
+      fat_arrow,
+      pound,
+      dollar,
+      question,
+
+      unknown,
+   };
+
+   /// \brief A lexeme, identified by its kind and its position in the source.
+   /// \note Tokens don't store their text or their source_coordinates: both are recoverable from the
+   ///       source, and keeping the token small is what lets large token streams fit in memory.
+   ///
+   struct token {
+      token_kind kind;
+      std::uint32_t offset;
+      std::uint32_t length;
+
+      /// \brief Returns the text of the token.
+      /// \param source The source that the token was lexed from.
+      ///
+      [[nodiscard]] constexpr std::u8string_view text(std::u8string_view const source) const noexcept
+      { return source.substr(offset, length); }
+
+      [[nodiscard]] constexpr friend bool operator==(token const&, token const&) noexcept = default;
+   };
+
+   static_assert(std::is_trivially_copyable_v<token>);
+   static_assert(std::is_standard_layout_v<token>);
+
+   /// \brief Checks if a token carries no meaning for the parser.
+   ///
+   [[nodiscard]] constexpr bool is_trivia(token_kind const kind) noexcept
+   { return kind <= token_kind::block_comment; }
+} // namespace lingua
+
+#endif // LINGUA_LEXER_TOKEN_HPP
@@ -0,0 +1,344 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_TOKEN_BUFFER_HPP
+#define LINGUA_LEXER_TOKEN_BUFFER_HPP
+
+#include "lingua/lexer/token.hpp"
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace lingua::detail_token_buffer {
+   /// \brief Reads an unsigned LEB128 number, and moves `p` past it.
+   ///
+   [[nodiscard]] inline std::uint32_t read_varint(std::uint8_t const*& p) noexcept
+   {
+      auto value = std::uint32_t{0};
+      for (auto shift = 0U;; shift += 7) {
+         auto const byte = *p++;
+         value |= static_cast<std::uint32_t>(byte & 0x7FU) << shift;
+         if ((byte & 0x80U) == 0) {
+            return value;
+         }
+      }
+   }
+} // namespace lingua::detail_token_buffer
+
+namespace lingua {
+   /// \brief Stores tokens as a structure of arrays: one array of kinds, one of offsets, and one of
+   ///        lengths.
+   ///
+   /// A token takes 9 bytes rather than the 12 that a padded lingua::token needs, and a pass that
+   /// only looks at kinds (e.g. skipping trivia) only touches a ninth of the memory. Iterators
+   /// reassemble each token as it's read.
+   ///
+   class token_buffer {
+   public:
+      class iterator;
+
+      token_buffer() = default;
+
+      explicit token_buffer(std::span<token const> const tokens)
+      {
+         reserve(tokens.size());
+         for (auto const t : tokens) {
+            push_back(t);
+         }
+      }
+
+      [[nodiscard]] std::size_t size() const noexcept
+      { return kinds_.size(); }
+
+      [[nodiscard]] bool empty() const noexcept
+      { return kinds_.empty(); }
+
+      void reserve(std::size_t const n)
+      {
+         kinds_.reserve(n);
+         offsets_.reserve(n);
+         lengths_.reserve(n);
+      }
+
+      void push_back(token const t)
+      {
+         kinds_.push_back(t.kind);
+         offsets_.push_back(t.offset);
+         lengths_.push_back(t.length);
+      }
+
+      void clear() noexcept
+      {
+         kinds_.clear();
+         offsets_.clear();
+         lengths_.clear();
+      }
+
+      [[nodiscard]] token operator[](std::size_t const i) const noexcept
+      { return token{kinds_[i], offsets_[i], lengths_[i]}; }
+      // [[expects: i < size()]]
+
+      [[nodiscard]] std::span<token_kind const> kinds() const noexcept
+      { return kinds_; }
+
+      [[nodiscard]] std::span<std::uint32_t const> offsets() const noexcept
+      { return offsets_; }
+
+      [[nodiscard]] std::span<std::uint32_t const> lengths() const noexcept
+      { return lengths_; }
+
+      /// \brief Returns the number of bytes that the tokens occupy, not counting spare capacity.
+      ///
+      [[nodiscard]] std::size_t size_in_bytes() const noexcept
+      { return size() * (sizeof(token_kind) + 2 * sizeof(std::uint32_t)); }
+
+      [[nodiscard]] iterator begin() const noexcept;
+      [[nodiscard]] iterator end() const noexcept;
+
+      [[nodiscard]] friend bool operator==(token_buffer const&, token_buffer const&) = default;
+
+   private:
+      std::vector<token_kind> kinds_;
+      std::vector<std::uint32_t> offsets_;
+      std::vector<std::uint32_t> lengths_;
+   };
+
+   /// \brief A random-access iterator that reads a token out of a token_buffer.
+   ///
+   class token_buffer::iterator {
+   public:
+      using value_type = token;
+      using difference_type = std::ptrdiff_t;
+      using iterator_concept = std::random_access_iterator_tag;
+
+      iterator() = default;
+
+      [[nodiscard]] token operator*() const noexcept
+      { return (*buffer_)[index_]; }
+
+      [[nodiscard]] token operator[](difference_type const n) const noexcept
+      { return *(*this + n); }
+
+      iterator& operator++() noexcept
+      {
+         ++index_;
+         return *this;
+      }
+
+      iterator operator++(int) noexcept
+      {
+         auto copy = *this;
+         ++*this;
+         return copy;
+      }
+
+      iterator& operator--() noexcept
+      {
+         --index_;
+         return *this;
+      }
+
+      iterator operator--(int) noexcept
+      {
+         auto copy = *this;
+         --*this;
+         return copy;
+      }
+
+      iterator& operator+=(difference_type const n) noexcept
+      {
+         index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + n);
+         return *this;
+      }
+
+      iterator& operator-=(difference_type const n) noexcept
+      { return *this += -n; }
+
+      [[nodiscard]] friend iterator operator+(iterator i, difference_type const n) noexcept
+      { return i += n; }
+
+      [[nodiscard]] friend iterator operator+(difference_type const n, iterator i) noexcept
+      { return i += n; }
+
+      [[nodiscard]] friend iterator operator-(iterator i, difference_type const n) noexcept
+      { return i -= n; }
+
+      [[nodiscard]] friend difference_type operator-(iterator const& x, iterator const& y) noexcept
+      { return static_cast<difference_type>(x.index_) - static_cast<difference_type>(y.index_); }
+
+      [[nodiscard]] friend bool operator==(iterator const& x, iterator const& y) noexcept
+      { return x.index_ == y.index_; }
+
+      [[nodiscard]] friend std::strong_ordering operator<=>(iterator const& x, iterator const& y) noexcept
+      { return x.index_ <=> y.index_; }
+
+   private:
+      friend class token_buffer;
+
+      token_buffer const* buffer_ = nullptr;
+      std::size_t index_ = 0;
+
+      iterator(token_buffer const* const buffer, std::size_t const index) noexcept
+         : buffer_{buffer}
+         , index_{index}
+      {}
+   };
+
+   inline token_buffer::iterator token_buffer::begin() const noexcept
+   { return iterator{this, 0}; }
+
+   inline token_buffer::iterator token_buffer::end() const noexcept
+   { return iterator{this, size()}; }
+
+   /// \brief Stores tokens for as little memory as possible, at the cost of decoding them to read
+   ///        them.
+   ///
+   /// Each offset is stored as its distance from the end of the token before it, and both that
+   /// distance and the length are stored as variable-length integers. The lexer produces
+   /// contiguous tokens, so the distance is almost always zero, and most tokens take three bytes:
+   /// the kind, the distance, and the length. Every block_size tokens, the position of the next
+   /// token is recorded so that operator[] only decodes part of a block.
+   ///
+   class compressed_token_buffer {
+   public:
+      class iterator;
+
+      static constexpr auto block_size = std::size_t{64};
+
+      compressed_token_buffer() = default;
+
+      explicit compressed_token_buffer(std::span<token const> tokens);
+
+      explicit compressed_token_buffer(token_buffer const& tokens);
+
+      [[nodiscard]] std::size_t size() const noexcept
+      { return kinds_.size(); }
+
+      [[nodiscard]] bool empty() const noexcept
+      { return kinds_.empty(); }
+
+      /// \brief Appends `t`, which must not start before the previous token ends.
+      ///
+      void push_back(token t);
+      // [[expects: t.offset >= end of the last token]]
+
+      /// \brief Returns the `i`th token, by decoding from the start of its block.
+      ///
+      [[nodiscard]] token operator[](std::size_t i) const noexcept;
+      // [[expects: i < size()]]
+
+      [[nodiscard]] iterator begin() const noexcept;
+
+      [[nodiscard]] std::default_sentinel_t end() const noexcept
+      { return std::default_sentinel; }
+
+      /// \brief Returns the number of bytes that the tokens occupy, not counting spare capacity.
+      ///
+      [[nodiscard]] std::size_t size_in_bytes() const noexcept
+      {
+         return kinds_.size() * sizeof(token_kind) + bytes_.size()
+              + blocks_.size() * sizeof(block);
+      }
+
+      /// \brief Returns the tokens in a token_buffer, for when they're about to be used heavily.
+      ///
+      [[nodiscard]] token_buffer decompress() const;
+
+   private:
+      /// \brief Where a block of tokens starts.
+      ///
+      struct block {
+         std::size_t position;
+         std::uint32_t previous_end;
+      };
+
+      std::vector<token_kind> kinds_;
+      std::vector<std::uint8_t> bytes_;
+      std::vector<block> blocks_;
+      std::uint32_t end_ = 0;
+   };
+
+   /// \brief A forward iterator that decodes the tokens in a compressed_token_buffer one at a
+   ///        time.
+   ///
+   class compressed_token_buffer::iterator {
+   public:
+      using value_type = token;
+      using difference_type = std::ptrdiff_t;
+      using iterator_concept = std::forward_iterator_tag;
+
+      iterator() = default;
+
+      [[nodiscard]] token operator*() const noexcept
+      { return current_; }
+
+      iterator& operator++() noexcept
+      {
+         ++index_;
+         decode();
+         return *this;
+      }
+
+      iterator operator++(int) noexcept
+      {
+         auto copy = *this;
+         ++*this;
+         return copy;
+      }
+
+      [[nodiscard]] friend bool operator==(iterator const& x, iterator const& y) noexcept
+      { return x.index_ == y.index_; }
+
+      [[nodiscard]] friend bool operator==(iterator const& x, std::default_sentinel_t) noexcept
+      { return x.index_ == x.buffer_->size(); }
+
+   private:
+      friend class compressed_token_buffer;
+
+      compressed_token_buffer const* buffer_ = nullptr;
+      std::size_t index_ = 0;
+      std::uint8_t const* next_ = nullptr;
+      std::uint32_t previous_end_ = 0;
+      token current_{};
+
+      iterator(compressed_token_buffer const* const buffer, std::size_t const index,
+         std::uint8_t const* const next, std::uint32_t const previous_end) noexcept
+         : buffer_{buffer}
+         , index_{index}
+         , next_{next}
+         , previous_end_{previous_end}
+      { decode(); }
+
+      void decode() noexcept
+      {
+         if (index_ == buffer_->size()) {
+            return;
+         }
+
+         auto const offset = previous_end_ + detail_token_buffer::read_varint(next_);
+         auto const length = detail_token_buffer::read_varint(next_);
+         current_ = token{buffer_->kinds_[index_], offset, length};
+         previous_end_ = offset + length;
+      }
+   };
+
+   inline compressed_token_buffer::iterator compressed_token_buffer::begin() const noexcept
+   { return iterator{this, 0, bytes_.data(), 0}; }
+} // namespace lingua
+
+#endif // LINGUA_LEXER_TOKEN_BUFFER_HPP
@@ -0,0 +1,154 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_TOKEN_GENERATOR_HPP
+#define LINGUA_LEXER_TOKEN_GENERATOR_HPP
+
+#include "lingua/lexer/delimiter_table.hpp"
+#include "lingua/lexer/lex.hpp"
+#include "lingua/lexer/lexical_error.hpp"
+#include "lingua/lexer/token.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace lingua {
+   /// \brief Lexes a source lazily, one token each time the consumer asks for one.
+   ///
+   /// Nothing past the last token that was asked for is read, so a tool that only needs the top
+   /// of each file (e.g. its `use` declarations) never touches the rest. The errors and delimiter
+   /// pairs of the tokens produced so far are kept as they would be by lex, and once every token
+   /// has been produced they are identical to lex's.
+   ///
+   /// token_generator is a view of the lexer's state rather than a coroutine, so pulling a token
+   /// costs a call to lexer::next and there is no frame to allocate.
+   ///
+   class token_generator {
+   public:
+      class iterator;
+
+      explicit token_generator(std::u8string_view const source) noexcept
+         : lexer_{source}
+      {}
+      // [[expects: size(source) <= max_source_size]]
+
+      /// \brief Lexes the next token.
+      /// \returns The token, or std::nullopt once every token has been produced.
+      ///
+      [[nodiscard]] std::optional<token> next()
+      {
+         if (lexer_.done()) {
+            return std::nullopt;
+         }
+
+         auto const t = lexer_.next();
+         delimiters_.add(count_++, t);
+         if (lexer_.error()) {
+            errors_.push_back(*lexer_.error());
+         }
+
+         // Unclosed openers are reported with the last token, so that a consumer that stops once
+         // done() is true sees the same errors as one that waits for std::nullopt.
+         if (lexer_.done()) {
+            delimiters_.finish();
+         }
+         return t;
+      }
+
+      /// \brief Checks if every token has been produced.
+      ///
+      [[nodiscard]] bool done() const noexcept
+      { return lexer_.done(); }
+
+      /// \brief Returns the number of bytes lexed so far.
+      ///
+      [[nodiscard]] std::uint32_t offset() const noexcept
+      { return lexer_.offset(); }
+
+      /// \brief Returns the number of tokens produced so far.
+      ///
+      [[nodiscard]] std::size_t count() const noexcept
+      { return count_; }
+
+      /// \brief Returns the errors in the tokens produced so far, ordered by offset.
+      ///
+      [[nodiscard]] std::span<lexical_error const> errors() const noexcept
+      { return errors_; }
+
+      /// \brief Returns the delimiter pairs among the tokens produced so far. Openers that haven't
+      ///        been closed yet are only reported as unbalanced once every token has been produced.
+      ///
+      [[nodiscard]] delimiter_table const& delimiters() const noexcept
+      { return delimiters_; }
+
+      /// \brief Returns an iterator that produces the next token. Like any input range, the
+      ///        tokens can only be traversed once.
+      ///
+      [[nodiscard]] iterator begin();
+
+      [[nodiscard]] std::default_sentinel_t end() const noexcept
+      { return std::default_sentinel; }
+
+   private:
+      lexer lexer_;
+      std::uint32_t count_ = 0;
+      std::vector<lexical_error> errors_;
+      delimiter_table delimiters_;
+   };
+
+   class token_generator::iterator {
+   public:
+      using value_type = token;
+      using difference_type = std::ptrdiff_t;
+      using iterator_concept = std::input_iterator_tag;
+
+      iterator() = default;
+
+      [[nodiscard]] token operator*() const noexcept
+      { return *current_; }
+
+      iterator& operator++()
+      {
+         current_ = generator_->next();
+         return *this;
+      }
+
+      void operator++(int)
+      { ++*this; }
+
+      [[nodiscard]] friend bool operator==(iterator const& i, std::default_sentinel_t) noexcept
+      { return not i.current_; }
+
+   private:
+      friend class token_generator;
+
+      token_generator* generator_ = nullptr;
+      std::optional<token> current_;
+
+      explicit iterator(token_generator& generator)
+         : generator_{&generator}
+         , current_{generator.next()}
+      {}
+   };
+
+   inline token_generator::iterator token_generator::begin()
+   { return iterator{*this}; }
+} // namespace lingua
+
+#endif // LINGUA_LEXER_TOKEN_GENERATOR_HPP
@@ -0,0 +1,128 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_TOKEN_LOOKAHEAD_HPP
+#define LINGUA_LEXER_TOKEN_LOOKAHEAD_HPP
+
+#include "lingua/lexer/token.hpp"
+#include "lingua/utility/contract.hpp"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <ranges>
+
+namespace lingua {
+   /// \brief Gives a parser the next N tokens of any range of tokens, without materialising the
+   ///        rest of it.
+   ///
+   /// The tokens are held in a ring buffer of N tokens, which is refilled from the range one token
+   /// at a time as the parser advances, so `Tokens` may be an input range such as a
+   /// token_generator as easily as a token_buffer. N is fixed so that peeking and advancing don't
+   /// need a loop or a division, and for small N they compile to a handful of instructions.
+   ///
+   template<std::size_t N, std::ranges::input_range Tokens>
+   requires (N > 0) and std::same_as<std::ranges::range_value_t<Tokens>, token>
+   class token_lookahead {
+   public:
+      static constexpr auto capacity = N;
+
+      /// \brief Buffers the first N tokens of `tokens`, which must outlive the token_lookahead.
+      ///
+      explicit token_lookahead(Tokens& tokens)
+         : back_{std::ranges::begin(tokens)}
+         , last_{std::ranges::end(tokens)}
+      {
+         if (back_ == last_) {
+            return;
+         }
+
+         tokens_[0] = *back_;
+         for (size_ = 1; size_ < N; ++size_) {
+            if (++back_ == last_) {
+               return;
+            }
+            tokens_[size_] = *back_;
+         }
+      }
+
+      /// \brief Returns the `i`th token from the current one, or std::nullopt if the range ends
+      ///        before it.
+      ///
+      [[nodiscard]] std::optional<token> peek(std::size_t const i = 0) const noexcept
+      {
+         LINGUA_EXPECTS(i < N);
+         if (i >= size_) {
+            return std::nullopt;
+         }
+
+         auto const j = head_ + i;
+         return tokens_[j < N ? j : j - N];
+      }
+
+      /// \brief Checks if the `i`th token from the current one exists and has kind `kind`.
+      ///
+      [[nodiscard]] bool next_is(token_kind const kind, std::size_t const i = 0) const noexcept
+      {
+         auto const t = peek(i);
+         return t and t->kind == kind;
+      }
+
+      /// \brief Moves past the current token, and buffers the token N places after it.
+      /// \returns The token that was moved past.
+      ///
+      token advance()
+      {
+         LINGUA_EXPECTS(not done());
+
+         auto const current = tokens_[head_];
+         if (back_ != last_ and ++back_ != last_) {
+            tokens_[head_] = *back_;
+         }
+         else {
+            --size_;
+         }
+
+         if (++head_ == N) {
+            head_ = 0;
+         }
+         return current;
+      }
+
+      /// \brief Checks if every token has been moved past.
+      ///
+      [[nodiscard]] bool done() const noexcept
+      { return size_ == 0; }
+
+      /// \brief Returns the number of tokens that can be peeked at, which is only less than N near
+      ///        the end of the range.
+      ///
+      [[nodiscard]] std::size_t size() const noexcept
+      { return size_; }
+
+   private:
+      std::array<token, N> tokens_{};
+      std::size_t head_ = 0;
+      std::size_t size_ = 0;
+      /// \brief Refers to the last token that was buffered, rather than the one after it, so that
+      ///        a range that produces tokens on demand isn't asked for one before it's needed.
+      ///
+      std::ranges::iterator_t<Tokens> back_;
+      std::ranges::sentinel_t<Tokens> last_;
+   };
+} // namespace lingua
+
+#endif // LINGUA_LEXER_TOKEN_LOOKAHEAD_HPP
@@ -0,0 +1,130 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_TOKEN_STREAM_HPP
+#define LINGUA_LEXER_TOKEN_STREAM_HPP
+
+#include "lingua/lexer/lex.hpp"
+#include "lingua/lexer/token.hpp"
+#include "lingua/source_buffer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace lingua {
+   /// \brief The tokens that a relex replaced: `removed` tokens starting at index `first` were
+   ///        replaced by `inserted` tokens.
+   ///
+   struct relexed_range {
+      std::size_t first;
+      std::size_t removed;
+      std::size_t inserted;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(relexed_range const&, relexed_range const&) noexcept = default;
+   };
+
+   /// \brief The tokens of a source that is being edited, kept up to date by relexing only the
+   ///        region around each edit.
+   ///
+   /// Tokens are kept in a gap buffer. Tokens after the gap store their distance from the end of
+   /// the source rather than from the start, so an edit doesn't change how they're stored, and the
+   /// tokens that follow an edit are shifted without being touched. Successive edits that are close
+   /// together (e.g. typing) only move the gap a short way.
+   ///
+   class token_stream {
+   public:
+      /// \brief Lexes `source`.
+      ///
+      explicit token_stream(std::u8string_view source);
+      // [[expects: size(source) <= max_source_size]]
+
+      /// \brief Lexes `source`.
+      ///
+      explicit token_stream(source_buffer const& source);
+
+      /// \brief Returns the number of tokens.
+      ///
+      [[nodiscard]] std::size_t size() const noexcept
+      { return tokens_.size() - gap_size(); }
+
+      /// \brief Returns the `i`th token.
+      ///
+      [[nodiscard]] token operator[](std::size_t const i) const noexcept
+      {
+         if (i < gap_begin_) {
+            return tokens_[i];
+         }
+
+         auto result = tokens_[i + gap_size()];
+         result.offset = source_size_ - result.offset;
+         return result;
+      }
+      // [[expects: i < size()]]
+
+      /// \brief Returns a copy of the tokens.
+      ///
+      [[nodiscard]] std::vector<token> tokens() const;
+
+      /// \brief Returns the errors found in the tokens, ordered by offset.
+      ///
+      [[nodiscard]] std::span<lexical_error const> errors() const noexcept
+      { return errors_; }
+
+      /// \brief Updates the tokens to reflect `edit`.
+      /// \param source The whole source, after `edit` was applied.
+      /// \returns The tokens that changed.
+      ///
+      /// Lexing restarts at the last token boundary that the edit can't have affected (see
+      /// max_lookahead), and stops once a token boundary after the edit lines up with one from
+      /// before the edit: lexing is deterministic from a boundary, so every token after that point
+      /// is unchanged.
+      ///
+      relexed_range relex(std::u8string_view source, text_edit edit);
+      // [[expects: edit.offset + edit.removed <= size of the source before the edit]]
+      // [[expects: size(source) == size of the source before the edit - edit.removed + edit.inserted]]
+
+      /// \brief Updates the tokens to reflect `edit`, reading the source straight out of a
+      ///        source_buffer rather than from a contiguous copy.
+      ///
+      relexed_range relex(source_buffer const& source, text_edit edit);
+      // [[expects: edit.offset + edit.removed <= size of the source before the edit]]
+      // [[expects: size(source) == size of the source before the edit - edit.removed + edit.inserted]]
+
+   private:
+      /// \brief Holds the tokens before the gap, the gap, and then the tokens after the gap.
+      ///
+      std::vector<token> tokens_;
+      std::size_t gap_begin_ = 0;
+      std::size_t gap_end_ = 0;
+      std::uint32_t source_size_ = 0;
+      std::vector<lexical_error> errors_;
+
+      [[nodiscard]] std::size_t gap_size() const noexcept
+      { return gap_end_ - gap_begin_; }
+
+      [[nodiscard]] std::uint32_t end_of(std::size_t i) const noexcept;
+
+      void move_gap(std::size_t index) noexcept;
+      void push_before_gap(token t);
+
+      template<typename MakeLexer>
+      relexed_range resume(text_edit edit, std::uint32_t new_size, MakeLexer make_lexer);
+   };
+} // namespace lingua
+
+#endif // LINGUA_LEXER_TOKEN_STREAM_HPP
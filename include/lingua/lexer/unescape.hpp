@@ -0,0 +1,82 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_UNESCAPE_HPP
+#define LINGUA_LEXER_UNESCAPE_HPP
+
+#include "lingua/lexer/token.hpp"
+#include "lingua/utility/string_arena.hpp"
+#include <cstdint>
+#include <string_view>
+
+namespace lingua {
+   enum class unescape_error : std::uint8_t {
+      none,
+      /// \brief An escape that isn't allowed in a char or string literal (e.g. `\q` or `\x80`).
+      ///
+      unknown_ascii_escape,
+      /// \brief An escape that isn't allowed in a byte or byte string literal (e.g. `\u{41}`).
+      ///
+      unknown_byte_escape,
+      /// \brief A `\u{...}` escape that's malformed (e.g. `\u{12x}`).
+      ///
+      unknown_unicode_escape,
+      /// \brief A `\u{...}` escape that names a UTF-16 surrogate (e.g. `\u{D800}`).
+      ///
+      surrogate_unicode_escape,
+      /// \brief A `\u{...}` escape above `\u{10FFFF}`.
+      ///
+      out_of_range_unicode_escape,
+      /// \brief A character outside ASCII in a byte, byte string, or raw byte string literal.
+      ///
+      non_ascii_byte,
+   };
+
+   /// \brief The value of a char, byte, or string literal, or the first error found while decoding
+   ///        it.
+   ///
+   struct unescaped_literal {
+      /// \brief The literal's contents with its escapes decoded, and without its prefix, quotes,
+      ///        or hashes. A char literal's value is the UTF-8 encoding of its character.
+      ///
+      /// The value views the literal itself when there's nothing to decode, and the arena
+      /// otherwise. It's empty if `error` isn't unescape_error::none.
+      ///
+      std::u8string_view value;
+      unescape_error error;
+
+      /// \brief The range of the literal that `error` refers to.
+      ///
+      std::uint32_t error_offset;
+      std::uint32_t error_length;
+   };
+
+   /// \brief Decodes the escapes in a char, byte, string, byte string, raw string, or raw byte
+   ///        string literal.
+   /// \param kind The kind of token that `literal` is.
+   /// \param literal The text of the token, including its prefix and quotes.
+   /// \param arena Where decoded values are written.
+   ///
+   /// The literal is first scanned for a backslash (or, in a byte literal, for a byte outside
+   /// ASCII) sixteen or thirty-two bytes at a time. A literal without one has nothing to decode,
+   /// and its value is a view of the literal, so most literals cost a single scan and no copy.
+   ///
+   [[nodiscard]] unescaped_literal
+   unescape_literal(token_kind kind, std::u8string_view literal, string_arena& arena);
+   // [[expects: literal is the text of a terminated token of kind `kind`, which is one of
+   //            token_kind::char_literal through token_kind::raw_byte_string_literal]]
+} // namespace lingua
+
+#endif // LINGUA_LEXER_UNESCAPE_HPP
@@ -0,0 +1,66 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_LEXER_XID_HPP
+#define LINGUA_LEXER_XID_HPP
+
+#include "lingua/lexer/detail/xid_table.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace lingua::detail_xid {
+   /// \brief Looks `c` up in the leaf that `chunks` names for its chunk.
+   ///
+   template<std::size_t N>
+   [[nodiscard]] constexpr bool
+   in_table(std::array<std::uint8_t, N> const& chunks, char32_t const c) noexcept
+   // [[expects: c < table_limit]]
+   {
+      auto const leaf = char32_t{chunks[c >> chunk_bits]};
+      auto const word = xid_leaves[leaf * words_per_chunk + ((c >> 6U) & (words_per_chunk - 1))];
+      return ((word >> (c & 63U)) & 1U) != 0;
+   }
+} // namespace lingua::detail_xid
+
+namespace lingua {
+   /// \brief Checks if `c` has the Unicode property XID_Start, which is what an identifier may
+   ///        begin with. Note that `_` isn't XID_Start, even though Rust identifiers may begin with
+   ///        it.
+   ///
+   [[nodiscard]] constexpr bool is_xid_start(char32_t const c) noexcept
+   {
+      if (c < 0x80) {
+         return (u8'a' <= (c | 0x20U) and (c | 0x20U) <= u8'z');
+      }
+      return c < detail_xid::table_limit and detail_xid::in_table(detail_xid::xid_start_chunks, c);
+   }
+
+   /// \brief Checks if `c` has the Unicode property XID_Continue, which is what the rest of an
+   ///        identifier is made of.
+   ///
+   [[nodiscard]] constexpr bool is_xid_continue(char32_t const c) noexcept
+   {
+      if (c < 0x80) {
+         return (u8'a' <= (c | 0x20U) and (c | 0x20U) <= u8'z') or (u8'0' <= c and c <= u8'9')
+             or c == u8'_';
+      }
+      if (c >= detail_xid::table_limit) {
+         return 0xe0100 <= c and c <= 0xe01ef; // variation selectors
+      }
+      return detail_xid::in_table(detail_xid::xid_continue_chunks, c);
+   }
+} // namespace lingua
+
+#endif // LINGUA_LEXER_XID_HPP
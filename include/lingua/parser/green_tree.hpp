@@ -0,0 +1,295 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_PARSER_GREEN_TREE_HPP
+#define LINGUA_PARSER_GREEN_TREE_HPP
+
+#include "lingua/lexer/token.hpp"
+#include "lingua/parser/syntax_tree.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace lingua {
+   class green_node;
+
+   /// \brief A token in a green tree: its kind and its text, but not its position.
+   ///
+   class green_token {
+   public:
+      [[nodiscard]] token_kind kind() const noexcept
+      { return kind_; }
+
+      [[nodiscard]] std::u8string_view text() const noexcept
+      { return text_; }
+
+      [[nodiscard]] std::uint32_t text_length() const noexcept
+      { return static_cast<std::uint32_t>(text_.size()); }
+
+      /// \brief Returns the name that the token spells, which is its text for all but identifiers,
+      ///        raw identifiers, and lifetimes.
+      ///
+      /// Those three are named by the NFC form of their text, without the `r#` of a raw identifier.
+      /// Names are interned, so two tokens spell the same name exactly when their names have the
+      /// same `data()`, even if one is written with precomposed characters and the other isn't.
+      ///
+      [[nodiscard]] std::u8string_view name() const noexcept
+      { return name_.data() == nullptr ? std::u8string_view{text_} : name_; }
+
+   private:
+      friend class green_interner;
+
+      token_kind kind_;
+      std::u8string text_;
+      std::u8string_view name_;
+
+      green_token(token_kind const kind, std::u8string_view const text)
+         : kind_{kind}
+         , text_{text}
+      {}
+   };
+
+   /// \brief Refers to either a green_node or a green_token.
+   ///
+   /// The two are told apart by the low bit of the pointer, so that a node's children take a
+   /// pointer each.
+   ///
+   class green_element {
+   public:
+      green_element(green_node const& node) noexcept
+         : bits_{reinterpret_cast<std::uintptr_t>(&node) | node_tag}
+      {}
+
+      green_element(green_token const& token) noexcept
+         : bits_{reinterpret_cast<std::uintptr_t>(&token)}
+      {}
+
+      [[nodiscard]] bool is_node() const noexcept
+      { return (bits_ & node_tag) != 0; }
+
+      [[nodiscard]] green_node const& node() const noexcept
+      { return *reinterpret_cast<green_node const*>(bits_ & ~node_tag); }
+      // [[expects: is_node()]]
+
+      [[nodiscard]] green_token const& token() const noexcept
+      { return *reinterpret_cast<green_token const*>(bits_); }
+      // [[expects: not is_node()]]
+
+      [[nodiscard]] std::uint32_t text_length() const noexcept;
+
+      /// \brief Green elements are interned, so two elements are equal exactly when they refer to
+      ///        the same object.
+      ///
+      [[nodiscard]] friend bool operator==(green_element, green_element) noexcept = default;
+
+   private:
+      friend class green_interner;
+
+      static constexpr auto node_tag = std::uintptr_t{1};
+
+      std::uintptr_t bits_;
+   };
+
+   /// \brief An immutable node in a lossless syntax tree.
+   ///
+   /// A green node knows its kind, its children, and how much text it covers, but not where the
+   /// text is: that's what lets identical subtrees, in the same file or in different files, be
+   /// the same object. Unlike a syntax_tree, the children include the node's tokens, and trivia,
+   /// so the text of a green tree is exactly the text of its source. Trivia belongs to the
+   /// smallest node that covers the tokens on both sides of it, and the source_file node owns any
+   /// trivia at the beginning or end of the file.
+   ///
+   class green_node {
+   public:
+      [[nodiscard]] syntax_kind kind() const noexcept
+      { return kind_; }
+
+      [[nodiscard]] std::span<green_element const> children() const noexcept
+      { return children_; }
+
+      [[nodiscard]] std::uint32_t text_length() const noexcept
+      { return text_length_; }
+
+      /// \brief Returns the text that the node covers.
+      ///
+      [[nodiscard]] std::u8string text() const;
+
+   private:
+      friend class green_interner;
+
+      syntax_kind kind_;
+      std::uint32_t text_length_;
+      std::size_t hash_;
+      std::vector<green_element> children_;
+
+      green_node(syntax_kind kind, std::span<green_element const> children, std::size_t hash);
+   };
+
+   static_assert(alignof(green_node) > 1 and alignof(green_token) > 1);
+
+   inline std::uint32_t green_element::text_length() const noexcept
+   { return is_node() ? node().text_length() : token().text_length(); }
+
+   /// \brief Owns green nodes and tokens, and makes sure that each distinct one is only stored
+   ///        once.
+   ///
+   /// A node is identified by its kind and its children, and since the children are interned
+   /// first, comparing two nodes only compares pointers. Sharing an interner between files shares
+   /// their common subtrees (e.g. the same `use` declarations, or the same derived
+   /// implementations), and every tree built from an interner is valid until the interner is
+   /// destroyed. Nothing is freed before then, so a long-lived interner grows with each edit.
+   ///
+   class green_interner {
+   public:
+      green_interner() = default;
+      green_interner(green_interner const&) = delete;
+      green_interner& operator=(green_interner const&) = delete;
+      green_interner(green_interner&&) = default;
+      green_interner& operator=(green_interner&&) = default;
+      ~green_interner() = default;
+
+      /// \brief Returns the token with kind `kind` and text `text`, making it if it's new.
+      ///
+      [[nodiscard]] green_token const& token(token_kind kind, std::u8string_view text);
+
+      /// \brief Returns the node with kind `kind` and children `children`, making it if it's new.
+      ///
+      [[nodiscard]] green_node const& node(syntax_kind kind,
+         std::span<green_element const> children);
+      // [[expects: every child was made by *this]]
+
+      /// \brief Returns the number of distinct nodes.
+      ///
+      [[nodiscard]] std::size_t node_count() const noexcept
+      { return nodes_.size(); }
+
+      /// \brief Returns the number of distinct tokens.
+      ///
+      [[nodiscard]] std::size_t token_count() const noexcept
+      { return tokens_.size(); }
+
+   private:
+      std::deque<green_token> tokens_;
+      std::deque<green_node> nodes_;
+      std::unordered_multimap<std::size_t, green_token const*> token_index_;
+      std::unordered_multimap<std::size_t, green_node const*> node_index_;
+      std::unordered_set<std::u8string> names_;
+   };
+
+   /// \brief Builds the green tree for a parsed source.
+   /// \param source The source that `tree` was parsed from.
+   /// \param tokens The tokens that `tree` was parsed from, including trivia.
+   /// \param tree The result of `parse(source, tokens)`.
+   /// \param interner Owns the result, and any nodes that it shares with other trees.
+   /// \returns The source_file node, whose text is `source`.
+   ///
+   /// The nodes correspond to the nodes of `tree`, except that absent children are left out, and
+   /// each node's span is the same as its syntax_tree counterpart.
+   ///
+   [[nodiscard]] green_node const& build_green_tree(std::u8string_view source,
+      std::span<token const> tokens, syntax_tree const& tree, green_interner& interner);
+   // [[expects: tokens are the tokens of source]]
+
+   /// \brief Walks a green tree, keeping track of the position and the parent of each element.
+   ///
+   /// Green nodes have neither, since they're shared; the cursor recovers both from the path that
+   /// it took from the root, so it does the job of a tree of red nodes without allocating one.
+   /// Moving the cursor allocates only when it descends deeper than it has been before.
+   ///
+   class syntax_cursor {
+   public:
+      /// \brief Starts a cursor at `root`, whose text begins at `offset`.
+      ///
+      explicit syntax_cursor(green_node const& root, std::uint32_t const offset = 0)
+         : current_{root}
+         , offset_{offset}
+      {}
+
+      /// \brief Returns the element that the cursor is at.
+      ///
+      [[nodiscard]] green_element current() const noexcept
+      { return current_; }
+
+      /// \brief Returns the text that the current element covers.
+      ///
+      [[nodiscard]] source_span span() const noexcept
+      { return source_span{offset_, current_.text_length()}; }
+
+      /// \brief Returns the number of ancestors of the current element.
+      ///
+      [[nodiscard]] std::size_t depth() const noexcept
+      { return ancestors_.size(); }
+
+      /// \brief Returns the parent of the current element.
+      ///
+      [[nodiscard]] green_node const& parent() const noexcept
+      { return *ancestors_.back().node; }
+      // [[expects: depth() > 0]]
+
+      /// \brief Moves to the parent of the current element.
+      /// \returns false, without moving, if the cursor is at the root.
+      ///
+      bool goto_parent() noexcept;
+
+      /// \brief Moves to the first child of the current element.
+      /// \returns false, without moving, if the current element has no children.
+      ///
+      bool goto_first_child();
+
+      /// \brief Moves to the next sibling of the current element.
+      /// \returns false, without moving, if the current element is its parent's last child.
+      ///
+      bool goto_next_sibling() noexcept;
+
+      /// \brief Moves to the previous sibling of the current element.
+      /// \returns false, without moving, if the current element is its parent's first child.
+      ///
+      bool goto_previous_sibling() noexcept;
+
+      /// \brief Moves down to the token that covers the byte at `offset`.
+      /// \returns false, without moving, if the current element doesn't cover `offset`.
+      ///
+      bool goto_token_at(std::uint32_t offset);
+
+      /// \brief Makes a copy of the tree with `replacement` in place of the current element.
+      /// \returns The root of the new tree. The cursor still refers to the old tree.
+      ///
+      /// Only the ancestors of the current element are made anew, and only if they aren't already
+      /// in `interner`: everything else is shared with the old tree.
+      ///
+      [[nodiscard]] green_node const& replace(green_element replacement,
+         green_interner& interner) const;
+      // [[expects: depth() > 0 or replacement.is_node()]]
+
+   private:
+      struct frame {
+         green_node const* node;
+         std::uint32_t offset;
+         std::uint32_t index;
+      };
+
+      green_element current_;
+      std::uint32_t offset_;
+      std::vector<frame> ancestors_;
+   };
+} // namespace lingua
+
+#endif // LINGUA_PARSER_GREEN_TREE_HPP
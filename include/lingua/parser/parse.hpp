@@ -0,0 +1,51 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_PARSER_PARSE_HPP
+#define LINGUA_PARSER_PARSE_HPP
+
+#include "lingua/lexer/token.hpp"
+#include "lingua/parser/syntax_tree.hpp"
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace lingua {
+   /// \brief The deepest that items, expressions, types, and patterns may nest.
+   ///
+   /// The parser is recursive, so this is what stops a source like `((((...` from exhausting the
+   /// stack. Parsing stops at the first construct that nests any deeper.
+   ///
+   inline constexpr auto max_nesting_depth = std::size_t{256};
+
+   /// \brief Parses a Rust source file.
+   /// \param source The source to parse.
+   /// \param tokens The tokens that lex produced for `source`. Trivia is skipped.
+   /// \returns A syntax_tree rooted at a source_file node, which is built even if the source has
+   ///          syntax errors: tokens that can't be parsed are covered by error nodes.
+   ///
+   /// Expressions are parsed by precedence climbing (a Pratt parser), and everything else by
+   /// recursive descent.
+   ///
+   [[nodiscard]] syntax_tree parse(std::u8string_view source, std::span<token const> tokens);
+   // [[expects: tokens are the tokens of source]]
+
+   /// \brief Lexes and parses a Rust source file.
+   ///
+   [[nodiscard]] syntax_tree parse(std::u8string_view source);
+   // [[expects: size(source) <= max_source_size]]
+} // namespace lingua
+
+#endif // LINGUA_PARSER_PARSE_HPP
@@ -0,0 +1,58 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_PARSER_SYNTAX_ERROR_HPP
+#define LINGUA_PARSER_SYNTAX_ERROR_HPP
+
+#include "lingua/lexer/token.hpp"
+#include <cstdint>
+#include <string_view>
+
+namespace lingua {
+   enum class syntax_error_kind : std::uint8_t {
+      expected_item,
+      expected_expression,
+      expected_type,
+      expected_pattern,
+      expected_identifier,
+      expected_token,
+      too_deeply_nested,
+   };
+
+   /// \brief A syntax error, recorded by position in the same way as a lexical_error.
+   ///
+   /// An error at the end of the source has an empty range at the end of the source.
+   ///
+   struct syntax_error {
+      syntax_error_kind kind;
+
+      /// \brief The token that was expected, when `kind` is syntax_error_kind::expected_token.
+      ///
+      token_kind expected;
+      std::uint32_t offset;
+      std::uint32_t length;
+
+      /// \brief Returns the text that the error refers to.
+      /// \param source The source that the error was found in.
+      ///
+      [[nodiscard]] constexpr std::u8string_view text(std::u8string_view const source) const noexcept
+      { return source.substr(offset, length); }
+
+      [[nodiscard]] constexpr friend bool
+      operator==(syntax_error const&, syntax_error const&) noexcept = default;
+   };
+} // namespace lingua
+
+#endif // LINGUA_PARSER_SYNTAX_ERROR_HPP
@@ -0,0 +1,377 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_PARSER_SYNTAX_TREE_HPP
+#define LINGUA_PARSER_SYNTAX_TREE_HPP
+
+#include "lingua/lexer/token.hpp"
+#include "lingua/parser/syntax_error.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace lingua {
+   /// \brief What a node in a syntax_tree represents.
+   ///
+   /// The comment on each kind lists its children in order. A child that is optional is
+   /// no_syntax_node when it's absent, so a child is always found at the same position; `...`
+   /// marks a list, which is always the last thing in the children. Where a node has a main token,
+   /// it's named after the children, and otherwise the main token is the node's first token.
+   ///
+   enum class syntax_kind : std::uint8_t {
+      // items
+      /// item...
+      source_file,
+      /// (none); main token: `#`
+      attribute,
+      /// attribute...
+      attribute_list,
+      /// (none); main token: `pub`
+      visibility,
+      /// attributes, visibility, generic_parameters, parameter_list, return type, where_clause,
+      ///    body; main token: name
+      function,
+      /// parameter or self_parameter...
+      parameter_list,
+      /// pattern, type
+      parameter,
+      /// type; main token: `self`
+      self_parameter,
+      /// generic_parameter...
+      generic_parameters,
+      /// bound_list, default type; main token: name or lifetime
+      generic_parameter,
+      /// where_predicate...
+      where_clause,
+      /// type or lifetime, bound_list
+      where_predicate,
+      /// attributes, visibility, generic_parameters, where_clause, field_list or tuple_field_list;
+      ///    main token: name
+      structure,
+      /// attributes, visibility, generic_parameters, where_clause, variant_list; main token: name
+      enumeration,
+      /// variant...
+      variant_list,
+      /// attributes, field_list or tuple_field_list, discriminant; main token: name
+      variant,
+      /// field...
+      field_list,
+      /// attributes, visibility, type; main token: name
+      field,
+      /// tuple_field...
+      tuple_field_list,
+      /// attributes, visibility, type
+      tuple_field,
+      /// attributes, visibility, use_tree
+      use_declaration,
+      /// path, use_tree_list or use_glob or use_rename
+      use_tree,
+      /// use_tree...
+      use_tree_list,
+      /// (none); main token: `*`
+      use_glob,
+      /// (none); main token: name or `_`
+      use_rename,
+      /// attributes, visibility, item_list; main token: name
+      module,
+      /// item...
+      item_list,
+      /// attributes, visibility, type, value; main token: name
+      constant,
+      /// attributes, visibility, type, value; main token: name
+      static_variable,
+      /// attributes, visibility, generic_parameters, bound_list, type; main token: name
+      type_alias,
+      /// attributes, visibility, generic_parameters, trait, type, where_clause, item_list; main
+      ///    token: `impl`
+      implementation,
+      /// attributes, visibility, generic_parameters, bound_list, where_clause, item_list; main
+      ///    token: name
+      trait_declaration,
+      /// attributes, visibility, macro_invocation
+      macro_item,
+      /// path; main token: `!`
+      macro_invocation,
+      /// attributes, visibility, use_rename; main token: name or `self`
+      extern_crate,
+      /// attributes, visibility, item_list; main token: `extern`
+      extern_block,
+
+      // types
+      /// qualified_type or path_segment..., where only the first can be a qualified_type
+      path,
+      /// type, trait; main token: `<`
+      qualified_type,
+      /// generic_arguments; main token: name, `self`, `Self`, `super`, or `crate`
+      path_segment,
+      /// type or lifetime or associated_type_binding...
+      generic_arguments,
+      /// type; main token: name
+      associated_type_binding,
+      /// (none); main token: lifetime
+      lifetime,
+      /// type or lifetime...
+      bound_list,
+      /// lifetime, type; main token: `&`
+      reference_type,
+      /// type; main token: `*`
+      pointer_type,
+      /// return type, type...; main token: `fn`
+      function_type,
+      /// type...
+      tuple_type,
+      /// type, length
+      array_type,
+      /// type
+      slice_type,
+      /// bound_list; main token: `impl` or `dyn`
+      bounded_type,
+      /// (none); main token: `!`
+      never_type,
+      /// (none); main token: `_`
+      inferred_type,
+
+      // patterns
+      /// (none); main token: name
+      identifier_pattern,
+      /// pattern; main token: name
+      binding_pattern,
+      /// (none); main token: `_`
+      wildcard_pattern,
+      /// (none); main token: literal
+      literal_pattern,
+      /// path
+      path_pattern,
+      /// pattern...
+      tuple_pattern,
+      /// pattern...
+      slice_pattern,
+      /// path, pattern...
+      tuple_struct_pattern,
+      /// path, field_pattern...
+      struct_pattern,
+      /// pattern, or no_syntax_node for shorthand; main token: name, or `..` for the rest of the
+      ///    fields
+      field_pattern,
+      /// pattern; main token: `&`
+      reference_pattern,
+      /// (none); main token: `..`
+      rest_pattern,
+      /// pattern...
+      or_pattern,
+
+      // expressions
+      /// (none); main token: literal
+      literal,
+      /// operand; main token: operator
+      unary,
+      /// operand; main token: `&` or `&&`
+      reference,
+      /// left operand, right operand; main token: operator
+      binary,
+      /// start, end; main token: `..` or `..=`
+      range,
+      /// operand, type; main token: `as`
+      cast,
+      /// callee, argument...
+      call,
+      /// receiver, generic_arguments, argument...; main token: name
+      method_call,
+      /// receiver; main token: name
+      field_access,
+      /// operand, index
+      index,
+      /// operand; main token: `?`
+      try_expression,
+      /// expression
+      group,
+      /// expression...
+      tuple,
+      /// expression...
+      array,
+      /// value, length
+      array_repeat,
+      /// statement..., with the block's value as the last child if it has one
+      block,
+      /// block; main token: `unsafe`
+      unsafe_block,
+      /// condition, block, else branch
+      if_expression,
+      /// pattern, expression; main token: `let`
+      let_condition,
+      /// condition, block
+      while_expression,
+      /// block
+      loop_expression,
+      /// pattern, iterable, block
+      for_expression,
+      /// scrutinee, match_arm...
+      match_expression,
+      /// pattern, guard, expression
+      match_arm,
+      /// value
+      return_expression,
+      /// value
+      break_expression,
+      /// (none)
+      continue_expression,
+      /// path, field_initialiser...
+      struct_expression,
+      /// value, or no_syntax_node for shorthand; main token: name, or `..` for the base of a
+      ///    functional update
+      field_initialiser,
+      /// closure_parameter_list, return type, body
+      closure,
+      /// parameter...
+      closure_parameter_list,
+
+      // statements
+      /// attributes, pattern, type, initialiser, else block
+      let_statement,
+      /// attributes, expression
+      expression_statement,
+
+      /// (none); covers tokens that were skipped while recovering from a syntax error
+      error,
+   };
+
+   /// \brief Identifies a node by its index in a syntax_tree.
+   ///
+   enum class syntax_node : std::uint32_t {};
+
+   /// \brief Marks an optional child that is absent.
+   ///
+   inline constexpr auto no_syntax_node = syntax_node{~std::uint32_t{0}};
+
+   /// \brief The bytes of a source that a node covers.
+   ///
+   struct source_span {
+      std::uint32_t offset;
+      std::uint32_t length;
+
+      /// \brief Returns the text that the span covers.
+      ///
+      [[nodiscard]] constexpr std::u8string_view text(std::u8string_view const source) const noexcept
+      { return source.substr(offset, length); }
+
+      [[nodiscard]] constexpr friend bool
+      operator==(source_span const&, source_span const&) noexcept = default;
+   };
+
+   namespace detail_parse {
+      class parser;
+   } // namespace detail_parse
+
+   /// \brief A parsed source, stored as a flat arena of nodes.
+   ///
+   /// Nodes don't point at one another: each is an index into parallel arrays of kinds, main
+   /// tokens, spans, and child ranges, and the children of every node are stored contiguously in a
+   /// single array of indices. Building a tree is a handful of vector appends per node, and
+   /// destroying one frees a handful of vectors no matter how many nodes it has. Spans are stored
+   /// as byte ranges rather than source_coordinate_ranges, and are converted only when a
+   /// diagnostic needs them.
+   ///
+   /// Children are always created before their parent, so the root is the last node. Every node
+   /// covers at least one token, except the root of an empty source.
+   ///
+   class syntax_tree {
+   public:
+      /// \brief Returns the source_file node.
+      ///
+      [[nodiscard]] syntax_node root() const noexcept
+      { return syntax_node{static_cast<std::uint32_t>(kinds_.size() - 1)}; }
+
+      /// \brief Returns the number of nodes.
+      ///
+      [[nodiscard]] std::size_t size() const noexcept
+      { return kinds_.size(); }
+
+      [[nodiscard]] syntax_kind kind(syntax_node const n) const noexcept
+      { return kinds_[index(n)]; }
+      // [[expects: n is a node in the tree]]
+
+      [[nodiscard]] source_span span(syntax_node const n) const noexcept
+      { return spans_[index(n)]; }
+      // [[expects: n is a node in the tree]]
+
+      /// \brief Returns the token that identifies `n` (see syntax_kind).
+      ///
+      [[nodiscard]] token main_token(syntax_node const n) const noexcept
+      { return tokens_[main_tokens_[index(n)]]; }
+      // [[expects: n is a node in the tree]]
+
+      /// \brief Returns the children of `n`, in the order that syntax_kind documents.
+      ///
+      [[nodiscard]] std::span<syntax_node const> children(syntax_node const n) const noexcept
+      {
+         auto const [first, count] = children_ranges_[index(n)];
+         return std::span{children_}.subspan(first, count);
+      }
+      // [[expects: n is a node in the tree]]
+
+      /// \brief Returns the `i`th child of `n`.
+      ///
+      [[nodiscard]] syntax_node child(syntax_node const n, std::size_t const i) const noexcept
+      { return children(n)[i]; }
+      // [[expects: i < size(children(n))]]
+
+      /// \brief Returns the tokens that were parsed, without trivia.
+      ///
+      /// Where a `>` that closes a list of generic arguments was lexed as the start of a `>>`,
+      /// `>=`, or `>>=`, the token is replaced by the rest of it: `Vec<Vec<u8>>` has one `>`
+      /// token, which starts at the second `>`.
+      ///
+      [[nodiscard]] std::span<token const> tokens() const noexcept
+      { return tokens_; }
+
+      /// \brief Returns the syntax errors, ordered by offset.
+      ///
+      [[nodiscard]] std::span<syntax_error const> errors() const noexcept
+      { return errors_; }
+
+      /// \brief Returns the number of bytes that the nodes occupy, not counting spare capacity.
+      ///
+      [[nodiscard]] std::size_t size_in_bytes() const noexcept
+      {
+         return size() * (sizeof(syntax_kind) + sizeof(std::uint32_t) + sizeof(source_span)
+                        + sizeof(children_range))
+              + children_.size() * sizeof(syntax_node);
+      }
+
+   private:
+      friend class detail_parse::parser;
+
+      struct children_range {
+         std::uint32_t first;
+         std::uint32_t count;
+      };
+
+      std::vector<syntax_kind> kinds_;
+      std::vector<std::uint32_t> main_tokens_;
+      std::vector<source_span> spans_;
+      std::vector<children_range> children_ranges_;
+      std::vector<syntax_node> children_;
+      std::vector<token> tokens_;
+      std::vector<syntax_error> errors_;
+
+      [[nodiscard]] static std::size_t index(syntax_node const n) noexcept
+      { return static_cast<std::underlying_type_t<syntax_node>>(n); }
+   };
+} // namespace lingua
+
+#endif // LINGUA_PARSER_SYNTAX_TREE_HPP
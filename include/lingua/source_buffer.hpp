@@ -0,0 +1,170 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_SOURCE_BUFFER_HPP
+#define LINGUA_SOURCE_BUFFER_HPP
+
+#include "lingua/source_coordinate.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace lingua {
+   /// \brief Describes a change to a source: `removed` bytes starting at `offset` were replaced by
+   ///        `inserted` bytes.
+   ///
+   struct text_edit {
+      std::uint32_t offset;
+      std::uint32_t removed;
+      std::uint32_t inserted;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(text_edit const&, text_edit const&) noexcept = default;
+   };
+
+   /// \brief An editable source, stored as a rope so that an edit costs O(log n) rather than a
+   ///        copy of the whole source.
+   ///
+   /// The text is split into chunks of at most max_chunk_size bytes, which are kept in a balanced
+   /// tree. Each subtree knows how many bytes and newlines it holds, so both the offset → chunk
+   /// and the offset ↔ source_coordinate mappings are O(log n), and stay up to date as the text
+   /// changes.
+   ///
+   class source_buffer {
+   public:
+      static constexpr auto max_chunk_size = std::size_t{4096};
+
+      source_buffer() = default;
+
+      explicit source_buffer(std::u8string_view text);
+
+      /// \brief Returns the number of bytes in the source.
+      ///
+      [[nodiscard]] std::size_t size() const noexcept
+      { return bytes(root_); }
+
+      [[nodiscard]] bool empty() const noexcept
+      { return size() == 0; }
+
+      /// \brief Returns the number of lines in the source. An empty source has one line.
+      ///
+      [[nodiscard]] std::size_t line_count() const noexcept
+      { return newlines(root_) + 1; }
+
+      /// \brief Replaces `removed` bytes starting at `offset` with `inserted`.
+      /// \returns The edit, in the form that token_stream::relex expects.
+      ///
+      text_edit replace(std::size_t offset, std::size_t removed, std::u8string_view inserted);
+      // [[expects: offset + removed <= size()]]
+
+      text_edit insert(std::size_t const offset, std::u8string_view const inserted)
+      { return replace(offset, 0, inserted); }
+
+      text_edit erase(std::size_t const offset, std::size_t const removed)
+      { return replace(offset, removed, {}); }
+
+      /// \brief A contiguous piece of the source.
+      ///
+      struct chunk {
+         std::u8string_view text;
+         std::size_t offset;
+      };
+
+      /// \brief Returns the chunk that holds the byte at `offset`.
+      /// \note The chunk is invalidated by the next edit.
+      ///
+      [[nodiscard]] chunk chunk_at(std::size_t offset) const noexcept;
+      // [[expects: offset < size()]]
+
+      /// \brief Returns the byte at `offset`.
+      ///
+      [[nodiscard]] char8_t operator[](std::size_t const offset) const noexcept
+      {
+         auto const [text, begin] = chunk_at(offset);
+         return text[offset - begin];
+      }
+      // [[expects: offset < size()]]
+
+      /// \brief Returns a copy of `count` bytes starting at `offset`, or of the rest of the source if
+      ///        there are fewer than `count`.
+      ///
+      [[nodiscard]] std::u8string substr(std::size_t offset, std::size_t count) const;
+      // [[expects: offset <= size()]]
+
+      /// \brief Returns a copy of the whole source.
+      ///
+      [[nodiscard]] std::u8string str() const
+      { return substr(0, size()); }
+
+      /// \brief Returns the coordinate of the byte at `offset`. Columns are counted in bytes.
+      ///
+      [[nodiscard]] source_coordinate coordinate_of(std::size_t offset) const noexcept;
+      // [[expects: offset <= size()]]
+
+      /// \brief Returns the offset of `coordinate`.
+      ///
+      [[nodiscard]] std::size_t offset_of(source_coordinate coordinate) const noexcept;
+      // [[expects: coordinate.line() <= line_count()]]
+      // [[expects: the coordinate lies inside its line]]
+
+      /// \brief Returns the offset of the first byte of `line`, which counts from 1.
+      ///
+      [[nodiscard]] std::size_t line_begin(std::size_t line) const noexcept;
+      // [[expects: 1 <= line and line <= line_count()]]
+
+   private:
+      using index_type = std::uint32_t;
+      static constexpr auto none = ~index_type{0};
+
+      struct node {
+         std::u8string text;
+         index_type left = none;
+         index_type right = none;
+         std::uint32_t priority = 0;
+         std::size_t bytes = 0;
+         std::size_t newlines = 0;
+         std::size_t text_newlines = 0;
+      };
+
+      /// \brief Nodes are addressed by index, so that the tree can be moved and copied without
+      ///        fixing up pointers.
+      ///
+      std::vector<node> nodes_;
+      std::vector<index_type> free_;
+      index_type root_ = none;
+      std::uint32_t seed_ = 0x9e3779b9;
+
+      [[nodiscard]] std::size_t bytes(index_type const t) const noexcept
+      { return t == none ? 0 : nodes_[t].bytes; }
+
+      [[nodiscard]] std::size_t newlines(index_type const t) const noexcept
+      { return t == none ? 0 : nodes_[t].newlines; }
+
+      void update(index_type t) noexcept;
+      [[nodiscard]] index_type make_node(std::u8string_view text);
+      [[nodiscard]] index_type make_tree(std::u8string_view text);
+      void release(index_type t) noexcept;
+
+      [[nodiscard]] std::pair<index_type, index_type> split(index_type t, std::size_t offset);
+      [[nodiscard]] index_type merge(index_type left, index_type right) noexcept;
+      [[nodiscard]] bool insert_in_place(index_type t, std::size_t offset, std::u8string_view text);
+      void coalesce(std::size_t offset);
+   };
+} // namespace lingua
+
+#endif // LINGUA_SOURCE_BUFFER_HPP
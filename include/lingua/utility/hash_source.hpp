@@ -0,0 +1,150 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_UTILITY_HASH_SOURCE_HPP
+#define LINGUA_UTILITY_HASH_SOURCE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace lingua::detail_hash_source {
+   /// \brief Generates a table of fixed pseudo-random constants using splitmix64, so that the
+   ///        tables that the hashes depend on don't need to be spelt out.
+   ///
+   template<std::size_t N>
+   [[nodiscard]] constexpr std::array<std::uint64_t, N> make_constants(std::uint64_t state) noexcept
+   {
+      auto result = std::array<std::uint64_t, N>{};
+      for (auto& entry : result) {
+         state += 0x9e3779b97f4a7c15;
+         auto z = state;
+         z = (z ^ (z >> 30U)) * 0xbf58476d1ce4e5b9;
+         z = (z ^ (z >> 27U)) * 0x94d049bb133111eb;
+         entry = z ^ (z >> 31U);
+      }
+      return result;
+   }
+
+   inline constexpr auto gear_table = make_constants<256>(0x6c696e677561);
+} // namespace lingua::detail_hash_source
+
+namespace lingua {
+   /// \brief A 128-bit, non-cryptographic digest of some source text.
+   ///
+   struct source_digest {
+      std::uint64_t low;
+      std::uint64_t high;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(source_digest const&, source_digest const&) noexcept = default;
+   };
+
+   /// \brief Incrementally computes the digest of a source that arrives in pieces.
+   ///
+   /// The digest depends only on the bytes, not on how they were split between calls to update, and
+   /// is the same on every machine. This lets a pass that already walks the source (e.g. loading,
+   /// or counting lines) hash each piece while it is still in cache, rather than reading the source
+   /// a second time.
+   ///
+   class source_hasher {
+   public:
+      static constexpr auto stripe_size = std::size_t{64};
+
+      source_hasher() noexcept;
+
+      /// \brief Appends `source` to the hashed text.
+      ///
+      void update(std::u8string_view source) noexcept;
+
+      /// \brief Returns the digest of everything passed to update so far.
+      ///
+      [[nodiscard]] source_digest digest() const noexcept;
+
+   private:
+      std::array<std::uint64_t, 8> accumulators_;
+      std::array<char8_t, stripe_size> buffer_{};
+      std::size_t buffered_ = 0;
+      std::size_t stripes_ = 0;
+      std::uint64_t size_ = 0;
+   };
+
+   /// \brief Returns the 128-bit digest of `source`.
+   ///
+   [[nodiscard]] source_digest hash_source(std::u8string_view source) noexcept;
+
+   /// \brief Returns the low 64 bits of `hash_source(source)`.
+   ///
+   [[nodiscard]] inline std::uint64_t hash_source_64(std::u8string_view const source) noexcept
+   { return hash_source(source).low; }
+
+   struct hashed_lines {
+      source_digest digest;
+      std::size_t newlines;
+   };
+
+   /// \brief Hashes `source` and counts its newlines in a single pass.
+   ///
+   [[nodiscard]] hashed_lines hash_and_count_lines(std::u8string_view source) noexcept;
+
+   /// \brief A gear hash: a rolling hash over (roughly) the last 64 bytes pushed, which needs no
+   ///        explicit window because older bytes are shifted out.
+   ///
+   class gear_hash {
+   public:
+      constexpr void push(char8_t const c) noexcept
+      { value_ = (value_ << 1U) + detail_hash_source::gear_table[c]; }
+
+      [[nodiscard]] constexpr std::uint64_t value() const noexcept
+      { return value_; }
+
+   private:
+      std::uint64_t value_ = 0;
+   };
+
+   struct chunking_options {
+      std::size_t min_size = 256;
+      /// \brief Must be a power of two.
+      ///
+      std::size_t average_size = 1024;
+      std::size_t max_size = 8192;
+   };
+
+   /// \brief A content-defined region of a source.
+   ///
+   struct source_chunk {
+      std::size_t offset;
+      std::size_t size;
+      std::uint64_t digest;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(source_chunk const&, source_chunk const&) noexcept = default;
+   };
+
+   /// \brief Splits `source` into chunks whose boundaries depend only on nearby bytes.
+   ///
+   /// An edit only changes the chunks that it touches (and occasionally a neighbour), so comparing
+   /// the chunks of two versions of a file finds the regions that changed, without a diff.
+   ///
+   [[nodiscard]] std::vector<source_chunk>
+   chunk_source(std::u8string_view source, chunking_options const& options = {});
+   // [[expects: options.min_size <= options.average_size]]
+   // [[expects: options.average_size <= options.max_size]]
+   // [[expects: has_single_bit(options.average_size)]]
+} // namespace lingua
+
+#endif // LINGUA_UTILITY_HASH_SOURCE_HPP
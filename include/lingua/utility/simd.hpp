@@ -0,0 +1,98 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_UTILITY_SIMD_HPP
+#define LINGUA_UTILITY_SIMD_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#if (defined(__x86_64__) or defined(__i386__)) and (defined(__GNUC__) or defined(__clang__))
+#   define LINGUA_SIMD_X86 1
+#   define LINGUA_SIMD_STRINGIFY(...) #__VA_ARGS__
+
+// Code between LINGUA_SIMD_BEGIN_TARGET and LINGUA_SIMD_END_TARGET may use the instructions of
+// `features`, whatever the rest of the translation unit was compiled for. It mustn't be called
+// unless active_simd_level() says that the processor has them.
+#   if defined(__clang__)
+#      define LINGUA_SIMD_BEGIN_TARGET(features)                                             \
+         _Pragma(LINGUA_SIMD_STRINGIFY(                                                    \
+            clang attribute push(__attribute__((target(features))), apply_to = function)))
+#      define LINGUA_SIMD_END_TARGET _Pragma("clang attribute pop")
+#   else
+#      define LINGUA_SIMD_BEGIN_TARGET(features) \
+         _Pragma("GCC push_options") _Pragma(LINGUA_SIMD_STRINGIFY(GCC target(features)))
+#      define LINGUA_SIMD_END_TARGET _Pragma("GCC pop_options")
+#   endif // defined(__clang__)
+#endif
+
+namespace lingua {
+   /// \brief The instruction sets that kernels are specialised for, from least to most capable.
+   ///        Each level includes the ones before it.
+   ///
+   /// `scalar` is whatever the whole program was compiled for, which is SSE2 on x86-64. `avx512`
+   /// is AVX-512F with the BW and VL extensions.
+   ///
+   enum class simd_level : std::uint8_t { scalar, sse4_2, avx2, avx512 };
+
+   inline constexpr auto simd_level_count = std::size_t{4};
+
+   /// \brief Returns the most capable level that both the processor and the operating system
+   ///        support.
+   ///
+   [[nodiscard]] simd_level supported_simd_level() noexcept;
+
+   /// \brief Returns the level that kernels dispatch on.
+   ///
+   /// It's decided when it's first needed: the supported level, or the level named by the
+   /// `LINGUA_SIMD` environment variable if that's lower. The variable can't raise the level above
+   /// what's supported, and names that parse_simd_level doesn't know are ignored.
+   ///
+   [[nodiscard]] simd_level active_simd_level() noexcept;
+
+   /// \brief Makes kernels dispatch on `level` from now on, so that tests can run every variant.
+   /// \returns The level that was active.
+   ///
+   simd_level set_simd_level(simd_level level) noexcept;
+   // [[expects: level <= supported_simd_level()]]
+
+   /// \brief Returns the name of `level`, which is also how the `LINGUA_SIMD` environment variable
+   ///        spells it.
+   ///
+   [[nodiscard]] std::string_view simd_level_name(simd_level level) noexcept;
+
+   /// \brief Returns the level called `name`: one of "scalar", "sse4.2", "avx2", or "avx512".
+   ///
+   [[nodiscard]] std::optional<simd_level> parse_simd_level(std::string_view name) noexcept;
+
+   /// \brief One implementation of a kernel for each simd_level.
+   ///
+   /// Kernels that don't have an implementation specific to a level repeat the one for the level
+   /// below it.
+   ///
+   template<class Function>
+   using simd_variants = std::array<Function*, simd_level_count>;
+
+   /// \brief Returns the variant of a kernel for the active level.
+   ///
+   template<class Function>
+   [[nodiscard]] Function* select_variant(simd_variants<Function> const& variants) noexcept
+   { return variants[static_cast<std::size_t>(active_simd_level())]; }
+} // namespace lingua
+
+#endif // LINGUA_UTILITY_SIMD_HPP
@@ -0,0 +1,72 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_UTILITY_STRING_ARENA_HPP
+#define LINGUA_UTILITY_STRING_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace lingua {
+   /// \brief A bump allocator for strings that all live as long as one another.
+   ///
+   /// Storage is handed out from large blocks, so storing a string costs a pointer increment rather
+   /// than a call to operator new, and everything is freed at once when the arena is destroyed.
+   /// Storage never moves, so views into it stay valid for the arena's lifetime.
+   ///
+   class string_arena {
+   public:
+      static constexpr auto default_block_size = std::size_t{64 * 1024};
+
+      string_arena() = default;
+
+      /// \param block_size The size of each block. Requests larger than this get a block of their
+      ///        own.
+      ///
+      explicit string_arena(std::size_t block_size) noexcept;
+
+      /// \brief Returns `size` bytes of uninitialised storage.
+      ///
+      [[nodiscard]] std::span<char8_t> allocate(std::size_t size);
+
+      /// \brief Returns the last `size` bytes of the most recent allocation to the arena, so that a
+      ///        writer can allocate an upper bound and then give back what it didn't use.
+      ///
+      void shrink(std::size_t size) noexcept;
+      // [[expects: size <= the size of the most recent allocation]]
+
+      /// \brief Copies `text` into the arena, and returns a view of the copy.
+      ///
+      [[nodiscard]] std::u8string_view store(std::u8string_view text);
+
+      /// \brief Returns the number of bytes currently allocated from the arena.
+      ///
+      [[nodiscard]] std::size_t bytes_used() const noexcept
+      { return bytes_used_; }
+   private:
+      std::vector<std::unique_ptr<char8_t[]>> blocks_;
+      std::size_t block_size_ = default_block_size;
+      char8_t* next_ = nullptr;
+      std::size_t remaining_ = 0;
+      std::size_t last_allocation_ = 0;
+      bool last_oversized_ = false;
+      std::size_t bytes_used_ = 0;
+   };
+} // namespace lingua
+
+#endif // LINGUA_UTILITY_STRING_ARENA_HPP
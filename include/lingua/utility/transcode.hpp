@@ -0,0 +1,53 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_UTILITY_TRANSCODE_HPP
+#define LINGUA_UTILITY_TRANSCODE_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace lingua {
+   enum class source_encoding : std::uint8_t { automatic, utf8, utf16_le, utf16_be, latin1 };
+
+   /// \brief Identifies the encoding of `bytes` from its byte order mark.
+   /// \returns `utf16_le` or `utf16_be` if `bytes` starts with the matching byte order mark, and
+   ///          `utf8` otherwise.
+   ///
+   /// Latin-1 has no byte order mark, and nearly every byte sequence is valid Latin-1, so it's
+   /// never detected: it has to be asked for.
+   ///
+   [[nodiscard]] source_encoding detect_encoding(std::u8string_view bytes) noexcept;
+
+   /// \brief Returns the UTF-8 form of `bytes`, which are encoded in `encoding`. A UTF-16 byte
+   ///        order mark is dropped, and UTF-8 is copied as it is.
+   ///
+   /// Ill-formed UTF-16 stays ill-formed, so that validate_utf8 reports it at its offset in the
+   /// result: a lone surrogate is written the way UTF-8 would write its value, and a final odd
+   /// byte is written as 0xFF.
+   ///
+   /// On processors with SSE4.2, eight characters are transcoded at a time while every one of them
+   /// fits in two UTF-8 bytes, which covers all of Latin-1 and most UTF-16 source code. The UTF-8
+   /// bytes are made for every character at once, and a shuffle then squeezes out the empty second
+   /// byte of each ASCII character. Characters that need three or four bytes are transcoded one at
+   /// a time.
+   ///
+   [[nodiscard]] std::u8string
+   transcode_to_utf8(std::u8string_view bytes, source_encoding encoding);
+   // [[expects: encoding != source_encoding::automatic]]
+} // namespace lingua
+
+#endif // LINGUA_UTILITY_TRANSCODE_HPP
@@ -0,0 +1,56 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_UTILITY_VALIDATE_UTF8_HPP
+#define LINGUA_UTILITY_VALIDATE_UTF8_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace lingua {
+   /// \brief Where a source first stops being valid UTF-8, if it does.
+   ///
+   struct utf8_validation {
+      /// \brief The offset of the first invalid sequence. It's unspecified if the source is valid.
+      ///
+      std::size_t error_offset = 0;
+
+      /// \brief The length of the first invalid sequence: the longest prefix of it that could
+      ///        begin a valid sequence, or one byte if there's no such prefix. Zero if the source is
+      ///        valid.
+      ///
+      std::uint8_t error_length = 0;
+
+      [[nodiscard]] constexpr bool valid() const noexcept
+      { return error_length == 0; }
+
+      [[nodiscard]] constexpr friend bool
+      operator==(utf8_validation const&, utf8_validation const&) noexcept = default;
+   };
+
+   /// \brief Checks that `source` is well-formed UTF-8, as defined by the Unicode Standard: no
+   ///        overlong encodings, no surrogates, nothing above U+10FFFF, and no truncated
+   ///        sequences.
+   ///
+   /// On processors with AVX2 or SSE4.2, each 32- or 16-byte block is checked with a handful of
+   /// table lookups on the high and low nibbles of each byte and its predecessors, and blocks of
+   /// ASCII are skipped with a single test. Only once a block is known to hold an error does a
+   /// scalar decoder look for exactly where it starts.
+   ///
+   [[nodiscard]] utf8_validation validate_utf8(std::u8string_view source) noexcept;
+} // namespace lingua
+
+#endif // LINGUA_UTILITY_VALIDATE_UTF8_HPP
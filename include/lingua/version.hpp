@@ -0,0 +1,29 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_VERSION_HPP
+#define LINGUA_VERSION_HPP
+
+#include <cstdint>
+
+namespace lingua {
+   /// \brief The version of lingua, which must be kept in sync with conanfile.py. Anything that
+   ///        persists lingua's output (e.g. token_cache) is keyed on this.
+   ///
+   inline constexpr auto version_major = std::uint32_t{0};
+   inline constexpr auto version_minor = std::uint32_t{1};
+} // namespace lingua
+
+#endif // LINGUA_VERSION_HPP
@@ -0,0 +1,550 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/cache/token_cache.hpp"
+#include "lingua/utility/contract.hpp"
+#include "lingua/version.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fmt/format.h>
+#include <fstream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if __has_include(<sys/mman.h>)
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#   define LINGUA_HAS_MMAP 1
+#endif // __has_include(<sys/mman.h>)
+
+namespace {
+   namespace fs = std::filesystem;
+
+   /// \brief Bumped whenever the layout of a cache file, lingua::token, or lingua::lexer_checkpoint
+   ///        changes.
+   ///
+   constexpr auto format_version = std::uint32_t{4};
+   constexpr auto magic = std::array{'l', 'i', 'n', 'g', 'u', 'a', 't', 'k'};
+   constexpr auto byte_order_mark = std::uint32_t{0x01020304};
+   constexpr auto entry_extension = ".tokens";
+   constexpr auto temporary_extension = ".tmp";
+
+   /// \brief Temporary files older than this are assumed to belong to a process that died before it
+   ///        could rename them into place.
+   ///
+   constexpr auto abandoned_temporary_age = std::chrono::minutes{10};
+
+   struct file_header {
+      std::array<char, 8> magic;
+      std::uint32_t format_version;
+      std::uint32_t version_major;
+      std::uint32_t version_minor;
+      std::uint32_t byte_order_mark;
+      std::uint64_t content_hash_low;
+      std::uint64_t content_hash_high;
+      std::uint64_t content_size;
+      std::uint64_t token_count;
+      std::uint64_t checkpoint_count;
+      std::uint64_t diagnostic_count;
+      std::uint64_t string_table_size;
+      std::uint64_t body_hash_low;
+      std::uint64_t body_hash_high;
+   };
+   static_assert(sizeof(file_header) == 96);
+
+   struct diagnostic_record {
+      std::int64_t begin_line;
+      std::int64_t begin_column;
+      std::int64_t end_line;
+      std::int64_t end_column;
+      std::uint32_t level;
+      std::uint32_t message_offset;
+      std::uint32_t message_length;
+      std::uint32_t reserved;
+   };
+   static_assert(sizeof(diagnostic_record) == 48);
+
+   [[nodiscard]] constexpr std::size_t align_up(std::size_t const n, std::size_t const alignment) noexcept
+   { return (n + alignment - 1) / alignment * alignment; }
+
+   [[nodiscard]] constexpr std::size_t tokens_offset() noexcept
+   { return sizeof(file_header); }
+
+   [[nodiscard]] constexpr std::size_t checkpoints_offset(std::size_t const token_count) noexcept
+   {
+      return align_up(tokens_offset() + token_count * sizeof(lingua::token),
+         alignof(lingua::lexer_checkpoint));
+   }
+
+   [[nodiscard]] constexpr std::size_t
+   diagnostics_offset(std::size_t const token_count, std::size_t const checkpoint_count) noexcept
+   {
+      return align_up(checkpoints_offset(token_count) + checkpoint_count * sizeof(lingua::lexer_checkpoint),
+         alignof(diagnostic_record));
+   }
+
+   [[nodiscard]] constexpr std::size_t strings_offset(std::size_t const token_count,
+      std::size_t const checkpoint_count, std::size_t const diagnostic_count) noexcept
+   {
+      return diagnostics_offset(token_count, checkpoint_count)
+           + diagnostic_count * sizeof(diagnostic_record);
+   }
+
+   [[nodiscard]] bool valid_header(file_header const& header, lingua::token_cache_key const key,
+      std::size_t const file_size) noexcept
+   {
+      if (header.magic != magic
+          or header.format_version != format_version
+          or header.version_major != lingua::version_major
+          or header.version_minor != lingua::version_minor
+          or header.byte_order_mark != byte_order_mark
+          or header.content_hash_low != key.hash.low
+          or header.content_hash_high != key.hash.high
+          or header.content_size != key.size
+          or header.content_size > lingua::max_source_size) {
+         return false;
+      }
+
+      // Bound the counts before using them, so that a corrupt header can't overflow the arithmetic.
+      return header.token_count <= file_size / sizeof(lingua::token)
+         and header.checkpoint_count <= file_size / sizeof(lingua::lexer_checkpoint)
+         and header.diagnostic_count <= file_size / sizeof(diagnostic_record)
+         and header.string_table_size <= file_size
+         and strings_offset(header.token_count, header.checkpoint_count, header.diagnostic_count)
+             + header.string_table_size == file_size;
+   }
+
+   /// \brief Checks that a checkpoint describes a position in a source of `source_size` bytes.
+   ///
+   [[nodiscard]] bool valid_checkpoint(lingua::lexer_checkpoint const& checkpoint,
+      std::uint32_t const source_size) noexcept
+   {
+      return checkpoint.offset <= source_size
+         and checkpoint.token_offset <= checkpoint.offset
+         and checkpoint.mode <= lingua::lexer_mode::block_comment
+         and checkpoint.kind <= lingua::token_kind::unknown;
+   }
+
+   /// \brief Checks that a diagnostic record has a known level, a well-formed range, and a message
+   ///        inside the string table.
+   ///
+   [[nodiscard]] bool valid_record(diagnostic_record const& record, std::size_t const strings_size)
+      noexcept
+   {
+      auto const begin = std::pair{record.begin_line, record.begin_column};
+      auto const end = std::pair{record.end_line, record.end_column};
+      return record.level <= static_cast<std::uint32_t>(lingua::diagnostic_level::ill_formed)
+         and std::uint64_t{record.message_offset} + record.message_length <= strings_size
+         and record.begin_line >= 0 and record.begin_column >= 0
+         and record.end_line >= 0 and record.end_column >= 0
+         and begin <= end;
+   }
+
+   /// \brief Returns the bytes that follow the header, as the hasher sees them.
+   ///
+   [[nodiscard]] std::u8string_view body(std::byte const* const bytes, std::size_t const size) noexcept
+   {
+      return std::u8string_view{reinterpret_cast<char8_t const*>(bytes + sizeof(file_header)),
+         size - sizeof(file_header)};
+   }
+
+   /// \brief Returns the contents of the file at `path` as a shared, read-only buffer.
+   ///
+   [[nodiscard]] std::shared_ptr<void const>
+   map_file(fs::path const& path, std::size_t& size) noexcept
+   {
+#ifdef LINGUA_HAS_MMAP
+      auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0) {
+         return nullptr;
+      }
+
+      struct ::stat status{};
+      if (::fstat(fd, &status) != 0 or status.st_size < static_cast<::off_t>(sizeof(file_header))) {
+         ::close(fd);
+         return nullptr;
+      }
+
+      size = static_cast<std::size_t>(status.st_size);
+      auto* const mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+      if (mapping == MAP_FAILED) {
+         return nullptr;
+      }
+
+      try {
+         return std::shared_ptr<void const>{mapping, [size](void const* const p) noexcept {
+            ::munmap(const_cast<void*>(p), size);
+         }};
+      }
+      catch (std::bad_alloc const&) {
+         ::munmap(mapping, size);
+         return nullptr;
+      }
+#else
+      try {
+         auto in = std::ifstream{path, std::ios::binary | std::ios::ate};
+         if (not in) {
+            return nullptr;
+         }
+         auto const end = in.tellg();
+         if (end < static_cast<std::streamoff>(sizeof(file_header))) {
+            return nullptr;
+         }
+         size = static_cast<std::size_t>(end);
+         auto buffer = std::shared_ptr<std::byte[]>{new std::byte[size]};
+         in.seekg(0);
+         in.read(reinterpret_cast<char*>(buffer.get()), static_cast<std::streamsize>(size));
+         return in ? std::shared_ptr<void const>{buffer, buffer.get()} : nullptr;
+      }
+      catch (...) {
+         return nullptr;
+      }
+#endif // LINGUA_HAS_MMAP
+   }
+
+   template<class T>
+   void write_object(std::ofstream& out, T const& value)
+   { out.write(reinterpret_cast<char const*>(&value), sizeof(T)); }
+
+   /// \brief Writes the body of an entry, hashing it on the way out.
+   ///
+   class body_writer {
+   public:
+      explicit body_writer(std::ofstream& out) noexcept
+         : out_{out}
+      {}
+
+      void write(void const* const data, std::size_t const size)
+      {
+         auto const text = std::u8string_view{static_cast<char8_t const*>(data), size};
+         hasher_.update(text);
+         out_.write(reinterpret_cast<char const*>(text.data()), static_cast<std::streamsize>(size));
+      }
+
+      template<class T>
+      void write_object(T const& value)
+      { write(&value, sizeof(T)); }
+
+      [[nodiscard]] lingua::source_digest digest() const noexcept
+      { return hasher_.digest(); }
+
+   private:
+      std::ofstream& out_;
+      lingua::source_hasher hasher_;
+   };
+
+   [[nodiscard]] fs::path temporary_path(fs::path const& entry)
+   {
+      static auto const process_tag = std::random_device{}();
+      static auto counter = std::atomic<std::uint64_t>{0};
+      auto result = entry;
+      result += fmt::format(".{:x}.{:x}{}", process_tag, counter++, temporary_extension);
+      return result;
+   }
+} // namespace
+
+namespace lingua {
+   std::span<lexer_checkpoint const> token_cache_entry::checkpoints() const noexcept
+   {
+      auto const valid = std::ranges::all_of(checkpoints_, [this](lexer_checkpoint const& c) {
+         return valid_checkpoint(c, source_size_);
+      });
+      auto const ordered = std::ranges::is_sorted(checkpoints_, {}, &lexer_checkpoint::offset);
+      return valid and ordered ? checkpoints_ : std::span<lexer_checkpoint const>{};
+   }
+
+   std::vector<cached_diagnostic> token_cache_entry::diagnostics() const
+   {
+      auto result = std::vector<cached_diagnostic>{};
+      result.reserve(diagnostics_.size() / sizeof(diagnostic_record));
+      for (auto i = std::size_t{0}; i < diagnostics_.size(); i += sizeof(diagnostic_record)) {
+         auto record = diagnostic_record{};
+         std::memcpy(&record, diagnostics_.data() + i, sizeof(record));
+         if (not valid_record(record, strings_.size())) {
+            continue;
+         }
+         result.push_back(cached_diagnostic{
+            static_cast<diagnostic_level>(record.level),
+            source_coordinate_range{
+               source_coordinate{
+                  source_coordinate::line_type{record.begin_line},
+                  source_coordinate::column_type{record.begin_column}
+               },
+               source_coordinate{
+                  source_coordinate::line_type{record.end_line},
+                  source_coordinate::column_type{record.end_column}
+               }
+            },
+            strings_.substr(record.message_offset, record.message_length)
+         });
+      }
+      return result;
+   }
+
+   token_cache::token_cache(std::filesystem::path directory, std::uintmax_t const max_size)
+      : directory_{std::move(directory)}
+      , max_size_{max_size}
+   {
+      fs::create_directories(directory_);
+      estimated_size_ = measure();
+   }
+
+   token_cache_key token_cache::make_key(std::u8string_view const source) noexcept
+   { return token_cache_key{hash_source(source), source.size()}; }
+
+   std::optional<token_cache_entry>
+   token_cache::load(token_cache_key const key, cache_verification const verification) const noexcept
+   try {
+      auto const path = entry_path(key);
+      auto size = std::size_t{0};
+      auto mapping = map_file(path, size);
+      if (mapping == nullptr) {
+         return std::nullopt;
+      }
+
+      auto const* const bytes = static_cast<std::byte const*>(mapping.get());
+      auto header = file_header{};
+      std::memcpy(&header, bytes, sizeof(header));
+      if (not valid_header(header, key, size)) {
+         return std::nullopt;
+      }
+
+      // A corrupt entry could describe tokens outside the source, but rather than read every record
+      // here, each one is checked against the source when the consumer reads it. Only a caller that
+      // asks for it pays for a second pass of hash_source, over the whole entry.
+      auto const body_hash = source_digest{header.body_hash_low, header.body_hash_high};
+      if (verification == cache_verification::digest and hash_source(body(bytes, size)) != body_hash) {
+         return std::nullopt;
+      }
+
+      auto const token_count = static_cast<std::size_t>(header.token_count);
+      auto const checkpoint_count = static_cast<std::size_t>(header.checkpoint_count);
+      auto const diagnostic_count = static_cast<std::size_t>(header.diagnostic_count);
+
+      auto result = token_cache_entry{};
+      result.source_size_ = static_cast<std::uint32_t>(header.content_size);
+      result.tokens_ = std::span{
+         reinterpret_cast<token const*>(bytes + tokens_offset()),
+         token_count
+      };
+      result.checkpoints_ = std::span{
+         reinterpret_cast<lexer_checkpoint const*>(bytes + checkpoints_offset(token_count)),
+         checkpoint_count
+      };
+      result.diagnostics_ = std::span{
+         bytes + diagnostics_offset(token_count, checkpoint_count),
+         diagnostic_count * sizeof(diagnostic_record)
+      };
+      result.strings_ = std::u8string_view{
+         reinterpret_cast<char8_t const*>(bytes + strings_offset(token_count, checkpoint_count,
+            diagnostic_count)),
+         static_cast<std::size_t>(header.string_table_size)
+      };
+      result.mapping_ = std::move(mapping);
+
+      // Entries are evicted in order of their modification time, so touching the entry on each hit
+      // makes eviction least-recently-used, rather than least-recently-written.
+      auto ignored = std::error_code{};
+      fs::last_write_time(path, fs::file_time_type::clock::now(), ignored);
+      return result;
+   }
+   catch (...) {
+      return std::nullopt;
+   }
+
+   bool token_cache::store(token_cache_key const key, std::span<token const> const tokens,
+      std::span<cached_diagnostic const> const diagnostics,
+      std::span<lexer_checkpoint const> const checkpoints) noexcept
+   try {
+      auto const path = entry_path(key);
+      auto const temporary = temporary_path(path);
+      {
+         auto out = std::ofstream{temporary, std::ios::binary | std::ios::trunc};
+         auto string_table_size = std::size_t{0};
+         for (auto const& diagnostic : diagnostics) {
+            string_table_size += diagnostic.help_message.size();
+         }
+
+         auto header = file_header{
+            magic,
+            format_version,
+            version_major,
+            version_minor,
+            byte_order_mark,
+            key.hash.low,
+            key.hash.high,
+            key.size,
+            tokens.size(),
+            checkpoints.size(),
+            diagnostics.size(),
+            string_table_size,
+            0,
+            0
+         };
+         // The header is written again once the body's digest is known.
+         write_object(out, header);
+
+         auto writer = body_writer{out};
+         constexpr auto zeroes = std::array<char, alignof(diagnostic_record)>{};
+         writer.write(tokens.data(), tokens.size_bytes());
+         writer.write(zeroes.data(),
+            checkpoints_offset(tokens.size()) - tokens_offset() - tokens.size_bytes());
+
+         writer.write(checkpoints.data(), checkpoints.size_bytes());
+         writer.write(zeroes.data(),
+            diagnostics_offset(tokens.size(), checkpoints.size()) - checkpoints_offset(tokens.size())
+            - checkpoints.size_bytes());
+
+         auto message_offset = std::uint32_t{0};
+         for (auto const& diagnostic : diagnostics) {
+            auto const coordinates = diagnostic.coordinates;
+            auto const message_length = static_cast<std::uint32_t>(diagnostic.help_message.size());
+            writer.write_object(diagnostic_record{
+               static_cast<std::int64_t>(coordinates.begin().line()),
+               static_cast<std::int64_t>(coordinates.begin().column()),
+               static_cast<std::int64_t>(coordinates.end().line()),
+               static_cast<std::int64_t>(coordinates.end().column()),
+               static_cast<std::uint32_t>(diagnostic.level),
+               message_offset,
+               message_length,
+               0
+            });
+            message_offset += message_length;
+         }
+
+         for (auto const& diagnostic : diagnostics) {
+            writer.write(diagnostic.help_message.data(), diagnostic.help_message.size());
+         }
+
+         auto const digest = writer.digest();
+         header.body_hash_low = digest.low;
+         header.body_hash_high = digest.high;
+         out.seekp(0);
+         write_object(out, header);
+
+         out.close();
+         if (not out) {
+            auto ignored = std::error_code{};
+            fs::remove(temporary, ignored);
+            return false;
+         }
+      }
+
+      auto error = std::error_code{};
+      auto const size = fs::file_size(temporary, error);
+      // rename atomically replaces any entry that another process wrote for the same key
+      fs::rename(temporary, path, error);
+      if (error) {
+         fs::remove(temporary, error);
+         return false;
+      }
+
+      estimated_size_ += size;
+      if (estimated_size_ > max_size_) {
+         // Other processes may have evicted entries since the last measurement.
+         estimated_size_ = measure();
+         if (estimated_size_ > max_size_) {
+            evict(max_size_ / 4 * 3);
+         }
+      }
+      return true;
+   }
+   catch (...) {
+      return false;
+   }
+
+   void token_cache::evict(std::uintmax_t const target_size) noexcept
+   try {
+      struct candidate {
+         fs::file_time_type last_used;
+         std::uintmax_t size;
+         fs::path path;
+      };
+
+      auto const now = fs::file_time_type::clock::now();
+      auto candidates = std::vector<candidate>{};
+      auto total = std::uintmax_t{0};
+      auto error = std::error_code{};
+      for (auto i = fs::directory_iterator{directory_, error}; not error and i != fs::directory_iterator{};
+           i.increment(error)) {
+         auto const& path = i->path();
+         auto const last_write = i->last_write_time(error);
+         if (error) {
+            error.clear();
+            continue;
+         }
+
+         if (path.extension() == temporary_extension and now - last_write > abandoned_temporary_age) {
+            fs::remove(path, error);
+            error.clear();
+         }
+         else if (path.extension() == entry_extension) {
+            auto const size = i->file_size(error);
+            if (error) {
+               error.clear();
+               continue;
+            }
+            total += size;
+            candidates.push_back(candidate{last_write, size, path});
+         }
+      }
+
+      std::sort(candidates.begin(), candidates.end(), [](candidate const& x, candidate const& y) {
+         return x.last_used < y.last_used;
+      });
+      for (auto const& c : candidates) {
+         if (total <= target_size) {
+            break;
+         }
+         // Removing an entry doesn't invalidate it for readers that have already mapped it, and
+         // failing to remove it means that another process got there first.
+         fs::remove(c.path, error);
+         total -= c.size;
+      }
+      estimated_size_ = total;
+   }
+   catch (...) {
+      // Eviction is best-effort: the next store will try again.
+   }
+
+   std::filesystem::path token_cache::entry_path(token_cache_key const key) const
+   {
+      return directory_ / fmt::format("{}.{}-{}-{:016x}{:016x}-{:x}{}", version_major, version_minor,
+         format_version, key.hash.high, key.hash.low, key.size, entry_extension);
+   }
+
+   std::uintmax_t token_cache::measure() const noexcept
+   {
+      auto total = std::uintmax_t{0};
+      auto error = std::error_code{};
+      for (auto i = fs::directory_iterator{directory_, error}; not error and i != fs::directory_iterator{};
+           i.increment(error)) {
+         if (i->path().extension() == entry_extension) {
+            auto size_error = std::error_code{};
+            auto const size = i->file_size(size_error);
+            total += size_error ? 0 : size;
+         }
+      }
+      return total;
+   }
+} // namespace lingua
@@ -0,0 +1,812 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/io/load_files.hpp"
+#include "lingua/utility/contract.hpp"
+#include "lingua/utility/transcode.hpp"
+#include "lingua/utility/validate_utf8.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#   include <cerrno>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#   define LINGUA_HAS_PREAD 1
+#else
+#   include <fstream>
+#endif // __has_include(<unistd.h>)
+
+#if defined(LINGUA_ENABLE_IO_URING) and defined(__linux__) and __has_include(<linux/io_uring.h>)
+#   include <array>
+#   include <bitset>
+#   include <cstring>
+#   include <linux/io_uring.h>
+#   include <linux/stat.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#   define LINGUA_HAS_IO_URING 1
+#endif
+
+namespace {
+   using clock_type = std::chrono::steady_clock;
+   using lingua::loaded_file;
+
+#ifdef LINGUA_HAS_PREAD
+   /// \brief Closes a file descriptor on scope exit.
+   ///
+   class file_descriptor {
+   public:
+      explicit file_descriptor(int const fd) noexcept
+         : fd_{fd}
+      {}
+
+      file_descriptor(file_descriptor const&) = delete;
+      file_descriptor& operator=(file_descriptor const&) = delete;
+
+      file_descriptor(file_descriptor&& other) noexcept
+         : fd_{std::exchange(other.fd_, -1)}
+      {}
+
+      file_descriptor& operator=(file_descriptor&& other) noexcept
+      {
+         reset(std::exchange(other.fd_, -1));
+         return *this;
+      }
+
+      ~file_descriptor()
+      { reset(-1); }
+
+      [[nodiscard]] int get() const noexcept
+      { return fd_; }
+
+      [[nodiscard]] bool valid() const noexcept
+      { return fd_ >= 0; }
+
+      void reset(int const fd) noexcept
+      {
+         if (valid()) {
+            ::close(fd_);
+         }
+         fd_ = fd;
+      }
+
+   private:
+      int fd_ = -1;
+   };
+
+   [[nodiscard]] std::error_code last_error() noexcept
+   { return std::error_code{errno, std::system_category()}; }
+
+   /// \brief Opens `file.path` and sizes `file.contents` to fit the whole file.
+   /// \returns The open file, or an invalid descriptor if `file.error` was set.
+   ///
+   [[nodiscard]] file_descriptor open_for_reading(loaded_file& file) noexcept
+   {
+      auto fd = file_descriptor{::open(file.path.c_str(), O_RDONLY | O_CLOEXEC)};
+      if (not fd.valid()) {
+         file.error = last_error();
+         return fd;
+      }
+
+      struct ::stat status{};
+      if (::fstat(fd.get(), &status) != 0) {
+         file.error = last_error();
+         fd.reset(-1);
+         return fd;
+      }
+
+      try {
+         file.contents.resize(static_cast<std::size_t>(status.st_size));
+      }
+      catch (std::bad_alloc const&) {
+         file.error = std::make_error_code(std::errc::not_enough_memory);
+         fd.reset(-1);
+      }
+      return fd;
+   }
+
+   /// \brief Reads `file.contents.size() - offset` bytes into `file.contents`, starting at
+   ///        `offset`. A file that shrinks while being read is truncated to what was read.
+   ///
+   void pread_remaining(int const fd, loaded_file& file, std::size_t offset) noexcept
+   {
+      while (offset < file.contents.size()) {
+         auto const result = ::pread(fd, file.contents.data() + offset, file.contents.size() - offset,
+            static_cast<::off_t>(offset));
+         if (result < 0) {
+            if (errno == EINTR) {
+               continue;
+            }
+            file.error = last_error();
+            return;
+         }
+         if (result == 0) {
+            break;
+         }
+         offset += static_cast<std::size_t>(result);
+      }
+      file.contents.resize(offset);
+   }
+
+   void read_file(loaded_file& file) noexcept
+   {
+      auto const fd = open_for_reading(file);
+      if (fd.valid()) {
+         pread_remaining(fd.get(), file, 0);
+      }
+   }
+#else
+   void read_file(loaded_file& file) noexcept
+   {
+      auto in = std::basic_ifstream<char8_t>{file.path, std::ios::binary};
+      if (not in) {
+         file.error = std::make_error_code(std::errc::no_such_file_or_directory);
+         return;
+      }
+      file.contents.assign(std::istreambuf_iterator<char8_t>{in}, std::istreambuf_iterator<char8_t>{});
+      if (in.bad()) {
+         file.error = std::make_error_code(std::errc::io_error);
+      }
+   }
+#endif // LINGUA_HAS_PREAD
+
+   /// \brief Transcodes `file.contents` to UTF-8 if it's stored in another encoding, and then
+   ///        records where it stops being valid UTF-8. Does nothing if the read failed.
+   ///
+   void decode(loaded_file& file, lingua::file_loader_options const& options) noexcept
+   {
+      if (file.error) {
+         return;
+      }
+
+      using lingua::source_encoding;
+      file.encoding = options.encoding == source_encoding::automatic
+                    ? lingua::detect_encoding(file.contents)
+                    : options.encoding;
+      if (file.encoding != source_encoding::utf8) {
+         try {
+            file.contents = lingua::transcode_to_utf8(file.contents, file.encoding);
+         }
+         catch (std::bad_alloc const&) {
+            file.error = std::make_error_code(std::errc::not_enough_memory);
+            return;
+         }
+      }
+
+      if (options.validate_utf8) {
+         file.utf8 = lingua::validate_utf8(file.contents);
+      }
+   }
+
+   /// \brief Reads files on a pool of threads, at most `max_in_flight` files ahead of the consumer.
+   ///
+   class thread_pool_loader {
+   public:
+      explicit thread_pool_loader(std::span<std::filesystem::path const> const paths,
+         lingua::file_loader_options const& options)
+         : files_(paths.size())
+         , ready_(paths.size(), false)
+         , max_in_flight_{options.max_in_flight}
+         , options_{options}
+      {
+         for (auto i = std::size_t{0}; i < paths.size(); ++i) {
+            files_[i].path = paths[i];
+         }
+
+         auto const thread_count = std::min(options.threads, paths.size());
+         workers_.reserve(thread_count);
+         for (auto i = std::size_t{0}; i < thread_count; ++i) {
+            workers_.emplace_back([this] { work(); });
+         }
+      }
+
+      thread_pool_loader(thread_pool_loader const&) = delete;
+      thread_pool_loader& operator=(thread_pool_loader const&) = delete;
+
+      ~thread_pool_loader()
+      {
+         {
+            auto const lock = std::scoped_lock{mutex_};
+            stopped_ = true;
+         }
+         space_available_.notify_all();
+         for (auto& worker : workers_) {
+            worker.join();
+         }
+      }
+
+      lingua::file_loader_statistics run(std::function<void(loaded_file)> const& consume)
+      {
+         auto statistics = lingua::file_loader_statistics{};
+         statistics.backend = lingua::file_loader_backend::thread_pool;
+
+         for (auto i = std::size_t{0}; i < files_.size(); ++i) {
+            auto file = loaded_file{};
+            {
+               auto lock = std::unique_lock{mutex_};
+               if (not ready_[i]) {
+                  auto const start = clock_type::now();
+                  file_ready_.wait(lock, [this, i] { return ready_[i]; });
+                  statistics.wait_time += clock_type::now() - start;
+               }
+               file = std::move(files_[i]);
+               delivered_ = i + 1;
+            }
+            space_available_.notify_all();
+
+            statistics.bytes += file.contents.size();
+            ++statistics.files;
+            consume(std::move(file));
+         }
+
+         auto const lock = std::scoped_lock{mutex_};
+         statistics.io_time = io_time_;
+         return statistics;
+      }
+
+   private:
+      std::vector<loaded_file> files_;
+      std::vector<bool> ready_;
+      std::vector<std::thread> workers_;
+      std::mutex mutex_;
+      std::condition_variable space_available_;
+      std::condition_variable file_ready_;
+      std::size_t max_in_flight_;
+      lingua::file_loader_options options_;
+      std::size_t next_ = 0;
+      std::size_t delivered_ = 0;
+      std::chrono::nanoseconds io_time_{0};
+      bool stopped_ = false;
+
+      void work() noexcept
+      {
+         auto lock = std::unique_lock{mutex_};
+         for (;;) {
+            space_available_.wait(lock, [this] {
+               return stopped_ or next_ == files_.size() or next_ < delivered_ + max_in_flight_;
+            });
+            if (stopped_ or next_ == files_.size()) {
+               return;
+            }
+
+            auto const i = next_++;
+            lock.unlock();
+
+            auto const start = clock_type::now();
+            read_file(files_[i]);
+            auto const elapsed = clock_type::now() - start;
+            decode(files_[i], options_);
+
+            lock.lock();
+            ready_[i] = true;
+            io_time_ += elapsed;
+            file_ready_.notify_one();
+         }
+      }
+   };
+
+#ifdef LINGUA_HAS_IO_URING
+   /// \brief A minimal io_uring instance, driven directly through the system calls so that no
+   ///        third-party library is required.
+   ///
+   class uring {
+   public:
+      explicit uring(unsigned const entries) noexcept
+      {
+         auto params = ::io_uring_params{};
+         fd_ = file_descriptor{static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params))};
+         if (not fd_.valid()) {
+            return;
+         }
+
+         sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+         cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+         auto const single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+         if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+         }
+
+         sq_ring_ = map(sq_ring_size_, IORING_OFF_SQ_RING);
+         cq_ring_ = single_mmap ? sq_ring_ : map(cq_ring_size_, IORING_OFF_CQ_RING);
+         sqes_size_ = params.sq_entries * sizeof(::io_uring_sqe);
+         sqes_ = static_cast<::io_uring_sqe*>(map(sqes_size_, IORING_OFF_SQES));
+         if (sq_ring_ == nullptr or cq_ring_ == nullptr or sqes_ == nullptr) {
+            unmap();
+            fd_.reset(-1);
+            return;
+         }
+
+         sq_head_ = field<unsigned>(sq_ring_, params.sq_off.head);
+         sq_tail_ = field<unsigned>(sq_ring_, params.sq_off.tail);
+         sq_mask_ = *field<unsigned>(sq_ring_, params.sq_off.ring_mask);
+         sq_entries_ = params.sq_entries;
+         sq_array_ = field<unsigned>(sq_ring_, params.sq_off.array);
+         cq_head_ = field<unsigned>(cq_ring_, params.cq_off.head);
+         cq_tail_ = field<unsigned>(cq_ring_, params.cq_off.tail);
+         cq_mask_ = *field<unsigned>(cq_ring_, params.cq_off.ring_mask);
+         cqes_ = field<::io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+         probe();
+      }
+
+      uring(uring const&) = delete;
+      uring& operator=(uring const&) = delete;
+
+      ~uring()
+      { unmap(); }
+
+      [[nodiscard]] bool valid() const noexcept
+      { return fd_.valid(); }
+
+      /// \brief Checks if the kernel supports `opcode`. Kernels older than 5.6 can't be probed, and
+      ///        so are assumed to support nothing.
+      ///
+      [[nodiscard]] bool supports(std::uint8_t const opcode) const noexcept
+      { return supported_.test(opcode); }
+
+      /// \brief Checks that the ring was set up, and that the kernel can open, size and read files
+      ///        through it. Kernels older than 5.6 can't, and are left to the thread pool.
+      ///
+      [[nodiscard]] bool can_load_files() const noexcept
+      {
+         return valid() and supports(IORING_OP_OPENAT) and supports(IORING_OP_STATX)
+            and supports(IORING_OP_READ);
+      }
+
+      /// \brief Returns the number of operations that have been queued but not yet popped.
+      ///
+      [[nodiscard]] unsigned outstanding() const noexcept
+      { return outstanding_; }
+
+      /// \brief Queues an open of `path` for reading. The open is not issued until submit.
+      /// \returns false if the submission queue is full.
+      ///
+      [[nodiscard]] bool queue_open(char const* const path, std::uint64_t const user_data) noexcept
+      {
+         auto sqe = ::io_uring_sqe{};
+         sqe.opcode = IORING_OP_OPENAT;
+         sqe.fd = AT_FDCWD;
+         sqe.addr = reinterpret_cast<std::uintptr_t>(path);
+         sqe.open_flags = O_RDONLY | O_CLOEXEC;
+         sqe.user_data = user_data;
+         return queue(sqe);
+      }
+
+      /// \brief Queues a query of the size of the file open as `fd`, to be written to `result`.
+      /// \returns false if the submission queue is full.
+      ///
+      [[nodiscard]] bool queue_size(int const fd, struct ::statx& result, std::uint64_t const user_data)
+         noexcept
+      {
+         auto sqe = ::io_uring_sqe{};
+         sqe.opcode = IORING_OP_STATX;
+         sqe.fd = fd;
+         sqe.addr = reinterpret_cast<std::uintptr_t>("");
+         sqe.len = STATX_SIZE;
+         sqe.addr2 = reinterpret_cast<std::uintptr_t>(&result);
+         sqe.statx_flags = AT_EMPTY_PATH;
+         sqe.user_data = user_data;
+         return queue(sqe);
+      }
+
+      /// \brief Queues a read of `length` bytes at `offset`. The read is not issued until submit.
+      /// \returns false if the submission queue is full.
+      ///
+      [[nodiscard]] bool queue_read(int const fd, char8_t* const buffer, unsigned const length,
+         std::uint64_t const offset, std::uint64_t const user_data) noexcept
+      {
+         auto sqe = ::io_uring_sqe{};
+         sqe.opcode = IORING_OP_READ;
+         sqe.fd = fd;
+         sqe.addr = reinterpret_cast<std::uintptr_t>(buffer);
+         sqe.len = length;
+         sqe.off = offset;
+         sqe.user_data = user_data;
+         return queue(sqe);
+      }
+
+      /// \brief Submits queued reads and waits until at least `wait_for` completions are available.
+      ///
+      void submit(unsigned const wait_for) noexcept
+      {
+         auto const flags = wait_for > 0 ? IORING_ENTER_GETEVENTS : 0U;
+         for (;;) {
+            auto const submitted = ::syscall(__NR_io_uring_enter, fd_.get(), unsubmitted_, wait_for,
+               flags, nullptr, 0);
+            if (submitted >= 0) {
+               unsubmitted_ -= static_cast<unsigned>(submitted);
+               return;
+            }
+            // The ring never holds more reads than it has completion entries, so the only errors
+            // that can legitimately occur are transient ones.
+            LINGUA_ASSERT(errno == EINTR or errno == EAGAIN or errno == EBUSY);
+         }
+      }
+
+      /// \brief Removes a completion from the completion queue, if one is available.
+      ///
+      [[nodiscard]] bool pop(::io_uring_cqe& result) noexcept
+      {
+         auto const head = *cq_head_;
+         if (head == std::atomic_ref{*cq_tail_}.load(std::memory_order_acquire)) {
+            return false;
+         }
+         result = cqes_[head & cq_mask_];
+         std::atomic_ref{*cq_head_}.store(head + 1, std::memory_order_release);
+         --outstanding_;
+         return true;
+      }
+
+   private:
+      file_descriptor fd_{-1};
+      void* sq_ring_ = nullptr;
+      void* cq_ring_ = nullptr;
+      ::io_uring_sqe* sqes_ = nullptr;
+      std::size_t sq_ring_size_ = 0;
+      std::size_t cq_ring_size_ = 0;
+      std::size_t sqes_size_ = 0;
+      unsigned* sq_head_ = nullptr;
+      unsigned* sq_tail_ = nullptr;
+      unsigned* sq_array_ = nullptr;
+      unsigned sq_mask_ = 0;
+      unsigned sq_entries_ = 0;
+      unsigned* cq_head_ = nullptr;
+      unsigned* cq_tail_ = nullptr;
+      unsigned cq_mask_ = 0;
+      ::io_uring_cqe* cqes_ = nullptr;
+      unsigned unsubmitted_ = 0;
+      unsigned outstanding_ = 0;
+      std::bitset<256> supported_;
+
+      [[nodiscard]] bool queue(::io_uring_sqe const& entry) noexcept
+      {
+         auto const tail = *sq_tail_;
+         if (tail - std::atomic_ref{*sq_head_}.load(std::memory_order_acquire) == sq_entries_) {
+            return false;
+         }
+
+         auto const index = tail & sq_mask_;
+         sqes_[index] = entry;
+         sq_array_[index] = index;
+         std::atomic_ref{*sq_tail_}.store(tail + 1, std::memory_order_release);
+         ++unsubmitted_;
+         ++outstanding_;
+         return true;
+      }
+
+      void probe() noexcept
+      {
+         constexpr auto max_ops = std::size_t{256};
+         alignas(::io_uring_probe) auto buffer =
+            std::array<std::byte, sizeof(::io_uring_probe) + max_ops * sizeof(::io_uring_probe_op)>{};
+         if (::syscall(__NR_io_uring_register, fd_.get(), IORING_REGISTER_PROBE, buffer.data(),
+                max_ops) < 0) {
+            return;
+         }
+
+         auto header = ::io_uring_probe{};
+         std::memcpy(&header, buffer.data(), sizeof(header));
+         for (auto i = std::size_t{0}; i < header.ops_len and i < max_ops; ++i) {
+            auto op = ::io_uring_probe_op{};
+            std::memcpy(&op, buffer.data() + sizeof(header) + i * sizeof(op), sizeof(op));
+            if ((op.flags & IO_URING_OP_SUPPORTED) != 0) {
+               supported_.set(op.op);
+            }
+         }
+      }
+
+      [[nodiscard]] void* map(std::size_t const size, std::uint64_t const offset) const noexcept
+      {
+         auto* const result = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            fd_.get(), static_cast<::off_t>(offset));
+         return result == MAP_FAILED ? nullptr : result;
+      }
+
+      void unmap() noexcept
+      {
+         if (sqes_ != nullptr) {
+            ::munmap(sqes_, sqes_size_);
+         }
+         if (cq_ring_ != nullptr and cq_ring_ != sq_ring_) {
+            ::munmap(cq_ring_, cq_ring_size_);
+         }
+         if (sq_ring_ != nullptr) {
+            ::munmap(sq_ring_, sq_ring_size_);
+         }
+         sqes_ = nullptr;
+         cq_ring_ = sq_ring_ = nullptr;
+      }
+
+      template<class T>
+      [[nodiscard]] static T* field(void* const ring, std::uint32_t const offset) noexcept
+      { return reinterpret_cast<T*>(static_cast<char*>(ring) + offset); }
+   };
+
+   /// \brief Opens, sizes and reads files through io_uring, keeping at most `max_in_flight` files
+   ///        outstanding. The kernel does all three while the consumer runs, so no reader threads
+   ///        are needed.
+   ///
+   class io_uring_loader {
+   public:
+      explicit io_uring_loader(std::span<std::filesystem::path const> const paths,
+         lingua::file_loader_options const& options)
+         : paths_{paths}
+         , slots_(std::min(options.max_in_flight, paths.size()))
+         , ring_{ring_entries(slots_.size())}
+         , options_{options}
+      {}
+
+      io_uring_loader(io_uring_loader const&) = delete;
+      io_uring_loader& operator=(io_uring_loader const&) = delete;
+
+      /// \brief Waits for any operations that are still in flight, since the kernel writes into
+      ///        buffers that are owned by the slots.
+      ///
+      ~io_uring_loader()
+      {
+         if (not ring_.valid()) {
+            return;
+         }
+
+         auto completion = ::io_uring_cqe{};
+         while (ring_.outstanding() > 0) {
+            ring_.submit(1);
+            while (ring_.pop(completion)) {
+               if (operation_of(completion) == operation::open and completion.res >= 0) {
+                  ::close(completion.res);
+               }
+            }
+         }
+      }
+
+      [[nodiscard]] bool valid() const noexcept
+      { return ring_.can_load_files(); }
+
+      lingua::file_loader_statistics run(std::function<void(loaded_file)> const& consume)
+      {
+         auto statistics = lingua::file_loader_statistics{};
+         statistics.backend = lingua::file_loader_backend::io_uring;
+
+         for (auto i = std::size_t{0}; i < paths_.size(); ++i) {
+            while (next_ < paths_.size() and next_ < i + slots_.size()) {
+               start_read(next_++);
+            }
+            ring_.submit(0);
+
+            auto& current = slot(i);
+            if (not current.complete) {
+               auto const start = clock_type::now();
+               while (not current.complete) {
+                  ring_.submit(1);
+                  reap();
+               }
+               statistics.wait_time += clock_type::now() - start;
+            }
+            reap();
+
+            // Decoding is the consumer's work rather than I/O, so it's done here instead of when the
+            // read completes, where it would be counted in io_time and delay the next completion.
+            auto file = std::move(current.file);
+            current = slot_type{};
+            decode(file, options_);
+            statistics.bytes += file.contents.size();
+            ++statistics.files;
+            consume(std::move(file));
+         }
+
+         statistics.io_time = io_time_;
+         return statistics;
+      }
+
+   private:
+      /// \brief The operation that a completion belongs to, which is kept in the low bits of its
+      ///        user data. The rest is the index of the file.
+      ///
+      enum class operation : std::uint64_t { open, size, read };
+      static constexpr auto operation_bits = 2U;
+
+      struct slot_type {
+         loaded_file file;
+         file_descriptor fd{-1};
+         struct ::statx status{};
+         std::size_t offset = 0;
+         clock_type::time_point issued;
+         bool complete = false;
+      };
+
+      std::span<std::filesystem::path const> paths_;
+      std::vector<slot_type> slots_;
+      uring ring_;
+      lingua::file_loader_options options_;
+      std::size_t next_ = 0;
+      std::chrono::nanoseconds io_time_{0};
+
+      /// \brief Reads are issued in chunks no larger than this, since an SQE's length is 32 bits.
+      ///
+      static constexpr auto max_read_length = std::size_t{1} << 30U;
+
+      [[nodiscard]] static unsigned ring_entries(std::size_t const in_flight) noexcept
+      {
+         auto result = 1U;
+         while (result < in_flight) {
+            result *= 2;
+         }
+         return result;
+      }
+
+      [[nodiscard]] static std::uint64_t user_data(std::size_t const index, operation const op) noexcept
+      { return std::uint64_t{index} << operation_bits | static_cast<std::uint64_t>(op); }
+
+      [[nodiscard]] static operation operation_of(::io_uring_cqe const& completion) noexcept
+      { return static_cast<operation>(completion.user_data & ((1U << operation_bits) - 1)); }
+
+      [[nodiscard]] slot_type& slot(std::size_t const index) noexcept
+      { return slots_[index % slots_.size()]; }
+
+      void start_read(std::size_t const index) noexcept
+      {
+         auto& s = slot(index);
+         s.file.path = paths_[index];
+         s.issued = clock_type::now();
+         if (not ring_.queue_open(s.file.path.c_str(), user_data(index, operation::open))) {
+            // The ring has an entry for every slot, so this only happens if the kernel has stopped
+            // consuming submissions.
+            read_file(s.file);
+            finish(s);
+         }
+      }
+
+      void opened(slot_type& s, std::size_t const index, int const result) noexcept
+      {
+         if (result < 0) {
+            s.file.error = std::error_code{-result, std::system_category()};
+            finish(s);
+            return;
+         }
+
+         s.fd.reset(result);
+         if (not ring_.queue_size(s.fd.get(), s.status, user_data(index, operation::size))) {
+            s.fd.reset(-1);
+            read_file(s.file);
+            finish(s);
+         }
+      }
+
+      void sized(slot_type& s, std::size_t const index, int const result) noexcept
+      {
+         if (result < 0) {
+            s.file.error = std::error_code{-result, std::system_category()};
+            finish(s);
+            return;
+         }
+
+         try {
+            s.file.contents.resize(static_cast<std::size_t>(s.status.stx_size));
+         }
+         catch (std::bad_alloc const&) {
+            s.file.error = std::make_error_code(std::errc::not_enough_memory);
+            finish(s);
+            return;
+         }
+
+         if (s.file.contents.empty()) {
+            finish(s);
+            return;
+         }
+         queue_remaining(s, index);
+      }
+
+      void queue_remaining(slot_type& s, std::size_t const index) noexcept
+      {
+         auto const length = std::min(s.file.contents.size() - s.offset, max_read_length);
+         if (not ring_.queue_read(s.fd.get(), s.file.contents.data() + s.offset,
+                static_cast<unsigned>(length), s.offset, user_data(index, operation::read))) {
+            fall_back_to_pread(s);
+         }
+      }
+
+      void received(slot_type& s, std::size_t const index, int const result) noexcept
+      {
+         if (result < 0) {
+            s.file.error = std::error_code{-result, std::system_category()};
+            finish(s);
+         }
+         else if (result == 0) {
+            s.file.contents.resize(s.offset);
+            finish(s);
+         }
+         else {
+            s.offset += static_cast<std::size_t>(result);
+            if (s.offset == s.file.contents.size()) {
+               finish(s);
+            }
+            else {
+               queue_remaining(s, index);
+            }
+         }
+      }
+
+      void reap() noexcept
+      {
+         auto completion = ::io_uring_cqe{};
+         while (ring_.pop(completion)) {
+            auto const index = static_cast<std::size_t>(completion.user_data >> operation_bits);
+            auto& s = slot(index);
+            switch (operation_of(completion)) {
+            case operation::open:
+               opened(s, index, completion.res);
+               break;
+            case operation::size:
+               sized(s, index, completion.res);
+               break;
+            case operation::read:
+               received(s, index, completion.res);
+               break;
+            }
+         }
+      }
+
+      void fall_back_to_pread(slot_type& s) noexcept
+      {
+         pread_remaining(s.fd.get(), s.file, s.offset);
+         finish(s);
+      }
+
+      void finish(slot_type& s) noexcept
+      {
+         s.fd.reset(-1);
+         s.complete = true;
+         io_time_ += clock_type::now() - s.issued;
+      }
+   };
+#endif // LINGUA_HAS_IO_URING
+} // namespace
+
+namespace lingua {
+   bool io_uring_available() noexcept
+   {
+#ifdef LINGUA_HAS_IO_URING
+      return uring{1}.can_load_files();
+#else
+      return false;
+#endif // LINGUA_HAS_IO_URING
+   }
+
+   file_loader_statistics load_files(std::span<std::filesystem::path const> const paths,
+      std::function<void(loaded_file)> const& consume, file_loader_options const& options)
+   {
+      LINGUA_EXPECTS(options.max_in_flight > 0);
+      LINGUA_EXPECTS(options.threads > 0);
+
+#ifdef LINGUA_HAS_IO_URING
+      if (options.backend != file_loader_backend::thread_pool and not paths.empty()) {
+         auto loader = io_uring_loader{paths, options};
+         if (loader.valid()) {
+            return loader.run(consume);
+         }
+      }
+#endif // LINGUA_HAS_IO_URING
+
+      auto loader = thread_pool_loader{paths, options};
+      return loader.run(consume);
+   }
+} // namespace lingua
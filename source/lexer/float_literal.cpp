@@ -0,0 +1,553 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/float_literal.hpp"
+#include "lingua/lexer/detail/power_of_five_table.hpp"
+#include "lingua/lexer/detail/swar_digits.hpp"
+#include "lingua/lexer/integer_literal.hpp"
+#include "lingua/utility/contract.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+
+namespace {
+   using lingua::float_literal_error;
+   using lingua::float_literal_value;
+   using lingua::float_type;
+   using lingua::uint128;
+   using lingua::detail_float_literal::power_of_five_128;
+   using lingua::detail_float_literal::smallest_power_of_five;
+   using lingua::detail_swar_digits::all_digits;
+   using lingua::detail_swar_digits::combine_digits;
+   using lingua::detail_swar_digits::load64;
+
+   constexpr auto low_32_bits = std::uint64_t{0xffffffff};
+
+   /// \brief The parameters of an IEEE 754 binary format that the conversion depends on.
+   ///
+   template<typename T>
+   struct binary_format;
+
+   template<>
+   struct binary_format<double> {
+      using bits_type = std::uint64_t;
+      static constexpr auto mantissa_bits = 52;
+      static constexpr auto minimum_exponent = -1023;
+      static constexpr auto infinite_power = 0x7ff;
+
+      // Anything below 10^-342 rounds to zero, and anything above 10^308 rounds to infinity.
+      static constexpr auto smallest_power_of_ten = -342;
+      static constexpr auto largest_power_of_ten = 308;
+
+      // The only powers of ten for which a product can land exactly halfway between two doubles.
+      static constexpr auto min_round_to_even_exponent = -4;
+      static constexpr auto max_round_to_even_exponent = 23;
+
+      static constexpr auto max_exact_mantissa = std::uint64_t{1} << 53U;
+      static constexpr auto exact_powers_of_ten = std::array{1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6,
+         1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+         1e22};
+   };
+
+   template<>
+   struct binary_format<float> {
+      using bits_type = std::uint32_t;
+      static constexpr auto mantissa_bits = 23;
+      static constexpr auto minimum_exponent = -127;
+      static constexpr auto infinite_power = 0xff;
+      static constexpr auto smallest_power_of_ten = -65;
+      static constexpr auto largest_power_of_ten = 38;
+      static constexpr auto min_round_to_even_exponent = -17;
+      static constexpr auto max_round_to_even_exponent = 10;
+      static constexpr auto max_exact_mantissa = std::uint64_t{1} << 24U;
+      static constexpr auto exact_powers_of_ten = std::array{1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F,
+         1e6F, 1e7F, 1e8F, 1e9F, 1e10F};
+   };
+
+   /// \brief A binary floating-point number before it's packed: `mantissa` holds the explicit
+   ///        mantissa bits, and `power2` holds the biased exponent.
+   ///
+   struct adjusted_mantissa {
+      std::uint64_t mantissa;
+      int power2;
+
+      [[nodiscard]] constexpr friend bool
+      operator==(adjusted_mantissa const&, adjusted_mantissa const&) noexcept = default;
+   };
+
+   /// \brief The parts of a decimal float literal, with `_`s still in its digits.
+   ///
+   struct decimal_literal {
+      std::u8string_view integer_digits;
+      std::u8string_view fraction_digits;
+
+      /// \brief The explicit exponent, saturated well beyond the range of any float type.
+      ///
+      std::int64_t exponent;
+   };
+
+   /// \brief The leading significant digits of a decimal_literal, as `mantissa * 10^exponent`.
+   ///
+   struct leading_digits {
+      std::uint64_t mantissa;
+      std::int64_t exponent;
+
+      /// \brief Whether any non-zero digits didn't fit in `mantissa`.
+      ///
+      bool truncated;
+   };
+
+   // 10^19 - 1 is the largest run of nines that fits in 64 bits.
+   constexpr auto max_leading_digits = 19;
+
+   [[nodiscard]] constexpr bool is_digit(char8_t const c) noexcept
+   { return u8'0' <= c and c <= u8'9'; }
+
+   [[nodiscard]] leading_digits read_leading_digits(decimal_literal const& literal) noexcept
+   {
+      auto digits = leading_digits{0, literal.exponent, false};
+      auto significant = 0;
+      auto const read = [&digits, &significant](std::u8string_view const part,
+                           bool const is_fraction) noexcept {
+         for (auto i = std::size_t{0}; i < part.size();) {
+            // Leading zeros are left to the slow path, since they don't add to `significant`.
+            if (significant != 0 and significant + 8 <= max_leading_digits
+                and part.size() - i >= 8) {
+               if (auto const word = load64(part.data() + i); all_digits(word, 10)) {
+                  digits.mantissa = digits.mantissa * 100'000'000 + combine_digits(word, 10);
+                  significant += 8;
+                  digits.exponent -= is_fraction ? 8 : 0;
+                  i += 8;
+                  continue;
+               }
+            }
+
+            auto const c = part[i++];
+            if (c == u8'_') {
+               continue;
+            }
+
+            auto const digit = static_cast<std::uint64_t>(c - u8'0');
+            if (significant < max_leading_digits and (significant != 0 or digit != 0)) {
+               digits.mantissa = digits.mantissa * 10 + digit;
+               ++significant;
+               digits.exponent -= is_fraction ? 1 : 0;
+            }
+            else if (significant == 0) {
+               digits.exponent -= is_fraction ? 1 : 0;
+            }
+            else {
+               digits.exponent += is_fraction ? 0 : 1;
+               digits.truncated |= digit != 0;
+            }
+         }
+      };
+
+      read(literal.integer_digits, false);
+      read(literal.fraction_digits, true);
+      return digits;
+   }
+
+   [[nodiscard]] constexpr uint128
+   full_multiply(std::uint64_t const x, std::uint64_t const y) noexcept
+   {
+      auto const x_low = x & low_32_bits;
+      auto const x_high = x >> 32U;
+      auto const y_low = y & low_32_bits;
+      auto const y_high = y >> 32U;
+
+      auto const low_low = x_low * y_low;
+      auto const low_high = x_low * y_high;
+      auto const high_low = x_high * y_low;
+      auto const middle = (low_low >> 32U) + (low_high & low_32_bits) + (high_low & low_32_bits);
+      return uint128{(low_low & low_32_bits) | (middle << 32U),
+         x_high * y_high + (low_high >> 32U) + (high_low >> 32U) + (middle >> 32U)};
+   }
+
+   /// \brief Returns floor(log2(10^q)) + 63, for q in [-342, 308].
+   ///
+   [[nodiscard]] constexpr int power(int const q) noexcept
+   { return (((152'170 + 65'536) * q) >> 16) + 63; }
+
+   /// \brief Returns the high bits of `w * 5^q`, to at least `precision` bits more than the ones
+   ///        that are known to be exact.
+   ///
+   template<int precision>
+   [[nodiscard]] constexpr uint128 multiply_by_power_of_five(int const q, std::uint64_t const w)
+   noexcept
+   {
+      auto const index = 2 * static_cast<std::size_t>(q - smallest_power_of_five);
+      constexpr auto precision_mask = ~std::uint64_t{0} >> precision;
+
+      auto product = full_multiply(w, power_of_five_128[index]);
+      if ((product.high & precision_mask) == precision_mask) {
+         // The low half of the power might carry into the bits that matter.
+         auto const low_product = full_multiply(w, power_of_five_128[index + 1]);
+         product.low += low_product.high;
+         product.high += low_product.high > product.low ? 1 : 0;
+      }
+      return product;
+   }
+
+   /// \brief Rounds `w * 10^q` to the nearest value of type `T`, using the Eisel-Lemire algorithm.
+   ///
+   template<typename T>
+   [[nodiscard]] constexpr adjusted_mantissa compute_float(std::int64_t const q, std::uint64_t w)
+   noexcept
+   {
+      using format = binary_format<T>;
+      if (w == 0 or q < format::smallest_power_of_ten) {
+         return adjusted_mantissa{0, 0};
+      }
+      if (q > format::largest_power_of_ten) {
+         return adjusted_mantissa{0, format::infinite_power};
+      }
+
+      auto const leading_zeros = std::countl_zero(w);
+      w <<= static_cast<unsigned>(leading_zeros);
+
+      auto const exponent = static_cast<int>(q);
+      auto const product = multiply_by_power_of_five<format::mantissa_bits + 3>(exponent, w);
+      auto const upper_bit = static_cast<int>(product.high >> 63U);
+      auto const shift = static_cast<unsigned>(upper_bit + 64 - format::mantissa_bits - 3);
+      auto answer = adjusted_mantissa{product.high >> shift,
+         power(exponent) + upper_bit - leading_zeros - format::minimum_exponent};
+
+      if (answer.power2 <= 0) {
+         // Subnormal: shift down to the fixed exponent, keeping one bit for rounding.
+         if (-answer.power2 + 1 >= 64) {
+            return adjusted_mantissa{0, 0};
+         }
+         answer.mantissa >>= static_cast<unsigned>(-answer.power2 + 1);
+         answer.mantissa += answer.mantissa & 1U;
+         answer.mantissa >>= 1U;
+         answer.power2 = answer.mantissa < (std::uint64_t{1} << format::mantissa_bits) ? 0 : 1;
+         return answer;
+      }
+
+      // An exact halfway product only occurs for a handful of exponents, and rounds to even.
+      if (product.low <= 1 and format::min_round_to_even_exponent <= q
+          and q <= format::max_round_to_even_exponent and (answer.mantissa & 3U) == 1
+          and (answer.mantissa << shift) == product.high) {
+         answer.mantissa &= ~std::uint64_t{1};
+      }
+
+      answer.mantissa += answer.mantissa & 1U;
+      answer.mantissa >>= 1U;
+      if (answer.mantissa >= (std::uint64_t{2} << format::mantissa_bits)) {
+         answer.mantissa = std::uint64_t{1} << format::mantissa_bits;
+         ++answer.power2;
+      }
+
+      answer.mantissa &= ~(std::uint64_t{1} << format::mantissa_bits);
+      if (answer.power2 >= format::infinite_power) {
+         return adjusted_mantissa{0, format::infinite_power};
+      }
+      return answer;
+   }
+
+   /// \brief A non-negative integer of a fixed capacity, which is enough to compare any decimal
+   ///        literal of at most max_exact_digits digits against a halfway point between doubles.
+   ///
+   class big_integer {
+   public:
+      explicit big_integer(std::uint64_t const value) noexcept
+      {
+         limbs_[0] = static_cast<std::uint32_t>(value & low_32_bits);
+         limbs_[1] = static_cast<std::uint32_t>(value >> 32U);
+         size_ = limbs_[1] != 0 ? 2 : limbs_[0] != 0 ? 1 : 0;
+      }
+
+      /// \brief Sets the value to `value * multiplier + addend`.
+      ///
+      void multiply_add(std::uint32_t const multiplier, std::uint32_t const addend) noexcept
+      {
+         auto carry = std::uint64_t{addend};
+         for (auto i = std::size_t{0}; i < size_; ++i) {
+            auto const product = std::uint64_t{limbs_[i]} * multiplier + carry;
+            limbs_[i] = static_cast<std::uint32_t>(product & low_32_bits);
+            carry = product >> 32U;
+         }
+
+         if (carry != 0) {
+            LINGUA_ASSERT(size_ < capacity);
+            limbs_[size_++] = static_cast<std::uint32_t>(carry);
+         }
+      }
+
+      void multiply_by_power_of_five(std::int64_t exponent) noexcept
+      {
+         constexpr auto largest_step = 13; // 5^13 is the largest power of five below 2^32.
+         constexpr auto powers = std::array<std::uint32_t, largest_step + 1>{1, 5, 25, 125, 625,
+            3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125};
+         for (; exponent >= largest_step; exponent -= largest_step) {
+            multiply_add(powers[largest_step], 0);
+         }
+         multiply_add(powers[static_cast<std::size_t>(exponent)], 0);
+      }
+
+      void shift_left(std::int64_t const bits) noexcept
+      {
+         if (size_ == 0 or bits == 0) {
+            return;
+         }
+
+         auto const limb_shift = static_cast<std::size_t>(bits / 32);
+         auto const bit_shift = static_cast<unsigned>(bits % 32);
+         LINGUA_ASSERT(size_ + limb_shift < capacity);
+
+         limbs_[size_ + limb_shift] = 0;
+         for (auto i = size_; i-- > 0;) {
+            auto const wide = std::uint64_t{limbs_[i]} << bit_shift;
+            limbs_[i + limb_shift + 1] |= static_cast<std::uint32_t>(wide >> 32U);
+            limbs_[i + limb_shift] = static_cast<std::uint32_t>(wide & low_32_bits);
+         }
+         for (auto i = std::size_t{0}; i < limb_shift; ++i) {
+            limbs_[i] = 0;
+         }
+
+         size_ += limb_shift + 1;
+         if (limbs_[size_ - 1] == 0) {
+            --size_;
+         }
+      }
+
+      /// \returns A negative number, zero, or a positive number, as `x` is less than, equal to, or
+      ///          greater than `y`.
+      ///
+      [[nodiscard]] friend int compare(big_integer const& x, big_integer const& y) noexcept
+      {
+         if (x.size_ != y.size_) {
+            return x.size_ < y.size_ ? -1 : 1;
+         }
+
+         for (auto i = x.size_; i-- > 0;) {
+            if (x.limbs_[i] != y.limbs_[i]) {
+               return x.limbs_[i] < y.limbs_[i] ? -1 : 1;
+            }
+         }
+         return 0;
+      }
+   private:
+      static constexpr auto capacity = std::size_t{176};
+      std::array<std::uint32_t, capacity> limbs_{};
+      std::size_t size_ = 0;
+   };
+
+   // A halfway point between two doubles has at most 767 significant digits, so any digits after
+   // the 800th can only break a tie.
+   constexpr auto max_exact_digits = 800;
+
+   /// \brief Decides which way `literal` rounds, given that it lies between `lower` and the next
+   ///        value of type `T` up, by comparing it against their halfway point exactly.
+   ///
+   template<typename T>
+   [[nodiscard]] adjusted_mantissa
+   round_exactly(decimal_literal const& literal, adjusted_mantissa const lower) noexcept
+   {
+      using format = binary_format<T>;
+
+      // The literal is digits * 10^exponent, or a little more than that if `sticky` is set.
+      auto digits = big_integer{0};
+      auto exponent = literal.exponent;
+      auto sticky = false;
+      auto significant = 0;
+      auto chunk = std::uint32_t{0};
+      auto chunk_size = 0;
+      constexpr auto chunk_multipliers = std::array<std::uint32_t, 10>{1, 10, 100, 1'000,
+         10'000, 100'000, 1'000'000, 10'000'000, 100'000'000, 1'000'000'000};
+      auto const read = [&](std::u8string_view const part, bool const is_fraction) noexcept {
+         for (auto const c : part) {
+            if (c == u8'_') {
+               continue;
+            }
+
+            auto const digit = static_cast<std::uint32_t>(c - u8'0');
+            if (significant < max_exact_digits and (significant != 0 or digit != 0)) {
+               chunk = chunk * 10 + digit;
+               ++significant;
+               if (++chunk_size == 9) {
+                  digits.multiply_add(chunk_multipliers[9], chunk);
+                  chunk = 0;
+                  chunk_size = 0;
+               }
+               exponent -= is_fraction ? 1 : 0;
+            }
+            else if (significant == 0) {
+               exponent -= is_fraction ? 1 : 0;
+            }
+            else {
+               exponent += is_fraction ? 0 : 1;
+               sticky |= digit != 0;
+            }
+         }
+      };
+      read(literal.integer_digits, false);
+      read(literal.fraction_digits, true);
+      digits.multiply_add(chunk_multipliers[static_cast<std::size_t>(chunk_size)], chunk);
+
+      // The halfway point is (2m + 1) * 2^(e - 1), where m * 2^e is `lower`.
+      auto const is_normal = lower.power2 != 0;
+      auto const mantissa = lower.mantissa | (is_normal ? std::uint64_t{1} << format::mantissa_bits
+                                                         : 0);
+      auto const binary_exponent = std::int64_t{is_normal ? lower.power2 : 1}
+                                 + format::minimum_exponent - format::mantissa_bits;
+      auto halfway = big_integer{2 * mantissa + 1};
+      auto halfway_exponent = binary_exponent - 1;
+
+      // Both sides are brought to integers with the same power of two, so they compare directly.
+      if (exponent >= 0) {
+         digits.multiply_by_power_of_five(exponent);
+      }
+      else {
+         halfway.multiply_by_power_of_five(-exponent);
+      }
+
+      if (exponent > halfway_exponent) {
+         digits.shift_left(exponent - halfway_exponent);
+      }
+      else {
+         halfway.shift_left(halfway_exponent - exponent);
+      }
+
+      auto const order = compare(digits, halfway);
+      auto const round_up = order > 0 or (order == 0 and (sticky or (lower.mantissa & 1U) != 0));
+      if (not round_up) {
+         return lower;
+      }
+
+      auto next = adjusted_mantissa{lower.mantissa + 1, lower.power2};
+      if (next.mantissa == std::uint64_t{1} << format::mantissa_bits) {
+         // Carrying into the implicit bit, which is also how a subnormal becomes normal.
+         next.mantissa = 0;
+         ++next.power2;
+      }
+      return next;
+   }
+
+   template<typename T>
+   [[nodiscard]] T to_binary(decimal_literal const& literal) noexcept
+   {
+      using format = binary_format<T>;
+      using bits_type = typename format::bits_type;
+
+      auto const leading = read_leading_digits(literal);
+      auto const q = leading.exponent;
+      auto const w = leading.mantissa;
+
+      // Clinger's fast path: both w and 10^|q| are exact, so one correctly rounded operation is
+      // enough.
+      constexpr auto max_exact_exponent = static_cast<std::int64_t>(
+         format::exact_powers_of_ten.size() - 1);
+      if (not leading.truncated and w <= format::max_exact_mantissa
+          and -max_exact_exponent <= q and q <= max_exact_exponent) {
+         auto const value = static_cast<T>(w);
+         auto const power_of_ten = format::exact_powers_of_ten[static_cast<std::size_t>(
+            q < 0 ? -q : q)];
+         return q < 0 ? value / power_of_ten : value * power_of_ten;
+      }
+
+      auto answer = compute_float<T>(q, w);
+      if (leading.truncated and answer != compute_float<T>(q, w + 1)) {
+         // The dropped digits place the literal somewhere in (w * 10^q, (w + 1) * 10^q), and the
+         // two ends round differently.
+         answer = round_exactly<T>(literal, answer);
+      }
+
+      auto const bits = static_cast<bits_type>(answer.mantissa)
+                      | static_cast<bits_type>(static_cast<bits_type>(answer.power2)
+                                               << format::mantissa_bits);
+      return std::bit_cast<T>(bits);
+   }
+} // namespace
+
+namespace lingua {
+   float_literal_value parse_float_literal(std::u8string_view const literal) noexcept
+   {
+      auto literal_value = float_literal_value{0.0, float_type::unsuffixed,
+         float_literal_error::none, 0};
+      auto const fail = [&literal_value](float_literal_error const error,
+                           std::size_t const offset) noexcept {
+         if (literal_value.error == float_literal_error::none) {
+            literal_value.error = error;
+            literal_value.error_offset = static_cast<std::uint32_t>(offset);
+         }
+      };
+      auto const skip_digits = [literal](std::size_t i) noexcept {
+         while (i < literal.size() and (literal[i] == u8'_' or is_digit(literal[i]))) {
+            ++i;
+         }
+         return i;
+      };
+
+      auto decimal = decimal_literal{};
+      auto i = skip_digits(0);
+      decimal.integer_digits = literal.substr(0, i);
+      if (i < literal.size() and literal[i] == u8'.') {
+         auto const fraction_end = skip_digits(i + 1);
+         decimal.fraction_digits = literal.substr(i + 1, fraction_end - i - 1);
+         i = fraction_end;
+      }
+
+      if (i < literal.size() and (literal[i] == u8'e' or literal[i] == u8'E')) {
+         auto const exponent_start = i++;
+         auto negative = false;
+         if (i < literal.size() and (literal[i] == u8'+' or literal[i] == u8'-')) {
+            negative = literal[i++] == u8'-';
+         }
+
+         // Saturating keeps huge exponents huge, which is all the conversion needs of them.
+         constexpr auto saturated = std::int64_t{1} << 40U;
+         auto has_digits = false;
+         for (; i < literal.size() and (literal[i] == u8'_' or is_digit(literal[i])); ++i) {
+            if (literal[i] != u8'_') {
+               has_digits = true;
+               if (decimal.exponent < saturated) {
+                  decimal.exponent = decimal.exponent * 10 + (literal[i] - u8'0');
+               }
+            }
+         }
+
+         if (not has_digits) {
+            fail(float_literal_error::missing_exponent_digits, exponent_start);
+         }
+         decimal.exponent = negative ? -decimal.exponent : decimal.exponent;
+      }
+
+      using namespace std::string_view_literals;
+      if (auto const suffix = literal.substr(i); suffix == u8"f32"sv) {
+         literal_value.type = float_type::f32;
+      }
+      else if (suffix == u8"f64"sv) {
+         literal_value.type = float_type::f64;
+      }
+      else if (not suffix.empty()) {
+         fail(float_literal_error::unknown_suffix, i);
+      }
+
+      if (literal_value.error != float_literal_error::none) {
+         return literal_value;
+      }
+
+      literal_value.value = literal_value.type == float_type::f32
+                          ? static_cast<double>(to_binary<float>(decimal))
+                          : to_binary<double>(decimal);
+      if (literal_value.value == std::numeric_limits<double>::infinity()) {
+         fail(float_literal_error::overflow, 0);
+      }
+      return literal_value;
+   }
+} // namespace lingua
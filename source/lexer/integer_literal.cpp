@@ -0,0 +1,217 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/integer_literal.hpp"
+#include "lingua/lexer/detail/swar_digits.hpp"
+#include <array>
+#include <cstddef>
+
+namespace {
+   using lingua::integer_literal_error;
+   using lingua::integer_literal_value;
+   using lingua::integer_type;
+   using lingua::uint128;
+   using lingua::detail_swar_digits::all_digits;
+   using lingua::detail_swar_digits::combine_digits;
+   using lingua::detail_swar_digits::load64;
+
+   constexpr auto low_32_bits = std::uint64_t{0xffffffff};
+
+   /// \brief Sets `x` to `x * multiplier + addend`, modulo 2^128.
+   /// \returns false if the result was reduced.
+   ///
+   [[nodiscard]] constexpr bool
+   multiply_add(uint128& x, std::uint64_t const multiplier, std::uint64_t const addend) noexcept
+   // [[expects: multiplier <= 2^32 and addend < 2^32]]
+   {
+      // Four 32-bit limbs, so that each product fits in 64 bits.
+      auto limbs =
+         std::array{x.low & low_32_bits, x.low >> 32U, x.high & low_32_bits, x.high >> 32U};
+      auto carry = addend;
+      for (auto& limb : limbs) {
+         auto const product = limb * multiplier + carry;
+         limb = product & low_32_bits;
+         carry = product >> 32U;
+      }
+
+      x = uint128{limbs[0] | (limbs[1] << 32U), limbs[2] | (limbs[3] << 32U)};
+      return carry == 0;
+   }
+
+   [[nodiscard]] constexpr bool greater(uint128 const x, uint128 const y) noexcept
+   { return x.high != y.high ? x.high > y.high : x.low > y.low; }
+
+   /// \brief Returns the largest magnitude that a literal of type `type` may have.
+   ///
+   [[nodiscard]] constexpr uint128
+   max_magnitude(integer_type const type, bool const negated) noexcept
+   {
+      constexpr auto all_bits = ~std::uint64_t{0};
+      auto const max_unsigned = [](unsigned const bits) noexcept {
+         if (bits >= 128) {
+            return uint128{all_bits, all_bits};
+         }
+         if (bits > 64) {
+            return uint128{all_bits, (std::uint64_t{1} << (bits - 64)) - 1};
+         }
+         return uint128{bits == 64 ? all_bits : (std::uint64_t{1} << bits) - 1, 0};
+      };
+      auto const max_signed = [negated, max_unsigned](unsigned const bits) noexcept {
+         // A negated literal may be one larger, to reach the type's minimum.
+         auto magnitude = max_unsigned(bits - 1);
+         if (negated) {
+            static_cast<void>(multiply_add(magnitude, 1, 1));
+         }
+         return magnitude;
+      };
+
+      switch (type) {
+      case integer_type::unsuffixed:
+      case integer_type::u128:
+         return max_unsigned(128);
+      case integer_type::u8:
+         return max_unsigned(8);
+      case integer_type::u16:
+         return max_unsigned(16);
+      case integer_type::u32:
+         return max_unsigned(32);
+      case integer_type::u64:
+      case integer_type::usize:
+         return max_unsigned(64);
+      case integer_type::i8:
+         return max_signed(8);
+      case integer_type::i16:
+         return max_signed(16);
+      case integer_type::i32:
+         return max_signed(32);
+      case integer_type::i64:
+      case integer_type::isize:
+         return max_signed(64);
+      case integer_type::i128:
+         return max_signed(128);
+      }
+      return max_unsigned(128);
+   }
+
+   [[nodiscard]] constexpr unsigned digit_value(char8_t const c) noexcept
+   {
+      if (u8'0' <= c and c <= u8'9') {
+         return static_cast<unsigned>(c - u8'0');
+      }
+      if (u8'a' <= c and c <= u8'f') {
+         return static_cast<unsigned>(c - u8'a' + 10);
+      }
+      if (u8'A' <= c and c <= u8'F') {
+         return static_cast<unsigned>(c - u8'A' + 10);
+      }
+      return 16;
+   }
+} // namespace
+
+namespace lingua {
+   integer_literal_value parse_integer_literal(std::u8string_view const literal,
+      bool const negated) noexcept
+   {
+      auto radix = 10U;
+      auto first = std::size_t{0};
+      if (literal.size() > 1 and literal[0] == u8'0') {
+         switch (literal[1]) {
+         case u8'x':
+            radix = 16;
+            first = 2;
+            break;
+         case u8'o':
+            radix = 8;
+            first = 2;
+            break;
+         case u8'b':
+            radix = 2;
+            first = 2;
+            break;
+         default:
+            break;
+         }
+      }
+
+      // Every decimal digit belongs to the digits, even in an octal or binary literal, so that
+      // `0b102` has an unknown digit rather than an unknown suffix.
+      auto const digit_limit = radix == 16 ? 16U : 10U;
+      auto last = first;
+      while (last < literal.size()
+             and (literal[last] == u8'_' or digit_value(literal[last]) < digit_limit)) {
+         ++last;
+      }
+
+      auto literal_value = integer_literal_value{uint128{0, 0}, integer_type::unsuffixed,
+         integer_literal_error::none, 0};
+      auto const fail = [&literal_value](integer_literal_error const error,
+                           std::size_t const offset) noexcept {
+         if (literal_value.error == integer_literal_error::none) {
+            literal_value.error = error;
+            literal_value.error_offset = static_cast<std::uint32_t>(offset);
+         }
+      };
+
+      auto const block_multiplier = std::uint64_t{radix} * radix * radix * radix * radix * radix
+                                  * radix * radix;
+      auto reduced = false;
+      auto has_digits = false;
+      auto const* const data = literal.data();
+      for (auto i = first; i < last;) {
+         if (last - i >= 8) {
+            if (auto const word = load64(data + i); all_digits(word, radix)) {
+               reduced |= not multiply_add(literal_value.value, block_multiplier,
+                  combine_digits(word, radix));
+               has_digits = true;
+               i += 8;
+               continue;
+            }
+         }
+
+         if (auto const digit = digit_value(literal[i]); digit < radix) {
+            reduced |= not multiply_add(literal_value.value, radix, digit);
+            has_digits = true;
+         }
+         else if (literal[i] != u8'_') {
+            fail(integer_literal_error::unknown_digit, i);
+         }
+         ++i;
+      }
+
+      if (not has_digits) {
+         fail(integer_literal_error::missing_digits, first);
+      }
+
+      auto const suffix = literal.substr(last);
+      if (not suffix.empty()) {
+         auto type = integer_type::u8;
+         while (type <= integer_type::isize and integer_type_name(type) != suffix) {
+            type = static_cast<integer_type>(static_cast<int>(type) + 1);
+         }
+
+         if (type > integer_type::isize) {
+            fail(integer_literal_error::unknown_suffix, last);
+         }
+         else {
+            literal_value.type = type;
+         }
+      }
+
+      if (reduced or greater(literal_value.value, max_magnitude(literal_value.type, negated))) {
+         fail(integer_literal_error::overflow, 0);
+      }
+      return literal_value;
+   }
+} // namespace lingua
@@ -17,13 +17,9 @@
 #include "lingua/utility/contract.hpp"
 #include <cjdb/cctype/isdigit.hpp>
 #include <cjdb/cctype/isxdigit.hpp>
-#include <range/v3/algorithm/all_of.hpp>
-#include <range/v3/algorithm/count.hpp>
-#include <range/v3/algorithm/find.hpp>
-#include <range/v3/begin_end.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <range/v3/distance.hpp>
-#include <range/v3/iterator/operations.hpp>
-#include <range/v3/view.hpp>
 #include <string_view>
 #include <unordered_set>
 
@@ -66,16 +62,59 @@ namespace lingua {
       LINGUA_EXPECTS(distance(escape) >= unicode_escape_distance_lower_bound);
       LINGUA_EXPECTS(escape.starts_with(unicode_escape_prefix));
       LINGUA_EXPECTS(escape.ends_with(unicode_escape_suffix));
-      LINGUA_EXPECTS(ranges::count(escape, unicode_escape_suffix) == 1);
 
-      using ranges::all_of, ranges::find;
-      using ranges::end, ranges::next, ranges::prev;
-      namespace view = ranges::view;
+      // decode_unicode_escape stops at the first `}`, so reading the whole escape also means that
+      // it has no other `}`.
+      auto const decoded = decode_unicode_escape(escape);
+      auto const well_formed = decoded.error == unicode_escape_error::none
+                            or decoded.error == unicode_escape_error::surrogate
+                            or decoded.error == unicode_escape_error::out_of_range;
+      return well_formed and decoded.length == escape.size();
+   }
+
+   [[nodiscard]] decoded_unicode_escape decode_unicode_escape(u8string_view const text) noexcept
+   {
+      LINGUA_EXPECTS(text.starts_with(u8R"(\u)"sv));
+
+      auto const fail = [](unicode_escape_error const error, std::size_t const length) noexcept {
+         return decoded_unicode_escape{0, error, static_cast<std::uint32_t>(length)};
+      };
+      if (text.size() < 3 or text[2] != u8'{') {
+         auto const length = std::min(text.size(), std::size_t{3});
+         return fail(unicode_escape_error::missing_open_brace, length);
+      }
+
+      constexpr auto max_digits = 6;
+      auto code_point = char32_t{0};
+      auto digits = 0;
+      for (auto i = std::size_t{3}; i < text.size(); ++i) {
+         auto const c = text[i];
+         if (c == unicode_escape_suffix) {
+            auto const length = static_cast<std::uint32_t>(i + 1);
+            if (digits == 0) {
+               return fail(unicode_escape_error::missing_digits, length);
+            }
 
-      auto not_suffix = [](auto const c) noexcept { return c != unicode_escape_suffix; };
-      auto unicode = escape | view::drop(3) | view::take_while(not_suffix);
+            auto error = unicode_escape_error::none;
+            if (code_point > 0x10ffff) {
+               error = unicode_escape_error::out_of_range;
+            }
+            else if (0xd800 <= code_point and code_point <= 0xdfff) {
+               error = unicode_escape_error::surrogate;
+            }
+            return decoded_unicode_escape{code_point, error, length};
+         }
 
-      constexpr auto unicode_distance_upper_bound = 7;
-      return distance(unicode) < unicode_distance_upper_bound and all_of(unicode, isxdigit);
+         if (not isxdigit(c)) {
+            return fail(unicode_escape_error::unknown_digit, i + 1);
+         }
+         if (++digits > max_digits) {
+            return fail(unicode_escape_error::too_many_digits, i + 1);
+         }
+
+         auto const value = c <= u8'9' ? c - u8'0' : (c | 0x20) - u8'a' + 10;
+         code_point = code_point * 16 + static_cast<char32_t>(value);
+      }
+      return fail(unicode_escape_error::missing_close_brace, text.size());
    }
 } // namespace lingua
@@ -0,0 +1,831 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/lex.hpp"
+#include "lingua/lexer/nfc.hpp"
+#include "lingua/lexer/xid.hpp"
+#include "lingua/utility/contract.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace {
+   using lingua::lex_limit;
+   using lingua::lexer_mode;
+   using lingua::lexical_error_kind;
+   using lingua::nfc_quick_check_result;
+   using lingua::token_kind;
+   using namespace std::string_view_literals;
+
+   struct scanned {
+      token_kind kind;
+      std::size_t end;
+      std::optional<lexical_error_kind> error = std::nullopt;
+
+      /// \brief The limit that stopped the scanner before the end of the token, if one did.
+      ///
+      std::optional<lex_limit> exceeded = std::nullopt;
+   };
+
+   /// \brief The parts of lingua::lex_limits that bound the scanning of a single token.
+   ///
+   struct scan_limits {
+      std::size_t max_literal_length = lingua::lex_limits::unbounded;
+      std::size_t max_comment_depth = lingua::lex_limits::unbounded;
+   };
+
+   [[nodiscard]] constexpr bool is_whitespace(char8_t const c) noexcept
+   { return c == u8' ' or (u8'\t' <= c and c <= u8'\r'); }
+
+   [[nodiscard]] constexpr bool is_digit(char8_t const c) noexcept
+   { return u8'0' <= c and c <= u8'9'; }
+
+   [[nodiscard]] constexpr bool is_hex_digit(char8_t const c) noexcept
+   { return is_digit(c) or (u8'a' <= c and c <= u8'f') or (u8'A' <= c and c <= u8'F'); }
+
+   [[nodiscard]] constexpr bool is_identifier_start(char8_t const c) noexcept
+   { return (u8'a' <= c and c <= u8'z') or (u8'A' <= c and c <= u8'Z') or c == u8'_'; }
+
+   [[nodiscard]] constexpr bool is_identifier_continue(char8_t const c) noexcept
+   { return is_identifier_start(c) or is_digit(c); }
+
+   /// \brief A view of the source that reads as '\0' past the end, so that lookahead needs no
+   ///        bounds checks.
+   ///
+   class cursor {
+   public:
+      explicit cursor(std::u8string_view const source) noexcept
+         : source_{source}
+      {}
+
+      [[nodiscard]] char8_t operator[](std::size_t const i) const noexcept
+      { return i < source_.size() ? source_[i] : u8'\0'; }
+
+      [[nodiscard]] std::size_t size() const noexcept
+      { return source_.size(); }
+
+      [[nodiscard]] std::u8string_view substr(std::size_t const offset,
+         std::size_t const length) const noexcept
+      { return source_.substr(offset, length); }
+
+      /// \brief Returns a cursor that reads as though the source ended after `size` bytes.
+      ///
+      [[nodiscard]] cursor first(std::size_t const size) const noexcept
+      { return cursor{source_.substr(0, size)}; }
+
+      template<class Predicate>
+      [[nodiscard]] std::size_t skip(std::size_t i, Predicate const p) const noexcept
+      {
+         while (i < source_.size() and p(source_[i])) {
+            ++i;
+         }
+         return i;
+      }
+
+   private:
+      std::u8string_view source_;
+   };
+
+   /// \brief Returns the number of bytes in the UTF-8 sequence at `i`, or 1 if there isn't a
+   ///        well-formed sequence there.
+   ///
+   [[nodiscard]] std::size_t code_point_length(cursor const& s, std::size_t const i) noexcept
+   {
+      auto const lead = s[i];
+      auto const length = lead < 0xC2 ? std::size_t{1}
+                        : lead < 0xE0 ? std::size_t{2}
+                        : lead < 0xF0 ? std::size_t{3}
+                        : lead < 0xF5 ? std::size_t{4}
+                        : std::size_t{1};
+      for (auto j = std::size_t{1}; j < length; ++j) {
+         if ((s[i + j] & 0xC0) != 0x80) {
+            return 1;
+         }
+      }
+      return length;
+   }
+
+   /// \brief Returns the length of the non-ASCII identifier character at `i`, or zero if there
+   ///        isn't one.
+   /// \param start Whether the character has to be able to begin an identifier.
+   ///
+   [[nodiscard]] std::size_t
+   non_ascii_identifier_length(cursor const& s, std::size_t const i, bool const start) noexcept
+   // [[expects: s[i] >= 0x80]]
+   {
+      auto const length = code_point_length(s, i);
+      if (length == 1) {
+         return 0;
+      }
+
+      auto c = char32_t{s[i]} & (0x7fU >> length);
+      for (auto j = std::size_t{1}; j < length; ++j) {
+         c = (c << 6U) | (s[i + j] & 0x3fU);
+      }
+      return (start ? lingua::is_xid_start(c) : lingua::is_xid_continue(c)) ? length : 0;
+   }
+
+   [[nodiscard]] bool starts_identifier(cursor const& s, std::size_t const i) noexcept
+   {
+      return is_identifier_start(s[i])
+          or (s[i] >= 0x80 and non_ascii_identifier_length(s, i, true) != 0);
+   }
+
+   /// \brief Moves past the identifier characters from `i` onwards. ASCII is skipped a byte at a
+   ///        time; only the rest is decoded and looked up in the XID_Continue table.
+   ///
+   [[nodiscard]] std::size_t skip_identifier(cursor const& s, std::size_t i) noexcept
+   {
+      for (;;) {
+         i = s.skip(i, is_identifier_continue);
+         auto const length = s[i] < 0x80 ? 0 : non_ascii_identifier_length(s, i, false);
+         if (length == 0) {
+            return i;
+         }
+         i += length;
+      }
+   }
+
+   constexpr auto keywords = std::array{
+      u8"Self"sv, u8"abstract"sv, u8"as"sv, u8"async"sv, u8"await"sv, u8"become"sv, u8"box"sv,
+      u8"break"sv, u8"const"sv, u8"continue"sv, u8"crate"sv, u8"do"sv, u8"dyn"sv, u8"else"sv,
+      u8"enum"sv, u8"extern"sv, u8"false"sv, u8"final"sv, u8"fn"sv, u8"for"sv, u8"if"sv,
+      u8"impl"sv, u8"in"sv, u8"let"sv, u8"loop"sv, u8"macro"sv, u8"match"sv, u8"mod"sv,
+      u8"move"sv, u8"mut"sv, u8"override"sv, u8"priv"sv, u8"pub"sv, u8"ref"sv, u8"return"sv,
+      u8"self"sv, u8"static"sv, u8"struct"sv, u8"super"sv, u8"trait"sv, u8"true"sv, u8"try"sv,
+      u8"type"sv, u8"typeof"sv, u8"unsafe"sv, u8"unsized"sv, u8"use"sv, u8"virtual"sv,
+      u8"where"sv, u8"while"sv, u8"yield"sv,
+   };
+   static_assert(std::ranges::is_sorted(keywords));
+
+   constexpr auto longest_keyword = std::size_t{8};
+
+   [[nodiscard]] bool is_keyword(std::u8string_view const identifier) noexcept
+   { return identifier.size() <= longest_keyword and std::ranges::binary_search(keywords, identifier); }
+
+   /// \brief The identifiers that `r#` can't be applied to. Must be kept in sync with
+   ///        invalid_identifier.
+   ///
+   [[nodiscard]] bool is_prohibited_raw_identifier(std::u8string_view const identifier) noexcept
+   {
+      return identifier == u8"crate" or identifier == u8"extern" or identifier == u8"self"
+          or identifier == u8"super" or identifier == u8"Self";
+   }
+
+   /// \brief Checks `identifier` against `p` once it's in NFC, so that spellings which differ only
+   ///        in their normalization are treated alike. Only identifiers that fail the quick check
+   ///        are copied, into a buffer on the stack.
+   ///
+   /// `p` only accepts keywords, so an identifier whose NFC form is longer than any keyword can't
+   /// satisfy it, and the buffer needn't be any longer than that.
+   ///
+   template<class Predicate>
+   [[nodiscard]] bool normalized_satisfies(std::u8string_view const identifier, Predicate p) noexcept
+   {
+      if (lingua::nfc_quick_check(identifier) == nfc_quick_check_result::yes) {
+         return p(identifier);
+      }
+
+      auto buffer = std::array<char8_t, longest_keyword>{};
+      auto const normalized = lingua::to_nfc(identifier, buffer);
+      return normalized and p(*normalized);
+   }
+
+   [[nodiscard]] scanned scan_whitespace(cursor const& s, std::size_t const i) noexcept
+   { return {token_kind::whitespace, s.skip(i + 1, is_whitespace)}; }
+
+   [[nodiscard]] scanned scan_line_comment(cursor const& s, std::size_t const i) noexcept
+   {
+      auto const rest = s.substr(i, s.size() - i);
+      auto const newline = rest.find(u8'\n');
+      return {token_kind::line_comment, newline == rest.npos ? s.size() : i + newline};
+   }
+
+   /// \brief Moves past the next part of a block comment, tracking how deeply it's nested.
+   ///
+   [[nodiscard]] std::size_t
+   step_block_comment(cursor const& s, std::size_t const i, std::uint32_t& depth) noexcept
+   {
+      if (s[i] == u8'/' and s[i + 1] == u8'*') {
+         ++depth;
+         return i + 2;
+      }
+      if (s[i] == u8'*' and s[i + 1] == u8'/') {
+         --depth;
+         return i + 2;
+      }
+      return i + 1;
+   }
+
+   /// \brief Scans the rest of a block comment, from a point `depth` comments deep.
+   /// \param max_depth How deeply the comment may nest before scanning stops.
+   ///
+   [[nodiscard]] scanned continue_block_comment(cursor const& s, std::size_t i, std::uint32_t depth,
+      std::size_t const max_depth = lingua::lex_limits::unbounded) noexcept
+   {
+      while (i < s.size()) {
+         i = step_block_comment(s, i, depth);
+         if (depth == 0) {
+            return {token_kind::block_comment, i};
+         }
+         if (depth > max_depth) {
+            return {token_kind::block_comment, i, std::nullopt, lex_limit::comment_depth};
+         }
+      }
+      return {token_kind::block_comment, s.size(), lexical_error_kind::unterminated_comment};
+   }
+
+   /// \brief Scans a block comment, allowing for nesting.
+   ///
+   [[nodiscard]] scanned
+   scan_block_comment(cursor const& s, std::size_t const i, scan_limits const& limits) noexcept
+   { return continue_block_comment(s, i + 2, 1, limits.max_comment_depth); }
+
+   /// \brief Returns the view of `s` that a literal starting at `i` is scanned through.
+   ///
+   /// A literal that is no longer than `max_length` is scanned exactly as it would be through `s`,
+   /// since the lexer never reads more than max_lookahead bytes past the end of a token. A longer
+   /// one is cut off a few bytes after `max_length`, rather than being scanned to its end.
+   ///
+   [[nodiscard]] cursor
+   literal_cursor(cursor const& s, std::size_t const i, std::size_t const max_length) noexcept
+   {
+      return max_length < s.size() - i ? s.first(i + max_length + lingua::max_lookahead + 1) : s;
+   }
+
+   /// \brief Moves past the next character of a string literal, which isn't its closing quote.
+   ///
+   [[nodiscard]] std::size_t step_string(cursor const& s, std::size_t const i) noexcept
+   { return s[i] == u8'\\' ? i + 2 : i + 1; }
+
+   /// \brief Scans the rest of a string literal, from a point that isn't inside an escape.
+   ///
+   [[nodiscard]] scanned
+   continue_string(cursor const& s, std::size_t i, token_kind const kind) noexcept
+   {
+      while (i < s.size()) {
+         if (s[i] == u8'"') {
+            return {kind, i + 1};
+         }
+         i = step_string(s, i);
+      }
+      return {kind, s.size(), lexical_error_kind::unterminated_string_literal};
+   }
+
+   /// \brief Scans a string literal whose opening quote is at `i`.
+   ///
+   [[nodiscard]] scanned
+   scan_string(cursor const& s, std::size_t const i, token_kind const kind) noexcept
+   { return continue_string(s, i + 1, kind); }
+
+   /// \brief Scans the rest of a raw string literal that is delimited by `hashes` `#`s.
+   ///
+   [[nodiscard]] scanned continue_raw_string(cursor const& s, std::size_t i, std::size_t const hashes,
+      token_kind const kind) noexcept
+   {
+      for (; i < s.size(); ++i) {
+         if (s[i] != u8'"') {
+            continue;
+         }
+         // Only look at as many `#`s as are needed, so that a closed literal never reads past its
+         // end.
+         auto suffix = std::size_t{0};
+         while (suffix < hashes and s[i + 1 + suffix] == u8'#') {
+            ++suffix;
+         }
+         if (suffix == hashes) {
+            return scanned{kind, i + 1 + hashes};
+         }
+      }
+      return scanned{kind, s.size(), lexical_error_kind::unterminated_string_literal};
+   }
+
+   /// \brief Scans a raw string literal, if there is one at `i`.
+   /// \param i The position of the first `#` or `"` after the prefix.
+   ///
+   [[nodiscard]] std::optional<scanned>
+   scan_raw_string(cursor const& s, std::size_t i, token_kind const kind) noexcept
+   {
+      auto const hashes_begin = i;
+      while (s[i] == u8'#' and i - hashes_begin < lingua::max_raw_string_hashes) {
+         ++i;
+      }
+      if (s[i] != u8'"') {
+         return std::nullopt;
+      }
+      return continue_raw_string(s, i + 1, i - hashes_begin, kind);
+   }
+
+   /// \brief Scans a character literal, if there is one at `quote`.
+   ///
+   [[nodiscard]] std::optional<scanned>
+   scan_char(cursor const& s, std::size_t const quote, token_kind const kind) noexcept
+   {
+      auto i = quote + 1;
+      if (s[i] == u8'\\') {
+         // Escapes are validated later, so all that matters here is where the literal ends: `\u{...}`
+         // is the longest escape.
+         constexpr auto longest_escape = std::size_t{10};
+         auto const limit = std::min(i + longest_escape, s.size());
+         i += 1 + code_point_length(s, i + 1);
+         while (i < limit and s[i] != u8'\'' and s[i] != u8'\n') {
+            ++i;
+         }
+      }
+      else if (s[i] != u8'\'' and s[i] != u8'\n' and i < s.size()) {
+         i += code_point_length(s, i);
+      }
+      else {
+         return std::nullopt;
+      }
+
+      return s[i] == u8'\'' ? std::optional{scanned{kind, i + 1}} : std::nullopt;
+   }
+
+   [[nodiscard]] scanned
+   scan_quote(cursor const& s, std::size_t const i, scan_limits const& limits) noexcept
+   {
+      auto const literal_s = literal_cursor(s, i, limits.max_literal_length);
+      if (auto const literal = scan_char(literal_s, i, token_kind::char_literal)) {
+         return *literal;
+      }
+      if (starts_identifier(s, i + 1)) {
+         return {token_kind::lifetime, skip_identifier(s, i + 1)};
+      }
+      return {token_kind::unknown, i + 1, lexical_error_kind::unterminated_char_literal};
+   }
+
+   [[nodiscard]] scanned scan_number(cursor const& s, std::size_t i) noexcept
+   {
+      if (s[i] == u8'0' and (s[i + 1] == u8'x' or s[i + 1] == u8'o' or s[i + 1] == u8'b')) {
+         // Digits that are out of range for the base are diagnosed when the value is computed.
+         i = s.skip(i + 2, [](char8_t const c) { return is_hex_digit(c) or c == u8'_'; });
+         return {token_kind::integer_literal, s.skip(i, is_identifier_continue)};
+      }
+
+      constexpr auto is_decimal = [](char8_t const c) { return is_digit(c) or c == u8'_'; };
+      auto kind = token_kind::integer_literal;
+      i = s.skip(i + 1, is_decimal);
+      if (s[i] == u8'.' and s[i + 1] != u8'.' and not starts_identifier(s, i + 1)) {
+         kind = token_kind::float_literal;
+         i = is_digit(s[i + 1]) ? s.skip(i + 1, is_decimal) : i + 1;
+      }
+
+      if ((s[i] == u8'e' or s[i] == u8'E')
+          and (is_digit(s[i + 1]) or ((s[i + 1] == u8'+' or s[i + 1] == u8'-') and is_digit(s[i + 2])))) {
+         kind = token_kind::float_literal;
+         i = s.skip(i + 2, is_decimal);
+      }
+      return {kind, s.skip(i, is_identifier_continue)};
+   }
+
+   [[nodiscard]] scanned scan_identifier(cursor const& s, std::size_t const i) noexcept
+   {
+      auto const end = skip_identifier(s, i);
+      return {normalized_satisfies(s.substr(i, end - i), is_keyword) ? token_kind::keyword
+                                                                     : token_kind::identifier,
+         end};
+   }
+
+   /// \brief Scans the tokens that start with an identifier character, but may turn out to be
+   ///        prefixed literals or raw identifiers.
+   ///
+   [[nodiscard]] scanned
+   scan_prefixed(cursor const& s, std::size_t const i, scan_limits const& limits) noexcept
+   {
+      auto const literal_s = literal_cursor(s, i, limits.max_literal_length);
+      if (s[i] == u8'r') {
+         if (auto const literal = scan_raw_string(literal_s, i + 1, token_kind::raw_string_literal)) {
+            return *literal;
+         }
+         if (s[i + 1] == u8'#' and starts_identifier(s, i + 2)) {
+            auto const end = skip_identifier(s, i + 2);
+            auto const name = s.substr(i + 2, end - (i + 2));
+            return normalized_satisfies(name, is_prohibited_raw_identifier)
+                 ? scanned{token_kind::raw_identifier, end, lexical_error_kind::invalid_identifier}
+                 : scanned{token_kind::raw_identifier, end};
+         }
+      }
+      else if (s[i] == u8'b') {
+         switch (s[i + 1]) {
+         case u8'\'':
+            if (auto const literal = scan_char(literal_s, i + 1, token_kind::byte_literal)) {
+               return *literal;
+            }
+            break;
+         case u8'"':
+            return scan_string(literal_s, i + 1, token_kind::byte_string_literal);
+         case u8'r':
+            if (auto const literal =
+                   scan_raw_string(literal_s, i + 2, token_kind::raw_byte_string_literal)) {
+               return *literal;
+            }
+            break;
+         default:
+            break;
+         }
+      }
+      return scan_identifier(s, i);
+   }
+
+   [[nodiscard]] scanned scan_unknown(cursor const& s, std::size_t const i) noexcept
+   { return {token_kind::unknown, i + code_point_length(s, i), lexical_error_kind::unknown_token}; }
+
+   /// \brief Picks between a one-character token and its `=` form, e.g. `+` and `+=`.
+   ///
+   [[nodiscard]] scanned
+   with_eq(cursor const& s, std::size_t const i, token_kind const kind, token_kind const eq) noexcept
+   { return s[i + 1] == u8'=' ? scanned{eq, i + 2} : scanned{kind, i + 1}; }
+
+   [[nodiscard]] scanned scan_punctuation(cursor const& s, std::size_t const i) noexcept
+   {
+      auto const single = [i](token_kind const kind) { return scanned{kind, i + 1}; };
+      auto const twice = [i](token_kind const kind) { return scanned{kind, i + 2}; };
+      switch (s[i]) {
+      case u8'(': return single(token_kind::open_paren);
+      case u8')': return single(token_kind::close_paren);
+      case u8'[': return single(token_kind::open_bracket);
+      case u8']': return single(token_kind::close_bracket);
+      case u8'{': return single(token_kind::open_brace);
+      case u8'}': return single(token_kind::close_brace);
+      case u8',': return single(token_kind::comma);
+      case u8';': return single(token_kind::semicolon);
+      case u8'@': return single(token_kind::at);
+      case u8'#': return single(token_kind::pound);
+      case u8'$': return single(token_kind::dollar);
+      case u8'?': return single(token_kind::question);
+      case u8'+': return with_eq(s, i, token_kind::plus, token_kind::plus_eq);
+      case u8'*': return with_eq(s, i, token_kind::star, token_kind::star_eq);
+      case u8'/': return with_eq(s, i, token_kind::slash, token_kind::slash_eq);
+      case u8'%': return with_eq(s, i, token_kind::percent, token_kind::percent_eq);
+      case u8'^': return with_eq(s, i, token_kind::caret, token_kind::caret_eq);
+      case u8'!': return with_eq(s, i, token_kind::bang, token_kind::ne);
+      case u8'-':
+         return s[i + 1] == u8'>' ? twice(token_kind::right_arrow)
+              : with_eq(s, i, token_kind::minus, token_kind::minus_eq);
+      case u8'&':
+         return s[i + 1] == u8'&' ? twice(token_kind::ampersand_ampersand)
+              : with_eq(s, i, token_kind::ampersand, token_kind::ampersand_eq);
+      case u8'|':
+         return s[i + 1] == u8'|' ? twice(token_kind::pipe_pipe)
+              : with_eq(s, i, token_kind::pipe, token_kind::pipe_eq);
+      case u8'=':
+         return s[i + 1] == u8'>' ? twice(token_kind::fat_arrow)
+              : with_eq(s, i, token_kind::eq, token_kind::eq_eq);
+      case u8'<':
+         return s[i + 1] == u8'<' ? with_eq(s, i + 1, token_kind::shl, token_kind::shl_eq)
+              : with_eq(s, i, token_kind::lt, token_kind::le);
+      case u8'>':
+         return s[i + 1] == u8'>' ? with_eq(s, i + 1, token_kind::shr, token_kind::shr_eq)
+              : with_eq(s, i, token_kind::gt, token_kind::ge);
+      case u8':':
+         return s[i + 1] == u8':' ? twice(token_kind::path_separator) : single(token_kind::colon);
+      case u8'.':
+         if (s[i + 1] != u8'.') {
+            return single(token_kind::dot);
+         }
+         return s[i + 2] == u8'.' ? scanned{token_kind::dot_dot_dot, i + 3}
+              : s[i + 2] == u8'=' ? scanned{token_kind::dot_dot_eq, i + 3}
+              : twice(token_kind::dot_dot);
+      default:
+         return scan_unknown(s, i);
+      }
+   }
+
+   [[nodiscard]] constexpr bool is_literal(token_kind const kind) noexcept
+   {
+      return kind == token_kind::integer_literal
+          or kind == token_kind::float_literal
+          or kind == token_kind::char_literal
+          or kind == token_kind::byte_literal
+          or kind == token_kind::string_literal
+          or kind == token_kind::byte_string_literal
+          or kind == token_kind::raw_string_literal
+          or kind == token_kind::raw_byte_string_literal;
+   }
+
+   [[nodiscard]] scanned
+   scan_token(cursor const& s, std::size_t const i, scan_limits const& limits) noexcept
+   {
+      auto const c = s[i];
+      if (is_whitespace(c)) {
+         return scan_whitespace(s, i);
+      }
+      if (c == u8'/' and s[i + 1] == u8'/') {
+         return scan_line_comment(s, i);
+      }
+      if (c == u8'/' and s[i + 1] == u8'*') {
+         return scan_block_comment(s, i, limits);
+      }
+      if (c == u8'r' or c == u8'b') {
+         return scan_prefixed(s, i, limits);
+      }
+      if (starts_identifier(s, i)) {
+         return scan_identifier(s, i);
+      }
+      if (is_digit(c)) {
+         return scan_number(literal_cursor(s, i, limits.max_literal_length), i);
+      }
+      if (c == u8'"') {
+         return scan_string(literal_cursor(s, i, limits.max_literal_length), i,
+            token_kind::string_literal);
+      }
+      if (c == u8'\'') {
+         return scan_quote(s, i, limits);
+      }
+      return scan_punctuation(s, i);
+   }
+
+   /// \brief Scans the token at `i`, stopping early if it exceeds one of `limits`.
+   ///
+   [[nodiscard]] scanned
+   scan(cursor const& s, std::size_t const i, scan_limits const& limits = {}) noexcept
+   {
+      auto result = scan_token(s, i, limits);
+      if (is_literal(result.kind) and result.end - i > limits.max_literal_length) {
+         result.exceeded = lex_limit::literal_length;
+      }
+      return result;
+   }
+
+   /// \brief Scans the rest of the token that `checkpoint` is inside.
+   ///
+   [[nodiscard]] scanned resume(cursor const& s, lingua::lexer_checkpoint const& checkpoint) noexcept
+   {
+      switch (checkpoint.mode) {
+      case lexer_mode::string:
+         return continue_string(s, checkpoint.offset, checkpoint.kind);
+      case lexer_mode::raw_string:
+         return continue_raw_string(s, checkpoint.offset, checkpoint.state, checkpoint.kind);
+      case lexer_mode::block_comment:
+         return continue_block_comment(s, checkpoint.offset, checkpoint.state);
+      case lexer_mode::code:
+         break;
+      }
+      return scan(s, checkpoint.token_offset);
+   }
+
+   [[nodiscard]] constexpr bool can_resume_inside(token_kind const kind) noexcept
+   {
+      return kind == token_kind::block_comment
+          or kind == token_kind::string_literal
+          or kind == token_kind::byte_string_literal
+          or kind == token_kind::raw_string_literal
+          or kind == token_kind::raw_byte_string_literal;
+   }
+
+   // Rust averages a little over four bytes per token once whitespace is counted.
+   constexpr auto expected_bytes_per_token = std::size_t{4};
+
+   /// \brief Returns the first multiple of `interval` that is greater than `offset`.
+   ///
+   [[nodiscard]] constexpr std::size_t
+   next_mark(std::size_t const offset, std::size_t const interval) noexcept
+   { return (offset / interval + 1) * interval; }
+
+   /// \brief Records a checkpoint at the first resumable position after each mark inside `t`, by
+   ///        stepping through the token the same way that its scanner does.
+   ///
+   void checkpoint_inside(cursor const& s, lingua::token const t, std::uint32_t const index,
+      std::size_t mark, std::size_t const interval, std::vector<lingua::lexer_checkpoint>& checkpoints)
+   {
+      auto const end = std::size_t{t.offset} + t.length;
+      auto const record = [&](std::size_t const i, lexer_mode const mode, std::uint32_t const state) {
+         checkpoints.push_back(lingua::lexer_checkpoint{
+            static_cast<std::uint32_t>(i),
+            index,
+            t.offset,
+            state,
+            mode,
+            t.kind
+         });
+         mark = next_mark(i, interval);
+      };
+
+      switch (t.kind) {
+      case token_kind::block_comment: {
+         auto depth = std::uint32_t{1};
+         for (auto i = std::size_t{t.offset} + 2; i < end; i = step_block_comment(s, i, depth)) {
+            if (i >= mark) {
+               record(i, lexer_mode::block_comment, depth);
+            }
+         }
+         break;
+      }
+      case token_kind::string_literal:
+      case token_kind::byte_string_literal: {
+         auto i = std::size_t{t.offset} + (t.kind == token_kind::string_literal ? 1 : 2);
+         for (; i < end and s[i] != u8'"'; i = step_string(s, i)) {
+            if (i >= mark) {
+               record(i, lexer_mode::string, 0);
+            }
+         }
+         break;
+      }
+      case token_kind::raw_string_literal:
+      case token_kind::raw_byte_string_literal: {
+         auto const hashes_begin = std::size_t{t.offset} + (t.kind == token_kind::raw_string_literal ? 1 : 2);
+         auto const hashes = s.skip(hashes_begin, [](char8_t const c) { return c == u8'#'; }) - hashes_begin;
+         // Anywhere in the body will do, so long as it's in front of the closing delimiter.
+         for (auto i = std::max(mark, hashes_begin + hashes + 1); i + hashes < end; i = mark) {
+            record(i, lexer_mode::raw_string, static_cast<std::uint32_t>(hashes));
+         }
+         break;
+      }
+      default:
+         break;
+      }
+   }
+} // namespace
+
+namespace lingua {
+   token lexer::next() noexcept
+   {
+      LINGUA_EXPECTS(not done());
+
+      auto const s = cursor{source_};
+      auto const result = resume_ ? resume(s, *std::exchange(resume_, std::nullopt))
+                                  : scan(s, offset_);
+      auto const end = static_cast<std::uint32_t>(result.end);
+      auto const lexeme = token{result.kind, offset_, end - offset_};
+      error_ = result.error ? std::optional{lexical_error{*result.error, lexeme.offset, lexeme.length}}
+                            : std::nullopt;
+      offset_ = end;
+      return lexeme;
+   }
+
+   lexed_source lex(std::u8string_view const source)
+   {
+      LINGUA_EXPECTS(source.size() <= max_source_size);
+
+      auto lexed = lexed_source{};
+      lexed.tokens.reserve(source.size() / expected_bytes_per_token);
+
+      for (auto l = lexer{source}; not l.done();) {
+         auto const index = static_cast<std::uint32_t>(lexed.tokens.size());
+         lexed.tokens.push_back(l.next());
+         lexed.delimiters.add(index, lexed.tokens.back());
+         if (l.error()) {
+            lexed.errors.push_back(*l.error());
+         }
+      }
+      lexed.delimiters.finish();
+      return lexed;
+   }
+
+   lexed_source lex(std::u8string_view const source, lex_limits const& limits)
+   {
+      LINGUA_EXPECTS(source.size() <= max_source_size);
+      LINGUA_EXPECTS(limits.time_check_interval > 0 and limits.time_check_tokens > 0);
+
+      auto lexed = lexed_source{};
+      auto const exceed = [&lexed](lex_limit const limit, std::uint64_t const value,
+                             std::uint32_t const offset) noexcept {
+         lexed.exceeded_limit = exceeded_lex_limit{limit, value, offset};
+      };
+
+      if (source.size() > limits.max_bytes) {
+         exceed(lex_limit::bytes, limits.max_bytes, 0);
+      }
+      else {
+         auto const expected_tokens = source.size() / expected_bytes_per_token;
+         lexed.tokens.reserve(std::min(expected_tokens, limits.max_tokens));
+      }
+
+      using clock = std::chrono::steady_clock;
+      auto const start = clock::now();
+      auto next_time_check = limits.time_check_interval;
+      auto tokens_until_time_check = limits.time_check_tokens;
+
+      // The scanner is driven directly rather than through a lexer, so that it can stop partway
+      // through a literal or comment that exceeds a limit, instead of scanning to its end first.
+      auto const s = cursor{source};
+      auto const token_limits = scan_limits{limits.max_literal_length, limits.max_comment_depth};
+      auto offset = std::uint32_t{0};
+      while (not lexed.exceeded_limit and offset < source.size()) {
+         if (offset >= next_time_check or tokens_until_time_check-- == 0) {
+            if (std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start)
+                > limits.max_time) {
+               exceed(lex_limit::time, static_cast<std::uint64_t>(limits.max_time.count()), offset);
+               break;
+            }
+            next_time_check = std::size_t{offset} + limits.time_check_interval;
+            tokens_until_time_check = limits.time_check_tokens;
+         }
+
+         if (lexed.tokens.size() == limits.max_tokens) {
+            exceed(lex_limit::tokens, limits.max_tokens, offset);
+            break;
+         }
+
+         auto const [kind, end, error, exceeded] = scan(s, offset, token_limits);
+         if (exceeded) {
+            exceed(*exceeded, *exceeded == lex_limit::literal_length ? limits.max_literal_length
+                                                                       : limits.max_comment_depth,
+               offset);
+            break;
+         }
+
+         auto const t = token{kind, offset, static_cast<std::uint32_t>(end - offset)};
+         if (error) {
+            if (lexed.errors.size() == limits.max_errors) {
+               exceed(lex_limit::errors, limits.max_errors, t.offset);
+               break;
+            }
+            lexed.errors.push_back(lexical_error{*error, t.offset, t.length});
+         }
+
+         auto const index = static_cast<std::uint32_t>(lexed.tokens.size());
+         lexed.tokens.push_back(t);
+         lexed.delimiters.add(index, t);
+         offset = static_cast<std::uint32_t>(end);
+      }
+
+      if (lexed.exceeded_limit) {
+         auto const stop = lexed.exceeded_limit->offset;
+         lexed.tokens.push_back(
+            token{token_kind::unknown, stop, static_cast<std::uint32_t>(source.size() - stop)});
+      }
+      lexed.delimiters.finish();
+      return lexed;
+   }
+
+   std::vector<lexer_checkpoint>
+   make_checkpoints(std::u8string_view const source, std::size_t const interval)
+   {
+      LINGUA_EXPECTS(source.size() <= max_source_size);
+      LINGUA_EXPECTS(interval > 0);
+
+      auto checkpoints = std::vector<lexer_checkpoint>{lexer_checkpoint{}};
+      auto const s = cursor{source};
+      auto mark = interval;
+      auto index = std::uint32_t{0};
+      for (auto l = lexer{source}; not l.done(); ++index) {
+         auto const t = l.next();
+         auto const end = std::size_t{t.offset} + t.length;
+         if (end <= mark) {
+            continue;
+         }
+
+         if (t.offset == mark or not can_resume_inside(t.kind)) {
+            if (checkpoints.back().offset != t.offset) {
+               auto boundary = lexer_checkpoint{};
+               boundary.offset = t.offset;
+               boundary.token_index = index;
+               boundary.token_offset = t.offset;
+               checkpoints.push_back(boundary);
+            }
+            mark = next_mark(t.offset, interval);
+         }
+         checkpoint_inside(s, t, index, mark, interval, checkpoints);
+         mark = (end + interval - 1) / interval * interval;
+      }
+      return checkpoints;
+   }
+
+   lexed_region lex_region(std::u8string_view const source,
+      std::span<lexer_checkpoint const> const checkpoints, std::size_t const begin,
+      std::size_t const end)
+   {
+      LINGUA_EXPECTS(begin <= end and end <= source.size());
+
+      auto const after = std::ranges::upper_bound(checkpoints, begin, {}, &lexer_checkpoint::offset);
+      LINGUA_EXPECTS(after != checkpoints.begin());
+      auto const& checkpoint = *std::prev(after);
+
+      auto region = lexed_region{};
+      region.first_token = checkpoint.token_index;
+      auto l = lexer{source, checkpoint};
+      while (not l.done() and l.offset() < end) {
+         auto const t = l.next();
+         if (std::size_t{t.offset} + t.length <= begin) {
+            ++region.first_token;
+            continue;
+         }
+         if (begin == end) {
+            break;
+         }
+
+         region.tokens.push_back(t);
+         if (l.error()) {
+            region.errors.push_back(*l.error());
+         }
+      }
+      return region;
+   }
+} // namespace lingua
@@ -0,0 +1,286 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/lexical_diagnostic.hpp"
+#include "lingua/lexer/string_literal_terminated.hpp"
+#include "lingua/source_coordinate.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua/utility/contract.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace {
+   using lingua::source_coordinate;
+
+   /// \brief Computes the coordinates of increasing offsets into a source.
+   ///
+   class coordinate_tracker {
+   public:
+      explicit coordinate_tracker(std::u8string_view const source) noexcept
+         : source_{source}
+      {}
+
+      [[nodiscard]] source_coordinate advance_to(std::size_t const offset) noexcept
+      {
+         LINGUA_EXPECTS(offset_ <= offset and offset <= source_.size());
+         for (; offset_ < offset; ++offset_) {
+            if (source_[offset_] == u8'\n') {
+               ++line_;
+               column_ = 1;
+            }
+            else {
+               ++column_;
+            }
+         }
+         return source_coordinate{
+            source_coordinate::line_type{line_},
+            source_coordinate::column_type{column_}
+         };
+      }
+
+   private:
+      std::u8string_view source_;
+      std::size_t offset_ = 0;
+      source_coordinate::value_type line_ = 1;
+      source_coordinate::value_type column_ = 1;
+   };
+
+   /// \brief Returns the part of an unterminated comment that unterminated_comment should quote.
+   ///
+   /// unterminated_comment counts `/*` and `*/` pairs that overlap, whereas the lexer doesn't (in
+   /// `/*/`, the `*` can't both open and close the comment). When the counts disagree, fall back to
+   /// the opening delimiter.
+   ///
+   [[nodiscard]] std::u8string_view comment_lexeme(std::u8string_view const comment) noexcept
+   {
+      auto balance = std::ptrdiff_t{0};
+      for (auto i = std::size_t{1}; i < comment.size(); ++i) {
+         if (comment[i - 1] == u8'/' and comment[i] == u8'*') {
+            ++balance;
+         }
+         else if (comment[i - 1] == u8'*' and comment[i] == u8'/') {
+            --balance;
+         }
+      }
+      return balance > 0 ? comment : comment.substr(0, 2);
+   }
+
+   /// \brief Returns the part of an unterminated string that unterminated_string_literal should
+   ///        quote.
+   ///
+   /// string_literal_terminated only looks at the last quote, so it accepts some strings that the
+   /// lexer doesn't (e.g. `r#"a"b#`). When they disagree, fall back to everything up to the
+   /// opening quote.
+   ///
+   [[nodiscard]] std::u8string_view string_lexeme(std::u8string_view const literal) noexcept
+   {
+      return lingua::string_literal_terminated(literal)
+           ? literal.substr(0, literal.find(u8'"') + 1)
+           : literal;
+   }
+
+   /// \brief Appends diagnostics in order of position, tracking their coordinates as it goes.
+   ///
+   class diagnostic_writer {
+   public:
+      explicit diagnostic_writer(std::u8string_view const source) noexcept
+         : source_{source}
+         , tracker_{source}
+      {}
+
+      void add(lingua::lexical_error const& error)
+      {
+         using namespace lingua;
+
+         auto const coordinates =
+            coordinates_of(error.offset, std::size_t{error.offset} + error.length);
+         auto const text = error.text(source_);
+         switch (error.kind) {
+         case lexical_error_kind::unknown_token:
+            diagnostics_.emplace_back(std::in_place_type<unknown_token>, text, coordinates);
+            break;
+         case lexical_error_kind::unterminated_comment:
+            diagnostics_.emplace_back(std::in_place_type<unterminated_comment>,
+               comment_lexeme(text), coordinates);
+            break;
+         case lexical_error_kind::unterminated_string_literal:
+            diagnostics_.emplace_back(std::in_place_type<unterminated_string_literal>,
+               string_lexeme(text), coordinates);
+            break;
+         case lexical_error_kind::unterminated_char_literal:
+            diagnostics_.emplace_back(std::in_place_type<unterminated_char_literal>, text,
+               coordinates);
+            break;
+         case lexical_error_kind::invalid_identifier:
+            diagnostics_.emplace_back(std::in_place_type<invalid_identifier>, text, coordinates);
+            break;
+         case lexical_error_kind::unbalanced_delimiter:
+            diagnostics_.emplace_back(std::in_place_type<unbalanced_delimiter>, text, coordinates);
+            break;
+         }
+      }
+
+      /// \brief Adds one diagnostic that stands for all of `repeats`.
+      ///
+      void add_repeats(std::span<lingua::lexical_error const> const repeats)
+      {
+         auto const coordinates = coordinates_of(repeats.front().offset,
+            std::size_t{repeats.back().offset} + repeats.back().length);
+         diagnostics_.emplace_back(std::in_place_type<lingua::repeated_diagnostic>, repeats.size(),
+            coordinates);
+      }
+
+      /// \brief Adds a note that the errors from `offset` on weren't reported.
+      ///
+      void add_suppressed(std::size_t const suppressed, std::size_t const offset)
+      {
+         diagnostics_.emplace_back(std::in_place_type<lingua::diagnostics_suppressed>, suppressed,
+            coordinates_of(offset, offset));
+      }
+
+      void add_exceeded(lingua::exceeded_lex_limit const& exceeded)
+      {
+         diagnostics_.emplace_back(std::in_place_type<lingua::lex_limit_exceeded>, exceeded.limit,
+            exceeded.value, coordinates_of(exceeded.offset, exceeded.offset));
+      }
+
+      [[nodiscard]] std::vector<lingua::lexical_diagnostic> take() noexcept
+      { return std::move(diagnostics_); }
+
+      void reserve(std::size_t const size)
+      { diagnostics_.reserve(size); }
+
+   private:
+      std::u8string_view source_;
+      coordinate_tracker tracker_;
+      std::vector<lingua::lexical_diagnostic> diagnostics_;
+
+      [[nodiscard]] lingua::source_coordinate_range
+      coordinates_of(std::size_t const begin, std::size_t const end) noexcept
+      {
+         auto const first = tracker_.advance_to(begin);
+         return lingua::source_coordinate_range{first, tracker_.advance_to(end)};
+      }
+   };
+
+   /// \brief Hands out the diagnostics that a diagnostic_limits allows for one file.
+   ///
+   class diagnostic_quota {
+   public:
+      explicit diagnostic_quota(lingua::diagnostic_limits const& limits) noexcept
+         : remaining_{limits.max_per_file}
+         , budget_{limits.budget}
+      {}
+
+      [[nodiscard]] bool take() noexcept
+      {
+         if (remaining_ == 0 or (budget_ != nullptr and budget_->take(1) == 0)) {
+            return false;
+         }
+         --remaining_;
+         return true;
+      }
+
+   private:
+      std::size_t remaining_;
+      lingua::diagnostic_budget* budget_;
+   };
+
+   /// \brief Checks if two errors would make the same diagnostic, apart from where it is.
+   ///
+   [[nodiscard]] bool same_diagnostic(std::u8string_view const source,
+      lingua::lexical_error const& x, lingua::lexical_error const& y) noexcept
+   { return x.kind == y.kind and x.text(source) == y.text(source); }
+
+   /// \brief Makes the diagnostics for `errors` that `limits` allows, then for `exceeded` if lexing
+   ///        stopped early.
+   ///
+   /// Errors are compared before any are formatted, so collapsed and suppressed errors cost next to
+   /// nothing.
+   ///
+   [[nodiscard]] std::vector<lingua::lexical_diagnostic>
+   diagnose(std::u8string_view const source, std::span<lingua::lexical_error const> const errors,
+      std::optional<lingua::exceeded_lex_limit> const& exceeded,
+      lingua::diagnostic_limits const& limits)
+   {
+      LINGUA_EXPECTS(limits.collapse_runs_of >= 2);
+
+      auto writer = diagnostic_writer{source};
+      writer.reserve(std::min(errors.size(), limits.max_per_file) + 2);
+
+      auto quota = diagnostic_quota{limits};
+      for (auto i = std::size_t{0}; i < errors.size();) {
+         auto run = std::size_t{1};
+         while (i + run < errors.size() and same_diagnostic(source, errors[i], errors[i + run])) {
+            ++run;
+         }
+
+         auto const collapse = run >= limits.collapse_runs_of;
+         auto const end = collapse ? i + 1 : i + run;
+         for (; i < end and quota.take(); ++i) {
+            writer.add(errors[i]);
+         }
+
+         if (i == end and collapse and quota.take()) {
+            writer.add_repeats(errors.subspan(i, run - 1));
+            i += run - 1;
+         }
+         else if (i != errors.size() and (i != end or collapse)) {
+            writer.add_suppressed(errors.size() - i, errors[i].offset);
+            break;
+         }
+      }
+
+      if (exceeded) {
+         writer.add_exceeded(*exceeded);
+      }
+      return writer.take();
+   }
+
+   /// \brief Merges the errors that lex found with its unbalanced delimiters.
+   ///
+   [[nodiscard]] std::vector<lingua::lexical_error> all_errors(lingua::lexed_source const& lexed)
+   {
+      auto const delimiter_errors = lexed.delimiters.errors();
+      auto errors = std::vector<lingua::lexical_error>{};
+      errors.reserve(lexed.errors.size() + delimiter_errors.size());
+      std::ranges::merge(lexed.errors, delimiter_errors, std::back_inserter(errors), {},
+         &lingua::lexical_error::offset, &lingua::lexical_error::offset);
+      return errors;
+   }
+} // namespace
+
+namespace lingua {
+   std::vector<lexical_diagnostic>
+   make_diagnostics(std::u8string_view const source, std::span<lexical_error const> const errors)
+   { return diagnose(source, errors, std::nullopt, diagnostic_limits{}); }
+
+   std::vector<lexical_diagnostic>
+   make_diagnostics(std::u8string_view const source, std::span<lexical_error const> const errors,
+      diagnostic_limits const& limits)
+   { return diagnose(source, errors, std::nullopt, limits); }
+
+   std::vector<lexical_diagnostic>
+   make_diagnostics(std::u8string_view const source, lexed_source const& lexed)
+   { return diagnose(source, all_errors(lexed), lexed.exceeded_limit, diagnostic_limits{}); }
+
+   std::vector<lexical_diagnostic>
+   make_diagnostics(std::u8string_view const source, lexed_source const& lexed,
+      diagnostic_limits const& limits)
+   { return diagnose(source, all_errors(lexed), lexed.exceeded_limit, limits); }
+} // namespace lingua
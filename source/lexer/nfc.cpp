@@ -0,0 +1,342 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/nfc.hpp"
+#include "lingua/lexer/detail/nfc_table.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace {
+   namespace detail_nfc = lingua::detail_nfc;
+
+   // Hangul syllables are composed and decomposed arithmetically, as described in section 3.12 of
+   // the Unicode Standard.
+   constexpr auto syllable_base = char32_t{0xac00};
+   constexpr auto leading_base = char32_t{0x1100};
+   constexpr auto vowel_base = char32_t{0x1161};
+   constexpr auto trailing_base = char32_t{0x11a7};
+   constexpr auto leading_count = char32_t{19};
+   constexpr auto vowel_count = char32_t{21};
+   constexpr auto trailing_count = char32_t{28};
+   constexpr auto vowel_syllable_count = vowel_count * trailing_count;
+   constexpr auto syllable_count = leading_count * vowel_syllable_count;
+
+   /// \brief Decodes the code point at `i`, and moves `i` past it.
+   ///
+   [[nodiscard]] char32_t decode(std::u8string_view const text, std::size_t& i) noexcept
+   // [[expects: i < text.size()]]
+   {
+      auto const lead = text[i];
+      auto const length = lead < 0xc0 ? std::size_t{1}
+                        : lead < 0xe0 ? std::size_t{2}
+                        : lead < 0xf0 ? std::size_t{3}
+                        : std::size_t{4};
+      if (length == 1 or text.size() - i < length) {
+         ++i;
+         return lead;
+      }
+
+      auto c = char32_t{lead} & (0x7fU >> length);
+      for (auto j = std::size_t{1}; j < length; ++j) {
+         c = (c << 6U) | (text[i + j] & 0x3fU);
+      }
+      i += length;
+      return c;
+   }
+
+   template<class Out>
+   void encode(char32_t const c, Out& out)
+   {
+      if (c < 0x80) {
+         out.push_back(static_cast<char8_t>(c));
+      }
+      else if (c < 0x800) {
+         out.push_back(static_cast<char8_t>(0xc0U | (c >> 6U)));
+         out.push_back(static_cast<char8_t>(0x80U | (c & 0x3fU)));
+      }
+      else if (c < 0x10000) {
+         out.push_back(static_cast<char8_t>(0xe0U | (c >> 12U)));
+         out.push_back(static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU)));
+         out.push_back(static_cast<char8_t>(0x80U | (c & 0x3fU)));
+      }
+      else {
+         out.push_back(static_cast<char8_t>(0xf0U | (c >> 18U)));
+         out.push_back(static_cast<char8_t>(0x80U | ((c >> 12U) & 0x3fU)));
+         out.push_back(static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU)));
+         out.push_back(static_cast<char8_t>(0x80U | (c & 0x3fU)));
+      }
+   }
+
+   /// \brief Stands in for a std::basic_string in the normalization steps, but stores into a
+   ///        fixed buffer, and remembers whether anything didn't fit.
+   ///
+   template<class T>
+   class bounded_buffer {
+   public:
+      explicit bounded_buffer(std::span<T> const storage) noexcept
+         : storage_{storage}
+      {}
+
+      void push_back(T const x) noexcept
+      {
+         if (size_ == storage_.size()) {
+            overflowed_ = true;
+            return;
+         }
+         storage_[size_++] = x;
+      }
+
+      void append(T const* const data, std::size_t const length) noexcept
+      {
+         for (auto i = std::size_t{0}; i < length; ++i) {
+            push_back(data[i]);
+         }
+      }
+
+      [[nodiscard]] T& operator[](std::size_t const i) noexcept
+      { return storage_[i]; }
+
+      [[nodiscard]] std::size_t size() const noexcept
+      { return size_; }
+
+      [[nodiscard]] bool empty() const noexcept
+      { return size_ == 0; }
+
+      void resize(std::size_t const size) noexcept
+      { size_ = size; }
+      // [[expects: size <= this->size()]]
+
+      [[nodiscard]] std::span<T> contents() const noexcept
+      { return storage_.first(size_); }
+
+      [[nodiscard]] bool overflowed() const noexcept
+      { return overflowed_; }
+
+   private:
+      std::span<T> storage_;
+      std::size_t size_ = 0;
+      bool overflowed_ = false;
+   };
+
+   [[nodiscard]] detail_nfc::normalization_class class_of(char32_t const c) noexcept
+   {
+      if (c < detail_nfc::table_start or c >= detail_nfc::table_limit) {
+         return detail_nfc::normalization_classes[0];
+      }
+
+      constexpr auto chunk_mask = (char32_t{1} << detail_nfc::chunk_bits) - 1;
+      auto const index = c - detail_nfc::table_start;
+      auto const leaf = char32_t{detail_nfc::normalization_chunks[index >> detail_nfc::chunk_bits]};
+      auto const offset = (leaf << detail_nfc::chunk_bits) | (index & chunk_mask);
+      return detail_nfc::normalization_classes[detail_nfc::normalization_leaves[offset]];
+   }
+
+   [[nodiscard]] std::uint8_t combining_class(char32_t const c) noexcept
+   { return class_of(c).combining_class; }
+
+   /// \brief Appends the full canonical decomposition of `c` to `out`.
+   ///
+   template<class CodePoints>
+   void decompose(char32_t const c, CodePoints& out)
+   {
+      if (auto const s = c - syllable_base; s < syllable_count) {
+         out.push_back(leading_base + s / vowel_syllable_count);
+         out.push_back(vowel_base + s % vowel_syllable_count / trailing_count);
+         if (auto const t = s % trailing_count; t != 0) {
+            out.push_back(trailing_base + t);
+         }
+         return;
+      }
+
+      auto const found = std::ranges::lower_bound(detail_nfc::decompositions, c, {},
+         &detail_nfc::decomposition::code_point);
+      if (found == detail_nfc::decompositions.end() or found->code_point != c) {
+         out.push_back(c);
+         return;
+      }
+      out.append(detail_nfc::decomposition_pool.data() + found->offset, found->length);
+   }
+
+   /// \brief Sorts each run of non-starters by combining class, keeping equal classes in order.
+   ///
+   template<class CodePoints>
+   void put_in_canonical_order(CodePoints& s) noexcept
+   {
+      for (auto i = std::size_t{1}; i < s.size(); ++i) {
+         auto const c = s[i];
+         auto const c_class = combining_class(c);
+         if (c_class == 0) {
+            continue;
+         }
+
+         // A starter has class 0, so this never moves a mark past one.
+         auto j = i;
+         for (; j > 0 and combining_class(s[j - 1]) > c_class; --j) {
+            s[j] = s[j - 1];
+         }
+         s[j] = c;
+      }
+   }
+
+   /// \brief Returns the primary composite of `first` and `second`, or zero if there isn't one.
+   ///
+   [[nodiscard]] char32_t compose_pair(char32_t const first, char32_t const second) noexcept
+   {
+      if (auto const l = first - leading_base, v = second - vowel_base;
+          l < leading_count and v < vowel_count) {
+         return syllable_base + (l * vowel_count + v) * trailing_count;
+      }
+      if (auto const s = first - syllable_base, t = second - trailing_base;
+          s < syllable_count and s % trailing_count == 0 and t - 1 < trailing_count - 1) {
+         return first + t;
+      }
+
+      auto const found = std::ranges::lower_bound(detail_nfc::compositions,
+         std::pair{first, second}, {}, [](detail_nfc::composition const& x) {
+            return std::pair{x.first, x.second};
+         });
+      return found != detail_nfc::compositions.end() and found->first == first
+          and found->second == second ? found->composite : char32_t{0};
+   }
+
+   /// \brief Replaces each starter and the unblocked characters that follow it with their
+   ///        primary composite, where there is one.
+   ///
+   template<class CodePoints>
+   void compose(CodePoints& s) noexcept
+   {
+      if (s.empty()) {
+         return;
+      }
+
+      auto starter = std::size_t{0};
+      // A string that begins with a non-starter has nothing to compose it with, so its class is
+      // treated as higher than any other.
+      auto last_class = combining_class(s[0]) == 0 ? 0U : 256U;
+      auto kept = std::size_t{1};
+      for (auto i = std::size_t{1}; i < s.size(); ++i) {
+         auto const c = s[i];
+         auto const c_class = unsigned{combining_class(c)};
+
+         // A character is blocked from the starter by any character between them whose class is
+         // zero or at least its own.
+         auto const unblocked = last_class < c_class or last_class == 0;
+         if (auto const composite = unblocked ? compose_pair(s[starter], c) : 0; composite != 0) {
+            s[starter] = composite;
+            continue;
+         }
+
+         if (c_class == 0) {
+            starter = kept;
+         }
+         last_class = c_class;
+         s[kept++] = c;
+      }
+      s.resize(kept);
+   }
+} // namespace
+
+namespace lingua {
+   nfc_quick_check_result nfc_quick_check(std::u8string_view const text) noexcept
+   {
+      auto answer = nfc_quick_check_result::yes;
+      auto last_class = std::uint8_t{0};
+      for (auto i = std::size_t{0}; i < text.size();) {
+         if (text[i] < 0x80) {
+            last_class = 0;
+            ++i;
+            continue;
+         }
+
+         auto const c = decode(text, i);
+         auto const [c_class, quick_check] = class_of(c);
+         if ((c_class != 0 and last_class > c_class) or quick_check == 2) {
+            return nfc_quick_check_result::no;
+         }
+         if (quick_check == 1) {
+            answer = nfc_quick_check_result::maybe;
+         }
+         last_class = c_class;
+      }
+      return answer;
+   }
+
+   std::u8string to_nfc(std::u8string_view const text)
+   {
+      if (nfc_quick_check(text) == nfc_quick_check_result::yes) {
+         return std::u8string{text};
+      }
+
+      auto code_points = std::u32string{};
+      code_points.reserve(text.size());
+      for (auto i = std::size_t{0}; i < text.size();) {
+         decompose(decode(text, i), code_points);
+      }
+      put_in_canonical_order(code_points);
+      compose(code_points);
+
+      auto normalized = std::u8string{};
+      normalized.reserve(text.size());
+      for (auto const c : code_points) {
+         encode(c, normalized);
+      }
+      return normalized;
+   }
+
+   std::optional<std::u8string_view>
+   to_nfc(std::u8string_view const text, std::span<char8_t> const buffer) noexcept
+   {
+      auto normalized = bounded_buffer{buffer};
+      if (nfc_quick_check(text) == nfc_quick_check_result::yes) {
+         normalized.append(text.data(), text.size());
+      }
+      else {
+         auto storage = std::array<char32_t, max_buffered_decomposition>{};
+         auto code_points = bounded_buffer<char32_t>{storage};
+         for (auto i = std::size_t{0}; i < text.size() and not code_points.overflowed();) {
+            decompose(decode(text, i), code_points);
+         }
+         if (code_points.overflowed()) {
+            return std::nullopt;
+         }
+         put_in_canonical_order(code_points);
+         compose(code_points);
+
+         for (auto const c : code_points.contents()) {
+            encode(c, normalized);
+         }
+      }
+
+      if (normalized.overflowed()) {
+         return std::nullopt;
+      }
+      auto const result = normalized.contents();
+      return std::u8string_view{result.data(), result.size()};
+   }
+
+   bool is_nfc(std::u8string_view const text)
+   {
+      switch (nfc_quick_check(text)) {
+      case nfc_quick_check_result::yes:
+         return true;
+      case nfc_quick_check_result::no:
+         return false;
+      case nfc_quick_check_result::maybe:
+         break;
+      }
+      return to_nfc(text) == text;
+   }
+} // namespace lingua
@@ -0,0 +1,91 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/token_buffer.hpp"
+#include "lingua/utility/contract.hpp"
+
+namespace {
+   /// \brief Appends `value` as an unsigned LEB128 number.
+   ///
+   void write_varint(std::vector<std::uint8_t>& bytes, std::uint32_t value)
+   {
+      while (value >= 0x80U) {
+         bytes.push_back(static_cast<std::uint8_t>(value | 0x80U));
+         value >>= 7U;
+      }
+      bytes.push_back(static_cast<std::uint8_t>(value));
+   }
+} // namespace
+
+namespace lingua {
+   compressed_token_buffer::compressed_token_buffer(std::span<token const> const tokens)
+   {
+      kinds_.reserve(tokens.size());
+      bytes_.reserve(tokens.size() * 2);
+      blocks_.reserve(tokens.size() / block_size + 1);
+      for (auto const t : tokens) {
+         push_back(t);
+      }
+   }
+
+   compressed_token_buffer::compressed_token_buffer(token_buffer const& tokens)
+   {
+      kinds_.reserve(tokens.size());
+      bytes_.reserve(tokens.size() * 2);
+      blocks_.reserve(tokens.size() / block_size + 1);
+      for (auto const t : tokens) {
+         push_back(t);
+      }
+   }
+
+   void compressed_token_buffer::push_back(token const t)
+   {
+      LINGUA_EXPECTS(t.offset >= end_);
+
+      if (kinds_.size() % block_size == 0) {
+         blocks_.push_back(block{bytes_.size(), end_});
+      }
+      kinds_.push_back(t.kind);
+      write_varint(bytes_, t.offset - end_);
+      write_varint(bytes_, t.length);
+      end_ = t.offset + t.length;
+   }
+
+   token compressed_token_buffer::operator[](std::size_t const i) const noexcept
+   {
+      LINGUA_EXPECTS(i < size());
+
+      auto const& start = blocks_[i / block_size];
+      auto const* next = bytes_.data() + start.position;
+      auto previous_end = start.previous_end;
+      for (auto skipped = i % block_size; skipped > 0; --skipped) {
+         previous_end += detail_token_buffer::read_varint(next);
+         previous_end += detail_token_buffer::read_varint(next);
+      }
+
+      auto const offset = previous_end + detail_token_buffer::read_varint(next);
+      return token{kinds_[i], offset, detail_token_buffer::read_varint(next)};
+   }
+
+   token_buffer compressed_token_buffer::decompress() const
+   {
+      auto tokens = token_buffer{};
+      tokens.reserve(size());
+      for (auto i = begin(); i != end(); ++i) {
+         tokens.push_back(*i);
+      }
+      return tokens;
+   }
+} // namespace lingua
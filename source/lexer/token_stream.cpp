@@ -0,0 +1,257 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/token_stream.hpp"
+#include "lingua/utility/contract.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <utility>
+
+namespace {
+   using lingua::lexical_error;
+   using lingua::max_lookahead;
+   using lingua::source_buffer;
+   using lingua::token;
+
+   /// \brief Lexes a source_buffer by lexing a contiguous copy of the text around the next token.
+   ///
+   /// A token is only accepted if the window holds max_lookahead bytes past its end (or the window
+   /// reaches the end of the source), since otherwise the lexer might have stopped early for want of
+   /// input. When it doesn't, the window is refilled from the token. The window starts small, so
+   /// that relexing a few tokens only copies a little, and grows as lexing carries on.
+   ///
+   class windowed_lexer {
+   public:
+      explicit windowed_lexer(source_buffer const& source, std::uint32_t const offset) noexcept
+         : source_{&source}
+         , offset_{offset}
+      {}
+
+      [[nodiscard]] bool done() const noexcept
+      { return offset_ == source_->size(); }
+
+      [[nodiscard]] std::uint32_t offset() const noexcept
+      { return offset_; }
+
+      [[nodiscard]] token next()
+      {
+         LINGUA_EXPECTS(not done());
+
+         if (offset_ < window_begin_ or offset_ >= window_begin_ + window_.size()) {
+            refill();
+         }
+
+         for (;;) {
+            auto l = lingua::lexer{window_, static_cast<std::uint32_t>(offset_ - window_begin_)};
+            auto lexeme = l.next();
+            if (window_begin_ + window_.size() == source_->size()
+            or std::size_t{l.offset()} + max_lookahead <= window_.size()) {
+               lexeme.offset = offset_;
+               error_ = l.error();
+               if (error_) {
+                  error_->offset = offset_;
+               }
+               offset_ += lexeme.length;
+               return lexeme;
+            }
+
+            // A token that doesn't fit in a window of its own needs a bigger one, whatever size it
+            // already is.
+            if (window_begin_ == offset_ or capacity_ < streaming_window) {
+               capacity_ *= 2;
+            }
+            refill();
+         }
+      }
+
+      [[nodiscard]] std::optional<lexical_error> const& error() const noexcept
+      { return error_; }
+
+   private:
+      static constexpr auto initial_window = std::size_t{4} * max_lookahead;
+      static constexpr auto streaming_window = std::size_t{64} * 1024;
+
+      source_buffer const* source_;
+      std::uint32_t offset_;
+      std::u8string window_;
+      std::size_t window_begin_ = 0;
+      std::size_t capacity_ = initial_window;
+      std::optional<lexical_error> error_;
+
+      void refill()
+      {
+         window_begin_ = offset_;
+         window_ = source_->substr(offset_, capacity_);
+      }
+   };
+} // namespace
+
+namespace lingua {
+   token_stream::token_stream(std::u8string_view const source)
+      : source_size_{(LINGUA_EXPECTS(source.size() <= max_source_size),
+                      static_cast<std::uint32_t>(source.size()))}
+   {
+      auto lexed = lex(source);
+      tokens_ = std::move(lexed.tokens);
+      errors_ = std::move(lexed.errors);
+      gap_begin_ = tokens_.size();
+      gap_end_ = tokens_.size();
+   }
+
+   token_stream::token_stream(source_buffer const& source)
+   {
+      relex(source, text_edit{0, 0, static_cast<std::uint32_t>(source.size())});
+   }
+
+   std::vector<token> token_stream::tokens() const
+   {
+      auto copy = std::vector<token>{};
+      copy.reserve(size());
+      for (auto i = std::size_t{0}; i < size(); ++i) {
+         copy.push_back((*this)[i]);
+      }
+      return copy;
+   }
+
+   relexed_range token_stream::relex(std::u8string_view const source, text_edit const edit)
+   {
+      LINGUA_EXPECTS(source.size() <= max_source_size);
+      return resume(edit, static_cast<std::uint32_t>(source.size()),
+         [source](std::uint32_t const restart) { return lexer{source, restart}; });
+   }
+
+   relexed_range token_stream::relex(source_buffer const& source, text_edit const edit)
+   {
+      LINGUA_EXPECTS(source.size() <= max_source_size);
+      return resume(edit, static_cast<std::uint32_t>(source.size()),
+         [&source](std::uint32_t const restart) { return windowed_lexer{source, restart}; });
+   }
+
+   template<typename MakeLexer>
+   relexed_range token_stream::resume(text_edit const edit, std::uint32_t const new_size,
+      MakeLexer make_lexer)
+   {
+      LINGUA_EXPECTS(edit.offset <= source_size_ and edit.removed <= source_size_ - edit.offset);
+      LINGUA_EXPECTS(new_size == std::size_t{source_size_} - edit.removed + edit.inserted);
+
+      // Keep every token that ends far enough in front of the edit that lexing it never looked at
+      // the edited bytes.
+      auto first = std::size_t{0};
+      for (auto last = size(); first < last;) {
+         auto const middle = first + (last - first) / 2;
+         if (std::size_t{end_of(middle)} + max_lookahead <= edit.offset) {
+            first = middle + 1;
+         }
+         else {
+            last = middle;
+         }
+      }
+      move_gap(first);
+
+      auto const old_size = source_size_;
+      auto const restart = first == 0 ? std::uint32_t{0} : end_of(first - 1);
+      auto const edited_end = std::int64_t{edit.offset} + edit.inserted;
+
+      // After the gap, tokens are stored as their distance from the end of the source, which holds
+      // for the unedited suffix whichever version of the source it's measured in. Tokens that were
+      // deleted are further from the end than the new source is long, so they come out negative,
+      // which is before edited_end; they must always be skipped, never matched.
+      auto const new_offset_of_next = [this, new_size] {
+         return std::int64_t{new_size} - std::int64_t{tokens_[gap_end_].offset};
+      };
+
+      auto new_errors = std::vector<lexical_error>{};
+      auto removed = std::size_t{0};
+      auto const old_gap_begin = gap_begin_;
+      auto l = make_lexer(restart);
+      while (not l.done()) {
+         if (auto const offset = std::int64_t{l.offset()}; offset >= edited_end) {
+            while (gap_end_ < tokens_.size() and new_offset_of_next() < offset) {
+               ++gap_end_;
+               ++removed;
+            }
+            if (gap_end_ < tokens_.size() and new_offset_of_next() == offset) {
+               break;
+            }
+         }
+
+         push_before_gap(l.next());
+         if (l.error()) {
+            new_errors.push_back(*l.error());
+         }
+      }
+
+      if (l.done()) {
+         removed += tokens_.size() - gap_end_;
+         gap_end_ = tokens_.size();
+      }
+
+      // The tokens after the gap are unchanged, but their errors were recorded relative to the
+      // start of the source, so they need to be moved.
+      auto const resumed = gap_end_ == tokens_.size() ? old_size
+                         : old_size - tokens_[gap_end_].offset;
+      auto const by_offset = [](lexical_error const& e) { return e.offset; };
+      auto const erase_begin = std::ranges::lower_bound(errors_, restart, {}, by_offset);
+      auto const erase_end = std::ranges::lower_bound(errors_, resumed, {}, by_offset);
+      for (auto& e : std::ranges::subrange{erase_end, errors_.end()}) {
+         e.offset = e.offset - old_size + new_size;
+      }
+      auto const insert_at = errors_.erase(erase_begin, erase_end);
+      errors_.insert(insert_at, new_errors.begin(), new_errors.end());
+
+      source_size_ = new_size;
+      return relexed_range{
+         .first = first,
+         .removed = removed,
+         .inserted = gap_begin_ - old_gap_begin,
+      };
+   }
+
+   std::uint32_t token_stream::end_of(std::size_t const i) const noexcept
+   {
+      auto const t = (*this)[i];
+      return t.offset + t.length;
+   }
+
+   void token_stream::move_gap(std::size_t const index) noexcept
+   {
+      while (gap_begin_ > index) {
+         auto& moved = tokens_[--gap_end_];
+         moved = tokens_[--gap_begin_];
+         moved.offset = source_size_ - moved.offset;
+      }
+      while (gap_begin_ < index) {
+         auto& moved = tokens_[gap_begin_++];
+         moved = tokens_[gap_end_++];
+         moved.offset = source_size_ - moved.offset;
+      }
+   }
+
+   void token_stream::push_before_gap(token const t)
+   {
+      if (gap_size() == 0) {
+         // Grow the gap in proportion to the stream, so that inserting many tokens is amortised
+         // constant time.
+         constexpr auto minimum_gap = std::size_t{64};
+         auto const growth = std::max(minimum_gap, tokens_.size() / 2);
+         tokens_.insert(tokens_.begin() + static_cast<std::ptrdiff_t>(gap_end_), growth, token{});
+         gap_end_ += growth;
+      }
+      tokens_[gap_begin_++] = t;
+   }
+} // namespace lingua
@@ -0,0 +1,346 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/unescape.hpp"
+#include "lingua/lexer/is_escape.hpp"
+#include "lingua/utility/contract.hpp"
+#include "lingua/utility/simd.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef LINGUA_SIMD_X86
+#   include <immintrin.h>
+#endif // LINGUA_SIMD_X86
+
+namespace {
+   using lingua::token_kind;
+   using lingua::unicode_escape_error;
+   using lingua::unescape_error;
+   using lingua::unescaped_literal;
+
+   /// \brief Finishes find_special one byte at a time, starting from offset `i`.
+   ///
+   [[nodiscard]] std::size_t find_special_tail(std::u8string_view const text, std::size_t i,
+      bool const find_escapes, bool const find_non_ascii) noexcept
+   {
+      for (; i < text.size(); ++i) {
+         if ((find_escapes and text[i] == u8'\\') or (find_non_ascii and text[i] >= 0x80)) {
+            return i;
+         }
+      }
+      return text.size();
+   }
+
+   /// \brief Returns the offset of the first backslash in `text` if `find_escapes` is set, or of
+   ///        the first byte outside ASCII if `find_non_ascii` is set, whichever comes first.
+   ///        Returns `text.size()` if there's neither.
+   ///
+   [[nodiscard]] std::size_t find_special_baseline(std::u8string_view const text,
+      bool const find_escapes, bool const find_non_ascii) noexcept
+   {
+      auto i = std::size_t{0};
+#if defined(__SSE2__)
+      auto const* const data = text.data();
+      auto const backslash = _mm_set1_epi8('\\');
+      auto const escape_mask = find_escapes ? ~0U : 0U;
+      auto const non_ascii_mask = find_non_ascii ? ~0U : 0U;
+      for (; text.size() - i >= 16; i += 16) {
+         auto const block =
+            _mm_loadu_si128(static_cast<__m128i const*>(static_cast<void const*>(data + i)));
+         auto const escapes =
+            static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, backslash)));
+         auto const non_ascii = static_cast<unsigned>(_mm_movemask_epi8(block));
+         if (auto const mask = (escapes & escape_mask) | (non_ascii & non_ascii_mask); mask != 0) {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+         }
+      }
+#endif // defined(__SSE2__)
+      return find_special_tail(text, i, find_escapes, find_non_ascii);
+   }
+} // namespace
+
+#ifdef LINGUA_SIMD_X86
+LINGUA_SIMD_BEGIN_TARGET("avx2")
+namespace {
+   namespace avx2 {
+      [[nodiscard]] std::size_t find_special(std::u8string_view const text,
+         bool const find_escapes, bool const find_non_ascii) noexcept
+      {
+         auto const* const data = text.data();
+         auto i = std::size_t{0};
+         auto const backslash = _mm256_set1_epi8('\\');
+         auto const escape_mask = find_escapes ? ~0U : 0U;
+         auto const non_ascii_mask = find_non_ascii ? ~0U : 0U;
+         for (; text.size() - i >= 32; i += 32) {
+            auto const block = _mm256_loadu_si256(static_cast<__m256i const*>(
+               static_cast<void const*>(data + i)));
+            auto const escapes =
+               static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, backslash)));
+            auto const non_ascii = static_cast<unsigned>(_mm256_movemask_epi8(block));
+            if (auto const mask = (escapes & escape_mask) | (non_ascii & non_ascii_mask); mask != 0)
+            {
+               return i + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+         }
+         return find_special_tail(text, i, find_escapes, find_non_ascii);
+      }
+   } // namespace avx2
+} // namespace
+LINGUA_SIMD_END_TARGET
+
+LINGUA_SIMD_BEGIN_TARGET("avx512f,avx512bw,avx512vl")
+namespace {
+   namespace avx512 {
+      [[nodiscard]] std::size_t find_special(std::u8string_view const text,
+         bool const find_escapes, bool const find_non_ascii) noexcept
+      {
+         auto const* const data = text.data();
+         auto i = std::size_t{0};
+         auto const backslash = _mm512_set1_epi8('\\');
+         auto const escape_mask = find_escapes ? ~std::uint64_t{0} : std::uint64_t{0};
+         auto const non_ascii_mask = find_non_ascii ? ~std::uint64_t{0} : std::uint64_t{0};
+         for (; text.size() - i >= 64; i += 64) {
+            auto const block = _mm512_loadu_si512(static_cast<void const*>(data + i));
+            auto const escapes = std::uint64_t{_mm512_cmpeq_epi8_mask(block, backslash)};
+            auto const non_ascii = std::uint64_t{_mm512_movepi8_mask(block)};
+            if (auto const mask = (escapes & escape_mask) | (non_ascii & non_ascii_mask); mask != 0)
+            {
+               return i + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+         }
+         return find_special_tail(text, i, find_escapes, find_non_ascii);
+      }
+   } // namespace avx512
+} // namespace
+LINGUA_SIMD_END_TARGET
+#endif // LINGUA_SIMD_X86
+
+namespace {
+   [[nodiscard]] std::size_t find_special(std::u8string_view const text, bool const find_escapes,
+      bool const find_non_ascii) noexcept
+   {
+      using kernel = std::size_t(std::u8string_view, bool, bool) noexcept;
+#ifdef LINGUA_SIMD_X86
+      constexpr auto variants = lingua::simd_variants<kernel>{find_special_baseline,
+         find_special_baseline, avx2::find_special, avx512::find_special};
+#else
+      constexpr auto variants = lingua::simd_variants<kernel>{find_special_baseline,
+         find_special_baseline, find_special_baseline, find_special_baseline};
+#endif // LINGUA_SIMD_X86
+      return lingua::select_variant(variants)(text, find_escapes, find_non_ascii);
+   }
+
+   [[nodiscard]] constexpr unsigned hex_value(char8_t const c) noexcept
+   {
+      if (u8'0' <= c and c <= u8'9') {
+         return static_cast<unsigned>(c - u8'0');
+      }
+      if (u8'a' <= c and c <= u8'f') {
+         return static_cast<unsigned>(c - u8'a' + 10);
+      }
+      if (u8'A' <= c and c <= u8'F') {
+         return static_cast<unsigned>(c - u8'A' + 10);
+      }
+      return 16;
+   }
+
+   /// \brief Writes the UTF-8 encoding of `code_point` to `out`, and returns the number of bytes
+   ///        written.
+   ///
+   std::size_t encode_utf8(char32_t const code_point, char8_t* const out) noexcept
+   // [[expects: code_point is a Unicode scalar value]]
+   {
+      if (code_point < 0x80) {
+         out[0] = static_cast<char8_t>(code_point);
+         return 1;
+      }
+      if (code_point < 0x800) {
+         out[0] = static_cast<char8_t>(0xc0U | (code_point >> 6U));
+         out[1] = static_cast<char8_t>(0x80U | (code_point & 0x3fU));
+         return 2;
+      }
+      if (code_point < 0x10000) {
+         out[0] = static_cast<char8_t>(0xe0U | (code_point >> 12U));
+         out[1] = static_cast<char8_t>(0x80U | ((code_point >> 6U) & 0x3fU));
+         out[2] = static_cast<char8_t>(0x80U | (code_point & 0x3fU));
+         return 3;
+      }
+      out[0] = static_cast<char8_t>(0xf0U | (code_point >> 18U));
+      out[1] = static_cast<char8_t>(0x80U | ((code_point >> 12U) & 0x3fU));
+      out[2] = static_cast<char8_t>(0x80U | ((code_point >> 6U) & 0x3fU));
+      out[3] = static_cast<char8_t>(0x80U | (code_point & 0x3fU));
+      return 4;
+   }
+
+   [[nodiscard]] constexpr bool is_whitespace(char8_t const c) noexcept
+   { return c == u8' ' or c == u8'\t' or c == u8'\n' or c == u8'\r'; }
+
+   /// \brief Where a literal's contents start and end, and which rules apply to them.
+   ///
+   struct literal_shape {
+      std::size_t prefix;
+      std::size_t suffix;
+      bool is_byte;
+      bool is_raw;
+      bool is_char;
+   };
+
+   [[nodiscard]] literal_shape shape_of(token_kind const kind, std::u8string_view const literal)
+   noexcept
+   {
+      switch (kind) {
+      case token_kind::char_literal:
+         return literal_shape{1, 1, false, false, true};
+      case token_kind::byte_literal:
+         return literal_shape{2, 1, true, false, true};
+      case token_kind::string_literal:
+         return literal_shape{1, 1, false, false, false};
+      case token_kind::byte_string_literal:
+         return literal_shape{2, 1, true, false, false};
+      case token_kind::raw_string_literal:
+      case token_kind::raw_byte_string_literal: {
+         // r#"..."# and br#"..."# close with as many hashes as they open with.
+         auto const quote = literal.find(u8'"');
+         auto const is_byte = kind == token_kind::raw_byte_string_literal;
+         return literal_shape{quote + 1, quote - (is_byte ? 1 : 0), is_byte, true, false};
+      }
+      default:
+         LINGUA_ASSERT(false and u8"unescape_literal only accepts char, byte, and string literals");
+         return literal_shape{0, 0, false, true, false};
+      }
+   }
+} // namespace
+
+namespace lingua {
+   unescaped_literal
+   unescape_literal(token_kind const kind, std::u8string_view const literal, string_arena& arena)
+   {
+      auto const shape = shape_of(kind, literal);
+      LINGUA_EXPECTS(literal.size() >= shape.prefix + shape.suffix);
+
+      auto const body = literal.substr(shape.prefix, literal.size() - shape.prefix - shape.suffix);
+      auto const first_special = find_special(body, not shape.is_raw, shape.is_byte);
+      if (first_special == body.size()) {
+         return unescaped_literal{body, unescape_error::none, 0, 0};
+      }
+
+      auto const fail = [&arena, &shape, body](unescape_error const error, std::size_t const offset,
+                           std::size_t const length) {
+         arena.shrink(body.size());
+         return unescaped_literal{{}, error, static_cast<std::uint32_t>(shape.prefix + offset),
+            static_cast<std::uint32_t>(length)};
+      };
+
+      // No escape decodes to more bytes than it's spelt with, so the value fits in body.size().
+      auto const out = arena.allocate(body.size()).data();
+      auto written = std::size_t{0};
+      auto const unknown_escape = shape.is_byte ? unescape_error::unknown_byte_escape
+                                                : unescape_error::unknown_ascii_escape;
+      for (auto i = std::size_t{0}; i < body.size();) {
+         // Copy everything up to the next escape in one go.
+         auto const run = i + find_special(body.substr(i), not shape.is_raw, shape.is_byte);
+         std::copy(body.data() + i, body.data() + run, out + written);
+         written += run - i;
+         i = run;
+         if (i == body.size()) {
+            break;
+         }
+
+         if (body[i] != u8'\\') {
+            return fail(unescape_error::non_ascii_byte, i, 1);
+         }
+
+         if (i + 1 == body.size()) {
+            return fail(unknown_escape, i, 1);
+         }
+
+         switch (auto const c = body[i + 1]; c) {
+         case u8'n':
+            out[written++] = u8'\n';
+            i += 2;
+            break;
+         case u8'r':
+            out[written++] = u8'\r';
+            i += 2;
+            break;
+         case u8't':
+            out[written++] = u8'\t';
+            i += 2;
+            break;
+         case u8'0':
+            out[written++] = u8'\0';
+            i += 2;
+            break;
+         case u8'\\':
+         case u8'\'':
+         case u8'"':
+            out[written++] = c;
+            i += 2;
+            break;
+         case u8'x': {
+            auto const escape = body.substr(i, 4);
+            auto const high = escape.size() == 4 ? hex_value(escape[2]) : 16;
+            auto const low = escape.size() == 4 ? hex_value(escape[3]) : 16;
+            // Outside byte literals, `\x` only reaches `\x7f`, so that it can't spell half of a
+            // UTF-8 sequence.
+            if (high >= (shape.is_byte ? 16U : 8U) or low == 16) {
+               return fail(unknown_escape, i, escape.size());
+            }
+            out[written++] = static_cast<char8_t>(high * 16 + low);
+            i += 4;
+            break;
+         }
+         case u8'u': {
+            if (shape.is_byte) {
+               auto const close = body.find(u8'}', i);
+               auto const length = close == std::u8string_view::npos ? 2 : close - i + 1;
+               return fail(unescape_error::unknown_byte_escape, i, length);
+            }
+
+            auto const decoded = lingua::decode_unicode_escape(body.substr(i));
+            switch (decoded.error) {
+            case unicode_escape_error::none:
+               break;
+            case unicode_escape_error::surrogate:
+               return fail(unescape_error::surrogate_unicode_escape, i, decoded.length);
+            case unicode_escape_error::out_of_range:
+               return fail(unescape_error::out_of_range_unicode_escape, i, decoded.length);
+            default:
+               return fail(unescape_error::unknown_unicode_escape, i, decoded.length);
+            }
+            written += encode_utf8(decoded.code_point, out + written);
+            i += decoded.length;
+            break;
+         }
+         case u8'\n':
+         case u8'\r':
+            // A backslash at the end of a line continues the string on the next line, skipping
+            // the newline and any indentation.
+            if (shape.is_char or (c == u8'\r' and body.substr(i + 2, 1) != u8"\n")) {
+               return fail(unknown_escape, i, 2);
+            }
+            for (i += 2; i < body.size() and is_whitespace(body[i]); ++i) {}
+            break;
+         default:
+            return fail(unknown_escape, i, 2);
+         }
+      }
+
+      arena.shrink(body.size() - written);
+      return unescaped_literal{std::u8string_view{out, written}, unescape_error::none, 0, 0};
+   }
+} // namespace lingua
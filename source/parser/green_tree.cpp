@@ -0,0 +1,303 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/parser/green_tree.hpp"
+#include "lingua/lexer/nfc.hpp"
+#include "lingua/utility/contract.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace {
+   [[nodiscard]] constexpr std::size_t
+   combine(std::size_t const seed, std::size_t const value) noexcept
+   { return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6U) + (seed >> 2U)); }
+
+   /// \brief Merges the lexer's tokens with the parser's, so that every byte of the source is in
+   ///        exactly one token, and every node boundary is a token boundary.
+   ///
+   /// The two only differ where the parser took a `>` that closes a list of generic arguments off
+   /// the front of a `>>`, `>=`, or `>>=`, and kept only the rest. A node may end between the two,
+   /// so the `>` is put back as a token of its own.
+   ///
+   [[nodiscard]] std::vector<lingua::token>
+   lossless_tokens(std::span<lingua::token const> const lexed,
+      std::span<lingua::token const> const parsed)
+   {
+      auto tokens = std::vector<lingua::token>{};
+      tokens.reserve(lexed.size() + 1);
+
+      auto next = std::size_t{0};
+      for (auto const t : lexed) {
+         if (is_trivia(t.kind)) {
+            tokens.push_back(t);
+            continue;
+         }
+
+         auto const end = t.offset + t.length;
+         auto covered = t.offset;
+         for (; next < parsed.size() and parsed[next].offset < end; ++next) {
+            if (parsed[next].offset != covered) {
+               tokens.push_back(lingua::token{lingua::token_kind::gt, covered,
+                  parsed[next].offset - covered});
+            }
+            tokens.push_back(parsed[next]);
+            covered = parsed[next].offset + parsed[next].length;
+         }
+
+         if (covered == t.offset) {
+            tokens.push_back(t);
+         }
+      }
+      return tokens;
+   }
+} // namespace
+
+namespace lingua {
+   green_node::green_node(syntax_kind const kind, std::span<green_element const> const children,
+      std::size_t const hash)
+      : kind_{kind}
+      , text_length_{0}
+      , hash_{hash}
+      , children_(children.begin(), children.end())
+   {
+      for (auto const child : children_) {
+         text_length_ += child.text_length();
+      }
+   }
+
+   std::u8string green_node::text() const
+   {
+      auto text = std::u8string{};
+      text.reserve(text_length_);
+
+      // Trees can be far deeper than the parser's nesting limit (e.g. a long chain of method
+      // calls), so the walk keeps its own stack rather than recursing.
+      auto path = std::vector<std::pair<green_node const*, std::size_t>>{{this, 0}};
+      while (not path.empty()) {
+         auto& [node, index] = path.back();
+         if (index == node->children_.size()) {
+            path.pop_back();
+            continue;
+         }
+
+         auto const child = node->children_[index++];
+         if (child.is_node()) {
+            path.emplace_back(&child.node(), 0);
+         }
+         else {
+            text += child.token().text();
+         }
+      }
+      return text;
+   }
+
+   green_token const& green_interner::token(token_kind const kind, std::u8string_view const text)
+   {
+      auto const hash =
+         combine(std::hash<std::u8string_view>{}(text), static_cast<std::size_t>(kind));
+      for (auto [first, last] = token_index_.equal_range(hash); first != last; ++first) {
+         if (first->second->kind_ == kind and first->second->text_ == text) {
+            return *first->second;
+         }
+      }
+
+      auto& interned = tokens_.emplace_back(green_token{kind, text});
+      token_index_.emplace(hash, &interned);
+      switch (kind) {
+      case token_kind::raw_identifier:
+         interned.name_ = *names_.insert(to_nfc(text.substr(2))).first;
+         break;
+      case token_kind::identifier:
+      case token_kind::lifetime:
+         interned.name_ = *names_.insert(to_nfc(text)).first;
+         break;
+      default:
+         break;
+      }
+      return interned;
+   }
+
+   green_node const& green_interner::node(syntax_kind const kind,
+      std::span<green_element const> const children)
+   {
+      auto hash = static_cast<std::size_t>(kind);
+      for (auto const child : children) {
+         hash = combine(hash, static_cast<std::size_t>(child.bits_));
+      }
+
+      for (auto [first, last] = node_index_.equal_range(hash); first != last; ++first) {
+         auto const& candidate = *first->second;
+         if (candidate.kind_ == kind and std::ranges::equal(candidate.children_, children)) {
+            return candidate;
+         }
+      }
+
+      auto const& interned = nodes_.emplace_back(green_node{kind, children, hash});
+      node_index_.emplace(hash, &interned);
+      return interned;
+   }
+
+   green_node const& build_green_tree(std::u8string_view const source,
+      std::span<token const> const tokens, syntax_tree const& tree, green_interner& interner)
+   {
+      auto const lossless = lossless_tokens(tokens, tree.tokens());
+      auto token_index = [&lossless](std::uint32_t const offset) noexcept {
+         auto const i = std::ranges::lower_bound(lossless, offset, {}, &token::offset);
+         return static_cast<std::size_t>(i - lossless.begin());
+      };
+
+      // Children are made before their parents, so visiting the nodes in order builds each green
+      // node after its children. A node's own tokens are the ones in its span that none of its
+      // children cover.
+      auto built = std::vector<green_node const*>(tree.size());
+      auto token_counts = std::vector<std::size_t>(tree.size());
+      auto children = std::vector<syntax_node>{};
+      auto elements = std::vector<green_element>{};
+      auto child_offset = [&tree](syntax_node const child) noexcept {
+         return tree.span(child).offset;
+      };
+      for (auto i = std::uint32_t{0}; i < tree.size(); ++i) {
+         auto const n = syntax_node{i};
+         children.clear();
+         std::ranges::copy_if(tree.children(n), std::back_inserter(children),
+            [](syntax_node const child) { return child != no_syntax_node; });
+         std::ranges::sort(children, {}, child_offset);
+
+         auto const span = tree.span(n);
+         auto const first = token_index(span.offset);
+         auto const last = token_index(span.offset + span.length);
+         elements.clear();
+         auto next_child = children.begin();
+         for (auto t = first; t < last;) {
+            // A child that doesn't start on one of the parent's tokens overlaps a sibling. parse
+            // doesn't make such trees, but if one turns up, its tokens are given to the parent so
+            // that the text is still all there.
+            auto const offset = lossless[t].offset;
+            while (next_child != children.end() and child_offset(*next_child) < offset) {
+               ++next_child;
+            }
+
+            if (next_child != children.end() and child_offset(*next_child) == offset) {
+               auto const child = static_cast<std::uint32_t>(*next_child++);
+               if (t + token_counts[child] <= last) {
+                  elements.emplace_back(*built[child]);
+                  t += token_counts[child];
+                  continue;
+               }
+            }
+
+            elements.emplace_back(interner.token(lossless[t].kind, lossless[t].text(source)));
+            ++t;
+         }
+
+         built[i] = &interner.node(tree.kind(n), elements);
+         token_counts[i] = last - first;
+      }
+
+      return *built.back();
+   }
+
+   bool syntax_cursor::goto_parent() noexcept
+   {
+      if (ancestors_.empty()) {
+         return false;
+      }
+
+      current_ = *ancestors_.back().node;
+      offset_ = ancestors_.back().offset;
+      ancestors_.pop_back();
+      return true;
+   }
+
+   bool syntax_cursor::goto_first_child()
+   {
+      if (not current_.is_node() or current_.node().children().empty()) {
+         return false;
+      }
+
+      auto const& node = current_.node();
+      ancestors_.push_back(frame{&node, offset_, 0});
+      current_ = node.children().front();
+      return true;
+   }
+
+   bool syntax_cursor::goto_next_sibling() noexcept
+   {
+      if (ancestors_.empty()) {
+         return false;
+      }
+
+      auto& parent = ancestors_.back();
+      auto const siblings = parent.node->children();
+      if (parent.index + 1 == siblings.size()) {
+         return false;
+      }
+
+      offset_ += current_.text_length();
+      current_ = siblings[++parent.index];
+      return true;
+   }
+
+   bool syntax_cursor::goto_previous_sibling() noexcept
+   {
+      if (ancestors_.empty() or ancestors_.back().index == 0) {
+         return false;
+      }
+
+      auto& parent = ancestors_.back();
+      current_ = parent.node->children()[--parent.index];
+      offset_ -= current_.text_length();
+      return true;
+   }
+
+   bool syntax_cursor::goto_token_at(std::uint32_t const offset)
+   {
+      if (offset < offset_ or offset - offset_ >= current_.text_length()) {
+         return false;
+      }
+
+      while (current_.is_node()) {
+         auto const& node = current_.node();
+         auto child_offset = offset_;
+         auto index = std::uint32_t{0};
+         for (; offset - child_offset >= node.children()[index].text_length(); ++index) {
+            child_offset += node.children()[index].text_length();
+         }
+
+         ancestors_.push_back(frame{&node, offset_, index});
+         current_ = node.children()[index];
+         offset_ = child_offset;
+      }
+      return true;
+   }
+
+   green_node const& syntax_cursor::replace(green_element const replacement,
+      green_interner& interner) const
+   {
+      LINGUA_EXPECTS(not ancestors_.empty() or replacement.is_node());
+
+      auto element = replacement;
+      auto children = std::vector<green_element>{};
+      for (auto const& ancestor : ancestors_ | std::views::reverse) {
+         children.assign(ancestor.node->children().begin(), ancestor.node->children().end());
+         children[ancestor.index] = element;
+         element = interner.node(ancestor.node->kind(), children);
+      }
+      return element.node();
+   }
+} // namespace lingua
@@ -0,0 +1,2172 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/parser/parse.hpp"
+#include "lingua/lexer/lex.hpp"
+#include "lingua/utility/contract.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+   using namespace std::string_view_literals;
+   using lingua::no_syntax_node, lingua::syntax_error_kind, lingua::syntax_kind, lingua::syntax_node,
+      lingua::token, lingua::token_kind;
+
+   /// \brief How tightly an infix operator binds to the operands on either side of it. An operator
+   ///        is left-associative when its right power is higher than its left power.
+   ///
+   struct binding_power {
+      std::uint8_t left;
+      std::uint8_t right;
+   };
+
+   constexpr auto cast_power = std::uint8_t{23};
+   constexpr auto prefix_power = std::uint8_t{25};
+
+   /// \brief The binding power of range operators' end, which is non-associative.
+   ///
+   constexpr auto range_end_power = std::uint8_t{4};
+
+   /// \brief The binding power of a let_condition's expression, which stops before `&&` so that
+   ///        `let` conditions can be chained.
+   ///
+   constexpr auto let_condition_power = std::uint8_t{9};
+
+   [[nodiscard]] constexpr std::optional<binding_power> infix_power(token_kind const kind) noexcept
+   {
+      switch (kind) {
+      case token_kind::eq:
+      case token_kind::plus_eq:
+      case token_kind::minus_eq:
+      case token_kind::star_eq:
+      case token_kind::slash_eq:
+      case token_kind::percent_eq:
+      case token_kind::caret_eq:
+      case token_kind::ampersand_eq:
+      case token_kind::pipe_eq:
+      case token_kind::shl_eq:
+      case token_kind::shr_eq:
+         return binding_power{2, 1};
+      case token_kind::dot_dot:
+      case token_kind::dot_dot_eq:
+         return binding_power{3, range_end_power};
+      case token_kind::pipe_pipe:
+         return binding_power{5, 6};
+      case token_kind::ampersand_ampersand:
+         return binding_power{7, 8};
+      case token_kind::eq_eq:
+      case token_kind::ne:
+      case token_kind::lt:
+      case token_kind::gt:
+      case token_kind::le:
+      case token_kind::ge:
+         return binding_power{9, 10};
+      case token_kind::pipe:
+         return binding_power{11, 12};
+      case token_kind::caret:
+         return binding_power{13, 14};
+      case token_kind::ampersand:
+         return binding_power{15, 16};
+      case token_kind::shl:
+      case token_kind::shr:
+         return binding_power{17, 18};
+      case token_kind::plus:
+      case token_kind::minus:
+         return binding_power{19, 20};
+      case token_kind::star:
+      case token_kind::slash:
+      case token_kind::percent:
+         return binding_power{21, 22};
+      default:
+         return std::nullopt;
+      }
+   }
+
+   [[nodiscard]] constexpr bool is_literal(token_kind const kind) noexcept
+   { return token_kind::integer_literal <= kind and kind <= token_kind::raw_byte_string_literal; }
+
+   [[nodiscard]] constexpr bool is_block_like(syntax_kind const kind) noexcept
+   {
+      switch (kind) {
+      case syntax_kind::block:
+      case syntax_kind::unsafe_block:
+      case syntax_kind::if_expression:
+      case syntax_kind::while_expression:
+      case syntax_kind::loop_expression:
+      case syntax_kind::for_expression:
+      case syntax_kind::match_expression:
+         return true;
+      default:
+         return false;
+      }
+   }
+
+   constexpr auto item_keywords = std::array{
+      u8"const"sv, u8"enum"sv, u8"extern"sv, u8"fn"sv, u8"impl"sv, u8"mod"sv, u8"pub"sv,
+      u8"static"sv, u8"struct"sv, u8"trait"sv, u8"type"sv, u8"use"sv,
+   };
+} // namespace
+
+namespace lingua::detail_parse {
+   class parser {
+   public:
+      explicit parser(std::u8string_view const source, std::span<token const> const tokens)
+         : source_{source}
+      {
+         tree_.tokens_.reserve(tokens.size() / 2);
+         std::ranges::copy_if(tokens, std::back_inserter(tree_.tokens_),
+            [](token const t) { return not is_trivia(t.kind); });
+
+         // Most nodes cover two or three tokens.
+         auto const expected_nodes = tree_.tokens_.size() / 2 + 1;
+         tree_.kinds_.reserve(expected_nodes);
+         tree_.main_tokens_.reserve(expected_nodes);
+         tree_.spans_.reserve(expected_nodes);
+         tree_.children_ranges_.reserve(expected_nodes);
+         tree_.children_.reserve(expected_nodes);
+      }
+
+      [[nodiscard]] syntax_tree parse() &&
+      {
+         auto const mark = scratch_.size();
+         while (not at_end()) {
+            push(parse_item_or_recover(false));
+         }
+
+         // source_file is the only node that can cover no tokens, so it's built by hand.
+         auto const [first, count] = store_children(mark);
+         tree_.kinds_.push_back(syntax_kind::source_file);
+         tree_.main_tokens_.push_back(0);
+         tree_.spans_.push_back(source_span{0, static_cast<std::uint32_t>(source_.size())});
+         tree_.children_ranges_.push_back(syntax_tree::children_range{first, count});
+
+         std::ranges::stable_sort(tree_.errors_, {}, &syntax_error::offset);
+         return std::move(tree_);
+      }
+
+   private:
+      std::u8string_view source_;
+      syntax_tree tree_;
+      std::uint32_t position_ = 0;
+      std::uint32_t last_end_ = 0;
+      std::size_t depth_ = 0;
+      bool abandoned_ = false;
+      bool struct_literals_ = true;
+      std::vector<syntax_node> scratch_;
+
+      /// \brief Where each if_expression in a chain of `else if`s starts, and where its children
+      ///        start in scratch_.
+      ///
+      struct chain_link {
+         std::uint32_t first;
+         std::size_t mark;
+      };
+
+      std::vector<chain_link> if_chain_;
+
+      /// \brief Counts how deeply the parser has recursed, and abandons parsing once it's too deep.
+      ///
+      class nesting {
+      public:
+         explicit nesting(parser& p) noexcept
+            : parser_{p}
+         {
+            if (++parser_.depth_ > max_nesting_depth and not parser_.at_end()) {
+               parser_.report(syntax_error_kind::too_deeply_nested);
+               parser_.abandoned_ = true;
+               parser_.last_end_ = parser_.tree_.tokens_.back().offset
+                                 + parser_.tree_.tokens_.back().length;
+               parser_.position_ = static_cast<std::uint32_t>(parser_.tree_.tokens_.size());
+            }
+         }
+
+         nesting(nesting const&) = delete;
+         nesting& operator=(nesting const&) = delete;
+
+         ~nesting()
+         { --parser_.depth_; }
+
+      private:
+         parser& parser_;
+      };
+
+      /// \brief Allows or forbids struct literals until it's destroyed. They're forbidden where a
+      ///        `{` would otherwise be ambiguous, such as in `if x == y {`.
+      ///
+      class struct_literal_scope {
+      public:
+         explicit struct_literal_scope(parser& p, bool const allowed) noexcept
+            : parser_{p}
+            , previous_{std::exchange(p.struct_literals_, allowed)}
+         {}
+
+         struct_literal_scope(struct_literal_scope const&) = delete;
+         struct_literal_scope& operator=(struct_literal_scope const&) = delete;
+
+         ~struct_literal_scope()
+         { parser_.struct_literals_ = previous_; }
+
+      private:
+         parser& parser_;
+         bool previous_;
+      };
+
+      // Tokens
+
+      [[nodiscard]] bool at_end() const noexcept
+      { return position_ >= tree_.tokens_.size(); }
+
+      [[nodiscard]] std::optional<token_kind> peek(std::size_t const ahead = 0) const noexcept
+      {
+         auto const i = position_ + ahead;
+         return i < tree_.tokens_.size() ? std::optional{tree_.tokens_[i].kind} : std::nullopt;
+      }
+
+      [[nodiscard]] bool at(token_kind const kind, std::size_t const ahead = 0) const noexcept
+      { return peek(ahead) == kind; }
+
+      [[nodiscard]] bool at_keyword(std::u8string_view const keyword,
+         std::size_t const ahead = 0) const noexcept
+      {
+         return at(token_kind::keyword, ahead)
+            and tree_.tokens_[position_ + ahead].text(source_) == keyword;
+      }
+
+      /// \brief Checks for an identifier with the text `word`, such as `union` or `_`.
+      ///
+      [[nodiscard]] bool at_word(std::u8string_view const word,
+         std::size_t const ahead = 0) const noexcept
+      {
+         return at(token_kind::identifier, ahead)
+            and tree_.tokens_[position_ + ahead].text(source_) == word;
+      }
+
+      [[nodiscard]] bool at_name(std::size_t const ahead = 0) const noexcept
+      {
+         return (at(token_kind::identifier, ahead) and not at_word(u8"_", ahead))
+             or at(token_kind::raw_identifier, ahead);
+      }
+
+      [[nodiscard]] bool at_path_segment(std::size_t const ahead = 0) const noexcept
+      {
+         return at(token_kind::identifier, ahead) or at(token_kind::raw_identifier, ahead)
+             or at_keyword(u8"self", ahead) or at_keyword(u8"Self", ahead)
+             or at_keyword(u8"super", ahead) or at_keyword(u8"crate", ahead);
+      }
+
+      [[nodiscard]] bool at_path_start() const noexcept
+      {
+         return at_path_segment() or (at(token_kind::path_separator) and at_path_segment(1))
+             or at(token_kind::lt);
+      }
+
+      /// \brief Checks for a path followed by `!`.
+      ///
+      [[nodiscard]] bool at_macro_invocation() const noexcept
+      {
+         auto i = std::size_t{at(token_kind::path_separator) ? 1U : 0U};
+         if (not at_path_segment(i)) {
+            return false;
+         }
+
+         ++i;
+         while (at(token_kind::path_separator, i) and at_path_segment(i + 1)) {
+            i += 2;
+         }
+         return at(token_kind::bang, i);
+      }
+
+      /// \brief Checks for a keyword that can only start an item.
+      ///
+      [[nodiscard]] bool at_item_keyword(std::size_t const ahead = 0) const noexcept
+      {
+         if (at_keyword(u8"unsafe", ahead) or at_keyword(u8"async", ahead)) {
+            return not at(token_kind::open_brace, ahead + 1) and not at_keyword(u8"move", ahead + 1);
+         }
+         if (at_word(u8"union", ahead)) {
+            return at_name(ahead + 1);
+         }
+         if (not at(token_kind::keyword, ahead)) {
+            return false;
+         }
+         auto const text = tree_.tokens_[position_ + ahead].text(source_);
+         return std::ranges::find(item_keywords, text) != item_keywords.end();
+      }
+
+      [[nodiscard]] bool at_item_start() const noexcept
+      { return at(token_kind::pound) or at_item_keyword() or at_macro_invocation(); }
+
+      std::uint32_t advance() noexcept
+      {
+         LINGUA_EXPECTS(not at_end());
+         auto const& t = tree_.tokens_[position_];
+         last_end_ = t.offset + t.length;
+         return position_++;
+      }
+
+      bool eat(token_kind const kind) noexcept
+      {
+         if (not at(kind)) {
+            return false;
+         }
+         advance();
+         return true;
+      }
+
+      bool eat_keyword(std::u8string_view const keyword) noexcept
+      {
+         if (not at_keyword(keyword)) {
+            return false;
+         }
+         advance();
+         return true;
+      }
+
+      bool expect(token_kind const kind)
+      {
+         if (eat(kind)) {
+            return true;
+         }
+         report(syntax_error_kind::expected_token, kind);
+         return false;
+      }
+
+      /// \brief Consumes a `>`, splitting it off the front of a `>>`, `>=`, or `>>=` if needed.
+      ///
+      bool eat_closing_angle() noexcept
+      {
+         if (eat(token_kind::gt)) {
+            return true;
+         }
+
+         auto& t = tree_.tokens_[position_];
+         auto remainder = token_kind::gt;
+         if (at(token_kind::shr)) {
+            remainder = token_kind::gt;
+         }
+         else if (at(token_kind::ge)) {
+            remainder = token_kind::eq;
+         }
+         else if (at(token_kind::shr_eq)) {
+            remainder = token_kind::ge;
+         }
+         else {
+            return false;
+         }
+
+         last_end_ = t.offset + 1;
+         t = token{remainder, t.offset + 1, t.length - 1};
+         return true;
+      }
+
+      /// \brief Consumes a name, or reports that one was expected.
+      /// \returns The index of the name, or `fallback` if there isn't one.
+      ///
+      std::uint32_t expect_name(std::uint32_t const fallback)
+      {
+         if (at_name()) {
+            return advance();
+         }
+         report(syntax_error_kind::expected_identifier);
+         return fallback;
+      }
+
+      /// \brief Skips a delimited group of tokens, including its delimiters.
+      ///
+      void skip_group() noexcept
+      {
+         auto depth = std::size_t{0};
+         do {
+            switch (*peek()) {
+            case token_kind::open_paren:
+            case token_kind::open_bracket:
+            case token_kind::open_brace:
+               ++depth;
+               break;
+            case token_kind::close_paren:
+            case token_kind::close_bracket:
+            case token_kind::close_brace:
+               --depth;
+               break;
+            default:
+               break;
+            }
+            advance();
+         } while (depth > 0 and not at_end());
+      }
+
+      /// \brief Skips to the token that closes the current list, stopping early at anything that
+      ///        belongs to an enclosing construct: a closing delimiter, a `;`, or an item.
+      ///
+      void skip_to(token_kind const close) noexcept
+      {
+         while (not at_end()) {
+            if (at(close)) {
+               advance();
+               return;
+            }
+            if (at(token_kind::close_paren) or at(token_kind::close_bracket)
+             or at(token_kind::close_brace) or at(token_kind::semicolon) or at_item_keyword()) {
+               return;
+            }
+            skip_group();
+         }
+      }
+
+      /// \brief Skips attributes where the tree has no place for them.
+      ///
+      void skip_attributes() noexcept
+      {
+         while (at(token_kind::pound) and not at(token_kind::bang, 1)) {
+            advance();
+            if (at(token_kind::open_bracket)) {
+               skip_group();
+            }
+         }
+      }
+
+      // Errors
+
+      void report(syntax_error_kind const kind, token_kind const expected = token_kind::unknown)
+      {
+         auto const offset = at_end() ? static_cast<std::uint32_t>(source_.size())
+                                      : tree_.tokens_[position_].offset;
+         auto const length = at_end() ? 0 : tree_.tokens_[position_].length;
+
+         // Only the first error at each position is worth reporting: the rest are knock-on effects.
+         if (abandoned_ or (not tree_.errors_.empty() and tree_.errors_.back().offset == offset)) {
+            return;
+         }
+         tree_.errors_.push_back(syntax_error{kind, expected, offset, length});
+      }
+
+      // Nodes
+
+      void push(syntax_node const n)
+      { scratch_.push_back(n); }
+
+      syntax_tree::children_range store_children(std::size_t const mark)
+      {
+         auto const first = static_cast<std::uint32_t>(tree_.children_.size());
+         auto const count = static_cast<std::uint32_t>(scratch_.size() - mark);
+         tree_.children_.insert(tree_.children_.end(),
+            scratch_.begin() + static_cast<std::ptrdiff_t>(mark), scratch_.end());
+         scratch_.resize(mark);
+         return syntax_tree::children_range{first, count};
+      }
+
+      /// \brief Makes a node out of everything from the token at `first` up to the last token that
+      ///        was consumed, whose children are those pushed since `mark`.
+      ///
+      syntax_node finish(syntax_kind const kind, std::uint32_t const main, std::uint32_t const first,
+         std::size_t const mark)
+      {
+         LINGUA_EXPECTS(first < position_);
+
+         auto const offset = tree_.tokens_[first].offset;
+         auto const n = syntax_node{static_cast<std::uint32_t>(tree_.kinds_.size())};
+         tree_.kinds_.push_back(kind);
+         tree_.main_tokens_.push_back(main);
+         tree_.spans_.push_back(source_span{offset, last_end_ - offset});
+         tree_.children_ranges_.push_back(store_children(mark));
+         return n;
+      }
+
+      /// \brief Makes a node out of the next token.
+      ///
+      syntax_node leaf(syntax_kind const kind)
+      {
+         auto const i = advance();
+         return finish(kind, i, i, scratch_.size());
+      }
+
+      [[nodiscard]] syntax_kind kind_of(syntax_node const n) const noexcept
+      { return n == no_syntax_node ? syntax_kind::error : tree_.kind(n); }
+
+      // Items
+
+      /// \brief Parses an item, or skips to the next thing that looks like one.
+      /// \param nested true when the item is in an item_list, which a `}` ends.
+      ///
+      syntax_node parse_item_or_recover(bool const nested)
+      {
+         auto const first = position_;
+         auto const item = parse_item();
+         if (position_ != first) {
+            return item;
+         }
+
+         report(syntax_error_kind::expected_item);
+         auto const mark = scratch_.size();
+         auto depth = std::size_t{0};
+         do {
+            if (at(token_kind::open_brace)) {
+               ++depth;
+            }
+            else if (at(token_kind::close_brace) and depth > 0) {
+               --depth;
+            }
+            advance();
+         } while (not at_end() and (depth > 0 or not (at_item_start()
+            or (nested and at(token_kind::close_brace)))));
+         return finish(syntax_kind::error, first, first, mark);
+      }
+
+      /// \brief Parses the items in braces.
+      ///
+      syntax_node parse_item_list()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (not expect(token_kind::open_brace)) {
+            return no_syntax_node;
+         }
+
+         while (not at_end() and not at(token_kind::close_brace)) {
+            push(parse_item_or_recover(true));
+         }
+         expect(token_kind::close_brace);
+         return finish(syntax_kind::item_list, first, first, mark);
+      }
+
+      syntax_node parse_item()
+      {
+         auto const guard = nesting{*this};
+         if (abandoned_) {
+            return no_syntax_node;
+         }
+         if (at(token_kind::pound) and at(token_kind::bang, 1)) {
+            return parse_attribute();
+         }
+
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         push(parse_attributes());
+         push(parse_visibility());
+
+         skip_qualifiers();
+
+         if (at_keyword(u8"fn")) {
+            return parse_function(first, mark);
+         }
+         if (at_keyword(u8"struct") or (at_word(u8"union") and at_name(1))) {
+            return parse_structure(first, mark);
+         }
+         if (at_keyword(u8"enum")) {
+            return parse_enumeration(first, mark);
+         }
+         if (at_keyword(u8"use")) {
+            return parse_use_declaration(first, mark);
+         }
+         if (at_keyword(u8"mod")) {
+            return parse_module(first, mark);
+         }
+         if (at_keyword(u8"const")) {
+            return parse_variable(syntax_kind::constant, first, mark);
+         }
+         if (at_keyword(u8"static")) {
+            return parse_variable(syntax_kind::static_variable, first, mark);
+         }
+         if (at_keyword(u8"type")) {
+            return parse_type_alias(first, mark);
+         }
+         if (at_keyword(u8"impl")) {
+            return parse_implementation(first, mark);
+         }
+         if (at_keyword(u8"trait")) {
+            return parse_trait(first, mark);
+         }
+         if (at_keyword(u8"extern") and at_keyword(u8"crate", 1)) {
+            return parse_extern_crate(first, mark);
+         }
+         if (at_keyword(u8"extern")) {
+            return parse_extern_block(first, mark);
+         }
+         if (at_macro_invocation()) {
+            return parse_macro_item(first, mark);
+         }
+
+         scratch_.resize(mark);
+         if (position_ == first) {
+            return no_syntax_node;
+         }
+
+         // There were attributes or a visibility, but no item for them to apply to.
+         report(syntax_error_kind::expected_item);
+         return finish(syntax_kind::error, first, first, mark);
+      }
+
+      /// \brief Skips `unsafe`, `async`, `const`, `extern`, and `extern "ABI"` in front of a
+      ///        function, which only change what the function means, not how it's parsed. `unsafe`
+      ///        may also be in front of an implementation, a trait, or an extern block.
+      ///
+      void skip_qualifiers() noexcept
+      {
+         for (;;) {
+            if (at_keyword(u8"unsafe") or at_keyword(u8"async")
+             or (at_keyword(u8"const") and (at_keyword(u8"fn", 1) or at_keyword(u8"unsafe", 1)))) {
+               advance();
+            }
+            else if (at_keyword(u8"extern") and (at_keyword(u8"fn", 1)
+                 or (at(token_kind::string_literal, 1) and not at(token_kind::open_brace, 2)))) {
+               advance();
+               eat(token_kind::string_literal);
+            }
+            else {
+               return;
+            }
+         }
+      }
+
+      /// \brief Parses `#[...]` or `#![...]`.
+      ///
+      syntax_node parse_attribute()
+      {
+         auto const first = advance();
+         eat(token_kind::bang);
+         if (at(token_kind::open_bracket)) {
+            skip_group();
+         }
+         else {
+            report(syntax_error_kind::expected_token, token_kind::open_bracket);
+         }
+         return finish(syntax_kind::attribute, first, first, scratch_.size());
+      }
+
+      syntax_node parse_attributes()
+      {
+         if (not at(token_kind::pound) or at(token_kind::bang, 1)) {
+            return no_syntax_node;
+         }
+
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         while (at(token_kind::pound) and not at(token_kind::bang, 1)) {
+            push(parse_attribute());
+         }
+         return finish(syntax_kind::attribute_list, first, first, mark);
+      }
+
+      /// \brief Parses `pub`, `pub(crate)`, `pub(super)`, `pub(self)`, or `pub(in path)`.
+      ///
+      syntax_node parse_visibility()
+      {
+         if (not at_keyword(u8"pub")) {
+            return no_syntax_node;
+         }
+
+         auto const first = advance();
+         if (at(token_kind::open_paren) and (at_keyword(u8"crate", 1) or at_keyword(u8"super", 1)
+            or at_keyword(u8"self", 1) or at_keyword(u8"in", 1))) {
+            skip_group();
+         }
+         return finish(syntax_kind::visibility, first, first, scratch_.size());
+      }
+
+      syntax_node parse_function(std::uint32_t const first, std::size_t const mark)
+      {
+         auto const keyword = advance();
+         auto const name = expect_name(keyword);
+         push(parse_generic_parameters());
+         push(parse_parameter_list());
+         push(eat(token_kind::right_arrow) ? parse_type() : no_syntax_node);
+         push(parse_where_clause());
+         if (at(token_kind::open_brace)) {
+            push(parse_block());
+         }
+         else {
+            push(no_syntax_node);
+            expect(token_kind::semicolon);
+         }
+         return finish(syntax_kind::function, name, first, mark);
+      }
+
+      syntax_node parse_parameter_list()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (not expect(token_kind::open_paren)) {
+            return no_syntax_node;
+         }
+
+         parse_delimited(token_kind::close_paren, [this] { return parse_parameter(); });
+         return finish(syntax_kind::parameter_list, first, first, mark);
+      }
+
+      syntax_node parse_parameter()
+      {
+         skip_attributes();
+         auto const first = position_;
+         auto const mark = scratch_.size();
+
+         // `self`, `mut self`, `&self`, `&mut self`, or `&'a mut self`, optionally with a type.
+         auto self_at = std::size_t{0};
+         if (at(token_kind::ampersand)) {
+            self_at = at(token_kind::lifetime, 1) ? 2 : 1;
+         }
+         if (at_keyword(u8"mut", self_at)) {
+            ++self_at;
+         }
+         if (at_keyword(u8"self", self_at) and not at(token_kind::path_separator, self_at + 1)) {
+            position_ += static_cast<std::uint32_t>(self_at);
+            auto const self = advance();
+            push(eat(token_kind::colon) ? parse_type() : no_syntax_node);
+            return finish(syntax_kind::self_parameter, self, first, mark);
+         }
+
+         push(parse_pattern());
+         expect(token_kind::colon);
+         push(parse_type());
+         return position_ == first ? no_syntax_node
+                                   : finish(syntax_kind::parameter, first, first, mark);
+      }
+
+      /// \brief Parses `<T: Bound = Default, 'a: 'b>`, if it's there.
+      ///
+      syntax_node parse_generic_parameters()
+      {
+         if (not at(token_kind::lt)) {
+            return no_syntax_node;
+         }
+
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         while (not at_end() and not at(token_kind::gt)) {
+            skip_attributes();
+            auto const parameter = position_;
+            auto const parameter_mark = scratch_.size();
+            eat_keyword(u8"const");
+            if (not at(token_kind::lifetime) and not at_name()) {
+               report(syntax_error_kind::expected_identifier);
+               break;
+            }
+
+            auto const name = advance();
+            push(eat(token_kind::colon) ? parse_bounds() : no_syntax_node);
+            push(eat(token_kind::eq) ? parse_type() : no_syntax_node);
+            push(finish(syntax_kind::generic_parameter, name, parameter, parameter_mark));
+            if (not eat(token_kind::comma)) {
+               break;
+            }
+         }
+
+         if (not eat_closing_angle()) {
+            report(syntax_error_kind::expected_token, token_kind::gt);
+         }
+         return finish(syntax_kind::generic_parameters, first, first, mark);
+      }
+
+      /// \brief Parses `A + B + 'a`.
+      ///
+      syntax_node parse_bounds()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         do {
+            if (at(token_kind::lifetime)) {
+               push(leaf(syntax_kind::lifetime));
+               continue;
+            }
+
+            eat(token_kind::question);
+            auto const bound = parse_type();
+            if (bound == no_syntax_node) {
+               break;
+            }
+            push(bound);
+         } while (eat(token_kind::plus));
+
+         return position_ == first ? no_syntax_node
+                                   : finish(syntax_kind::bound_list, first, first, mark);
+      }
+
+      syntax_node parse_where_clause()
+      {
+         if (not at_keyword(u8"where")) {
+            return no_syntax_node;
+         }
+
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         while (at(token_kind::lifetime) or at_type_start()) {
+            auto const predicate = position_;
+            auto const predicate_mark = scratch_.size();
+            push(at(token_kind::lifetime) ? leaf(syntax_kind::lifetime) : parse_type());
+            if (position_ == predicate) {
+               scratch_.resize(predicate_mark);
+               break;
+            }
+            expect(token_kind::colon);
+            push(parse_bounds());
+            push(finish(syntax_kind::where_predicate, predicate, predicate, predicate_mark));
+            if (not eat(token_kind::comma)) {
+               break;
+            }
+         }
+         return finish(syntax_kind::where_clause, first, first, mark);
+      }
+
+      syntax_node parse_structure(std::uint32_t const first, std::size_t const mark)
+      {
+         auto const keyword = advance();
+         auto const name = expect_name(keyword);
+         push(parse_generic_parameters());
+         if (at(token_kind::open_paren)) {
+            auto const fields = parse_tuple_field_list();
+            push(parse_where_clause());
+            push(fields);
+            expect(token_kind::semicolon);
+         }
+         else {
+            push(parse_where_clause());
+            if (at(token_kind::open_brace)) {
+               push(parse_field_list());
+            }
+            else {
+               push(no_syntax_node);
+               expect(token_kind::semicolon);
+            }
+         }
+         return finish(syntax_kind::structure, name, first, mark);
+      }
+
+      syntax_node parse_field_list()
+      {
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         parse_delimited(token_kind::close_brace, [this] {
+            auto const field = position_;
+            auto const field_mark = scratch_.size();
+            push(parse_attributes());
+            push(parse_visibility());
+            auto const name = expect_name(field);
+            expect(token_kind::colon);
+            push(parse_type());
+            return position_ == field ? no_syntax_node
+                                      : finish(syntax_kind::field, name, field, field_mark);
+         });
+         return finish(syntax_kind::field_list, first, first, mark);
+      }
+
+      syntax_node parse_tuple_field_list()
+      {
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         parse_delimited(token_kind::close_paren, [this] {
+            auto const field = position_;
+            auto const field_mark = scratch_.size();
+            push(parse_attributes());
+            push(parse_visibility());
+            push(parse_type());
+            return position_ == field ? no_syntax_node
+                                      : finish(syntax_kind::tuple_field, field, field, field_mark);
+         });
+         return finish(syntax_kind::tuple_field_list, first, first, mark);
+      }
+
+      syntax_node parse_enumeration(std::uint32_t const first, std::size_t const mark)
+      {
+         auto const keyword = advance();
+         auto const name = expect_name(keyword);
+         push(parse_generic_parameters());
+         push(parse_where_clause());
+
+         auto const variants = position_;
+         auto const variants_mark = scratch_.size();
+         if (not expect(token_kind::open_brace)) {
+            push(no_syntax_node);
+            return finish(syntax_kind::enumeration, name, first, mark);
+         }
+
+         parse_delimited(token_kind::close_brace, [this] {
+            auto const variant = position_;
+            auto const variant_mark = scratch_.size();
+            push(parse_attributes());
+            auto const variant_name = expect_name(variant);
+            if (at(token_kind::open_brace)) {
+               push(parse_field_list());
+            }
+            else if (at(token_kind::open_paren)) {
+               push(parse_tuple_field_list());
+            }
+            else {
+               push(no_syntax_node);
+            }
+            push(eat(token_kind::eq) ? parse_expression() : no_syntax_node);
+            return position_ == variant
+                 ? no_syntax_node
+                 : finish(syntax_kind::variant, variant_name, variant, variant_mark);
+         });
+         push(finish(syntax_kind::variant_list, variants, variants, variants_mark));
+         return finish(syntax_kind::enumeration, name, first, mark);
+      }
+
+      syntax_node parse_use_declaration(std::uint32_t const first, std::size_t const mark)
+      {
+         advance();
+         push(parse_use_tree());
+         expect(token_kind::semicolon);
+         return finish(syntax_kind::use_declaration, first, first, mark);
+      }
+
+      /// \brief Parses `a::b`, `a::b as c`, `a::*`, or `a::{b, c}`.
+      ///
+      syntax_node parse_use_tree()
+      {
+         auto const guard = nesting{*this};
+         if (abandoned_) {
+            return no_syntax_node;
+         }
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (at_path_start()) {
+            push(parse_path(path_mode::use));
+            if (at_keyword(u8"as")) {
+               auto const as = advance();
+               auto const name = at_word(u8"_") ? advance() : expect_name(as);
+               push(finish(syntax_kind::use_rename, name, as, scratch_.size()));
+               return finish(syntax_kind::use_tree, first, first, mark);
+            }
+            if (not eat(token_kind::path_separator)) {
+               push(no_syntax_node);
+               return finish(syntax_kind::use_tree, first, first, mark);
+            }
+         }
+         else {
+            push(no_syntax_node);
+            eat(token_kind::path_separator);
+         }
+
+         if (at(token_kind::star)) {
+            push(leaf(syntax_kind::use_glob));
+         }
+         else if (at(token_kind::open_brace)) {
+            auto const list = advance();
+            auto const list_mark = scratch_.size();
+            parse_delimited(token_kind::close_brace, [this] { return parse_use_tree(); });
+            push(finish(syntax_kind::use_tree_list, list, list, list_mark));
+         }
+         else {
+            report(syntax_error_kind::expected_identifier);
+            push(no_syntax_node);
+         }
+
+         if (position_ == first) {
+            scratch_.resize(mark);
+            return no_syntax_node;
+         }
+         return finish(syntax_kind::use_tree, first, first, mark);
+      }
+
+      syntax_node parse_module(std::uint32_t const first, std::size_t const mark)
+      {
+         auto const keyword = advance();
+         auto const name = expect_name(keyword);
+         if (eat(token_kind::semicolon)) {
+            push(no_syntax_node);
+         }
+         else {
+            push(parse_item_list());
+         }
+         return finish(syntax_kind::module, name, first, mark);
+      }
+
+      /// \brief Parses a constant or a static variable.
+      ///
+      syntax_node parse_variable(syntax_kind const kind, std::uint32_t const first,
+         std::size_t const mark)
+      {
+         auto const keyword = advance();
+         eat_keyword(u8"mut");
+         auto const name = at_word(u8"_") ? advance() : expect_name(keyword);
+         expect(token_kind::colon);
+         push(parse_type());
+         push(eat(token_kind::eq) ? parse_expression() : no_syntax_node);
+         expect(token_kind::semicolon);
+         return finish(kind, name, first, mark);
+      }
+
+      syntax_node parse_type_alias(std::uint32_t const first, std::size_t const mark)
+      {
+         auto const keyword = advance();
+         auto const name = expect_name(keyword);
+         push(parse_generic_parameters());
+
+         // An associated type in a trait may have bounds rather than a definition.
+         push(eat(token_kind::colon) ? parse_bounds() : no_syntax_node);
+         push(eat(token_kind::eq) ? parse_type() : no_syntax_node);
+         expect(token_kind::semicolon);
+         return finish(syntax_kind::type_alias, name, first, mark);
+      }
+
+      syntax_node parse_implementation(std::uint32_t const first, std::size_t const mark)
+      {
+         auto const keyword = advance();
+         push(parse_generic_parameters());
+
+         eat(token_kind::bang);
+         auto const type = parse_type();
+         if (eat_keyword(u8"for")) {
+            push(type);
+            push(parse_type());
+         }
+         else {
+            push(no_syntax_node);
+            push(type);
+         }
+         push(parse_where_clause());
+         push(parse_item_list());
+         return finish(syntax_kind::implementation, keyword, first, mark);
+      }
+
+      syntax_node parse_trait(std::uint32_t const first, std::size_t const mark)
+      {
+         auto const keyword = advance();
+         auto const name = expect_name(keyword);
+         push(parse_generic_parameters());
+         push(eat(token_kind::colon) ? parse_bounds() : no_syntax_node);
+         push(parse_where_clause());
+         push(parse_item_list());
+         return finish(syntax_kind::trait_declaration, name, first, mark);
+      }
+
+      /// \brief Parses `extern crate name;` or `extern crate name as alias;`.
+      ///
+      syntax_node parse_extern_crate(std::uint32_t const first, std::size_t const mark)
+      {
+         advance();
+         auto const keyword = advance();
+         auto const name = at_keyword(u8"self") ? advance() : expect_name(keyword);
+         if (at_keyword(u8"as")) {
+            auto const as = advance();
+            auto const alias = at_word(u8"_") ? advance() : expect_name(as);
+            push(finish(syntax_kind::use_rename, alias, as, scratch_.size()));
+         }
+         else {
+            push(no_syntax_node);
+         }
+         expect(token_kind::semicolon);
+         return finish(syntax_kind::extern_crate, name, first, mark);
+      }
+
+      /// \brief Parses `extern { ... }` or `extern "ABI" { ... }`.
+      ///
+      syntax_node parse_extern_block(std::uint32_t const first, std::size_t const mark)
+      {
+         auto const keyword = advance();
+         eat(token_kind::string_literal);
+         push(parse_item_list());
+         return finish(syntax_kind::extern_block, keyword, first, mark);
+      }
+
+      /// \brief Parses `name! { ... }`, `name!(...);`, or `macro_rules! name { ... }`.
+      ///
+      syntax_node parse_macro_item(std::uint32_t const first, std::size_t const mark)
+      {
+         push(parse_macro_invocation());
+         if (tree_.tokens_[position_ - 1].kind != token_kind::close_brace) {
+            expect(token_kind::semicolon);
+         }
+         return finish(syntax_kind::macro_item, first, first, mark);
+      }
+
+      syntax_node parse_macro_invocation()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         push(parse_path(path_mode::expression));
+         auto const bang = position_;
+         if (not expect(token_kind::bang)) {
+            return finish(syntax_kind::macro_invocation, first, first, mark);
+         }
+
+         eat(token_kind::identifier);
+         if (at(token_kind::open_paren) or at(token_kind::open_bracket)
+          or at(token_kind::open_brace)) {
+            skip_group();
+         }
+         else {
+            report(syntax_error_kind::expected_token, token_kind::open_paren);
+         }
+         return finish(syntax_kind::macro_invocation, bang, first, mark);
+      }
+
+      // Paths and types
+
+      enum class path_mode {
+         /// \brief Generic arguments follow a segment directly, as in `Vec<T>`.
+         ///
+         type,
+
+         /// \brief Generic arguments follow `::`, as in `Vec::<T>::new`.
+         ///
+         expression,
+
+         /// \brief There are no generic arguments, and a trailing `::` isn't consumed.
+         ///
+         use,
+      };
+
+      syntax_node parse_path(path_mode const mode)
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (at(token_kind::lt)) {
+            push(parse_qualified_type());
+            expect(token_kind::path_separator);
+         }
+         else {
+            eat(token_kind::path_separator);
+         }
+         while (at_path_segment()) {
+            auto const segment = advance();
+            auto const segment_mark = scratch_.size();
+            if (mode == path_mode::type and at(token_kind::lt)) {
+               push(parse_generic_arguments());
+            }
+            else if (mode == path_mode::type and at(token_kind::open_paren)) {
+               push(parse_parenthesised_arguments());
+            }
+            else if (mode == path_mode::expression and at(token_kind::path_separator)
+                 and at(token_kind::lt, 1)) {
+               advance();
+               push(parse_generic_arguments());
+            }
+            else {
+               push(no_syntax_node);
+            }
+            push(finish(syntax_kind::path_segment, segment, segment, segment_mark));
+
+            if (not at(token_kind::path_separator) or not at_path_segment(1)) {
+               break;
+            }
+            advance();
+         }
+         return finish(syntax_kind::path, first, first, mark);
+      }
+
+      /// \brief Parses the `<T as Trait>` in `<T as Trait>::Output`, or the `<T>` in `<T>::new`.
+      ///
+      syntax_node parse_qualified_type()
+      {
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         push(parse_type());
+         push(eat_keyword(u8"as") ? parse_type() : no_syntax_node);
+         if (not eat_closing_angle()) {
+            report(syntax_error_kind::expected_token, token_kind::gt);
+         }
+         return finish(syntax_kind::qualified_type, first, first, mark);
+      }
+
+      syntax_node parse_generic_arguments()
+      {
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         while (not at_end() and not at(token_kind::gt) and not at(token_kind::shr)
+            and not at(token_kind::ge) and not at(token_kind::shr_eq)) {
+            if (at(token_kind::lifetime)) {
+               push(leaf(syntax_kind::lifetime));
+            }
+            else if (at_name() and at(token_kind::eq, 1)) {
+               auto const name = advance();
+               auto const binding_mark = scratch_.size();
+               advance();
+               push(parse_type());
+               push(finish(syntax_kind::associated_type_binding, name, name, binding_mark));
+            }
+            else if (is_literal(peek().value_or(token_kind::unknown)) or at(token_kind::open_brace)) {
+               push(parse_primary());
+            }
+            else {
+               auto const type = parse_type();
+               if (type == no_syntax_node) {
+                  break;
+               }
+               push(type);
+            }
+
+            if (not eat(token_kind::comma)) {
+               break;
+            }
+         }
+
+         if (not eat_closing_angle()) {
+            report(syntax_error_kind::expected_token, token_kind::gt);
+         }
+         return finish(syntax_kind::generic_arguments, first, first, mark);
+      }
+
+      /// \brief Parses the `(A, B) -> C` in `Fn(A, B) -> C` as generic arguments.
+      ///
+      syntax_node parse_parenthesised_arguments()
+      {
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         parse_delimited(token_kind::close_paren, [this] { return parse_type(); });
+         if (eat(token_kind::right_arrow)) {
+            push(parse_type());
+         }
+         return finish(syntax_kind::generic_arguments, first, first, mark);
+      }
+
+      [[nodiscard]] bool at_type_start() const noexcept
+      {
+         return at_path_start() or at(token_kind::open_paren) or at(token_kind::open_bracket)
+             or at(token_kind::ampersand) or at(token_kind::ampersand_ampersand)
+             or at(token_kind::bang) or at(token_kind::star) or at_word(u8"_")
+             or at_keyword(u8"impl") or at_keyword(u8"dyn") or at_function_type_start();
+      }
+
+      [[nodiscard]] bool at_function_type_start() const noexcept
+      {
+         return at_keyword(u8"fn") or (at_keyword(u8"unsafe") and not at(token_kind::open_brace, 1))
+             or at_keyword(u8"extern");
+      }
+
+      syntax_node parse_type()
+      {
+         auto const guard = nesting{*this};
+         if (abandoned_) {
+            return no_syntax_node;
+         }
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (at_path_start()) {
+            return parse_path(path_mode::type);
+         }
+         if (at_word(u8"_")) {
+            return leaf(syntax_kind::inferred_type);
+         }
+         if (at(token_kind::bang)) {
+            return leaf(syntax_kind::never_type);
+         }
+         if (at(token_kind::ampersand) or at(token_kind::ampersand_ampersand)) {
+            return parse_reference_type();
+         }
+         if (at(token_kind::star)) {
+            auto const star = advance();
+            if (not eat_keyword(u8"const") and not eat_keyword(u8"mut")) {
+               report(syntax_error_kind::expected_token, token_kind::keyword);
+            }
+            push(parse_type());
+            return finish(syntax_kind::pointer_type, star, first, mark);
+         }
+         if (at_function_type_start()) {
+            return parse_function_type();
+         }
+         if (at_keyword(u8"impl") or at_keyword(u8"dyn")) {
+            auto const keyword = advance();
+            push(parse_bounds());
+            return finish(syntax_kind::bounded_type, keyword, first, mark);
+         }
+         if (at(token_kind::open_paren)) {
+            advance();
+            auto const elements = parse_delimited(token_kind::close_paren,
+               [this] { return parse_type(); });
+            if (elements.count == 1 and not elements.trailing_comma) {
+               auto const inner = scratch_.back();
+               scratch_.resize(mark);
+               return inner;
+            }
+            return finish(syntax_kind::tuple_type, first, first, mark);
+         }
+         if (at(token_kind::open_bracket)) {
+            advance();
+            push(parse_type());
+            auto kind = syntax_kind::slice_type;
+            if (eat(token_kind::semicolon)) {
+               auto const scope = struct_literal_scope{*this, true};
+               push(parse_expression());
+               kind = syntax_kind::array_type;
+            }
+            expect(token_kind::close_bracket);
+            return finish(kind, first, first, mark);
+         }
+
+         report(syntax_error_kind::expected_type);
+         return no_syntax_node;
+      }
+
+      syntax_node parse_reference_type()
+      {
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         push(at(token_kind::lifetime) ? leaf(syntax_kind::lifetime) : no_syntax_node);
+         eat_keyword(u8"mut");
+         push(parse_type());
+         auto const inner = finish(syntax_kind::reference_type, first, first, mark);
+         if (tree_.tokens_[first].kind != token_kind::ampersand_ampersand) {
+            return inner;
+         }
+
+         // `&&T` is a reference to a reference, sharing the `&&` token.
+         push(no_syntax_node);
+         push(inner);
+         return finish(syntax_kind::reference_type, first, first, mark);
+      }
+
+      /// \brief Parses `fn(A, B) -> C`, which may have qualifiers such as `unsafe extern "C"` and
+      ///        names for its parameters.
+      ///
+      syntax_node parse_function_type()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         skip_qualifiers();
+         auto const keyword = position_;
+         if (not eat_keyword(u8"fn")) {
+            report(syntax_error_kind::expected_type);
+            return position_ == first ? no_syntax_node
+                                      : finish(syntax_kind::error, first, first, mark);
+         }
+
+         // The return type comes last in the source, but first in the children.
+         auto const return_type = scratch_.size();
+         push(no_syntax_node);
+         if (expect(token_kind::open_paren)) {
+            parse_delimited(token_kind::close_paren, [this] {
+               skip_attributes();
+               if ((at_name() or at_word(u8"_")) and at(token_kind::colon, 1)) {
+                  advance();
+                  advance();
+               }
+               if (at(token_kind::dot_dot_dot)) {
+                  advance();
+                  return no_syntax_node;
+               }
+               return parse_type();
+            });
+         }
+         if (eat(token_kind::right_arrow)) {
+            auto const type = parse_type();
+            scratch_[return_type] = type;
+         }
+         return finish(syntax_kind::function_type, keyword, first, mark);
+      }
+
+      // Patterns
+
+      /// \brief Parses a pattern, including alternatives separated by `|`.
+      ///
+      syntax_node parse_pattern()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         eat(token_kind::pipe);
+         push(parse_single_pattern());
+         if (not at(token_kind::pipe)) {
+            auto const single = scratch_.back();
+            scratch_.resize(mark);
+            return single;
+         }
+
+         while (eat(token_kind::pipe)) {
+            push(parse_single_pattern());
+         }
+         return finish(syntax_kind::or_pattern, first, first, mark);
+      }
+
+      syntax_node parse_single_pattern()
+      {
+         auto const guard = nesting{*this};
+         if (abandoned_) {
+            return no_syntax_node;
+         }
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (at_word(u8"_")) {
+            return leaf(syntax_kind::wildcard_pattern);
+         }
+         if (at(token_kind::dot_dot)) {
+            return leaf(syntax_kind::rest_pattern);
+         }
+         if (at(token_kind::minus) and is_literal(peek(1).value_or(token_kind::unknown))) {
+            advance();
+            auto const literal = advance();
+            return finish(syntax_kind::literal_pattern, literal, first, mark);
+         }
+         if (is_literal(peek().value_or(token_kind::unknown)) or at_keyword(u8"true")
+          or at_keyword(u8"false")) {
+            return leaf(syntax_kind::literal_pattern);
+         }
+         if (at(token_kind::ampersand) or at(token_kind::ampersand_ampersand)) {
+            advance();
+            eat_keyword(u8"mut");
+            push(parse_single_pattern());
+            return finish(syntax_kind::reference_pattern, first, first, mark);
+         }
+         if (at(token_kind::open_paren)) {
+            advance();
+            auto const elements = parse_delimited(token_kind::close_paren,
+               [this] { return parse_pattern(); });
+            if (elements.count == 1 and not elements.trailing_comma) {
+               auto const inner = scratch_.back();
+               scratch_.resize(mark);
+               return inner;
+            }
+            return finish(syntax_kind::tuple_pattern, first, first, mark);
+         }
+         if (at(token_kind::open_bracket)) {
+            advance();
+            parse_delimited(token_kind::close_bracket, [this] { return parse_pattern(); });
+            return finish(syntax_kind::slice_pattern, first, first, mark);
+         }
+         if (at_keyword(u8"ref") or at_keyword(u8"mut") or (at_name() and at(token_kind::at, 1))) {
+            eat_keyword(u8"ref");
+            eat_keyword(u8"mut");
+            auto const name = expect_name(first);
+            if (not eat(token_kind::at)) {
+               return finish(syntax_kind::identifier_pattern, name, first, mark);
+            }
+            push(parse_single_pattern());
+            return finish(syntax_kind::binding_pattern, name, first, mark);
+         }
+         if (at_name() and not at(token_kind::path_separator, 1) and not at(token_kind::open_paren, 1)
+          and not at(token_kind::bang, 1) and not at(token_kind::open_brace, 1)) {
+            return leaf(syntax_kind::identifier_pattern);
+         }
+         if (at_path_start()) {
+            push(parse_path(path_mode::expression));
+            if (eat(token_kind::open_paren)) {
+               parse_delimited(token_kind::close_paren, [this] { return parse_pattern(); });
+               return finish(syntax_kind::tuple_struct_pattern, first, first, mark);
+            }
+            if (eat(token_kind::open_brace)) {
+               parse_delimited(token_kind::close_brace, [this] { return parse_field_pattern(); });
+               return finish(syntax_kind::struct_pattern, first, first, mark);
+            }
+            return finish(syntax_kind::path_pattern, first, first, mark);
+         }
+
+         report(syntax_error_kind::expected_pattern);
+         return no_syntax_node;
+      }
+
+      /// \brief Parses `name: pattern`, `name`, `ref mut name`, or `..` in a struct pattern.
+      ///
+      syntax_node parse_field_pattern()
+      {
+         skip_attributes();
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (at(token_kind::dot_dot)) {
+            auto const rest = advance();
+            return finish(syntax_kind::field_pattern, rest, first, mark);
+         }
+         if ((at_name() or at(token_kind::integer_literal)) and at(token_kind::colon, 1)) {
+            auto const name = advance();
+            advance();
+            push(parse_pattern());
+            return finish(syntax_kind::field_pattern, name, first, mark);
+         }
+
+         eat_keyword(u8"ref");
+         eat_keyword(u8"mut");
+         if (not at_name()) {
+            report(syntax_error_kind::expected_identifier);
+            return position_ == first ? no_syntax_node
+                                      : finish(syntax_kind::error, first, first, mark);
+         }
+         auto const name = advance();
+         push(no_syntax_node);
+         return finish(syntax_kind::field_pattern, name, first, mark);
+      }
+
+      // Expressions
+
+      [[nodiscard]] bool at_expression_start() const noexcept
+      {
+         if (at_path_start() or is_literal(peek().value_or(token_kind::unknown))) {
+            return true;
+         }
+
+         switch (peek().value_or(token_kind::unknown)) {
+         case token_kind::open_paren:
+         case token_kind::open_bracket:
+         case token_kind::open_brace:
+         case token_kind::minus:
+         case token_kind::bang:
+         case token_kind::star:
+         case token_kind::ampersand:
+         case token_kind::ampersand_ampersand:
+         case token_kind::pipe:
+         case token_kind::pipe_pipe:
+         case token_kind::dot_dot:
+         case token_kind::dot_dot_eq:
+         case token_kind::lifetime:
+            return true;
+         case token_kind::keyword: {
+            constexpr auto expression_keywords = std::array{
+               u8"break"sv, u8"continue"sv, u8"false"sv, u8"for"sv, u8"if"sv, u8"let"sv,
+               u8"loop"sv, u8"match"sv, u8"move"sv, u8"return"sv, u8"true"sv, u8"unsafe"sv,
+               u8"while"sv,
+            };
+            auto const text = tree_.tokens_[position_].text(source_);
+            return std::ranges::find(expression_keywords, text) != expression_keywords.end();
+         }
+         default:
+            return false;
+         }
+      }
+
+      syntax_node parse_expression(std::uint8_t const min_power = 0)
+      {
+         auto const guard = nesting{*this};
+         if (abandoned_) {
+            return no_syntax_node;
+         }
+         auto const first = position_;
+         auto const lhs = parse_prefix();
+         if (lhs == no_syntax_node) {
+            return no_syntax_node;
+         }
+         return parse_expression_tail(lhs, first, min_power);
+      }
+
+      /// \brief Parses the postfix and infix operators that follow `lhs`, which starts at the token
+      ///        `first`, as long as they bind at least as tightly as `min_power`.
+      ///
+      syntax_node parse_expression_tail(syntax_node lhs, std::uint32_t const first,
+         std::uint8_t const min_power)
+      {
+         for (;;) {
+            auto const mark = scratch_.size();
+            if (at(token_kind::open_paren)) {
+               advance();
+               push(lhs);
+               parse_arguments(token_kind::close_paren);
+               lhs = finish(syntax_kind::call, first, first, mark);
+            }
+            else if (at(token_kind::open_bracket)) {
+               advance();
+               push(lhs);
+               auto const scope = struct_literal_scope{*this, true};
+               push(parse_expression());
+               expect(token_kind::close_bracket);
+               lhs = finish(syntax_kind::index, first, first, mark);
+            }
+            else if (at(token_kind::question)) {
+               auto const question = advance();
+               push(lhs);
+               lhs = finish(syntax_kind::try_expression, question, first, mark);
+            }
+            else if (at(token_kind::dot)) {
+               advance();
+               push(lhs);
+               auto const name = position_;
+               if (at_name() or at(token_kind::integer_literal) or at(token_kind::float_literal)
+                or at_keyword(u8"await")) {
+                  advance();
+               }
+               else {
+                  report(syntax_error_kind::expected_identifier);
+                  return finish(syntax_kind::field_access, name - 1, first, mark);
+               }
+
+               auto generic_arguments = no_syntax_node;
+               if (at(token_kind::path_separator) and at(token_kind::lt, 1)) {
+                  advance();
+                  generic_arguments = parse_generic_arguments();
+               }
+               if (eat(token_kind::open_paren)) {
+                  push(generic_arguments);
+                  parse_arguments(token_kind::close_paren);
+                  lhs = finish(syntax_kind::method_call, name, first, mark);
+               }
+               else {
+                  lhs = finish(syntax_kind::field_access, name, first, mark);
+               }
+            }
+            else if (at_keyword(u8"as")) {
+               if (cast_power < min_power) {
+                  return lhs;
+               }
+               auto const as = advance();
+               push(lhs);
+               push(parse_type());
+               lhs = finish(syntax_kind::cast, as, first, mark);
+            }
+            else {
+               auto const power = infix_power(peek().value_or(token_kind::unknown));
+               if (not power or power->left < min_power) {
+                  return lhs;
+               }
+
+               auto const op = advance();
+               push(lhs);
+               auto const kind = tree_.tokens_[op].kind;
+               if (kind == token_kind::dot_dot or kind == token_kind::dot_dot_eq) {
+                  push(at_expression_start() ? parse_expression(power->right) : no_syntax_node);
+                  lhs = finish(syntax_kind::range, op, first, mark);
+                  continue;
+               }
+
+               auto const rhs = parse_expression(power->right);
+               if (rhs == no_syntax_node) {
+                  report(syntax_error_kind::expected_expression);
+               }
+               push(rhs);
+               lhs = finish(syntax_kind::binary, op, first, mark);
+            }
+         }
+      }
+
+      /// \brief Parses comma-separated arguments up to `close`, which the opening delimiter has
+      ///        already been consumed for.
+      ///
+      void parse_arguments(token_kind const close)
+      {
+         auto const scope = struct_literal_scope{*this, true};
+         parse_delimited(close, [this] { return parse_expression(); });
+      }
+
+      syntax_node parse_prefix()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         switch (peek().value_or(token_kind::unknown)) {
+         case token_kind::minus:
+         case token_kind::bang:
+         case token_kind::star: {
+            auto const op = advance();
+            push(parse_operand(prefix_power));
+            return finish(syntax_kind::unary, op, first, mark);
+         }
+         case token_kind::ampersand:
+         case token_kind::ampersand_ampersand: {
+            // `&&x` is a reference to a reference, sharing the `&&` token.
+            auto const op = advance();
+            auto const doubled = tree_.tokens_[op].kind == token_kind::ampersand_ampersand;
+            eat_keyword(u8"mut");
+            push(parse_operand(prefix_power));
+            auto const inner = finish(syntax_kind::reference, op, first, mark);
+            if (not doubled) {
+               return inner;
+            }
+            push(inner);
+            return finish(syntax_kind::reference, op, first, mark);
+         }
+         case token_kind::dot_dot:
+         case token_kind::dot_dot_eq: {
+            auto const op = advance();
+            push(no_syntax_node);
+            push(at_expression_start() ? parse_expression(range_end_power) : no_syntax_node);
+            return finish(syntax_kind::range, op, first, mark);
+         }
+         case token_kind::pipe:
+         case token_kind::pipe_pipe:
+            return parse_closure();
+         default:
+            break;
+         }
+
+         if (at_keyword(u8"move") and (at(token_kind::pipe, 1) or at(token_kind::pipe_pipe, 1))) {
+            return parse_closure();
+         }
+         if (at_keyword(u8"let")) {
+            auto const let = advance();
+            push(parse_pattern());
+            expect(token_kind::eq);
+            auto const scope = struct_literal_scope{*this, false};
+            push(parse_operand(let_condition_power));
+            return finish(syntax_kind::let_condition, let, first, mark);
+         }
+         if (at_keyword(u8"return") or at_keyword(u8"break")) {
+            auto const keyword = advance();
+            eat(token_kind::lifetime);
+            push(at_expression_start() ? parse_expression() : no_syntax_node);
+            auto const kind = tree_.tokens_[keyword].text(source_) == u8"return"
+                            ? syntax_kind::return_expression
+                            : syntax_kind::break_expression;
+            return finish(kind, keyword, first, mark);
+         }
+         if (at_keyword(u8"continue")) {
+            auto const keyword = advance();
+            eat(token_kind::lifetime);
+            return finish(syntax_kind::continue_expression, keyword, first, mark);
+         }
+         return parse_primary();
+      }
+
+      /// \brief Parses the operand of a prefix operator, reporting it if it's missing.
+      ///
+      syntax_node parse_operand(std::uint8_t const power)
+      {
+         auto const operand = parse_expression(power);
+         if (operand == no_syntax_node) {
+            report(syntax_error_kind::expected_expression);
+         }
+         return operand;
+      }
+
+      syntax_node parse_closure()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         eat_keyword(u8"move");
+
+         auto const parameters = position_;
+         auto const parameters_mark = scratch_.size();
+         if (not eat(token_kind::pipe_pipe)) {
+            advance();
+            while (not at_end() and not at(token_kind::pipe)) {
+               auto const parameter = position_;
+               auto const parameter_mark = scratch_.size();
+               push(parse_single_pattern());
+               push(eat(token_kind::colon) ? parse_type() : no_syntax_node);
+               if (position_ != parameter) {
+                  push(finish(syntax_kind::parameter, parameter, parameter, parameter_mark));
+               }
+               if (not eat(token_kind::comma)) {
+                  break;
+               }
+            }
+            expect(token_kind::pipe);
+         }
+         push(finish(syntax_kind::closure_parameter_list, parameters, parameters, parameters_mark));
+
+         if (eat(token_kind::right_arrow)) {
+            push(parse_type());
+            push(parse_required_block());
+         }
+         else {
+            push(no_syntax_node);
+            push(parse_operand(0));
+         }
+         return finish(syntax_kind::closure, first, first, mark);
+      }
+
+      syntax_node parse_primary()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (is_literal(peek().value_or(token_kind::unknown)) or at_keyword(u8"true")
+          or at_keyword(u8"false")) {
+            return leaf(syntax_kind::literal);
+         }
+         if (at_macro_invocation()) {
+            return parse_macro_invocation();
+         }
+         if (at_path_start()) {
+            auto const path = parse_path(path_mode::expression);
+            if (struct_literals_ and at_struct_literal_body()) {
+               push(path);
+               return parse_struct_expression(first, mark);
+            }
+            return path;
+         }
+         if (at(token_kind::open_paren)) {
+            advance();
+            auto const scope = struct_literal_scope{*this, true};
+            auto const elements = parse_delimited(token_kind::close_paren,
+               [this] { return parse_expression(); });
+            auto const kind = elements.count == 1 and not elements.trailing_comma
+                            ? syntax_kind::group
+                            : syntax_kind::tuple;
+            return finish(kind, first, first, mark);
+         }
+         if (at(token_kind::open_bracket)) {
+            advance();
+            auto const scope = struct_literal_scope{*this, true};
+            if (at(token_kind::close_bracket)) {
+               advance();
+               return finish(syntax_kind::array, first, first, mark);
+            }
+
+            push(parse_expression());
+            if (eat(token_kind::semicolon)) {
+               push(parse_expression());
+               expect(token_kind::close_bracket);
+               return finish(syntax_kind::array_repeat, first, first, mark);
+            }
+            if (eat(token_kind::comma)) {
+               parse_delimited(token_kind::close_bracket, [this] { return parse_expression(); });
+            }
+            else {
+               expect(token_kind::close_bracket);
+            }
+            return finish(syntax_kind::array, first, first, mark);
+         }
+         return parse_block_like();
+      }
+
+      /// \brief Checks if a `{` after a path starts a struct expression's fields rather than a
+      ///        block.
+      ///
+      [[nodiscard]] bool at_struct_literal_body() const noexcept
+      {
+         if (not at(token_kind::open_brace)) {
+            return false;
+         }
+         if (at(token_kind::close_brace, 1) or at(token_kind::dot_dot, 1)) {
+            return true;
+         }
+         return (at_name(1) or at(token_kind::integer_literal, 1))
+            and (at(token_kind::colon, 2) or at(token_kind::comma, 2) or at(token_kind::close_brace, 2));
+      }
+
+      syntax_node parse_struct_expression(std::uint32_t const first, std::size_t const mark)
+      {
+         advance();
+         auto const scope = struct_literal_scope{*this, true};
+         parse_delimited(token_kind::close_brace, [this] {
+            auto const field = position_;
+            auto const field_mark = scratch_.size();
+            if (eat(token_kind::dot_dot)) {
+               push(parse_operand(0));
+               return finish(syntax_kind::field_initialiser, field, field, field_mark);
+            }
+            if (not at_name() and not at(token_kind::integer_literal)) {
+               report(syntax_error_kind::expected_identifier);
+               return no_syntax_node;
+            }
+
+            auto const name = advance();
+            push(eat(token_kind::colon) ? parse_operand(0) : no_syntax_node);
+            return finish(syntax_kind::field_initialiser, name, field, field_mark);
+         });
+         return finish(syntax_kind::struct_expression, first, first, mark);
+      }
+
+      /// \brief Parses the expressions that end with a block and so can stand as statements
+      ///        without a `;`.
+      ///
+      syntax_node parse_block_like()
+      {
+         auto const first = position_;
+         auto const mark = scratch_.size();
+
+         // A label, such as `'outer: loop {}`.
+         if (at(token_kind::lifetime) and at(token_kind::colon, 1)) {
+            advance();
+            advance();
+         }
+
+         if (at(token_kind::open_brace)) {
+            return parse_block();
+         }
+         if (at_keyword(u8"unsafe") and at(token_kind::open_brace, 1)) {
+            auto const keyword = advance();
+            push(parse_block());
+            return finish(syntax_kind::unsafe_block, keyword, first, mark);
+         }
+         if (at_keyword(u8"if")) {
+            return parse_if();
+         }
+         if (at_keyword(u8"while")) {
+            auto const keyword = advance();
+            push(parse_condition());
+            push(parse_required_block());
+            return finish(syntax_kind::while_expression, keyword, first, mark);
+         }
+         if (at_keyword(u8"loop")) {
+            auto const keyword = advance();
+            push(parse_required_block());
+            return finish(syntax_kind::loop_expression, keyword, first, mark);
+         }
+         if (at_keyword(u8"for")) {
+            auto const keyword = advance();
+            push(parse_pattern());
+            if (not eat_keyword(u8"in")) {
+               report(syntax_error_kind::expected_token, token_kind::keyword);
+            }
+            push(parse_condition());
+            push(parse_required_block());
+            return finish(syntax_kind::for_expression, keyword, first, mark);
+         }
+         if (at_keyword(u8"match")) {
+            return parse_match();
+         }
+
+         if (position_ != first) {
+            report(syntax_error_kind::expected_token, token_kind::open_brace);
+            return finish(syntax_kind::error, first, first, mark);
+         }
+         report(syntax_error_kind::expected_expression);
+         return no_syntax_node;
+      }
+
+      /// \brief Parses an expression in which a struct expression isn't allowed, because its `{`
+      ///        would be mistaken for a block's.
+      ///
+      syntax_node parse_condition()
+      {
+         auto const scope = struct_literal_scope{*this, false};
+         return parse_operand(0);
+      }
+
+      syntax_node parse_required_block()
+      {
+         if (at(token_kind::open_brace)) {
+            return parse_block();
+         }
+         report(syntax_error_kind::expected_token, token_kind::open_brace);
+         return no_syntax_node;
+      }
+
+      /// \brief Parses an `if` and any `else if`s that follow it.
+      ///
+      /// Each `else if` is an if_expression nested in the one before it, but the chain is parsed in
+      /// a loop so that a long chain isn't mistaken for deep nesting.
+      ///
+      syntax_node parse_if()
+      {
+         auto const guard = nesting{*this};
+         if (abandoned_) {
+            return no_syntax_node;
+         }
+
+         auto const base = if_chain_.size();
+         for (;;) {
+            auto const first = advance();
+            if_chain_.push_back(chain_link{first, scratch_.size()});
+            push(parse_condition());
+            push(parse_required_block());
+            if (not eat_keyword(u8"else")) {
+               push(no_syntax_node);
+               break;
+            }
+            if (not at_keyword(u8"if")) {
+               push(parse_required_block());
+               break;
+            }
+         }
+
+         auto n = no_syntax_node;
+         while (if_chain_.size() > base) {
+            auto const link = if_chain_.back();
+            if_chain_.pop_back();
+            if (n != no_syntax_node) {
+               push(n);
+            }
+            n = finish(syntax_kind::if_expression, link.first, link.first, link.mark);
+         }
+         return n;
+      }
+
+      syntax_node parse_match()
+      {
+         auto const first = advance();
+         auto const mark = scratch_.size();
+         push(parse_condition());
+         if (not expect(token_kind::open_brace)) {
+            return finish(syntax_kind::match_expression, first, first, mark);
+         }
+
+         auto const scope = struct_literal_scope{*this, true};
+         while (not at_end() and not at(token_kind::close_brace)) {
+            skip_attributes();
+            auto const arm = position_;
+            auto const arm_mark = scratch_.size();
+            push(parse_pattern());
+            push(eat_keyword(u8"if") ? parse_operand(0) : no_syntax_node);
+            expect(token_kind::fat_arrow);
+            auto const body = parse_operand(0);
+            push(body);
+            if (position_ == arm) {
+               skip_to(token_kind::comma);
+               if (position_ == arm) {
+                  advance();
+               }
+               scratch_.resize(arm_mark);
+               continue;
+            }
+
+            push(finish(syntax_kind::match_arm, arm, arm, arm_mark));
+            if (not eat(token_kind::comma) and not is_block_like(kind_of(body))
+             and not at(token_kind::close_brace)) {
+               report(syntax_error_kind::expected_token, token_kind::comma);
+               skip_to(token_kind::comma);
+            }
+         }
+         expect(token_kind::close_brace);
+         return finish(syntax_kind::match_expression, first, first, mark);
+      }
+
+      // Statements
+
+      syntax_node parse_block()
+      {
+         auto const guard = nesting{*this};
+         if (abandoned_) {
+            return no_syntax_node;
+         }
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         if (not expect(token_kind::open_brace)) {
+            return no_syntax_node;
+         }
+
+         auto const scope = struct_literal_scope{*this, true};
+         while (not at_end() and not at(token_kind::close_brace)) {
+            auto const statement = position_;
+            auto const value = parse_statement();
+            if (position_ == statement) {
+               report(syntax_error_kind::expected_expression);
+               auto const error_mark = scratch_.size();
+               skip_to(token_kind::semicolon);
+               if (position_ == statement) {
+                  advance();
+               }
+               push(finish(syntax_kind::error, statement, statement, error_mark));
+               continue;
+            }
+            if (value != no_syntax_node) {
+               push(value);
+            }
+         }
+         expect(token_kind::close_brace);
+         return finish(syntax_kind::block, first, first, mark);
+      }
+
+      /// \brief Parses a statement, or the expression that a block ends with.
+      /// \returns The statement, or no_syntax_node for an empty statement.
+      ///
+      syntax_node parse_statement()
+      {
+         if (eat(token_kind::semicolon)) {
+            return no_syntax_node;
+         }
+
+         if (at_statement_item()) {
+            return parse_item();
+         }
+
+         auto const first = position_;
+         auto const mark = scratch_.size();
+         auto const attributes = parse_attributes();
+         push(attributes);
+         if (at_keyword(u8"let")) {
+            advance();
+            push(parse_pattern());
+            push(eat(token_kind::colon) ? parse_type() : no_syntax_node);
+            push(eat(token_kind::eq) ? parse_operand(0) : no_syntax_node);
+            push(eat_keyword(u8"else") ? parse_required_block() : no_syntax_node);
+            expect(token_kind::semicolon);
+            return finish(syntax_kind::let_statement, first, first, mark);
+         }
+
+         auto expression = no_syntax_node;
+         auto const expression_first = position_;
+         if (at_block_like_start()) {
+            expression = parse_block_like();
+            if (at(token_kind::dot) or at(token_kind::question)) {
+               expression = parse_expression_tail(expression, expression_first, 0);
+            }
+         }
+         else {
+            expression = parse_expression();
+         }
+
+         if (expression == no_syntax_node) {
+            scratch_.resize(mark);
+            return position_ == first ? no_syntax_node
+                                      : finish(syntax_kind::error, first, first, mark);
+         }
+         if (at(token_kind::close_brace) and attributes == no_syntax_node) {
+            // The block's value.
+            scratch_.resize(mark);
+            return expression;
+         }
+         if (not eat(token_kind::semicolon) and not is_block_like(kind_of(expression))
+          and not at(token_kind::close_brace)) {
+            report(syntax_error_kind::expected_token, token_kind::semicolon);
+         }
+         push(expression);
+         return finish(syntax_kind::expression_statement, first, first, mark);
+      }
+
+      /// \brief Checks if a statement is an item, looking past any attributes in front of it.
+      ///
+      [[nodiscard]] bool at_statement_item() const noexcept
+      {
+         auto i = std::size_t{0};
+         while (at(token_kind::pound, i) and at(token_kind::open_bracket, i + 1)) {
+            // Attributes are short, so there's no need for the delimiter_table here.
+            auto depth = std::size_t{0};
+            i += 1;
+            do {
+               if (at(token_kind::open_bracket, i)) {
+                  ++depth;
+               }
+               else if (at(token_kind::close_bracket, i)) {
+                  --depth;
+               }
+               ++i;
+            } while (depth > 0 and peek(i));
+         }
+         return at_item_keyword(i);
+      }
+
+      [[nodiscard]] bool at_block_like_start() const noexcept
+      {
+         return at(token_kind::open_brace) or (at_keyword(u8"unsafe") and at(token_kind::open_brace, 1))
+             or at_keyword(u8"if") or at_keyword(u8"while") or at_keyword(u8"loop")
+             or at_keyword(u8"for") or at_keyword(u8"match")
+             or (at(token_kind::lifetime) and at(token_kind::colon, 1));
+      }
+
+      // Lists
+
+      struct delimited_list {
+         std::size_t count;
+         bool trailing_comma;
+      };
+
+      /// \brief Parses elements separated by commas up to and including `close`, pushing each one.
+      ///
+      template<typename Element>
+      delimited_list parse_delimited(token_kind const close, Element element)
+      {
+         auto list = delimited_list{0, false};
+         while (not at_end() and not at(close)) {
+            auto const e = element();
+            if (e != no_syntax_node) {
+               push(e);
+               ++list.count;
+            }
+
+            list.trailing_comma = eat(token_kind::comma);
+            if (not list.trailing_comma) {
+               break;
+            }
+         }
+
+         if (not expect(close)) {
+            skip_to(close);
+         }
+         return list;
+      }
+   };
+} // namespace lingua::detail_parse
+
+namespace lingua {
+   syntax_tree parse(std::u8string_view const source, std::span<token const> const tokens)
+   { return detail_parse::parser{source, tokens}.parse(); }
+
+   syntax_tree parse(std::u8string_view const source)
+   {
+      auto const lexed = lex(source);
+      return parse(source, lexed.tokens);
+   }
+} // namespace lingua
@@ -0,0 +1,347 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/source_buffer.hpp"
+#include "lingua/utility/contract.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace {
+   [[nodiscard]] std::size_t count_newlines(std::u8string_view const text) noexcept
+   { return static_cast<std::size_t>(std::ranges::count(text, u8'\n')); }
+
+   /// \brief New chunks start half full, so that typing into them doesn't immediately split them.
+   ///
+   constexpr auto initial_chunk_size = lingua::source_buffer::max_chunk_size / 2;
+} // namespace
+
+namespace lingua {
+   source_buffer::source_buffer(std::u8string_view const text)
+   {
+      LINGUA_EXPECTS(text.size() <= std::numeric_limits<std::uint32_t>::max());
+      root_ = make_tree(text);
+   }
+
+   text_edit source_buffer::replace(std::size_t const offset, std::size_t const removed,
+      std::u8string_view const inserted)
+   {
+      LINGUA_EXPECTS(offset <= size() and removed <= size() - offset);
+      LINGUA_EXPECTS(size() - removed + inserted.size() <= std::numeric_limits<std::uint32_t>::max());
+
+      if (removed > 0) {
+         auto const [before, rest] = split(root_, offset);
+         auto const [middle, after] = split(rest, removed);
+         release(middle);
+         root_ = merge(before, after);
+         coalesce(offset);
+      }
+
+      if (not inserted.empty() and not insert_in_place(root_, offset, inserted)) {
+         auto const [before, after] = split(root_, offset);
+         root_ = merge(merge(before, make_tree(inserted)), after);
+         coalesce(offset);
+         coalesce(offset + inserted.size());
+      }
+
+      return text_edit{
+         static_cast<std::uint32_t>(offset),
+         static_cast<std::uint32_t>(removed),
+         static_cast<std::uint32_t>(inserted.size())
+      };
+   }
+
+   source_buffer::chunk source_buffer::chunk_at(std::size_t offset) const noexcept
+   {
+      LINGUA_EXPECTS(offset < size());
+
+      auto base = std::size_t{0};
+      for (auto t = root_;;) {
+         auto const& n = nodes_[t];
+         auto const left_bytes = bytes(n.left);
+         if (offset < left_bytes) {
+            t = n.left;
+            continue;
+         }
+
+         offset -= left_bytes;
+         base += left_bytes;
+         if (offset < n.text.size()) {
+            return chunk{n.text, base};
+         }
+
+         offset -= n.text.size();
+         base += n.text.size();
+         t = n.right;
+      }
+   }
+
+   std::u8string source_buffer::substr(std::size_t offset, std::size_t count) const
+   {
+      LINGUA_EXPECTS(offset <= size());
+      count = std::min(count, size() - offset);
+
+      auto text = std::u8string{};
+      text.reserve(count);
+      while (count > 0) {
+         auto const [piece, begin] = chunk_at(offset);
+         auto const taken = piece.substr(offset - begin, count);
+         text += taken;
+         offset += taken.size();
+         count -= taken.size();
+      }
+      return text;
+   }
+
+   source_coordinate source_buffer::coordinate_of(std::size_t const offset) const noexcept
+   {
+      LINGUA_EXPECTS(offset <= size());
+
+      // Count the newlines in front of `offset`.
+      auto line = std::size_t{1};
+      auto remaining = offset;
+      for (auto t = root_; t != none;) {
+         auto const& n = nodes_[t];
+         auto const left_bytes = bytes(n.left);
+         if (remaining < left_bytes) {
+            t = n.left;
+            continue;
+         }
+
+         line += newlines(n.left);
+         remaining -= left_bytes;
+         if (remaining < n.text.size()) {
+            line += count_newlines(std::u8string_view{n.text}.substr(0, remaining));
+            break;
+         }
+
+         line += n.text_newlines;
+         remaining -= n.text.size();
+         t = n.right;
+      }
+
+      return source_coordinate{
+         source_coordinate::line_type{static_cast<source_coordinate::value_type>(line)},
+         source_coordinate::column_type{
+            static_cast<source_coordinate::value_type>(offset - line_begin(line) + 1)
+         }
+      };
+   }
+
+   std::size_t source_buffer::offset_of(source_coordinate const coordinate) const noexcept
+   {
+      auto const line = static_cast<source_coordinate::value_type>(coordinate.line());
+      auto const column = static_cast<source_coordinate::value_type>(coordinate.column());
+      LINGUA_EXPECTS(line >= 1 and static_cast<std::size_t>(line) <= line_count());
+      LINGUA_EXPECTS(column >= 1);
+
+      auto const offset = line_begin(static_cast<std::size_t>(line))
+                        + static_cast<std::size_t>(column) - 1;
+      LINGUA_EXPECTS(offset <= size());
+      return offset;
+   }
+
+   std::size_t source_buffer::line_begin(std::size_t const line) const noexcept
+   {
+      LINGUA_EXPECTS(1 <= line and line <= line_count());
+
+      // Find the newline that ends the previous line.
+      auto newline = line - 1;
+      auto base = std::size_t{0};
+      for (auto t = root_; newline > 0;) {
+         auto const& n = nodes_[t];
+         if (newline <= newlines(n.left)) {
+            t = n.left;
+            continue;
+         }
+
+         newline -= newlines(n.left);
+         base += bytes(n.left);
+         if (newline <= n.text_newlines) {
+            for (auto i = std::size_t{0};; ++i) {
+               if (n.text[i] == u8'\n' and --newline == 0) {
+                  return base + i + 1;
+               }
+            }
+         }
+
+         newline -= n.text_newlines;
+         base += n.text.size();
+         t = n.right;
+      }
+      return 0;
+   }
+
+   void source_buffer::update(index_type const t) noexcept
+   {
+      auto& n = nodes_[t];
+      n.bytes = bytes(n.left) + n.text.size() + bytes(n.right);
+      n.newlines = newlines(n.left) + n.text_newlines + newlines(n.right);
+   }
+
+   source_buffer::index_type source_buffer::make_node(std::u8string_view const text)
+   {
+      // xorshift32: the priorities only need to look random to keep the tree balanced.
+      seed_ ^= seed_ << 13U;
+      seed_ ^= seed_ >> 17U;
+      seed_ ^= seed_ << 5U;
+
+      auto fresh = node{};
+      fresh.text = text;
+      fresh.priority = seed_;
+      fresh.text_newlines = count_newlines(text);
+
+      auto t = index_type{};
+      if (free_.empty()) {
+         t = static_cast<index_type>(nodes_.size());
+         nodes_.push_back(std::move(fresh));
+      }
+      else {
+         t = free_.back();
+         free_.pop_back();
+         nodes_[t] = std::move(fresh);
+      }
+      update(t);
+      return t;
+   }
+
+   source_buffer::index_type source_buffer::make_tree(std::u8string_view text)
+   {
+      auto t = none;
+      while (not text.empty()) {
+         auto const piece = text.substr(0, initial_chunk_size);
+         t = merge(t, make_node(piece));
+         text.remove_prefix(piece.size());
+      }
+      return t;
+   }
+
+   void source_buffer::release(index_type const t) noexcept
+   {
+      if (t == none) {
+         return;
+      }
+
+      release(nodes_[t].left);
+      release(nodes_[t].right);
+      nodes_[t] = node{};
+      free_.push_back(t);
+   }
+
+   std::pair<source_buffer::index_type, source_buffer::index_type>
+   source_buffer::split(index_type const t, std::size_t const offset)
+   {
+      if (t == none) {
+         return {none, none};
+      }
+
+      auto const left_bytes = bytes(nodes_[t].left);
+      auto const length = nodes_[t].text.size();
+      if (offset <= left_bytes) {
+         auto const [before, after] = split(nodes_[t].left, offset);
+         nodes_[t].left = after;
+         update(t);
+         return {before, t};
+      }
+
+      if (offset >= left_bytes + length) {
+         auto const [before, after] = split(nodes_[t].right, offset - left_bytes - length);
+         nodes_[t].right = before;
+         update(t);
+         return {t, after};
+      }
+
+      // The split lands inside this node's chunk, so the tail moves into a node of its own. The
+      // tail is copied out first, because making a node may reallocate nodes_.
+      auto const cut = offset - left_bytes;
+      auto const tail_text = nodes_[t].text.substr(cut);
+      auto const tail = make_node(tail_text);
+      auto const right = nodes_[t].right;
+      nodes_[t].text.resize(cut);
+      nodes_[t].text_newlines -= nodes_[tail].text_newlines;
+      nodes_[t].right = none;
+      update(t);
+      return {t, merge(tail, right)};
+   }
+
+   source_buffer::index_type source_buffer::merge(index_type const left, index_type const right) noexcept
+   {
+      if (left == none) {
+         return right;
+      }
+      if (right == none) {
+         return left;
+      }
+
+      if (nodes_[left].priority > nodes_[right].priority) {
+         nodes_[left].right = merge(nodes_[left].right, right);
+         update(left);
+         return left;
+      }
+
+      nodes_[right].left = merge(left, nodes_[right].left);
+      update(right);
+      return right;
+   }
+
+   bool source_buffer::insert_in_place(index_type const t, std::size_t const offset,
+      std::u8string_view const text)
+   {
+      if (t == none) {
+         return false;
+      }
+
+      auto const left_bytes = bytes(nodes_[t].left);
+      auto& n = nodes_[t];
+      auto inserted = false;
+      if (offset < left_bytes) {
+         inserted = insert_in_place(n.left, offset, text);
+      }
+      else if (offset <= left_bytes + n.text.size()) {
+         inserted = n.text.size() + text.size() <= max_chunk_size;
+         if (inserted) {
+            n.text.insert(offset - left_bytes, text);
+            n.text_newlines += count_newlines(text);
+         }
+      }
+      else {
+         inserted = insert_in_place(n.right, offset - left_bytes - n.text.size(), text);
+      }
+
+      if (inserted) {
+         update(t);
+      }
+      return inserted;
+   }
+
+   void source_buffer::coalesce(std::size_t const offset)
+   {
+      if (offset == 0 or offset >= size()) {
+         return;
+      }
+
+      auto const before = chunk_at(offset - 1);
+      auto const after = chunk_at(offset);
+      if (before.offset == after.offset or before.text.size() + after.text.size() > max_chunk_size) {
+         return;
+      }
+
+      auto combined = std::u8string{before.text};
+      combined += after.text;
+      auto const [front, rest] = split(root_, before.offset);
+      auto const [middle, back] = split(rest, combined.size());
+      release(middle);
+      root_ = merge(merge(front, make_node(combined)), back);
+   }
+} // namespace lingua
@@ -0,0 +1,406 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/hash_source.hpp"
+#include "lingua/utility/contract.hpp"
+#include "lingua/utility/simd.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#ifdef LINGUA_SIMD_X86
+#   include <immintrin.h>
+#endif // LINGUA_SIMD_X86
+
+// The hash accumulates 64-byte stripes into eight 64-bit lanes, in the style of XXH3: each lane adds
+// the product of the low and high halves of its data (mixed with a secret), and its neighbour adds
+// the raw data. The lanes are scrambled every 1 KiB and folded into two 64-bit halves at the end.
+// The vector implementations compute exactly the same lanes as the scalar one, so the digest does
+// not depend on the machine that computed it.
+namespace {
+   using lingua::detail_hash_source::make_constants;
+   using lingua::source_digest;
+   using lingua::source_hasher;
+
+   constexpr auto lanes = std::size_t{8};
+   constexpr auto stripe_size = source_hasher::stripe_size;
+   constexpr auto stripes_per_block = std::size_t{16};
+
+   constexpr auto accumulate_secret = make_constants<lanes>(0x61636375);
+   constexpr auto scramble_secret = make_constants<lanes>(0x73637261);
+   constexpr auto low_secret = make_constants<lanes>(0x6c6f77);
+   constexpr auto high_secret = make_constants<lanes>(0x68696768);
+
+   constexpr auto prime32 = std::uint64_t{0x9e3779b1};
+   constexpr auto prime64_1 = std::uint64_t{0x9e3779b185ebca87};
+   constexpr auto prime64_2 = std::uint64_t{0xc2b2ae3d27d4eb4f};
+
+   constexpr auto initial_accumulators = std::array<std::uint64_t, lanes>{
+      0x00000000c2b2ae3d, 0x9e3779b185ebca87, 0xc2b2ae3d27d4eb4f, 0x165667b19e3779f9,
+      0x85ebca77c2b2ae63, 0x0000000085ebca77, 0x27d4eb2f165667c5, 0x000000009e3779b1,
+   };
+
+   using accumulators = std::array<std::uint64_t, lanes>;
+
+   [[nodiscard]] std::uint64_t multiply_fold(std::uint64_t const x, std::uint64_t const y) noexcept
+   {
+      // portable 64x64->128 multiply, since __int128 isn't standard C++
+      auto const x_low = x & 0xffffffffU;
+      auto const x_high = x >> 32U;
+      auto const y_low = y & 0xffffffffU;
+      auto const y_high = y >> 32U;
+
+      auto const low_low = x_low * y_low;
+      auto const high_low = x_high * y_low;
+      auto const low_high = x_low * y_high;
+      auto const high_high = x_high * y_high;
+
+      auto const cross = (low_low >> 32U) + (high_low & 0xffffffffU) + low_high;
+      auto const upper = (high_low >> 32U) + (cross >> 32U) + high_high;
+      auto const lower = (cross << 32U) | (low_low & 0xffffffffU);
+      return upper ^ lower;
+   }
+
+   [[nodiscard]] std::uint64_t avalanche(std::uint64_t h) noexcept
+   {
+      h ^= h >> 37U;
+      h *= 0x165667919e3779f9;
+      return h ^ (h >> 32U);
+   }
+
+#if defined(__SSE2__)
+   /// \brief Processes `count` stripes, starting at the `first_stripe`th stripe of the source.
+   /// \returns The number of newlines in the stripes, if requested.
+   ///
+   template<bool CountNewlines>
+   std::size_t accumulate_baseline(accumulators& acc, char8_t const* data, std::size_t const count,
+      std::size_t const first_stripe) noexcept
+   {
+      auto load = [](void const* const p) noexcept {
+         return _mm_loadu_si128(static_cast<__m128i const*>(p));
+      };
+      auto store = [](void* const p, __m128i const x) noexcept {
+         _mm_storeu_si128(static_cast<__m128i*>(p), x);
+      };
+
+      auto acc0 = load(acc.data());
+      auto acc1 = load(acc.data() + 2);
+      auto acc2 = load(acc.data() + 4);
+      auto acc3 = load(acc.data() + 6);
+      auto const newline = _mm_set1_epi8('\n');
+      auto newlines = std::size_t{0};
+
+      auto step = [&](__m128i const a, std::size_t const lane) noexcept {
+         auto const d = load(data + 8 * lane);
+         if constexpr (CountNewlines) {
+            auto const mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(d, newline)));
+            newlines += static_cast<std::size_t>(std::popcount(mask));
+         }
+         auto const keyed = _mm_xor_si128(d, load(accumulate_secret.data() + lane));
+         auto const product = _mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32));
+         auto const swapped = _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+         return _mm_add_epi64(a, _mm_add_epi64(product, swapped));
+      };
+      auto scramble = [load](__m128i const a, std::size_t const lane) noexcept {
+         auto const mixed = _mm_xor_si128(_mm_xor_si128(a, _mm_srli_epi64(a, 47)),
+            load(scramble_secret.data() + lane));
+         auto const p = _mm_set1_epi64x(static_cast<long long>(prime32));
+         auto const low = _mm_mul_epu32(mixed, p);
+         auto const high = _mm_mul_epu32(_mm_srli_epi64(mixed, 32), p);
+         return _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+      };
+
+      for (auto i = std::size_t{0}; i < count; ++i, data += stripe_size) {
+         acc0 = step(acc0, 0);
+         acc1 = step(acc1, 2);
+         acc2 = step(acc2, 4);
+         acc3 = step(acc3, 6);
+
+         if ((first_stripe + i + 1) % stripes_per_block == 0) {
+            acc0 = scramble(acc0, 0);
+            acc1 = scramble(acc1, 2);
+            acc2 = scramble(acc2, 4);
+            acc3 = scramble(acc3, 6);
+         }
+      }
+
+      store(acc.data(), acc0);
+      store(acc.data() + 2, acc1);
+      store(acc.data() + 4, acc2);
+      store(acc.data() + 6, acc3);
+      return newlines;
+   }
+#else
+   [[nodiscard]] std::uint64_t load64(char8_t const* const p) noexcept
+   {
+      auto result = std::uint64_t{};
+      std::memcpy(&result, p, sizeof(result));
+      if constexpr (std::endian::native == std::endian::big) {
+         auto swapped = std::uint64_t{0};
+         for (auto i = 0U; i < 8U; ++i) {
+            swapped = (swapped << 8U) | ((result >> (8U * i)) & 0xffU);
+         }
+         result = swapped;
+      }
+      return result;
+   }
+
+   /// \brief Counts the bytes in `word` that are '\n'.
+   ///
+   [[nodiscard]] int count_newlines(std::uint64_t const word) noexcept
+   {
+      constexpr auto newlines = std::uint64_t{0x0a0a0a0a0a0a0a0a};
+      constexpr auto low_seven_bits = std::uint64_t{0x7f7f7f7f7f7f7f7f};
+      auto const x = word ^ newlines;
+      auto const t = ~(((x & low_seven_bits) + low_seven_bits) | x | low_seven_bits);
+      return std::popcount(t);
+   }
+
+   void scramble_scalar(accumulators& acc) noexcept
+   {
+      for (auto i = std::size_t{0}; i < lanes; ++i) {
+         acc[i] = (acc[i] ^ (acc[i] >> 47U) ^ scramble_secret[i]) * prime32;
+      }
+   }
+
+   template<bool CountNewlines>
+   [[nodiscard]] std::size_t
+   accumulate_stripe_scalar(accumulators& acc, char8_t const* const stripe) noexcept
+   {
+      auto newlines = 0;
+      for (auto i = std::size_t{0}; i < lanes; ++i) {
+         auto const data = load64(stripe + 8 * i);
+         auto const keyed = data ^ accumulate_secret[i];
+         acc[i ^ 1U] += data;
+         acc[i] += (keyed & 0xffffffffU) * (keyed >> 32U);
+         if constexpr (CountNewlines) {
+            newlines += count_newlines(data);
+         }
+      }
+      return static_cast<std::size_t>(newlines);
+   }
+
+   template<bool CountNewlines>
+   std::size_t accumulate_baseline(accumulators& acc, char8_t const* data, std::size_t const count,
+      std::size_t const first_stripe) noexcept
+   {
+      auto newlines = std::size_t{0};
+      for (auto i = std::size_t{0}; i < count; ++i, data += stripe_size) {
+         newlines += accumulate_stripe_scalar<CountNewlines>(acc, data);
+         if ((first_stripe + i + 1) % stripes_per_block == 0) {
+            scramble_scalar(acc);
+         }
+      }
+      return newlines;
+   }
+#endif // defined(__SSE2__)
+} // namespace
+
+#ifdef LINGUA_SIMD_X86
+LINGUA_SIMD_BEGIN_TARGET("avx2")
+namespace {
+   namespace avx2 {
+      [[nodiscard]] __m256i load(void const* const p) noexcept
+      { return _mm256_loadu_si256(static_cast<__m256i const*>(p)); }
+
+      void store(void* const p, __m256i const x) noexcept
+      { _mm256_storeu_si256(static_cast<__m256i*>(p), x); }
+
+      [[nodiscard]] __m256i step(__m256i const a, __m256i const d, __m256i const secret) noexcept
+      {
+         auto const keyed = _mm256_xor_si256(d, secret);
+         auto const product = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+         auto const swapped = _mm256_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+         return _mm256_add_epi64(a, _mm256_add_epi64(product, swapped));
+      }
+
+      [[nodiscard]] __m256i scramble(__m256i const a, __m256i const secret) noexcept
+      {
+         auto const mixed = _mm256_xor_si256(_mm256_xor_si256(a, _mm256_srli_epi64(a, 47)), secret);
+         auto const p = _mm256_set1_epi64x(static_cast<long long>(prime32));
+         auto const low = _mm256_mul_epu32(mixed, p);
+         auto const high = _mm256_mul_epu32(_mm256_srli_epi64(mixed, 32), p);
+         return _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+      }
+
+      [[nodiscard]] std::size_t count_newlines(__m256i const d, __m256i const newline) noexcept
+      {
+         auto const matches = _mm256_cmpeq_epi8(d, newline);
+         return static_cast<std::size_t>(std::popcount(static_cast<unsigned>(
+            _mm256_movemask_epi8(matches))));
+      }
+
+      template<bool CountNewlines>
+      std::size_t accumulate(accumulators& acc, char8_t const* data, std::size_t const count,
+         std::size_t const first_stripe) noexcept
+      {
+         auto acc0 = load(acc.data());
+         auto acc1 = load(acc.data() + 4);
+         auto const secret0 = load(accumulate_secret.data());
+         auto const secret1 = load(accumulate_secret.data() + 4);
+         auto const newline = _mm256_set1_epi8('\n');
+         auto newlines = std::size_t{0};
+
+         for (auto i = std::size_t{0}; i < count; ++i, data += stripe_size) {
+            auto const d0 = load(data);
+            auto const d1 = load(data + 32);
+            acc0 = step(acc0, d0, secret0);
+            acc1 = step(acc1, d1, secret1);
+            if constexpr (CountNewlines) {
+               newlines += count_newlines(d0, newline) + count_newlines(d1, newline);
+            }
+
+            if ((first_stripe + i + 1) % stripes_per_block == 0) {
+               acc0 = scramble(acc0, load(scramble_secret.data()));
+               acc1 = scramble(acc1, load(scramble_secret.data() + 4));
+            }
+         }
+
+         store(acc.data(), acc0);
+         store(acc.data() + 4, acc1);
+         return newlines;
+      }
+   } // namespace avx2
+} // namespace
+LINGUA_SIMD_END_TARGET
+#endif // LINGUA_SIMD_X86
+
+namespace {
+   template<bool CountNewlines>
+   std::size_t accumulate(accumulators& acc, char8_t const* const data, std::size_t const count,
+      std::size_t const first_stripe) noexcept
+   {
+      using kernel = std::size_t(accumulators&, char8_t const*, std::size_t, std::size_t) noexcept;
+#ifdef LINGUA_SIMD_X86
+      constexpr auto variants = lingua::simd_variants<kernel>{accumulate_baseline<CountNewlines>,
+         accumulate_baseline<CountNewlines>, avx2::accumulate<CountNewlines>,
+         avx2::accumulate<CountNewlines>};
+#else
+      constexpr auto variants = lingua::simd_variants<kernel>{accumulate_baseline<CountNewlines>,
+         accumulate_baseline<CountNewlines>, accumulate_baseline<CountNewlines>,
+         accumulate_baseline<CountNewlines>};
+#endif // LINGUA_SIMD_X86
+      return lingua::select_variant(variants)(acc, data, count, first_stripe);
+   }
+
+   [[nodiscard]] source_digest finalise(accumulators const& acc, std::uint64_t const size) noexcept
+   {
+      auto low = size * prime64_1;
+      auto high = ~size * prime64_2;
+      for (auto i = std::size_t{0}; i < lanes; i += 2) {
+         low += multiply_fold(acc[i] ^ low_secret[i], acc[i + 1] ^ low_secret[i + 1]);
+         high += multiply_fold(acc[i] ^ high_secret[i], acc[i + 1] ^ high_secret[i + 1]);
+      }
+      return source_digest{avalanche(low), avalanche(high)};
+   }
+
+   /// \brief Hashes `source` in one pass, optionally counting its newlines at the same time.
+   ///
+   template<bool CountNewlines>
+   [[nodiscard]] lingua::hashed_lines hash_impl(std::u8string_view const source) noexcept
+   {
+      auto acc = initial_accumulators;
+      auto const stripes = source.size() / stripe_size;
+      auto newlines = accumulate<CountNewlines>(acc, source.data(), stripes, 0);
+
+      auto const tail = source.substr(stripes * stripe_size);
+      if (not tail.empty()) {
+         auto padded = std::array<char8_t, stripe_size>{};
+         std::copy(tail.begin(), tail.end(), padded.begin());
+         newlines += accumulate<CountNewlines>(acc, padded.data(), 1, stripes);
+      }
+      return lingua::hashed_lines{finalise(acc, source.size()), newlines};
+   }
+} // namespace
+
+namespace lingua {
+   source_hasher::source_hasher() noexcept
+      : accumulators_{initial_accumulators}
+   {}
+
+   void source_hasher::update(std::u8string_view source) noexcept
+   {
+      size_ += source.size();
+      if (buffered_ > 0) {
+         auto const taken = std::min(source.size(), stripe_size - buffered_);
+         std::copy_n(source.begin(), taken, buffer_.begin() + static_cast<std::ptrdiff_t>(buffered_));
+         buffered_ += taken;
+         source.remove_prefix(taken);
+         if (buffered_ < stripe_size) {
+            return;
+         }
+         (void)accumulate<false>(accumulators_, buffer_.data(), 1, stripes_++);
+         buffered_ = 0;
+      }
+
+      auto const stripes = source.size() / stripe_size;
+      (void)accumulate<false>(accumulators_, source.data(), stripes, stripes_);
+      stripes_ += stripes;
+      source.remove_prefix(stripes * stripe_size);
+
+      std::copy(source.begin(), source.end(), buffer_.begin());
+      buffered_ = source.size();
+   }
+
+   source_digest source_hasher::digest() const noexcept
+   {
+      auto acc = accumulators_;
+      if (buffered_ > 0) {
+         auto padded = std::array<char8_t, stripe_size>{};
+         std::copy_n(buffer_.begin(), buffered_, padded.begin());
+         (void)accumulate<false>(acc, padded.data(), 1, stripes_);
+      }
+      return finalise(acc, size_);
+   }
+
+   source_digest hash_source(std::u8string_view const source) noexcept
+   { return hash_impl<false>(source).digest; }
+
+   hashed_lines hash_and_count_lines(std::u8string_view const source) noexcept
+   { return hash_impl<true>(source); }
+
+   std::vector<source_chunk> chunk_source(std::u8string_view const source, chunking_options const& options)
+   {
+      LINGUA_EXPECTS(options.min_size <= options.average_size);
+      LINGUA_EXPECTS(options.average_size <= options.max_size);
+      LINGUA_EXPECTS(std::has_single_bit(options.average_size));
+
+      // Test the high bits of the gear hash: they depend on the last 64 bytes, whereas the low bits
+      // depend on only the last few.
+      auto const bits = static_cast<unsigned>(std::countr_zero(options.average_size));
+      auto const mask = bits == 0 ? std::uint64_t{0} : ~std::uint64_t{0} << (64U - bits);
+
+      auto result = std::vector<source_chunk>{};
+      result.reserve(source.size() / options.average_size + 1);
+      auto start = std::size_t{0};
+      while (start < source.size()) {
+         auto const limit = std::min(source.size(), start + options.max_size);
+         auto end = limit;
+         auto hash = gear_hash{};
+         for (auto i = start; i < limit; ++i) {
+            hash.push(source[i]);
+            if (i + 1 - start >= options.min_size and (hash.value() & mask) == 0) {
+               end = i + 1;
+               break;
+            }
+         }
+
+         auto const chunk = source.substr(start, end - start);
+         result.push_back(source_chunk{start, chunk.size(), hash_source_64(chunk)});
+         start = end;
+      }
+      return result;
+   }
+} // namespace lingua
@@ -0,0 +1,96 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/simd.hpp"
+#include "lingua/utility/contract.hpp"
+#include <atomic>
+#include <cstdlib>
+
+namespace {
+   using lingua::simd_level;
+
+   constexpr auto names = std::array<std::string_view, lingua::simd_level_count>{
+      "scalar", "sse4.2", "avx2", "avx512"};
+
+   [[nodiscard]] simd_level detect() noexcept
+   {
+#ifdef LINGUA_SIMD_X86
+      // __builtin_cpu_supports also checks that the operating system saves the wider registers.
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f") and __builtin_cpu_supports("avx512bw")
+          and __builtin_cpu_supports("avx512vl")) {
+         return simd_level::avx512;
+      }
+      if (__builtin_cpu_supports("avx2")) {
+         return simd_level::avx2;
+      }
+      if (__builtin_cpu_supports("sse4.2")) {
+         return simd_level::sse4_2;
+      }
+#endif // LINGUA_SIMD_X86
+      return simd_level::scalar;
+   }
+
+   [[nodiscard]] simd_level initial_level() noexcept
+   {
+      auto const supported = lingua::supported_simd_level();
+      auto const* const name = std::getenv("LINGUA_SIMD");
+      if (name == nullptr) {
+         return supported;
+      }
+
+      auto const requested = lingua::parse_simd_level(name);
+      return requested and *requested < supported ? *requested : supported;
+   }
+
+   /// \brief The level is only ever changed by tests, but it's atomic so that changing it while
+   ///        another thread is loading files isn't a data race.
+   ///
+   [[nodiscard]] std::atomic<simd_level>& active_level() noexcept
+   {
+      static auto level = std::atomic<simd_level>{initial_level()};
+      return level;
+   }
+} // namespace
+
+namespace lingua {
+   simd_level supported_simd_level() noexcept
+   {
+      static auto const supported = detect();
+      return supported;
+   }
+
+   simd_level active_simd_level() noexcept
+   { return active_level().load(std::memory_order_relaxed); }
+
+   simd_level set_simd_level(simd_level const level) noexcept
+   {
+      LINGUA_EXPECTS(level <= supported_simd_level());
+      return active_level().exchange(level, std::memory_order_relaxed);
+   }
+
+   std::string_view simd_level_name(simd_level const level) noexcept
+   { return names[static_cast<std::size_t>(level)]; }
+
+   std::optional<simd_level> parse_simd_level(std::string_view const name) noexcept
+   {
+      for (auto i = std::size_t{0}; i < names.size(); ++i) {
+         if (names[i] == name) {
+            return static_cast<simd_level>(i);
+         }
+      }
+      return std::nullopt;
+   }
+} // namespace lingua
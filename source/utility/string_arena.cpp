@@ -0,0 +1,70 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/string_arena.hpp"
+#include "lingua/utility/contract.hpp"
+#include <algorithm>
+
+namespace lingua {
+   string_arena::string_arena(std::size_t const block_size) noexcept
+      : block_size_{block_size}
+   {
+      LINGUA_EXPECTS(block_size > 0);
+   }
+
+   std::span<char8_t> string_arena::allocate(std::size_t const size)
+   {
+      last_allocation_ = size;
+      bytes_used_ += size;
+      last_oversized_ = size > block_size_;
+      if (last_oversized_) {
+         // An oversized request gets a block of its own, and the current block carries on serving
+         // smaller ones.
+         blocks_.push_back(std::make_unique_for_overwrite<char8_t[]>(size));
+         return std::span{blocks_.back().get(), size};
+      }
+
+      if (size > remaining_) {
+         blocks_.push_back(std::make_unique_for_overwrite<char8_t[]>(block_size_));
+         next_ = blocks_.back().get();
+         remaining_ = block_size_;
+      }
+
+      auto* const storage = next_;
+      next_ += size;
+      remaining_ -= size;
+      return std::span{storage, size};
+   }
+
+   void string_arena::shrink(std::size_t const size) noexcept
+   {
+      LINGUA_EXPECTS(size <= last_allocation_);
+      last_allocation_ -= size;
+      bytes_used_ -= size;
+
+      // Space at the end of an oversized block can't be handed out again.
+      if (not last_oversized_) {
+         next_ -= size;
+         remaining_ += size;
+      }
+   }
+
+   std::u8string_view string_arena::store(std::u8string_view const text)
+   {
+      auto const storage = allocate(text.size());
+      std::ranges::copy(text, storage.begin());
+      return std::u8string_view{storage.data(), storage.size()};
+   }
+} // namespace lingua
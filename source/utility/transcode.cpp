@@ -0,0 +1,330 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/transcode.hpp"
+#include "lingua/utility/contract.hpp"
+#include "lingua/utility/simd.hpp"
+#include <array>
+#include <cstddef>
+
+#ifdef LINGUA_SIMD_X86
+#   include <immintrin.h>
+#endif // LINGUA_SIMD_X86
+
+namespace {
+   using lingua::source_encoding;
+
+   /// \brief Writes `c` as UTF-8, without checking that it's a Unicode scalar value.
+   /// \returns One past the last byte written.
+   ///
+   [[nodiscard]] char8_t* encode(char32_t const c, char8_t* out) noexcept
+   {
+      if (c < 0x80) {
+         *out++ = static_cast<char8_t>(c);
+      }
+      else if (c < 0x800) {
+         *out++ = static_cast<char8_t>(0xc0U | (c >> 6U));
+         *out++ = static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else if (c < 0x10000) {
+         *out++ = static_cast<char8_t>(0xe0U | (c >> 12U));
+         *out++ = static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         *out++ = static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else {
+         *out++ = static_cast<char8_t>(0xf0U | (c >> 18U));
+         *out++ = static_cast<char8_t>(0x80U | ((c >> 12U) & 0x3fU));
+         *out++ = static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         *out++ = static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      return out;
+   }
+
+   /// \brief The code units of a UTF-16 source, in either byte order.
+   ///
+   class utf16_units {
+   public:
+      explicit utf16_units(std::u8string_view const bytes, bool const little_endian) noexcept
+         : bytes_{bytes}
+         , little_endian_{little_endian}
+      {}
+
+      [[nodiscard]] std::size_t size() const noexcept
+      { return bytes_.size() / 2; }
+
+      [[nodiscard]] char16_t operator[](std::size_t const i) const noexcept
+      {
+         auto const first = static_cast<unsigned>(bytes_[2 * i]);
+         auto const second = static_cast<unsigned>(bytes_[2 * i + 1]);
+         return static_cast<char16_t>(little_endian_ ? first | (second << 8U)
+                                                     : (first << 8U) | second);
+      }
+
+      [[nodiscard]] char8_t const* data() const noexcept
+      { return bytes_.data(); }
+
+      [[nodiscard]] bool little_endian() const noexcept
+      { return little_endian_; }
+
+   private:
+      std::u8string_view bytes_;
+      bool little_endian_;
+   };
+
+   [[nodiscard]] constexpr bool is_high_surrogate(char16_t const u) noexcept
+   { return 0xd800 <= u and u <= 0xdbff; }
+
+   [[nodiscard]] constexpr bool is_low_surrogate(char16_t const u) noexcept
+   { return 0xdc00 <= u and u <= 0xdfff; }
+
+   /// \brief Transcodes the character that starts at unit `i`, which takes two units if it's a
+   ///        surrogate pair and one otherwise.
+   /// \returns The unit after the character.
+   ///
+   [[nodiscard]] std::size_t
+   transcode_character(utf16_units const& units, std::size_t const i, char8_t*& out) noexcept
+   // [[expects: i < units.size()]]
+   {
+      auto const u = units[i];
+      if (is_high_surrogate(u) and i + 1 < units.size() and is_low_surrogate(units[i + 1])) {
+         auto const c = 0x10000 + ((char32_t{u} - 0xd800) << 10U) + (units[i + 1] - 0xdc00U);
+         out = encode(c, out);
+         return i + 2;
+      }
+      out = encode(u, out);
+      return i + 1;
+   }
+
+   /// \brief The vectorised loops store whole blocks, so the result has room for one more block
+   ///        than the longest it can be, and is trimmed to fit at the end.
+   ///
+   constexpr auto slack = std::size_t{16};
+
+   /// \brief Transcodes the Latin-1 in `bytes`, starting at `i`, one character at a time.
+   /// \returns One past the last byte written.
+   ///
+   [[nodiscard]] char8_t*
+   latin1_tail(std::u8string_view const bytes, std::size_t i, char8_t* out) noexcept
+   {
+      for (; i < bytes.size(); ++i) {
+         out = encode(bytes[i], out);
+      }
+      return out;
+   }
+
+   /// \brief Transcodes `units`, starting at `i`, one character at a time.
+   /// \returns One past the last byte written.
+   ///
+   [[nodiscard]] char8_t* utf16_tail(utf16_units const& units, std::size_t i, char8_t* out) noexcept
+   {
+      while (i < units.size()) {
+         i = transcode_character(units, i, out);
+      }
+      return out;
+   }
+
+   [[nodiscard]] char8_t* latin1_unvectorised(std::u8string_view const bytes, char8_t* const out)
+   noexcept
+   { return latin1_tail(bytes, 0, out); }
+
+   [[nodiscard]] char8_t* utf16_unvectorised(utf16_units const& units, char8_t* const out) noexcept
+   { return utf16_tail(units, 0, out); }
+
+#ifdef LINGUA_SIMD_X86
+   constexpr auto lanes = std::size_t{8};
+
+   /// \brief For each set of lanes that need two bytes, the shuffle that keeps the first byte of
+   ///        every lane and the second byte only of those lanes, and how many bytes that keeps.
+   ///
+   struct compression {
+      std::array<std::array<char8_t, 16>, 256> shuffles;
+      std::array<std::uint8_t, 256> lengths;
+   };
+
+   constexpr auto compressions = [] {
+      auto result = compression{};
+      for (auto mask = 0U; mask < 256; ++mask) {
+         auto& shuffle = result.shuffles[mask];
+         shuffle.fill(0x80);
+         auto k = std::size_t{0};
+         for (auto lane = 0U; lane < lanes; ++lane) {
+            shuffle[k++] = static_cast<char8_t>(2 * lane);
+            if ((mask >> lane) & 1U) {
+               shuffle[k++] = static_cast<char8_t>(2 * lane + 1);
+            }
+         }
+         result.lengths[mask] = static_cast<std::uint8_t>(k);
+      }
+      return result;
+   }();
+#endif // LINGUA_SIMD_X86
+} // namespace
+
+#ifdef LINGUA_SIMD_X86
+LINGUA_SIMD_BEGIN_TARGET("sse4.2")
+namespace {
+   namespace sse4_2 {
+      [[nodiscard]] __m128i load(char8_t const* const p) noexcept
+      { return _mm_loadu_si128(static_cast<__m128i const*>(static_cast<void const*>(p))); }
+
+      void store(char8_t* const p, __m128i const x) noexcept
+      { _mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(p)), x); }
+
+      [[nodiscard]] __m128i broadcast(std::uint16_t const x) noexcept
+      { return _mm_set1_epi16(static_cast<short>(x)); }
+
+      /// \brief Writes the eight characters in `units` as UTF-8.
+      /// \returns One past the last byte written. Up to sixteen bytes are stored, so there must
+      ///          be room for them even if fewer are needed.
+      ///
+      [[nodiscard]] char8_t* transcode_block(__m128i const units, char8_t* const out) noexcept
+      // [[expects: every unit is less than 0x800]]
+      {
+         auto const ascii = _mm_cmplt_epi16(units, broadcast(0x80));
+         auto const lead = _mm_or_si128(_mm_srli_epi16(units, 6), broadcast(0xc0));
+         auto const trail = _mm_or_si128(_mm_and_si128(units, broadcast(0x3f)), broadcast(0x80));
+         auto const two_bytes = _mm_or_si128(lead, _mm_slli_epi16(trail, 8));
+         auto const utf8 = _mm_blendv_epi8(two_bytes, units, ascii);
+
+         auto const mask = ~static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_packs_epi16(ascii, _mm_setzero_si128()))) & 0xffU;
+         store(out, _mm_shuffle_epi8(utf8, load(compressions.shuffles[mask].data())));
+         return out + compressions.lengths[mask];
+      }
+
+      [[nodiscard]] bool fits_in_two_bytes(__m128i const units) noexcept
+      { return _mm_testz_si128(units, broadcast(0xf800)) != 0; }
+
+      [[nodiscard]] __m128i load_units(utf16_units const& units, std::size_t const i) noexcept
+      {
+         auto const x = load(units.data() + 2 * i);
+         if (units.little_endian()) {
+            return x;
+         }
+         auto const swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+         return _mm_shuffle_epi8(x, swap);
+      }
+
+      [[nodiscard]] char8_t* latin1(std::u8string_view const bytes, char8_t* out) noexcept
+      {
+         auto i = std::size_t{0};
+         for (; bytes.size() - i >= 2 * lanes; i += 2 * lanes) {
+            auto const block = load(bytes.data() + i);
+            if (_mm_movemask_epi8(block) == 0) {
+               store(out, block);
+               out += 2 * lanes;
+               continue;
+            }
+            out = transcode_block(_mm_cvtepu8_epi16(block), out);
+            out = transcode_block(_mm_cvtepu8_epi16(_mm_srli_si128(block, 8)), out);
+         }
+         return latin1_tail(bytes, i, out);
+      }
+
+      [[nodiscard]] char8_t* utf16(utf16_units const& units, char8_t* out) noexcept
+      {
+         auto i = std::size_t{0};
+         while (units.size() - i >= lanes) {
+            if (auto const block = load_units(units, i); fits_in_two_bytes(block)) {
+               out = transcode_block(block, out);
+               i += lanes;
+               continue;
+            }
+
+            // A surrogate pair may straddle the end of the block, so this can finish one unit
+            // past it.
+            for (auto const end = i + lanes; i < end;) {
+               i = transcode_character(units, i, out);
+            }
+         }
+         return utf16_tail(units, i, out);
+      }
+   } // namespace sse4_2
+} // namespace
+LINGUA_SIMD_END_TARGET
+#endif // LINGUA_SIMD_X86
+
+namespace {
+   // Neither kernel has a wider variant: squeezing out the bytes of ASCII characters doesn't
+   // cross 128-bit lanes, and AVX2's shuffles can't.
+#ifdef LINGUA_SIMD_X86
+   constexpr auto latin1_variants =
+      lingua::simd_variants<char8_t*(std::u8string_view, char8_t*) noexcept>{
+         latin1_unvectorised, sse4_2::latin1, sse4_2::latin1, sse4_2::latin1};
+
+   constexpr auto utf16_variants = lingua::simd_variants<char8_t*(utf16_units const&, char8_t*)
+      noexcept>{utf16_unvectorised, sse4_2::utf16, sse4_2::utf16, sse4_2::utf16};
+#else
+   constexpr auto latin1_variants =
+      lingua::simd_variants<char8_t*(std::u8string_view, char8_t*) noexcept>{
+         latin1_unvectorised, latin1_unvectorised, latin1_unvectorised, latin1_unvectorised};
+
+   constexpr auto utf16_variants = lingua::simd_variants<char8_t*(utf16_units const&, char8_t*)
+      noexcept>{utf16_unvectorised, utf16_unvectorised, utf16_unvectorised, utf16_unvectorised};
+#endif // LINGUA_SIMD_X86
+
+   [[nodiscard]] std::u8string latin1_to_utf8(std::u8string_view const bytes)
+   {
+      auto result = std::u8string(2 * bytes.size() + slack, u8'\0');
+      auto const end = lingua::select_variant(latin1_variants)(bytes, result.data());
+      result.resize(static_cast<std::size_t>(end - result.data()));
+      return result;
+   }
+
+   [[nodiscard]] std::u8string utf16_to_utf8(std::u8string_view bytes, bool const little_endian)
+   {
+      auto const byte_order_mark = little_endian ? u8"\xff\xfe" : u8"\xfe\xff";
+      if (bytes.starts_with(byte_order_mark)) {
+         bytes.remove_prefix(2);
+      }
+
+      auto const units = utf16_units{bytes, little_endian};
+      auto result = std::u8string(3 * units.size() + bytes.size() % 2 + slack, u8'\0');
+      auto end = lingua::select_variant(utf16_variants)(units, result.data());
+      if (bytes.size() % 2 != 0) {
+         *end++ = 0xff;
+      }
+      result.resize(static_cast<std::size_t>(end - result.data()));
+      return result;
+   }
+} // namespace
+
+namespace lingua {
+   source_encoding detect_encoding(std::u8string_view const bytes) noexcept
+   {
+      if (bytes.starts_with(u8"\xff\xfe")) {
+         return source_encoding::utf16_le;
+      }
+      if (bytes.starts_with(u8"\xfe\xff")) {
+         return source_encoding::utf16_be;
+      }
+      return source_encoding::utf8;
+   }
+
+   std::u8string transcode_to_utf8(std::u8string_view const bytes, source_encoding const encoding)
+   {
+      LINGUA_EXPECTS(encoding != source_encoding::automatic);
+      switch (encoding) {
+      case source_encoding::utf16_le:
+         return utf16_to_utf8(bytes, true);
+      case source_encoding::utf16_be:
+         return utf16_to_utf8(bytes, false);
+      case source_encoding::latin1:
+         return latin1_to_utf8(bytes);
+      default:
+         return std::u8string{bytes};
+      }
+   }
+} // namespace lingua
@@ -0,0 +1,320 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/validate_utf8.hpp"
+#include "lingua/utility/simd.hpp"
+#include <array>
+#include <cstring>
+
+#ifdef LINGUA_SIMD_X86
+#   include <immintrin.h>
+#endif // LINGUA_SIMD_X86
+
+// The vectorised check is the "lookup" algorithm from Keiser and Lemire's "Validating UTF-8 In Less
+// Than One Instruction Per Byte". Every error that involves only two adjacent bytes is identified
+// by the high nibble of the first byte, its low nibble, and the high nibble of the second: each
+// nibble selects a set of errors it's consistent with from a sixteen-entry table, and a pair of
+// bytes is in error when all three sets agree. The remaining errors, too few or too many
+// continuation bytes after a three- or four-byte lead, are found by checking that exactly the
+// bytes that must be continuations are.
+namespace {
+   using lingua::utf8_validation;
+
+   [[nodiscard]] constexpr bool is_continuation(char8_t const c) noexcept
+   { return (c & 0xc0U) == 0x80U; }
+
+   /// \brief Returns the length of the sequence that `lead` starts, or zero if `lead` can't start
+   ///        a sequence.
+   ///
+   [[nodiscard]] constexpr std::size_t sequence_length(char8_t const lead) noexcept
+   {
+      if (lead < 0x80) {
+         return 1;
+      }
+      if (lead < 0xc2) {
+         return 0; // a continuation byte, or the lead of an overlong two-byte sequence
+      }
+      if (lead < 0xe0) {
+         return 2;
+      }
+      if (lead < 0xf0) {
+         return 3;
+      }
+      return lead < 0xf5 ? 4 : 0;
+   }
+
+   /// \brief Validates `source` one character at a time, starting at `i`.
+   ///
+   [[nodiscard]] utf8_validation validate_scalar(std::u8string_view const source, std::size_t i)
+   noexcept
+   // [[expects: i is the start of a character]]
+   {
+      auto const fail = [](std::size_t const offset, std::size_t const length) noexcept {
+         return utf8_validation{offset, static_cast<std::uint8_t>(length)};
+      };
+
+      while (i < source.size()) {
+         if (source.size() - i >= 8) {
+            auto word = std::uint64_t{};
+            std::memcpy(&word, source.data() + i, sizeof(word));
+            if ((word & 0x8080808080808080) == 0) {
+               i += 8;
+               continue;
+            }
+         }
+
+         auto const lead = source[i];
+         auto const length = sequence_length(lead);
+         if (length == 0) {
+            return fail(i, 1);
+         }
+
+         // The range of the second byte is what rules out overlong encodings, surrogates, and
+         // values above U+10FFFF.
+         auto second_low = 0x80U;
+         auto second_high = 0xbfU;
+         switch (lead) {
+         case 0xe0:
+            second_low = 0xa0;
+            break;
+         case 0xed:
+            second_high = 0x9f;
+            break;
+         case 0xf0:
+            second_low = 0x90;
+            break;
+         case 0xf4:
+            second_high = 0x8f;
+            break;
+         default:
+            break;
+         }
+
+         for (auto k = std::size_t{1}; k < length; ++k) {
+            if (i + k == source.size()) {
+               return fail(i, k);
+            }
+
+            auto const c = source[i + k];
+            if (k == 1 ? c < second_low or c > second_high : not is_continuation(c)) {
+               return fail(i, k);
+            }
+         }
+         i += length;
+      }
+      return utf8_validation{};
+   }
+
+   /// \brief Returns where to resume decoding so that the character spanning `offset` is seen
+   ///        whole: the start of a character that's unfinished at `offset`, or of a byte that
+   ///        can't start one, or `offset` itself if every character before it is complete.
+   ///
+   [[nodiscard]] std::size_t
+   character_start(std::u8string_view const source, std::size_t const offset) noexcept
+   // [[expects: source.substr(0, offset) is valid UTF-8, except maybe for its last character]]
+   {
+      for (auto k = std::size_t{1}; k <= 3 and k <= offset; ++k) {
+         if (auto const c = source[offset - k]; not is_continuation(c)) {
+            auto const length = sequence_length(c);
+            return length == 0 or length > k ? offset - k : offset;
+         }
+      }
+      return offset;
+   }
+
+   /// \brief Validates `source` one character at a time, for processors without a vectorised
+   ///        variant.
+   ///
+   [[nodiscard]] utf8_validation validate_unvectorised(std::u8string_view const source) noexcept
+   { return validate_scalar(source, 0); }
+
+#ifdef LINGUA_SIMD_X86
+   constexpr std::uint8_t too_short = 1U << 0U;    // 11______ 0_______ or 11______ 11______
+   constexpr std::uint8_t too_long = 1U << 1U;     // 0_______ 10______
+   constexpr std::uint8_t overlong_3 = 1U << 2U;   // 11100000 100_____
+   constexpr std::uint8_t too_large = 1U << 3U;    // 11110100 1001____, or 11110101+ 10______
+   constexpr std::uint8_t surrogate = 1U << 4U;    // 11101101 101_____
+   constexpr std::uint8_t overlong_2 = 1U << 5U;   // 1100000_ 10______
+   constexpr std::uint8_t too_large_1000 = 1U << 6U; // 11110101+ 1000____
+   constexpr std::uint8_t overlong_4 = 1U << 6U;   // 11110000 1000____
+   constexpr std::uint8_t two_continuations = 1U << 7U; // 10______ 10______
+   constexpr std::uint8_t carry = too_short | too_long | two_continuations;
+
+   using table = std::array<std::uint8_t, 16>;
+
+   // Indexed by the high nibble of the first byte.
+   constexpr auto first_high_errors = table{too_long, too_long, too_long, too_long, too_long,
+      too_long, too_long, too_long, two_continuations, two_continuations, two_continuations,
+      two_continuations, too_short | overlong_2, too_short, too_short | overlong_3 | surrogate,
+      too_short | too_large | too_large_1000 | overlong_4};
+
+   // Indexed by the low nibble of the first byte.
+   constexpr auto first_low_errors = table{carry | overlong_3 | overlong_2 | overlong_4,
+      carry | overlong_2, carry, carry, carry | too_large, carry | too_large | too_large_1000,
+      carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+      carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+      carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+      carry | too_large | too_large_1000, carry | too_large | too_large_1000 | surrogate,
+      carry | too_large | too_large_1000, carry | too_large | too_large_1000};
+
+   // Indexed by the high nibble of the second byte.
+   constexpr auto second_high_errors = table{too_short, too_short, too_short, too_short,
+      too_short, too_short, too_short, too_short,
+      too_long | overlong_2 | two_continuations | overlong_3 | too_large_1000 | overlong_4,
+      too_long | overlong_2 | two_continuations | overlong_3 | too_large,
+      too_long | overlong_2 | two_continuations | surrogate | too_large,
+      too_long | overlong_2 | two_continuations | surrogate | too_large, too_short, too_short,
+      too_short, too_short};
+#endif // LINGUA_SIMD_X86
+} // namespace
+
+#ifdef LINGUA_SIMD_X86
+LINGUA_SIMD_BEGIN_TARGET("sse4.2")
+namespace {
+   namespace sse4_2 {
+      using block = __m128i;
+      constexpr auto block_size = std::size_t{16};
+
+      [[nodiscard]] block load(char8_t const* const p) noexcept
+      { return _mm_loadu_si128(static_cast<block const*>(static_cast<void const*>(p))); }
+
+      [[nodiscard]] block load(table const& t) noexcept
+      { return _mm_loadu_si128(static_cast<block const*>(static_cast<void const*>(t.data()))); }
+
+      [[nodiscard]] block broadcast(std::uint8_t const x) noexcept
+      { return _mm_set1_epi8(static_cast<char>(x)); }
+
+      [[nodiscard]] bool is_ascii(block const x) noexcept
+      { return _mm_movemask_epi8(x) == 0; }
+
+      [[nodiscard]] bool any(block const x) noexcept
+      { return _mm_testz_si128(x, x) == 0; }
+
+      [[nodiscard]] block lookup(table const& t, block const index) noexcept
+      { return _mm_shuffle_epi8(load(t), index); }
+
+      [[nodiscard]] block high_nibbles(block const x) noexcept
+      { return _mm_and_si128(_mm_srli_epi16(x, 4), broadcast(0x0f)); }
+
+      [[nodiscard]] block low_nibbles(block const x) noexcept
+      { return _mm_and_si128(x, broadcast(0x0f)); }
+
+      /// \brief Returns `current` shifted up by `n` bytes, with the last `n` bytes of `previous`
+      ///        shifted in.
+      ///
+      template<int n>
+      [[nodiscard]] block shift_in(block const current, block const previous) noexcept
+      { return _mm_alignr_epi8(current, previous, 16 - n); }
+
+      [[nodiscard]] block saturating_subtract(block const x, block const y) noexcept
+      { return _mm_subs_epu8(x, y); }
+
+      [[nodiscard]] block bit_and(block const x, block const y) noexcept
+      { return _mm_and_si128(x, y); }
+
+      [[nodiscard]] block bit_or(block const x, block const y) noexcept
+      { return _mm_or_si128(x, y); }
+
+      [[nodiscard]] block bit_xor(block const x, block const y) noexcept
+      { return _mm_xor_si128(x, y); }
+
+      [[nodiscard]] block zero() noexcept
+      { return _mm_setzero_si128(); }
+
+#      include "validate_utf8_kernel.hpp"
+   } // namespace sse4_2
+} // namespace
+LINGUA_SIMD_END_TARGET
+
+LINGUA_SIMD_BEGIN_TARGET("avx2")
+namespace {
+   namespace avx2 {
+      using block = __m256i;
+      constexpr auto block_size = std::size_t{32};
+
+      [[nodiscard]] block load(char8_t const* const p) noexcept
+      { return _mm256_loadu_si256(static_cast<block const*>(static_cast<void const*>(p))); }
+
+      [[nodiscard]] block load(table const& t) noexcept
+      {
+         auto const half = _mm_loadu_si128(static_cast<__m128i const*>(static_cast<void const*>(
+            t.data())));
+         return _mm256_broadcastsi128_si256(half);
+      }
+
+      [[nodiscard]] block broadcast(std::uint8_t const x) noexcept
+      { return _mm256_set1_epi8(static_cast<char>(x)); }
+
+      [[nodiscard]] bool is_ascii(block const x) noexcept
+      { return _mm256_movemask_epi8(x) == 0; }
+
+      [[nodiscard]] bool any(block const x) noexcept
+      { return _mm256_testz_si256(x, x) == 0; }
+
+      [[nodiscard]] block lookup(table const& t, block const index) noexcept
+      { return _mm256_shuffle_epi8(load(t), index); }
+
+      [[nodiscard]] block high_nibbles(block const x) noexcept
+      { return _mm256_and_si256(_mm256_srli_epi16(x, 4), broadcast(0x0f)); }
+
+      [[nodiscard]] block low_nibbles(block const x) noexcept
+      { return _mm256_and_si256(x, broadcast(0x0f)); }
+
+      /// \brief Returns `current` shifted up by `n` bytes, with the last `n` bytes of `previous`
+      ///        shifted in.
+      ///
+      template<int n>
+      [[nodiscard]] block shift_in(block const current, block const previous) noexcept
+      {
+         auto const straddle = _mm256_permute2x128_si256(previous, current, 0x21);
+         return _mm256_alignr_epi8(current, straddle, 16 - n);
+      }
+
+      [[nodiscard]] block saturating_subtract(block const x, block const y) noexcept
+      { return _mm256_subs_epu8(x, y); }
+
+      [[nodiscard]] block bit_and(block const x, block const y) noexcept
+      { return _mm256_and_si256(x, y); }
+
+      [[nodiscard]] block bit_or(block const x, block const y) noexcept
+      { return _mm256_or_si256(x, y); }
+
+      [[nodiscard]] block bit_xor(block const x, block const y) noexcept
+      { return _mm256_xor_si256(x, y); }
+
+      [[nodiscard]] block zero() noexcept
+      { return _mm256_setzero_si256(); }
+
+#      include "validate_utf8_kernel.hpp"
+   } // namespace avx2
+} // namespace
+LINGUA_SIMD_END_TARGET
+#endif // LINGUA_SIMD_X86
+
+namespace {
+   // There's no AVX-512 variant: the AVX2 one already runs at close to the speed of a copy.
+   constexpr auto variants = lingua::simd_variants<utf8_validation(std::u8string_view) noexcept>{
+#ifdef LINGUA_SIMD_X86
+      validate_unvectorised, sse4_2::validate, avx2::validate, avx2::validate,
+#else
+      validate_unvectorised, validate_unvectorised, validate_unvectorised, validate_unvectorised,
+#endif // LINGUA_SIMD_X86
+   };
+} // namespace
+
+namespace lingua {
+   utf8_validation validate_utf8(std::u8string_view const source) noexcept
+   { return select_variant(variants)(source); }
+} // namespace lingua
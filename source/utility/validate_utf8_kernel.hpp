@@ -0,0 +1,82 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// The part of validate_utf8 that's written in terms of blocks. validate_utf8.cpp includes it once
+// for each instruction set, in a namespace that defines `block`, `block_size`, and the operations
+// on blocks, so it deliberately has no include guard.
+//
+
+   /// \brief Returns a non-zero block if `current` holds an error, given the block before it.
+   ///
+   [[nodiscard]] block find_errors(block const current, block const previous) noexcept
+   {
+      auto const previous_1 = shift_in<1>(current, previous);
+      auto const pair_errors = bit_and(bit_and(lookup(first_high_errors, high_nibbles(previous_1)),
+                                          lookup(first_low_errors, low_nibbles(previous_1))),
+         lookup(second_high_errors, high_nibbles(current)));
+
+      // A byte must be a continuation if it's the third byte after a 111_____ lead or the fourth
+      // after a 1111____ lead. Only those leads keep their high bit after the subtractions.
+      auto const third =
+         saturating_subtract(shift_in<2>(current, previous), broadcast(0xe0 - 0x80));
+      auto const fourth =
+         saturating_subtract(shift_in<3>(current, previous), broadcast(0xf0 - 0x80));
+      auto const must_continue = bit_and(bit_or(third, fourth), broadcast(0x80));
+
+      // two_continuations is the high bit, so a continuation that's required cancels it out.
+      return bit_xor(must_continue, pair_errors);
+   }
+
+   /// \brief Returns a non-zero block if `current` ends partway through a sequence.
+   ///
+   [[nodiscard]] block find_incomplete(block const current) noexcept
+   {
+      // Only a lead byte that's too close to the end to be finished exceeds its limit.
+      static constexpr auto limits = [] {
+         auto x = std::array<char8_t, block_size>{};
+         x.fill(0xff);
+         x[block_size - 3] = 0xf0 - 1;
+         x[block_size - 2] = 0xe0 - 1;
+         x[block_size - 1] = 0xc0 - 1;
+         return x;
+      }();
+      return saturating_subtract(current, load(limits.data()));
+   }
+
+   [[nodiscard]] utf8_validation validate(std::u8string_view const source) noexcept
+   {
+      auto i = std::size_t{0};
+      auto previous = zero();
+      auto incomplete = zero();
+      for (; source.size() - i >= block_size; i += block_size) {
+         auto const current = load(source.data() + i);
+         if (is_ascii(current)) {
+            if (any(incomplete)) {
+               break;
+            }
+         }
+         else if (any(find_errors(current, previous))) {
+            break;
+         }
+         else {
+            incomplete = find_incomplete(current);
+         }
+         previous = current;
+      }
+
+      // Either the blocks ran out, or the block at `i` holds the first error. Both cases are
+      // finished off by the scalar decoder, starting from the character that spans `i`.
+      return validate_scalar(source, character_start(source, i));
+   }
@@ -0,0 +1,72 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <system_error>
+#include <vector>
+
+// Stands in for libFuzzer's main when the compiler doesn't have it, so that the fuzz targets can
+// still be built and run over their corpora as ordinary tests. Each argument is either a file to
+// run the target on, or a directory whose files are run in order of name.
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, std::size_t size);
+
+namespace {
+   namespace fs = std::filesystem;
+
+   [[nodiscard]] bool run(fs::path const& path)
+   {
+      auto file = std::ifstream{path, std::ios::binary};
+      if (not file) {
+         std::fprintf(stderr, "can't read %s\n", path.c_str());
+         return false;
+      }
+
+      auto const input = std::vector<std::uint8_t>(std::istreambuf_iterator<char>{file},
+         std::istreambuf_iterator<char>{});
+      static_cast<void>(LLVMFuzzerTestOneInput(input.data(), input.size()));
+      return true;
+   }
+} // namespace
+
+int main(int const argc, char** const argv)
+{
+   auto inputs = std::vector<fs::path>{};
+   for (auto const* const argument : std::span{argv, static_cast<std::size_t>(argc)}.subspan(1)) {
+      auto error = std::error_code{};
+      if (not fs::is_directory(argument, error)) {
+         inputs.emplace_back(argument);
+         continue;
+      }
+
+      auto const first = inputs.size();
+      for (auto const& entry : fs::directory_iterator{argument, error}) {
+         if (entry.is_regular_file()) {
+            inputs.push_back(entry.path());
+         }
+      }
+      std::sort(inputs.begin() + static_cast<std::ptrdiff_t>(first), inputs.end());
+   }
+
+   auto const ran = std::ranges::count_if(inputs, run);
+   std::printf("ran %td of %zu inputs\n", ran, inputs.size());
+   return ran == static_cast<std::ptrdiff_t>(inputs.size()) ? 0 : 1;
+}
@@ -0,0 +1 @@
+fn main() { let s = "\q\q\q\q\q\q\q\q\x80\u{D800}\u{110000}"; }
\ No newline at end of file
@@ -0,0 +1 @@
+'a' 'ab b'\x80' '\u{1F600}' 'lifetime b'é' '
\ No newline at end of file
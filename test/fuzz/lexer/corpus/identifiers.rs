@@ -0,0 +1 @@
+r#fn r#self café café  r#_ 
\ No newline at end of file
@@ -0,0 +1 @@
+0x_ 1e+ 1.5e10f32 0b102 0o8 18446744073709551616u64 1f32 1_000.000_1e-3_f64 0xffu8 128i8
\ No newline at end of file
@@ -0,0 +1,2 @@
+"abc\" r#"x"# br"y" b"\xff\u{41}" "\
+   continued"
\ No newline at end of file
@@ -0,0 +1 @@
+(((([[[[{{{{ fn f() { g(] } ))))]]]]}}}}
\ No newline at end of file
@@ -0,0 +1 @@
+r###"a "# b "## c
\ No newline at end of file
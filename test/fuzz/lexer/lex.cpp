@@ -0,0 +1,35 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/lex.hpp"
+
+#include "lingua/lexer/lexical_diagnostic.hpp"
+#include "lingua_test/check_linear_time.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Lexes the input and turns its errors into diagnostics, which is where a file full of bad escapes,
+// unterminated literals, or unbalanced delimiters does its work.
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* const data, std::size_t const size)
+{
+   auto const source = std::u8string(data, data + size);
+   lingua_test::check_linear_time(source, [](std::u8string_view const x) {
+      auto const lexed = lingua::lex(x);
+      static_cast<void>(lingua::make_diagnostics(x, lexed));
+   });
+   return 0;
+}
@@ -0,0 +1,41 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/lex.hpp"
+
+#include "lingua_test/check_linear_time.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Records checkpoints every few bytes and relexes the source from each of them, so that resuming
+// inside strings, raw strings, and nested comments is exercised as often as starting from the top.
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* const data, std::size_t const size)
+{
+   if (size == 0) {
+      return 0;
+   }
+
+   // The first byte picks the distance between checkpoints, and the rest is the source.
+   auto const interval = std::size_t{data[0]} % 64 + 1;
+   auto const source = std::u8string(data + 1, data + size);
+   lingua_test::check_linear_time(source, [interval](std::u8string_view const x) {
+      auto const checkpoints = lingua::make_checkpoints(x, interval);
+      static_cast<void>(lingua::lex_region(x, checkpoints, 0, x.size()));
+      static_cast<void>(lingua::lex_region(x, checkpoints, x.size() / 2, x.size()));
+   });
+   return 0;
+}
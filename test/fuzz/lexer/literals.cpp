@@ -0,0 +1,95 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/float_literal.hpp"
+
+#include "lingua/lexer/integer_literal.hpp"
+#include "lingua/lexer/lex.hpp"
+#include "lingua/lexer/string_literal_terminated.hpp"
+#include "lingua/lexer/unescape.hpp"
+#include "lingua/utility/string_arena.hpp"
+#include "lingua_test/check_linear_time.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace {
+   using lingua::token_kind;
+
+   [[nodiscard]] bool is_float(std::u8string_view const literal) noexcept
+   {
+      auto const prefixed = literal.size() > 1 and literal[0] == u8'0'
+                        and (literal[1] == u8'x' or literal[1] == u8'o' or literal[1] == u8'b');
+      return not prefixed and (literal.ends_with(u8"f32") or literal.ends_with(u8"f64"));
+   }
+
+   /// \brief Decodes every literal that lex finds in `source`, with the function for its kind.
+   ///
+   void decode_literals(std::u8string_view const source)
+   {
+      // Unterminated literals don't meet the decoders' preconditions, and are left alone. Errors
+      // are ordered by offset, so they're walked alongside the tokens.
+      auto const lexed = lingua::lex(source);
+      auto error = lexed.errors.begin();
+      auto const has_error = [&error, &lexed](lingua::token const& t) {
+         while (error != lexed.errors.end() and error->offset < t.offset) {
+            ++error;
+         }
+         return error != lexed.errors.end() and error->offset == t.offset;
+      };
+
+      auto arena = lingua::string_arena{};
+      for (auto const& t : lexed.tokens) {
+         auto const text = t.text(source);
+         switch (t.kind) {
+         case token_kind::integer_literal:
+            if (is_float(text)) {
+               static_cast<void>(lingua::parse_float_literal(text));
+            }
+            else {
+               static_cast<void>(lingua::parse_integer_literal(text));
+            }
+            break;
+         case token_kind::float_literal:
+            static_cast<void>(lingua::parse_float_literal(text));
+            break;
+         case token_kind::string_literal:
+         case token_kind::raw_string_literal:
+            static_cast<void>(lingua::string_literal_terminated(text));
+            [[fallthrough]];
+         case token_kind::char_literal:
+         case token_kind::byte_literal:
+         case token_kind::byte_string_literal:
+         case token_kind::raw_byte_string_literal:
+            if (not has_error(t)) {
+               static_cast<void>(lingua::unescape_literal(t.kind, text, arena));
+            }
+            break;
+         default:
+            break;
+         }
+      }
+   }
+} // namespace
+
+// Runs the functions that decode literals on the literals in the input, which lex finds first so
+// that each one sees the kind of text that it expects.
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* const data, std::size_t const size)
+{
+   auto const source = std::u8string(data, data + size);
+   lingua_test::check_linear_time(source, decode_literals);
+   return 0;
+}
@@ -0,0 +1,104 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_UNIT_TEST_CHECK_LINEAR_TIME_HPP
+#define LINGUA_UNIT_TEST_CHECK_LINEAR_TIME_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+namespace lingua_test {
+   /// \brief The smallest input that check_linear_time times, in bytes.
+   ///
+   inline constexpr auto linear_time_base_size = std::size_t{1024};
+
+   /// \brief How many times larger the second input that check_linear_time times is.
+   ///
+   inline constexpr auto linear_time_scale = std::size_t{16};
+
+   /// \brief How much more a byte of the larger input may cost before check_linear_time aborts.
+   ///        Linear code costs the same per byte for both inputs, and quadratic code costs
+   ///        linear_time_scale times as much.
+   ///
+   inline constexpr auto linear_time_tolerance = 4.0;
+
+   /// \brief Inputs that take less than this are too quick for the comparison to be trusted.
+   ///
+   inline constexpr auto linear_time_noise_floor = std::chrono::milliseconds{1};
+
+   /// \brief Runs `f` on `input`, and then on `input` repeated to two sizes, and aborts if a byte
+   ///        of the larger input costs much more than a byte of the smaller one.
+   ///
+   /// Repeating an input repeats whatever makes it expensive: a string of bad escapes becomes a
+   /// longer string of bad escapes, and an unclosed delimiter becomes many. Each size is timed
+   /// three times and the fastest run kept, which filters out most interruptions. Aborting is how a
+   /// fuzz target reports a problem, so libFuzzer keeps the input that caused it.
+   ///
+   template<class F>
+   void check_linear_time(std::u8string_view const input, F f)
+   {
+      f(input);
+      if (input.empty()) {
+         return;
+      }
+
+      auto small = std::u8string{};
+      while (small.size() < linear_time_base_size) {
+         small += input;
+      }
+
+      auto large = std::u8string{};
+      large.reserve(small.size() * linear_time_scale);
+      for (auto i = std::size_t{0}; i < linear_time_scale; ++i) {
+         large += small;
+      }
+
+      auto const time = [&f](std::u8string_view const x) {
+         using std::chrono::steady_clock;
+         auto best = steady_clock::duration::max();
+         for (auto i = 0; i < 3; ++i) {
+            auto const start = steady_clock::now();
+            f(x);
+            best = std::min(best, steady_clock::now() - start);
+         }
+         return std::max(best, steady_clock::duration{1});
+      };
+      auto const small_time = time(small);
+      auto const large_time = time(large);
+      if (large_time < linear_time_noise_floor) {
+         return;
+      }
+
+      auto const nanoseconds_per_byte = [](auto const duration, std::size_t const size) {
+         auto const elapsed = std::chrono::duration<double, std::nano>{duration};
+         return elapsed.count() / static_cast<double>(size);
+      };
+      auto const small_cost = nanoseconds_per_byte(small_time, small.size());
+      auto const large_cost = nanoseconds_per_byte(large_time, large.size());
+      if (large_cost > small_cost * linear_time_tolerance) {
+         std::fprintf(stderr,
+            "check_linear_time: %zu bytes cost %.2f ns each, but %zu bytes cost %.2f ns each\n",
+            small.size(), small_cost, large.size(), large_cost);
+         std::abort();
+      }
+   }
+} // namespace lingua_test
+
+#endif // LINGUA_UNIT_TEST_CHECK_LINEAR_TIME_HPP
@@ -0,0 +1,158 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_UNIT_TEST_DIFFERENTIAL_HPP
+#define LINGUA_UNIT_TEST_DIFFERENTIAL_HPP
+
+#include <cstddef>
+#include <doctest.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Differential tests run an optimised kernel and a simple reference implementation on the same
+// inputs, and check that they agree: exhaustively on short strings over a small alphabet, and on
+// random strings long enough to cross block boundaries. A mismatch is shrunk before it's reported,
+// so that the failure names the smallest input that still tells the two apart.
+namespace lingua_test {
+   /// \brief Calls `f` with every string of at most `max_length` characters drawn from
+   ///        `alphabet`, shortest first.
+   ///
+   template<class F>
+   void for_each_string(std::u8string_view const alphabet, std::size_t const max_length, F f)
+   // [[expects: not alphabet.empty()]]
+   {
+      auto digits = std::vector<std::size_t>{};
+      auto text = std::u8string{};
+      for (auto length = std::size_t{0}; length <= max_length; ++length) {
+         digits.assign(length, 0);
+         text.assign(length, alphabet[0]);
+         for (;;) {
+            f(std::u8string_view{text});
+
+            // Count up like an odometer, with the last character turning fastest.
+            auto i = length;
+            for (; i > 0 and ++digits[i - 1] == alphabet.size(); --i) {
+               digits[i - 1] = 0;
+               text[i - 1] = alphabet[0];
+            }
+            if (i == 0) {
+               break;
+            }
+            text[i - 1] = alphabet[digits[i - 1]];
+         }
+      }
+   }
+
+   /// \brief Returns up to `max_pieces` strings drawn at random from `pieces`, one after another.
+   ///
+   template<class Engine>
+   [[nodiscard]] std::u8string random_string(Engine& engine,
+      std::span<std::u8string_view const> const pieces, std::size_t const max_pieces)
+   // [[expects: not pieces.empty()]]
+   {
+      auto result = std::u8string{};
+      for (auto count = engine() % (max_pieces + 1); count > 0; --count) {
+         result += pieces[engine() % pieces.size()];
+      }
+      return result;
+   }
+
+   /// \brief Returns a locally smallest input for which `differs` still holds: removing any one
+   ///        character, or replacing any character with `a`, would make it false.
+   ///
+   /// Runs are removed starting with the whole input, then halves, quarters, and so on down to
+   /// single characters, and the whole process repeats until nothing more can be taken away.
+   ///
+   template<class Differs>
+   [[nodiscard]] std::u8string shrink(std::u8string input, Differs differs)
+   // [[expects: differs(input)]]
+   {
+      for (auto progress = true; progress;) {
+         progress = false;
+         for (auto run = input.size(); run > 0; run /= 2) {
+            for (auto i = std::size_t{0}; i + run <= input.size();) {
+               auto candidate = input;
+               candidate.erase(i, run);
+               if (differs(std::u8string_view{candidate})) {
+                  input = std::move(candidate);
+                  progress = true;
+               }
+               else {
+                  i += run;
+               }
+            }
+         }
+
+         for (auto& c : input) {
+            if (auto const original = c; original != u8'a') {
+               c = u8'a';
+               if (differs(std::u8string_view{input})) {
+                  progress = true;
+               }
+               else {
+                  c = original;
+               }
+            }
+         }
+      }
+      return input;
+   }
+
+   /// \brief Returns `text` with everything outside printable ASCII spelt as `\xNN`, so that it
+   ///        can be shown in a test's output.
+   ///
+   [[nodiscard]] inline std::string printable(std::u8string_view const text)
+   {
+      constexpr auto hex = std::string_view{"0123456789abcdef"};
+      auto result = std::string{};
+      for (auto const c : text) {
+         if (u8' ' <= c and c <= u8'~' and c != u8'\\') {
+            result += static_cast<char>(c);
+         }
+         else {
+            result += "\\x";
+            result += hex[static_cast<std::size_t>(c >> 4U)];
+            result += hex[static_cast<std::size_t>(c & 0xfU)];
+         }
+      }
+      return result;
+   }
+
+   /// \brief Checks that `fast` and `reference` give equal results for `input`. If they don't,
+   ///        the check is made on the input that shrink finds, which is captured as `shrunk`.
+   /// \returns true if they agree.
+   ///
+   template<class Fast, class Reference>
+   bool check_agreement(std::u8string_view const input, Fast fast, Reference reference)
+   {
+      auto const differs = [&fast, &reference](std::u8string_view const x) {
+         return not (fast(x) == reference(x));
+      };
+      if (not differs(input)) {
+         return true;
+      }
+
+      auto const smallest = shrink(std::u8string{input}, differs);
+      auto const shrunk = printable(smallest);
+      CAPTURE(shrunk);
+      CHECK(fast(std::u8string_view{smallest}) == reference(std::u8string_view{smallest}));
+      return false;
+   }
+} // namespace lingua_test
+
+#endif // LINGUA_UNIT_TEST_DIFFERENTIAL_HPP
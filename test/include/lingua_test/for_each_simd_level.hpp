@@ -0,0 +1,67 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef LINGUA_UNIT_TEST_FOR_EACH_SIMD_LEVEL_HPP
+#define LINGUA_UNIT_TEST_FOR_EACH_SIMD_LEVEL_HPP
+
+#include "lingua/utility/simd.hpp"
+#include <cstddef>
+#include <doctest.h>
+#include <string>
+
+namespace lingua_test {
+   /// \brief Restores the simd_level that was active when it was made, however its scope is left.
+   ///
+   class simd_level_guard {
+   public:
+      simd_level_guard() noexcept
+         : original_{lingua::active_simd_level()}
+      {}
+
+      simd_level_guard(simd_level_guard const&) = delete;
+      simd_level_guard& operator=(simd_level_guard const&) = delete;
+
+      ~simd_level_guard()
+      { lingua::set_simd_level(original_); }
+
+   private:
+      lingua::simd_level original_;
+   };
+
+   /// \brief Calls `f` once for each simd_level that the processor supports, with kernels
+   ///        dispatching on that level, so that every variant of a kernel is tested.
+   ///
+   /// The level that was active beforehand is restored even if `f` throws (e.g. a failed
+   /// `REQUIRE`), so that later test cases aren't left on a lower level.
+   ///
+   /// \note Don't put a `SUBCASE` inside `f`: doctest runs each subcase only once, so it would
+   ///       only see the first level. Call for_each_simd_level inside the `SUBCASE` instead.
+   ///
+   template<class F>
+   void for_each_simd_level(F f)
+   {
+      auto const guard = simd_level_guard{};
+      auto const supported = static_cast<std::size_t>(lingua::supported_simd_level());
+      for (auto i = std::size_t{0}; i <= supported; ++i) {
+         auto const level = static_cast<lingua::simd_level>(i);
+         lingua::set_simd_level(level);
+         auto const simd_level = std::string{lingua::simd_level_name(level)};
+         CAPTURE(simd_level);
+         f();
+      }
+   }
+} // namespace lingua_test
+
+#endif // LINGUA_UNIT_TEST_FOR_EACH_SIMD_LEVEL_HPP
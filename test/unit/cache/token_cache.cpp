@@ -0,0 +1,337 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/cache/token_cache.hpp"
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/lexer/lex.hpp"
+#include "lingua/lexer/token.hpp"
+#include "lingua_test/make_coordinates.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+   namespace fs = std::filesystem;
+   using lingua::token, lingua::token_kind;
+   using namespace std::string_view_literals;
+
+   constexpr auto source = u8"fn main() {}"sv;
+   auto const tokens = std::vector<token>{
+      {token_kind::keyword, 0, 2},
+      {token_kind::whitespace, 2, 1},
+      {token_kind::identifier, 3, 4},
+      {token_kind::open_paren, 7, 1},
+      {token_kind::close_paren, 8, 1},
+      {token_kind::whitespace, 9, 1},
+      {token_kind::open_brace, 10, 1},
+      {token_kind::close_brace, 11, 1},
+   };
+
+   fs::path fresh_directory(char const* const name)
+   {
+      auto result = fs::temp_directory_path() / name;
+      fs::remove_all(result);
+      return result;
+   }
+
+   template<typename T>
+   void overwrite(fs::path const& path, std::streamoff const offset, T const value)
+   {
+      auto out = std::fstream{path, std::ios::in | std::ios::out | std::ios::binary};
+      out.seekp(offset);
+      out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+   }
+
+   std::size_t entry_count(fs::path const& directory)
+   {
+      auto const entries = fs::directory_iterator{directory};
+      return static_cast<std::size_t>(std::count_if(fs::begin(entries), fs::end(entries),
+         [](fs::directory_entry const& x) { return x.path().extension() == ".tokens"; }));
+   }
+} // namespace
+
+TEST_CASE("checks token streams round-trip through the cache") {
+   auto const directory = fresh_directory("lingua-token-cache-round-trip");
+   auto cache = lingua::token_cache{directory, 1U << 20U};
+   auto const key = lingua::token_cache::make_key(source);
+
+   SUBCASE("checks a missing entry") {
+      CHECK(not cache.load(key));
+   }
+
+   SUBCASE("checks tokens and diagnostics are preserved") {
+      auto const first_message = u8"unknown token \"`\""sv;
+      auto const second_message = u8"unterminated string literal: `\"hello`"sv;
+      auto const diagnostics = std::vector<lingua::cached_diagnostic>{
+         {lingua::diagnostic_level::ill_formed, lingua_test::make_coordinates(u8"`"), first_message},
+         {lingua::diagnostic_level::warning, lingua_test::make_coordinates(u8"\"hello"), second_message},
+      };
+      REQUIRE(cache.store(key, tokens, diagnostics));
+
+      auto const entry = cache.load(key);
+      REQUIRE(entry);
+      CHECK(std::ranges::equal(entry->tokens(), tokens));
+
+      auto const loaded = entry->diagnostics();
+      REQUIRE(loaded.size() == 2);
+      CHECK(loaded[0].level == lingua::diagnostic_level::ill_formed);
+      CHECK(loaded[0].coordinates == diagnostics[0].coordinates);
+      CHECK(loaded[0].help_message == first_message);
+      CHECK(loaded[1].level == lingua::diagnostic_level::warning);
+      CHECK(loaded[1].coordinates == diagnostics[1].coordinates);
+      CHECK(loaded[1].help_message == second_message);
+   }
+
+   SUBCASE("checks lexer checkpoints are preserved") {
+      constexpr auto long_source = u8"/* a long comment */ \"and a long string\" r#\"raw\"#"sv;
+      auto const long_key = lingua::token_cache::make_key(long_source);
+      auto const checkpoints = lingua::make_checkpoints(long_source, 4);
+      REQUIRE(checkpoints.size() > 2);
+
+      REQUIRE(cache.store(long_key, {}, {}, checkpoints));
+      auto const entry = cache.load(long_key);
+      REQUIRE(entry);
+      CHECK(entry->tokens().empty());
+      CHECK(std::ranges::equal(entry->checkpoints(), checkpoints));
+
+      auto const region = lingua::lex_region(long_source, entry->checkpoints(), 25, 30);
+      REQUIRE(region.tokens.size() == 1);
+      CHECK(region.tokens.front().kind == token_kind::string_literal);
+   }
+
+   SUBCASE("checks different contents don't share an entry") {
+      REQUIRE(cache.store(key, tokens, {}));
+      CHECK(not cache.load(lingua::token_cache::make_key(u8"fn main() { }")));
+   }
+
+   SUBCASE("checks entries outlive the cache") {
+      REQUIRE(cache.store(key, tokens, {}));
+      auto const entry = cache.load(key);
+      REQUIRE(entry);
+      fs::remove_all(directory);
+      CHECK(std::ranges::equal(entry->tokens(), tokens));
+   }
+
+   fs::remove_all(directory);
+}
+
+TEST_CASE("checks corrupt entries are ignored") {
+   auto const directory = fresh_directory("lingua-token-cache-corrupt");
+   auto cache = lingua::token_cache{directory, 1U << 20U};
+   auto const key = lingua::token_cache::make_key(source);
+   auto const diagnostics = std::vector<lingua::cached_diagnostic>{
+      {lingua::diagnostic_level::warning, lingua_test::make_coordinates(u8"main"), u8"unused"sv},
+   };
+   REQUIRE(cache.store(key, tokens, diagnostics));
+   REQUIRE(cache.load(key));
+
+   // A 96-byte header, then the tokens, then (with no checkpoints) the 48-byte diagnostic records:
+   // four 64-bit coordinates followed by the level, message offset, and message length. Last comes
+   // the string table.
+   auto const path = fs::directory_iterator{directory}->path();
+   auto const tokens_offset = std::streamoff{96};
+   auto const diagnostics_offset =
+      tokens_offset + static_cast<std::streamoff>(tokens.size() * sizeof(token));
+   SUBCASE("truncated") {
+      fs::resize_file(path, fs::file_size(path) - 1);
+      CHECK(not cache.load(key));
+   }
+
+   SUBCASE("overwritten header") {
+      auto out = std::fstream{path, std::ios::in | std::ios::out | std::ios::binary};
+      out.write("garbage!", 8);
+      out.close();
+      CHECK(not cache.load(key));
+   }
+
+   SUBCASE("truncated inside the header") {
+      fs::resize_file(path, 40);
+      CHECK(not cache.load(key));
+   }
+
+   SUBCASE("empty") {
+      fs::resize_file(path, 0);
+      CHECK(not cache.load(key));
+   }
+
+   // Records are checked as they're read, rather than when the entry is loaded, so an entry with a
+   // corrupt record is still a hit unless the caller asks for its digest to be checked.
+   constexpr auto digest = lingua::cache_verification::digest;
+   SUBCASE("token kind out of range") {
+      overwrite(path, tokens_offset, std::uint8_t{0xFF});
+      CHECK(not cache.load(key, digest));
+
+      auto const entry = cache.load(key);
+      REQUIRE(entry);
+      CHECK(entry->tokens()[0] == token{token_kind::unknown, 0, 12});
+      CHECK(entry->tokens()[1] == tokens[1]);
+   }
+
+   SUBCASE("token outside the source") {
+      overwrite(path, tokens_offset + std::streamoff{sizeof(token)} + 4, std::uint32_t{1000});
+      CHECK(not cache.load(key, digest));
+
+      auto const entry = cache.load(key);
+      REQUIRE(entry);
+      CHECK(entry->tokens()[1] == token{token_kind::unknown, 12, 0});
+   }
+
+   SUBCASE("diagnostic level out of range") {
+      overwrite(path, diagnostics_offset + 32, std::uint32_t{7});
+      CHECK(not cache.load(key, digest));
+
+      auto const entry = cache.load(key);
+      REQUIRE(entry);
+      CHECK(entry->diagnostics().empty());
+   }
+
+   SUBCASE("message outside the string table") {
+      overwrite(path, diagnostics_offset + 40, std::uint32_t{1000});
+      CHECK(not cache.load(key, digest));
+
+      auto const entry = cache.load(key);
+      REQUIRE(entry);
+      CHECK(entry->diagnostics().empty());
+   }
+
+   SUBCASE("diagnostic that ends before it begins") {
+      overwrite(path, diagnostics_offset + 16, std::int64_t{0});
+      CHECK(not cache.load(key, digest));
+
+      auto const entry = cache.load(key);
+      REQUIRE(entry);
+      CHECK(entry->diagnostics().empty());
+   }
+
+   SUBCASE("message that's been changed") {
+      overwrite(path, static_cast<std::streamoff>(fs::file_size(path)) - 1, 'X');
+      CHECK(not cache.load(key, digest));
+      CHECK(cache.load(key));
+   }
+
+   SUBCASE("intact") {
+      CHECK(cache.load(key, digest));
+   }
+
+   fs::remove_all(directory);
+}
+
+TEST_CASE("checks the cache stays within its size bound") {
+   auto const directory = fresh_directory("lingua-token-cache-eviction");
+   constexpr auto max_size = 40'000U;
+   auto cache = lingua::token_cache{directory, max_size};
+
+   auto contents = std::u8string(1000, u8'x');
+   for (auto i = 0; i < 20; ++i) {
+      contents += u8'x';
+      auto long_tokens = std::vector<token>{};
+      for (auto j = std::uint32_t{0}; j < contents.size(); ++j) {
+         long_tokens.push_back(token{token_kind::identifier, j, 1});
+      }
+      CHECK(cache.store(lingua::token_cache::make_key(contents), long_tokens, {}));
+   }
+
+   auto total = std::uintmax_t{0};
+   for (auto const& entry : fs::directory_iterator{directory}) {
+      total += entry.file_size();
+   }
+   CHECK(total <= max_size);
+   CHECK(entry_count(directory) > 0);
+
+   // the most recent entry is never the first to go
+   CHECK(cache.load(lingua::token_cache::make_key(contents)));
+   fs::remove_all(directory);
+}
+
+TEST_CASE("checks eviction removes the least-recently-used entries") {
+   auto const directory = fresh_directory("lingua-token-cache-lru");
+   auto cache = lingua::token_cache{directory, 1U << 20U};
+   constexpr auto other_source = u8"fn main(){}"sv;
+   auto const other_tokens = std::vector<token>{
+      {token_kind::keyword, 0, 2},
+      {token_kind::whitespace, 2, 1},
+      {token_kind::identifier, 3, 4},
+      {token_kind::open_paren, 7, 1},
+      {token_kind::close_paren, 8, 1},
+      {token_kind::open_brace, 9, 1},
+      {token_kind::close_brace, 10, 1},
+   };
+   auto const key = lingua::token_cache::make_key(source);
+   auto const other_key = lingua::token_cache::make_key(other_source);
+   // The first entry was written two hours ago and the second an hour ago, but only the first has
+   // been read since.
+   auto const now = fs::file_time_type::clock::now();
+   REQUIRE(cache.store(key, tokens, {}));
+   fs::last_write_time(fs::directory_iterator{directory}->path(), now - std::chrono::hours{2});
+   REQUIRE(cache.store(other_key, other_tokens, {}));
+   for (auto const& entry : fs::directory_iterator{directory}) {
+      if (entry.last_write_time() > now - std::chrono::hours{2}) {
+         fs::last_write_time(entry.path(), now - std::chrono::hours{1});
+      }
+   }
+   REQUIRE(cache.load(key));
+
+   auto total = std::uintmax_t{0};
+   for (auto const& entry : fs::directory_iterator{directory}) {
+      total += entry.file_size();
+   }
+   cache.evict(total - 1);
+   CHECK(cache.load(key));
+   CHECK(not cache.load(other_key));
+   fs::remove_all(directory);
+}
+
+TEST_CASE("checks concurrent writers never expose partial entries") {
+   auto const directory = fresh_directory("lingua-token-cache-concurrent");
+   auto const contents = std::u8string(40'000, u8'x');
+   auto const key = lingua::token_cache::make_key(contents);
+   auto many_tokens = std::vector<token>{};
+   for (auto i = std::uint32_t{0}; i < contents.size(); i += 4) {
+      many_tokens.push_back(token{token_kind::identifier, i, 4});
+   }
+
+   auto writers = std::vector<std::thread>{};
+   for (auto i = 0; i < 4; ++i) {
+      writers.emplace_back([&] {
+         auto cache = lingua::token_cache{directory, 1U << 24U};
+         for (auto j = 0; j < 20; ++j) {
+            cache.store(key, many_tokens, {});
+         }
+      });
+   }
+
+   auto reader = lingua::token_cache{directory, 1U << 24U};
+   auto torn = 0;
+   for (auto i = 0; i < 200; ++i) {
+      if (auto const entry = reader.load(key); entry and not std::ranges::equal(entry->tokens(), many_tokens)) {
+         ++torn;
+      }
+   }
+
+   for (auto& writer : writers) {
+      writer.join();
+   }
+   CHECK(torn == 0);
+   CHECK(entry_count(directory) == 1);
+   fs::remove_all(directory);
+}
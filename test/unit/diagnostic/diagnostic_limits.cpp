@@ -0,0 +1,57 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/diagnostic/diagnostic_limits.hpp"
+
+#include <cstddef>
+#include <doctest.h>
+#include <thread>
+#include <vector>
+
+TEST_CASE("checks a diagnostic_budget never hands out more than it holds") {
+   SUBCASE("from one thread") {
+      auto budget = lingua::diagnostic_budget{10};
+      CHECK(budget.take(4) == 4);
+      CHECK(budget.remaining() == 6);
+      CHECK(budget.take(0) == 0);
+      CHECK(budget.take(8) == 6);
+      CHECK(budget.remaining() == 0);
+      CHECK(budget.take(1) == 0);
+   }
+
+   SUBCASE("from many threads") {
+      constexpr auto capacity = std::size_t{10000};
+      constexpr auto thread_count = 8;
+      auto budget = lingua::diagnostic_budget{capacity};
+      auto taken = std::vector<std::size_t>(thread_count);
+      {
+         auto threads = std::vector<std::jthread>{};
+         for (auto& t : taken) {
+            threads.emplace_back([&budget, &t] {
+               while (budget.take(1) == 1) {
+                  ++t;
+               }
+            });
+         }
+      }
+
+      auto total = std::size_t{0};
+      for (auto const t : taken) {
+         total += t;
+      }
+      CHECK(total == capacity);
+      CHECK(budget.remaining() == 0);
+   }
+}
@@ -0,0 +1,57 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/diagnostic/lexical/integer_literal_overflow.hpp"
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua_test/make_coordinates.hpp"
+#include <doctest.h>
+#include <string_view>
+
+namespace {
+   void check_integer_literal_overflow(std::u8string_view const literal, bool const negated,
+      std::u8string_view const expected_help_message) noexcept
+   {
+      auto const coordinates = lingua_test::make_coordinates(literal);
+      auto const diagnostic = lingua::integer_literal_overflow{literal, negated, coordinates};
+
+      CHECK(diagnostic.level == lingua::diagnostic_level::ill_formed);
+      CHECK(diagnostic.coordinates() == coordinates);
+      CHECK(expected_help_message == diagnostic.help_message());
+   }
+} // namespace
+
+TEST_CASE("checks the error type for integer literals that overflow their type") {
+   using namespace std::string_view_literals;
+
+   check_integer_literal_overflow(u8"256u8"sv, false,
+      u8"integer literal `256u8` is out of range for `u8`, whose values are from `0` to `255`\n"
+      u8"                    ^");
+   check_integer_literal_overflow(u8"0x8000_0000i32"sv, false,
+      u8"integer literal `0x8000_0000i32` is out of range for `i32`, whose values are from "
+      u8"`-2147483648` to `2147483647`\n"
+      u8"                            ^");
+   check_integer_literal_overflow(u8"129i8"sv, true,
+      u8"integer literal `-129i8` is out of range for `i8`, whose values are from `-128` to "
+      u8"`127`\n"
+      u8"                     ^");
+}
+
+TEST_CASE("checks the error type for integer literals that don't fit in 128 bits") {
+   using namespace std::string_view_literals;
+
+   check_integer_literal_overflow(u8"340282366920938463463374607431768211456"sv, false,
+      u8"integer literal `340282366920938463463374607431768211456` doesn't fit in 128 bits.");
+}
@@ -0,0 +1,55 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/diagnostic/lexical/invalid_unicode_escape.hpp"
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua_test/make_coordinates.hpp"
+#include <doctest.h>
+#include <string_view>
+
+namespace {
+   template<class Diagnostic>
+   void check_diagnostic(std::u8string_view const lexeme, std::u8string_view const escape,
+      std::u8string_view const expected_help_message)
+   {
+      auto const coordinates = lingua_test::make_coordinates(lexeme);
+      auto const first = lexeme.begin() + static_cast<std::ptrdiff_t>(lexeme.find(escape));
+      auto const diagnostic = Diagnostic{lexeme,
+         {first, first + static_cast<std::ptrdiff_t>(escape.size())}, coordinates};
+
+      CHECK(diagnostic.level == lingua::diagnostic_level::ill_formed);
+      CHECK(diagnostic.coordinates() == coordinates);
+      CHECK(diagnostic.help_message() == expected_help_message);
+   }
+} // namespace
+
+TEST_CASE("checks Unicode escapes that name surrogates") {
+   using namespace std::string_view_literals;
+   check_diagnostic<lingua::unicode_escape_surrogate>(u8R"("a\u{D800}b")"sv, u8R"(\u{D800})"sv,
+u8R"(Unicode escape '\u{D800}' names a surrogate, which isn't a character, in literal `"a\u{D800}b"`
+                                                                                    ^~~~~~~~)"sv);
+   check_diagnostic<lingua::unicode_escape_surrogate>(u8R"('\u{dfff}')"sv, u8R"(\u{dfff})"sv,
+u8R"(Unicode escape '\u{dfff}' names a surrogate, which isn't a character, in literal `'\u{dfff}'`
+                                                                                   ^~~~~~~~)"sv);
+}
+
+TEST_CASE("checks Unicode escapes above U+10FFFF") {
+   using namespace std::string_view_literals;
+   check_diagnostic<lingua::unicode_escape_out_of_range>(u8R"("\u{110000}")"sv,
+      u8R"(\u{110000})"sv,
+u8R"(Unicode escape '\u{110000}' is above '\u{10FFFF}', the largest character, in literal `"\u{110000}"`
+                                                                                       ^~~~~~~~~~)"sv);
+}
@@ -0,0 +1,50 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/diagnostic/lexical/invalid_utf8.hpp"
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/utility/validate_utf8.hpp"
+#include "lingua_test/make_coordinates.hpp"
+#include <doctest.h>
+#include <string_view>
+
+namespace {
+   void check_invalid_utf8(std::u8string_view const source,
+      std::u8string_view const expected_help_message) noexcept
+   {
+      auto const coordinates = lingua_test::make_coordinates(source);
+      auto const error = lingua::validate_utf8(source);
+      auto const diagnostic = lingua::invalid_utf8{source, error, coordinates};
+
+      CHECK(diagnostic.level == lingua::diagnostic_level::ill_formed);
+      CHECK(diagnostic.coordinates() == coordinates);
+      CHECK(expected_help_message == diagnostic.help_message());
+   }
+} // namespace
+
+TEST_CASE("checks the error type for source that isn't valid UTF-8") {
+   using namespace std::string_view_literals;
+
+   check_invalid_utf8(u8"fn \xff() {}"sv,
+      u8"invalid UTF-8 at byte 3: `\\xFF` doesn't begin a valid character");
+   check_invalid_utf8(u8"let s = \"\xed\xa0\x80\";"sv,
+      u8"invalid UTF-8 at byte 9: `\\xED` doesn't begin a valid character");
+   check_invalid_utf8(u8"// \xe2\x82x"sv,
+      u8"invalid UTF-8 at byte 3: `\\xE2\\x82` doesn't begin a valid character");
+   check_invalid_utf8(u8"// \xf0\x9f\x98"sv,
+      u8"invalid UTF-8 at byte 3: `\\xF0\\x9F\\x98` is an unfinished character at the end of the "
+      u8"file");
+}
@@ -0,0 +1,53 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/diagnostic/lexical/lex_limit_exceeded.hpp"
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua_test/make_coordinates.hpp"
+#include <cstdint>
+#include <doctest.h>
+#include <string_view>
+
+namespace {
+   void check_lex_limit_exceeded(lingua::lex_limit const limit, std::uint64_t const value,
+      std::u8string_view const expected_help_message) noexcept
+   {
+      auto const coordinates = lingua_test::make_coordinates(u8" ");
+      auto const diagnostic = lingua::lex_limit_exceeded{limit, value, coordinates};
+
+      CHECK(diagnostic.level == lingua::diagnostic_level::ill_formed);
+      CHECK(diagnostic.coordinates() == coordinates);
+      CHECK(expected_help_message == diagnostic.help_message());
+   }
+} // namespace
+
+TEST_CASE("checks the error type for sources that exceed a lexing limit") {
+   using lingua::lex_limit;
+   using namespace std::string_view_literals;
+
+   check_lex_limit_exceeded(lex_limit::bytes, 1024,
+      u8"lexing stopped: the file is larger than 1024 bytes"sv);
+   check_lex_limit_exceeded(lex_limit::tokens, 10,
+      u8"lexing stopped: the file has more than 10 tokens"sv);
+   check_lex_limit_exceeded(lex_limit::errors, 0,
+      u8"lexing stopped: the file has more than 0 lexical errors"sv);
+   check_lex_limit_exceeded(lex_limit::literal_length, 4096,
+      u8"lexing stopped: literal is longer than 4096 bytes"sv);
+   check_lex_limit_exceeded(lex_limit::comment_depth, 64,
+      u8"lexing stopped: comment nests more than 64 deep"sv);
+   check_lex_limit_exceeded(lex_limit::time, 250,
+      u8"lexing stopped: the file took more than 250 ms to lex"sv);
+}
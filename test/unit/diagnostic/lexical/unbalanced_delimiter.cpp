@@ -0,0 +1,50 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/diagnostic/lexical/unbalanced_delimiter.hpp"
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua_test/make_coordinates.hpp"
+#include <doctest.h>
+#include <fmt/format.h>
+#include <string_view>
+
+void check_unbalanced_delimiter(std::u8string_view const delimiter,
+   std::u8string_view const expected_message) noexcept
+{
+   using lingua::unbalanced_delimiter;
+
+   auto const coordinates = lingua_test::make_coordinates(delimiter);
+   auto const diagnostic = unbalanced_delimiter{delimiter, coordinates};
+
+   CHECK(diagnostic.level == lingua::diagnostic_level::ill_formed);
+   CHECK(diagnostic.coordinates() == coordinates);
+   CHECK(diagnostic.help_message() == expected_message);
+}
+
+TEST_CASE("checks that delimiters are balanced") {
+   SUBCASE("unclosed delimiters") {
+      check_unbalanced_delimiter(u8"(", u8"unclosed delimiter: `(`");
+      check_unbalanced_delimiter(u8"[", u8"unclosed delimiter: `[`");
+      check_unbalanced_delimiter(u8"{", u8"unclosed delimiter: `{`");
+   }
+
+   SUBCASE("unexpected closing delimiters") {
+      check_unbalanced_delimiter(u8")", u8"unexpected closing delimiter: `)`");
+      check_unbalanced_delimiter(u8"]", u8"unexpected closing delimiter: `]`");
+      check_unbalanced_delimiter(u8"}", u8"unexpected closing delimiter: `}`");
+   }
+}
@@ -0,0 +1,50 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/diagnostic/lexical/unterminated_char_literal.hpp"
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include "lingua_test/make_coordinates.hpp"
+#include <doctest.h>
+#include <fmt/format.h>
+#include <string_view>
+
+void check_unterminated_char(std::u8string_view const lexeme) noexcept
+{
+   using lingua::unterminated_char_literal;
+
+   auto const coordinates = lingua_test::make_coordinates(lexeme);
+   auto const diagnostic = unterminated_char_literal{lexeme, coordinates};
+
+   CHECK(diagnostic.level == lingua::diagnostic_level::ill_formed);
+   CHECK(diagnostic.coordinates() == coordinates);
+
+   auto const expected_message = fmt::format(u8"unterminated character literal: `{}`", lexeme);
+   CHECK(diagnostic.help_message() == expected_message);
+}
+
+TEST_CASE("checks that character literals are terminated") {
+   SUBCASE("character literals") {
+      check_unterminated_char(u8"'");
+      check_unterminated_char(u8"'a");
+      check_unterminated_char(u8R"('\')");
+   }
+
+   SUBCASE("byte literals") {
+      check_unterminated_char(u8"b'");
+      check_unterminated_char(u8"b'a");
+   }
+}
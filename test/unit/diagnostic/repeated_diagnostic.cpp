@@ -0,0 +1,34 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/diagnostic/repeated_diagnostic.hpp"
+
+#include "lingua/diagnostic/diagnostic_level.hpp"
+#include "lingua_test/make_coordinates.hpp"
+#include <doctest.h>
+#include <string_view>
+
+TEST_CASE("checks the diagnostic that stands for repeats of the one before it") {
+   using namespace std::string_view_literals;
+
+   auto const coordinates = lingua_test::make_coordinates(u8"` ` `"sv);
+   auto const once = lingua::repeated_diagnostic{1, coordinates};
+   CHECK(once.level == lingua::diagnostic_level::ill_formed);
+   CHECK(once.coordinates() == coordinates);
+   CHECK(once.help_message() == u8"the previous diagnostic is repeated 1 more time"sv);
+
+   auto const many = lingua::repeated_diagnostic{99999, coordinates};
+   CHECK(many.help_message() == u8"the previous diagnostic is repeated 99999 more times"sv);
+}
@@ -0,0 +1,204 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/io/load_files.hpp"
+
+#include <doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+   namespace fs = std::filesystem;
+
+   class temporary_directory {
+   public:
+      temporary_directory()
+         : path_{fs::temp_directory_path() / "lingua-load-files-test"}
+      {
+         fs::remove_all(path_);
+         fs::create_directories(path_);
+      }
+
+      temporary_directory(temporary_directory const&) = delete;
+      temporary_directory& operator=(temporary_directory const&) = delete;
+
+      ~temporary_directory()
+      { fs::remove_all(path_); }
+
+      fs::path write(std::string const& name, std::u8string const& contents) const
+      {
+         auto path = path_ / name;
+         auto out = std::ofstream{path, std::ios::binary};
+         out.write(reinterpret_cast<char const*>(contents.data()),
+            static_cast<std::streamsize>(contents.size()));
+         return path;
+      }
+
+      fs::path const& path() const noexcept
+      { return path_; }
+
+   private:
+      fs::path path_;
+   };
+
+   /// \brief Returns the backend that load_files should pick when `requested` is asked for.
+   ///
+   lingua::file_loader_backend expected_backend(lingua::file_loader_backend const requested)
+   {
+      using lingua::file_loader_backend;
+      return requested == file_loader_backend::thread_pool or not lingua::io_uring_available()
+           ? file_loader_backend::thread_pool
+           : file_loader_backend::io_uring;
+   }
+
+   void check_load_files(lingua::file_loader_options const& options)
+   {
+      auto const directory = temporary_directory{};
+      auto paths = std::vector<fs::path>{};
+      auto expected = std::vector<std::u8string>{};
+      for (auto i = 0; i < 50; ++i) {
+         auto contents = u8"fn f" + std::u8string(static_cast<std::size_t>(i * 97), u8'x')
+                       + u8"() {}\n";
+         paths.push_back(directory.write("file" + std::to_string(i) + ".rs", contents));
+         expected.push_back(std::move(contents));
+      }
+      paths.push_back(directory.write("empty.rs", u8""));
+      expected.emplace_back();
+      paths.push_back(directory.path() / "does-not-exist.rs");
+
+      auto loaded = std::vector<lingua::loaded_file>{};
+      auto const statistics = lingua::load_files(paths,
+         [&loaded](lingua::loaded_file file) { loaded.push_back(std::move(file)); }, options);
+
+      REQUIRE(loaded.size() == paths.size());
+      CHECK(statistics.backend == expected_backend(options.backend));
+      CHECK(statistics.files == paths.size());
+      for (auto i = std::size_t{0}; i < expected.size(); ++i) {
+         CHECK(loaded[i].path == paths[i]);
+         CHECK(not loaded[i].error);
+         CHECK(loaded[i].contents == expected[i]);
+      }
+
+      CHECK(loaded.back().path == paths.back());
+      CHECK(loaded.back().error);
+      CHECK(loaded.back().contents.empty());
+
+      auto bytes = std::size_t{0};
+      for (auto const& contents : expected) {
+         bytes += contents.size();
+      }
+      CHECK(statistics.bytes == bytes);
+      CHECK(statistics.hidden_io_time() <= statistics.io_time);
+   }
+} // namespace
+
+TEST_CASE("checks files are loaded in order") {
+   using lingua::file_loader_backend;
+
+   SUBCASE("thread pool") {
+      check_load_files({.backend = file_loader_backend::thread_pool});
+   }
+
+   SUBCASE("thread pool, one file in flight") {
+      check_load_files({.backend = file_loader_backend::thread_pool, .max_in_flight = 1});
+   }
+
+   SUBCASE("thread pool, one thread") {
+      check_load_files({.backend = file_loader_backend::thread_pool, .max_in_flight = 3, .threads = 1});
+   }
+
+   SUBCASE("io_uring, or its fallback") {
+      if (not lingua::io_uring_available()) {
+         MESSAGE("io_uring isn't available, so only its fallback to the thread pool is checked");
+      }
+      check_load_files({.backend = file_loader_backend::io_uring, .max_in_flight = 4});
+   }
+
+   SUBCASE("automatic") {
+      check_load_files({});
+   }
+}
+
+TEST_CASE("checks files are validated as UTF-8") {
+   using lingua::file_loader_backend, lingua::utf8_validation;
+
+   auto const directory = temporary_directory{};
+   auto const paths = std::vector<fs::path>{
+      directory.write("valid.rs", u8"fn main() { let π = 3.14; }"),
+      directory.write("invalid.rs", u8"fn main() {}\n// \xc0\xaf\n"),
+      directory.path() / "does-not-exist.rs",
+   };
+
+   for (auto const backend : {file_loader_backend::thread_pool, file_loader_backend::io_uring}) {
+      auto loaded = std::vector<lingua::loaded_file>{};
+      auto const save = [&loaded](lingua::loaded_file file) { loaded.push_back(std::move(file)); };
+
+      auto const statistics = lingua::load_files(paths, save, {.backend = backend});
+      CHECK(statistics.backend == expected_backend(backend));
+      REQUIRE(loaded.size() == paths.size());
+      CHECK(loaded[0].utf8 == utf8_validation{});
+      CHECK(loaded[1].utf8 == utf8_validation{16, 1});
+      CHECK(loaded[2].utf8 == utf8_validation{});
+
+      loaded.clear();
+      lingua::load_files(paths, save, {.backend = backend, .validate_utf8 = false});
+      REQUIRE(loaded.size() == paths.size());
+      CHECK(loaded[1].utf8 == utf8_validation{});
+   }
+}
+
+TEST_CASE("checks an empty list of files") {
+   auto called = false;
+   auto const statistics = lingua::load_files({}, [&called](lingua::loaded_file) { called = true; });
+   CHECK(not called);
+   CHECK(statistics.files == 0);
+}
+
+TEST_CASE("checks files are transcoded to UTF-8") {
+   using lingua::file_loader_backend, lingua::source_encoding, lingua::utf8_validation;
+
+   auto const directory = temporary_directory{};
+   auto const paths = std::vector<fs::path>{
+      directory.write("utf16le.rs", std::u8string{u8"\xff\xfe" u8"f\0n\0 \0\xc0\x03\0\xd8", 12}),
+      directory.write("utf16be.rs", std::u8string{u8"\xfe\xff" u8"\0f\0n", 6}),
+      directory.write("latin1.rs", u8"// caf\xe9\n"),
+   };
+
+   for (auto const backend : {file_loader_backend::thread_pool, file_loader_backend::io_uring}) {
+      auto loaded = std::vector<lingua::loaded_file>{};
+      auto const save = [&loaded](lingua::loaded_file file) { loaded.push_back(std::move(file)); };
+
+      auto const statistics = lingua::load_files(paths, save, {.backend = backend});
+      CHECK(statistics.backend == expected_backend(backend));
+      REQUIRE(loaded.size() == paths.size());
+      CHECK(loaded[0].encoding == source_encoding::utf16_le);
+      CHECK(loaded[0].contents == u8"fn π\xed\xa0\x80");
+      CHECK(loaded[0].utf8 == utf8_validation{5, 1});
+      CHECK(loaded[1].encoding == source_encoding::utf16_be);
+      CHECK(loaded[1].contents == u8"fn");
+      CHECK(loaded[2].encoding == source_encoding::utf8);
+      CHECK(not loaded[2].utf8.valid());
+
+      loaded.clear();
+      lingua::load_files(std::span{paths}.subspan(2), save,
+         {.backend = backend, .encoding = source_encoding::latin1});
+      REQUIRE(loaded.size() == 1);
+      CHECK(loaded[0].encoding == source_encoding::latin1);
+      CHECK(loaded[0].contents == u8"// café\n");
+      CHECK(loaded[0].utf8.valid());
+   }
+}
@@ -0,0 +1,123 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/delimiter_table.hpp"
+
+#include "lingua/lexer/lex.hpp"
+#include <cstdint>
+#include <doctest.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+   using lingua::lexical_error, lingua::lexical_error_kind;
+   using namespace std::string_view_literals;
+
+   /// \brief Returns the index of the token that starts at `offset`.
+   ///
+   [[nodiscard]] std::uint32_t token_at(lingua::lexed_source const& lexed, std::size_t const offset)
+   {
+      auto index = std::uint32_t{0};
+      while (lexed.tokens[index].offset != offset) {
+         ++index;
+      }
+      return index;
+   }
+
+   [[nodiscard]] lexical_error unbalanced(std::uint32_t const offset) noexcept
+   { return lexical_error{lexical_error_kind::unbalanced_delimiter, offset, 1}; }
+} // namespace
+
+TEST_CASE("checks delimiters are paired while lexing") {
+   SUBCASE("checks balanced delimiters") {
+      constexpr auto source = u8"fn f(x: [u8; 2]) { g(x[0]); /* ( */ \"{\" }"sv;
+      auto const lexed = lingua::lex(source);
+      CHECK(lexed.delimiters.errors().empty());
+      CHECK(lexed.delimiters.delimiters().size() == 10);
+
+      auto const check_pair = [&lexed, source](std::u8string_view const open, std::u8string_view const close) {
+         auto const opener = token_at(lexed, source.find(open));
+         auto const closer = token_at(lexed, source.find(close));
+         CHECK(lexed.delimiters.match(opener) == closer);
+         CHECK(lexed.delimiters.match(closer) == opener);
+      };
+      check_pair(u8"(x:", u8") {");
+      check_pair(u8"[u8", u8"]) {");
+      check_pair(u8"{ g", u8"}");
+      check_pair(u8"(x[", u8"); ");
+      check_pair(u8"[0", u8"]);");
+
+      CHECK(lexed.delimiters.match(0) == std::nullopt);
+   }
+
+   SUBCASE("checks a walk over the tokens can skip a body by its entry") {
+      constexpr auto source = u8"fn f() { g(x[0]); } fn h() {}"sv;
+      auto const lexed = lingua::lex(source);
+      auto const& table = lexed.delimiters;
+
+      // Count the delimiters passed on the way to the first `{`, which makes its entry known.
+      auto entry = std::size_t{0};
+      auto index = std::uint32_t{0};
+      for (; lexed.tokens[index].kind != lingua::token_kind::open_brace; ++index) {
+         entry += lingua::delimiter_table::is_delimiter(lexed.tokens[index].kind) ? 1 : 0;
+      }
+      REQUIRE(table.delimiters()[entry] == index);
+
+      auto const closer = table.partner(entry);
+      REQUIRE(closer);
+      CHECK(table.partner(*closer) == entry);
+      CHECK(table.delimiters()[*closer] == token_at(lexed, source.find(u8"} fn")));
+      CHECK(table.delimiters()[*closer + 1] == token_at(lexed, source.find(u8"() {}")));
+   }
+
+   SUBCASE("checks a closer that doesn't match the innermost opener") {
+      constexpr auto source = u8"{ ( }"sv;
+      auto const lexed = lingua::lex(source);
+      CHECK(lexed.delimiters.match(0) == 4);
+      CHECK(lexed.delimiters.match(2) == std::nullopt);
+      CHECK(lexed.delimiters.partner(1) == std::nullopt);
+      CHECK(std::vector(lexed.delimiters.errors().begin(), lexed.delimiters.errors().end())
+         == std::vector{unbalanced(2)});
+   }
+
+   SUBCASE("checks a closer with no opener") {
+      constexpr auto source = u8"( ] )"sv;
+      auto const lexed = lingua::lex(source);
+      CHECK(lexed.delimiters.match(0) == 4);
+      CHECK(lexed.delimiters.match(2) == std::nullopt);
+      CHECK(std::vector(lexed.delimiters.errors().begin(), lexed.delimiters.errors().end())
+         == std::vector{unbalanced(2)});
+   }
+
+   SUBCASE("checks many closers with no opener") {
+      // Each `]` used to scan every `(` before it, which took seconds at this size.
+      constexpr auto n = std::size_t{200'000};
+      auto source = std::u8string(n, u8'(');
+      source.append(n, u8']');
+      source += u8')';
+      auto const lexed = lingua::lex(source);
+      CHECK(lexed.delimiters.errors().size() == 2 * n - 1);
+      CHECK(lexed.delimiters.match(n - 1) == 2 * n);
+   }
+
+   SUBCASE("checks openers that are never closed are ordered by offset") {
+      constexpr auto source = u8"( [ } {"sv;
+      auto const lexed = lingua::lex(source);
+      CHECK(std::vector(lexed.delimiters.errors().begin(), lexed.delimiters.errors().end())
+         == std::vector{unbalanced(0), unbalanced(2), unbalanced(4), unbalanced(6)});
+   }
+}
@@ -0,0 +1,768 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua_test/differential.hpp"
+
+#include "lingua/lexer/float_literal.hpp"
+#include "lingua/lexer/integer_literal.hpp"
+#include "lingua/lexer/is_escape.hpp"
+#include "lingua/lexer/nfc.hpp"
+#include "lingua/lexer/unescape.hpp"
+#include "lingua/lexer/xid.hpp"
+#include "lingua/utility/string_arena.hpp"
+#include "lingua_test/for_each_simd_level.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <doctest.h>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+   using lingua::float_literal_error, lingua::float_type;
+   using lingua::integer_literal_error, lingua::integer_type, lingua::token_kind, lingua::uint128;
+   using lingua::nfc_quick_check_result;
+   using namespace std::string_literals;
+   using namespace std::string_view_literals;
+
+   __extension__ using u128 = unsigned __int128;
+
+   void append_utf8(std::u8string& out, char32_t const c)
+   {
+      if (c < 0x80) {
+         out += static_cast<char8_t>(c);
+      }
+      else if (c < 0x800) {
+         out += static_cast<char8_t>(0xc0U | (c >> 6U));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else if (c < 0x10000) {
+         out += static_cast<char8_t>(0xe0U | (c >> 12U));
+         out += static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else {
+         out += static_cast<char8_t>(0xf0U | (c >> 18U));
+         out += static_cast<char8_t>(0x80U | ((c >> 12U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+   }
+
+   [[nodiscard]] constexpr char8_t hex_value(char8_t const c) noexcept
+   {
+      return static_cast<char8_t>(c <= u8'9' ? c - u8'0' : (c | 0x20U) - u8'a' + 10);
+   }
+
+   [[nodiscard]] constexpr bool is_whitespace(char8_t const c) noexcept
+   { return c == u8' ' or c == u8'\t' or c == u8'\n' or c == u8'\r'; }
+
+   /// \brief Decodes the body of a string or byte string literal one character at a time, using
+   ///        the predicates in is_escape.hpp to decide which escapes are allowed.
+   /// \returns The decoded value, or std::nullopt if the body has an error.
+   ///
+   std::optional<std::u8string>
+   reference_unescape(std::u8string_view const body, bool const is_byte)
+   {
+      auto value = std::u8string{};
+      for (auto i = std::size_t{0}; i < body.size();) {
+         auto const rest = body.substr(i);
+         if (rest[0] != u8'\\') {
+            if (is_byte and rest[0] >= 0x80) {
+               return std::nullopt;
+            }
+            value += rest[0];
+            ++i;
+            continue;
+         }
+
+         if (rest.size() < 2) {
+            return std::nullopt;
+         }
+
+         switch (rest[1]) {
+         case u8'\'':
+         case u8'"':
+            // Quotes may be escaped in literals, but aren't among is_ascii_escape's escapes.
+            value += rest[1];
+            i += 2;
+            break;
+         case u8'\r':
+            if (not rest.substr(2).starts_with(u8'\n')) {
+               return std::nullopt;
+            }
+            [[fallthrough]];
+         case u8'\n':
+            for (i += 2; i < body.size() and is_whitespace(body[i]); ++i) {}
+            break;
+         case u8'u': {
+            auto const close = rest.find(u8'}');
+            if (is_byte or close == std::u8string_view::npos or close < 4
+                or not rest.starts_with(u8"\\u{"sv)) {
+               return std::nullopt;
+            }
+
+            auto const escape = rest.substr(0, close + 1);
+            if (not lingua::is_unicode_escape(escape)) {
+               return std::nullopt;
+            }
+
+            auto const decoded = lingua::decode_unicode_escape(escape);
+            if (decoded.error != lingua::unicode_escape_error::none) {
+               return std::nullopt;
+            }
+            append_utf8(value, decoded.code_point);
+            i += escape.size();
+            break;
+         }
+         case u8'x': {
+            auto const escape = rest.substr(0, 4);
+            if (escape.size() != 4
+                or not (is_byte ? lingua::is_byte_escape(escape) : lingua::is_ascii_escape(escape)))
+            {
+               return std::nullopt;
+            }
+            value += static_cast<char8_t>(hex_value(escape[2]) * 16 + hex_value(escape[3]));
+            i += 4;
+            break;
+         }
+         default: {
+            auto const escape = rest.substr(0, 2);
+            if (not (is_byte ? lingua::is_byte_escape(escape) : lingua::is_ascii_escape(escape))) {
+               return std::nullopt;
+            }
+
+            constexpr auto spellings = u8"nrt\\0"sv;
+            constexpr auto values = u8"\n\r\t\\\0"sv;
+            value += values[spellings.find(escape[1])];
+            i += 2;
+            break;
+         }
+         }
+      }
+      return value;
+   }
+
+   /// \brief Unescapes `body` as the body of a `kind` literal, giving std::nullopt for errors.
+   ///
+   std::optional<std::u8string> unescape(token_kind const kind, std::u8string_view const body)
+   {
+      auto const is_byte = kind == token_kind::byte_string_literal;
+      auto const literal = (is_byte ? u8"b\""s : u8"\""s) + std::u8string{body} + u8'"';
+      auto arena = lingua::string_arena{};
+      auto const unescaped = lingua::unescape_literal(kind, literal, arena);
+      if (unescaped.error != lingua::unescape_error::none) {
+         return std::nullopt;
+      }
+      return std::u8string{unescaped.value};
+   }
+
+   void check_unescape(std::u8string_view const body)
+   {
+      for (auto const kind : {token_kind::string_literal, token_kind::byte_string_literal}) {
+         lingua_test::check_agreement(body,
+            [kind](std::u8string_view const x) { return unescape(kind, x); },
+            [kind](std::u8string_view const x) {
+               return reference_unescape(x, kind == token_kind::byte_string_literal);
+            });
+      }
+   }
+
+   struct parsed_integer {
+      uint128 value;
+      integer_type type;
+      integer_literal_error error;
+      std::uint32_t error_offset;
+
+      friend bool operator==(parsed_integer const&, parsed_integer const&) = default;
+   };
+
+   /// \brief Returns the largest magnitude that a `type` literal may have.
+   ///
+   [[nodiscard]] u128 max_magnitude(integer_type const type, bool const negated) noexcept
+   {
+      constexpr auto bits = std::array{128U, 8U, 16U, 32U, 64U, 128U, 64U, 8U, 16U, 32U, 64U, 128U,
+         64U};
+      auto const width = bits[static_cast<std::size_t>(type)];
+      if (type < integer_type::i8) {
+         return (u128{1} << (width - 1)) * 2 - 1;
+      }
+      return (u128{1} << (width - 1)) - (negated ? 0 : 1);
+   }
+
+   /// \brief Parses an integer literal a digit at a time, in 128-bit arithmetic.
+   ///
+   parsed_integer reference_parse(std::u8string_view const literal, bool const negated)
+   {
+      auto radix = 10U;
+      auto i = std::size_t{0};
+      if (literal.size() > 1 and literal[0] == u8'0') {
+         constexpr auto prefixes = u8"xob"sv;
+         constexpr auto radixes = std::array{16U, 8U, 2U};
+         if (auto const p = prefixes.find(literal[1]); p != std::u8string_view::npos) {
+            radix = radixes[p];
+            i = 2;
+         }
+      }
+
+      auto result = parsed_integer{uint128{0, 0}, integer_type::unsuffixed,
+         integer_literal_error::none, 0};
+      auto const fail = [&result](integer_literal_error const error, std::size_t const offset) {
+         if (result.error == integer_literal_error::none) {
+            result.error = error;
+            result.error_offset = static_cast<std::uint32_t>(offset);
+         }
+      };
+
+      constexpr auto hex_digits = u8"0123456789abcdefABCDEF"sv;
+      auto const first = i;
+      auto value = u128{0};
+      auto reduced = false;
+      auto has_digits = false;
+      for (; i < literal.size(); ++i) {
+         auto const c = literal[i];
+         auto const is_digit = hex_digits.find(c) < (radix == 16 ? hex_digits.size() : 10);
+         if (c == u8'_') {
+            continue;
+         }
+         if (not is_digit) {
+            break;
+         }
+
+         auto const digit = hex_value(c);
+         if (digit >= radix) {
+            fail(integer_literal_error::unknown_digit, i);
+            continue;
+         }
+
+         reduced |= value > (~u128{0} - digit) / radix;
+         value = value * radix + digit;
+         has_digits = true;
+      }
+
+      if (not has_digits) {
+         fail(integer_literal_error::missing_digits, first);
+      }
+
+      if (auto const suffix = literal.substr(i); not suffix.empty()) {
+         auto type = integer_type::u8;
+         while (type <= integer_type::isize and lingua::integer_type_name(type) != suffix) {
+            type = static_cast<integer_type>(static_cast<int>(type) + 1);
+         }
+
+         if (type > integer_type::isize) {
+            fail(integer_literal_error::unknown_suffix, i);
+         }
+         else {
+            result.type = type;
+         }
+      }
+
+      if (reduced or value > max_magnitude(result.type, negated)) {
+         fail(integer_literal_error::overflow, 0);
+      }
+
+      // The value is only specified when there's no error, or when it overflowed.
+      if (result.error == integer_literal_error::none
+          or result.error == integer_literal_error::overflow) {
+         result.value = uint128{static_cast<std::uint64_t>(value),
+            static_cast<std::uint64_t>(value >> 64U)};
+      }
+      return result;
+   }
+
+   parsed_integer parse(std::u8string_view const literal, bool const negated)
+   {
+      auto const parsed = lingua::parse_integer_literal(literal, negated);
+      auto result = parsed_integer{uint128{0, 0}, parsed.type, parsed.error, parsed.error_offset};
+      if (parsed.error == integer_literal_error::none
+          or parsed.error == integer_literal_error::overflow) {
+         result.value = parsed.value;
+      }
+      return result;
+   }
+
+   void check_integer(std::u8string_view const literal)
+   {
+      for (auto const negated : {false, true}) {
+         lingua_test::check_agreement(literal,
+            [negated](std::u8string_view const x) { return parse(x, negated); },
+            [negated](std::u8string_view const x) { return reference_parse(x, negated); });
+      }
+   }
+
+   struct parsed_float {
+      double value;
+      float_type type;
+      float_literal_error error;
+
+      friend bool operator==(parsed_float const&, parsed_float const&) = default;
+   };
+
+   [[nodiscard]] constexpr bool is_decimal_digit(char8_t const c) noexcept
+   { return u8'0' <= c and c <= u8'9'; }
+
+   /// \brief Returns where the run of digits and `_`s that starts at `i` ends, or std::nullopt if
+   ///        it doesn't have any digits.
+   ///
+   std::optional<std::size_t> skip_digits(std::u8string_view const x, std::size_t i)
+   {
+      auto has_digits = false;
+      for (; i < x.size() and (is_decimal_digit(x[i]) or x[i] == u8'_'); ++i) {
+         has_digits |= is_decimal_digit(x[i]);
+      }
+      return has_digits ? std::optional{i} : std::nullopt;
+   }
+
+   /// \brief Splits `x` into its number and its suffix, if it's a literal that parse_float_literal
+   ///        accepts without error: digits, then a fraction, an exponent, or an `f32` or `f64`
+   ///        suffix, or more than one of them.
+   ///
+   std::optional<std::pair<std::u8string_view, std::u8string_view>>
+   split_float(std::u8string_view const x)
+   {
+      if (x.empty() or not is_decimal_digit(x[0])) {
+         return std::nullopt;
+      }
+
+      auto i = *skip_digits(x, 0);
+      auto const integer_end = i;
+      if (i < x.size() and x[i] == u8'.') {
+         if (i + 1 == x.size() or not is_decimal_digit(x[i + 1])) {
+            return std::nullopt;
+         }
+         i = *skip_digits(x, i + 1);
+      }
+
+      if (i < x.size() and (x[i] == u8'e' or x[i] == u8'E')) {
+         auto const sign = i + 1 < x.size() and (x[i + 1] == u8'+' or x[i + 1] == u8'-');
+         auto const exponent_end = skip_digits(x, i + (sign ? 2 : 1));
+         if (not exponent_end) {
+            return std::nullopt;
+         }
+         i = *exponent_end;
+      }
+
+      auto const suffix = x.substr(i);
+      if ((i == integer_end and suffix.empty())
+          or not (suffix.empty() or suffix == u8"f32"sv or suffix == u8"f64"sv)) {
+         return std::nullopt;
+      }
+      return std::pair{x.substr(0, i), suffix};
+   }
+
+   /// \brief Parses a float literal with the C library, which rounds correctly.
+   ///
+   std::optional<parsed_float> reference_parse_float(std::u8string_view const literal)
+   {
+      auto const parts = split_float(literal);
+      if (not parts) {
+         return std::nullopt;
+      }
+
+      auto text = std::string{};
+      for (auto const c : parts->first) {
+         if (c != u8'_') {
+            text += static_cast<char>(c);
+         }
+      }
+
+      auto const type = parts->second.empty()      ? float_type::unsuffixed
+                      : parts->second == u8"f32"sv ? float_type::f32
+                                                   : float_type::f64;
+      auto const value = type == float_type::f32 ? double{std::strtof(text.c_str(), nullptr)}
+                                                 : std::strtod(text.c_str(), nullptr);
+      auto const error = std::isinf(value) ? float_literal_error::overflow
+                                           : float_literal_error::none;
+      return parsed_float{value, type, error};
+   }
+
+   std::optional<parsed_float> parse_float(std::u8string_view const literal)
+   {
+      if (not split_float(literal)) {
+         return std::nullopt;
+      }
+
+      auto const parsed = lingua::parse_float_literal(literal);
+      return parsed_float{parsed.value, parsed.type, parsed.error};
+   }
+
+   void check_float(std::u8string_view const literal)
+   { lingua_test::check_agreement(literal, parse_float, reference_parse_float); }
+
+   /// \brief Decodes well-formed UTF-8, giving std::nullopt for anything else.
+   ///
+   std::optional<std::u32string> decode_utf8(std::u8string_view const text)
+   {
+      auto result = std::u32string{};
+      for (auto i = std::size_t{0}; i < text.size();) {
+         auto const lead = text[i];
+         auto const length = lead < 0x80 ? 1U : lead < 0xc2 ? 0U : lead < 0xe0 ? 2U
+                           : lead < 0xf0 ? 3U : lead < 0xf5 ? 4U : 0U;
+         if (length == 0 or text.size() - i < length) {
+            return std::nullopt;
+         }
+
+         auto c = length == 1 ? char32_t{lead} : char32_t{lead} & (0x7fU >> length);
+         for (auto j = std::size_t{1}; j < length; ++j) {
+            if ((text[i + j] & 0xc0U) != 0x80) {
+               return std::nullopt;
+            }
+            c = (c << 6U) | (text[i + j] & 0x3fU);
+         }
+
+         constexpr auto smallest = std::array{char32_t{0}, char32_t{0}, char32_t{0x80},
+            char32_t{0x800}, char32_t{0x10000}};
+         if (c < smallest[length] or c > 0x10ffff or (0xd800 <= c and c <= 0xdfff)) {
+            return std::nullopt;
+         }
+         result += c;
+         i += length;
+      }
+      return result;
+   }
+
+   /// \brief The properties that the XID and NFC tables were generated from, read straight from
+   ///        the copy of the Unicode Character Database in config/ucd.
+   ///
+   struct ucd_properties {
+      std::vector<bool> xid_start = std::vector<bool>(0x110000);
+      std::vector<bool> xid_continue = std::vector<bool>(0x110000);
+      std::vector<std::uint8_t> combining_class = std::vector<std::uint8_t>(0x110000);
+
+      /// \brief 0 for NFC_Quick_Check=Yes, 1 for Maybe, and 2 for No.
+      ///
+      std::vector<std::uint8_t> quick_check = std::vector<std::uint8_t>(0x110000);
+   };
+
+   /// \brief Calls `f` with the first and last code points and the fields of each entry in the
+   ///        UCD file `name`.
+   ///
+   template<class F>
+   void for_each_ucd_entry(char const* const name, F f)
+   {
+      auto in = std::ifstream{std::string{LINGUA_UCD_DIRECTORY} + "/" + name};
+      REQUIRE(in);
+
+      auto const trim = [](std::string_view x) {
+         while (not x.empty() and x.front() == ' ') {
+            x.remove_prefix(1);
+         }
+         while (not x.empty() and x.back() == ' ') {
+            x.remove_suffix(1);
+         }
+         return x;
+      };
+
+      for (auto line = std::string{}; std::getline(in, line);) {
+         auto rest = trim(std::string_view{line}.substr(0, line.find('#')));
+         if (rest.empty()) {
+            continue;
+         }
+
+         auto fields = std::vector<std::string_view>{};
+         for (auto semicolon = rest.find(';'); semicolon != std::string_view::npos;
+              semicolon = rest.find(';')) {
+            fields.push_back(trim(rest.substr(0, semicolon)));
+            rest.remove_prefix(semicolon + 1);
+         }
+         fields.push_back(trim(rest));
+
+         auto const range = std::string{fields[0]};
+         auto const dots = range.find("..");
+         auto const first = static_cast<char32_t>(std::stoul(range.substr(0, dots), nullptr, 16));
+         auto const last = dots == std::string::npos
+                         ? first
+                         : static_cast<char32_t>(std::stoul(range.substr(dots + 2), nullptr, 16));
+         fields.erase(fields.begin());
+         f(first, last, fields);
+      }
+   }
+
+   ucd_properties const& ucd()
+   {
+      static auto const properties = [] {
+         auto result = ucd_properties{};
+         for_each_ucd_entry("DerivedCoreProperties.txt",
+            [&result](char32_t const first, char32_t const last, auto const& fields) {
+               auto& property = fields[0] == "XID_Start" ? result.xid_start : result.xid_continue;
+               for (auto c = first; c <= last; ++c) {
+                  property[c] = true;
+               }
+            });
+         for_each_ucd_entry("DerivedCombiningClass.txt",
+            [&result](char32_t const first, char32_t const last, auto const& fields) {
+               auto const combining_class = static_cast<std::uint8_t>(std::stoi(
+                  std::string{fields[0]}));
+               for (auto c = first; c <= last; ++c) {
+                  result.combining_class[c] = combining_class;
+               }
+            });
+         for_each_ucd_entry("DerivedNormalizationProps.txt",
+            [&result](char32_t const first, char32_t const last, auto const& fields) {
+               if (fields[0] != "NFC_QC") {
+                  return;
+               }
+               for (auto c = first; c <= last; ++c) {
+                  result.quick_check[c] = fields[1] == "M" ? 1 : 2;
+               }
+            });
+         return result;
+      }();
+      return properties;
+   }
+
+   using xid_properties = std::vector<std::pair<bool, bool>>;
+
+   std::optional<xid_properties> classify(std::u8string_view const text)
+   {
+      auto const code_points = decode_utf8(text);
+      if (not code_points) {
+         return std::nullopt;
+      }
+
+      auto result = xid_properties{};
+      for (auto const c : *code_points) {
+         result.emplace_back(lingua::is_xid_start(c), lingua::is_xid_continue(c));
+      }
+      return result;
+   }
+
+   std::optional<xid_properties> reference_classify(std::u8string_view const text)
+   {
+      auto const code_points = decode_utf8(text);
+      if (not code_points) {
+         return std::nullopt;
+      }
+
+      auto result = xid_properties{};
+      for (auto const c : *code_points) {
+         result.emplace_back(ucd().xid_start[c], ucd().xid_continue[c]);
+      }
+      return result;
+   }
+
+   std::optional<nfc_quick_check_result> quick_check(std::u8string_view const text)
+   {
+      if (not decode_utf8(text)) {
+         return std::nullopt;
+      }
+      return lingua::nfc_quick_check(text);
+   }
+
+   /// \brief Runs the quick check from section 9 of UAX #15 over the UCD's properties.
+   ///
+   std::optional<nfc_quick_check_result> reference_quick_check(std::u8string_view const text)
+   {
+      auto const code_points = decode_utf8(text);
+      if (not code_points) {
+         return std::nullopt;
+      }
+
+      auto result = nfc_quick_check_result::yes;
+      auto last_class = std::uint8_t{0};
+      for (auto const c : *code_points) {
+         auto const combining_class = ucd().combining_class[c];
+         if (last_class > combining_class and combining_class != 0) {
+            return nfc_quick_check_result::no;
+         }
+         if (ucd().quick_check[c] == 2) {
+            return nfc_quick_check_result::no;
+         }
+         if (ucd().quick_check[c] == 1) {
+            result = nfc_quick_check_result::maybe;
+         }
+         last_class = combining_class;
+      }
+      return result;
+   }
+
+   /// \brief Calls `f` with the UTF-8 form of every Unicode scalar value.
+   ///
+   template<class F>
+   void for_each_scalar_value(F f)
+   {
+      auto text = std::u8string{};
+      for (auto c = char32_t{0}; c <= 0x10ffff; ++c) {
+         if (c == 0xd800) {
+            c = 0xdfff;
+            continue;
+         }
+         text.clear();
+         append_utf8(text, c);
+         f(std::u8string_view{text});
+      }
+   }
+} // namespace
+
+TEST_CASE("checks that shrink finds a smallest input") {
+   auto const has_escaped_x = [](std::u8string_view const x) {
+      return x.find(u8"\\x"sv) != std::u8string_view::npos;
+   };
+   CHECK(lingua_test::shrink(u8"fn main() { \"\\x41\" }"s, has_escaped_x) == u8"\\x"sv);
+
+   auto const long_enough = [](std::u8string_view const x) { return x.size() >= 3; };
+   CHECK(lingua_test::shrink(u8"hello, world"s, long_enough) == u8"aaa"sv);
+
+   auto const always = [](std::u8string_view) { return true; };
+   CHECK(lingua_test::shrink(u8"x"s, always).empty());
+   CHECK(lingua_test::shrink(u8"hello, world"s, always).empty());
+   CHECK(lingua_test::printable(u8"a\\\xff"sv) == "a\\x5c\\xff");
+}
+
+TEST_CASE("checks unescape_literal agrees with the escape predicates") {
+   SUBCASE("on every short body") {
+      lingua_test::for_each_simd_level([] {
+         lingua_test::for_each_string(u8"\\nxu{}7fa\r\n \"\xc3"sv, 4, check_unescape);
+      });
+   }
+
+   SUBCASE("on long random bodies") {
+      lingua_test::for_each_simd_level([] {
+         constexpr auto pieces = std::array{u8"a"sv, u8"the quick brown fox "sv,
+            u8"jumps over the lazy dog, "sv, u8"\\n"sv, u8"\\t"sv, u8"\\\\"sv, u8"\\\""sv,
+            u8"\\x41"sv, u8"\\x7f"sv, u8"\\x80"sv, u8"\\xff"sv, u8"\\u{1F600}"sv, u8"\\u{D800}"sv,
+            u8"\\u{110000}"sv, u8"\\u{}"sv, u8"é"sv, u8"😀"sv, u8"\\\n    "sv, u8"\\q"sv};
+         auto engine = std::mt19937_64{0x756e6573};
+         for (auto i = 0; i < 3000; ++i) {
+            auto const body = lingua_test::random_string(engine, pieces, 60);
+            check_unescape(body);
+         }
+      });
+   }
+}
+
+TEST_CASE("checks parse_integer_literal agrees with parsing a digit at a time") {
+   SUBCASE("on every short literal") {
+      // The padding pushes the short tails across the boundaries of eight-digit blocks.
+      for (auto const prefix : {u8""sv, u8"0x"sv, u8"0o"sv, u8"0b"sv}) {
+         for (auto const padding : {u8""sv, u8"1010101"sv, u8"0000000000000000"sv}) {
+            for (auto const suffix : {u8""sv, u8"u8"sv, u8"i128"sv}) {
+               lingua_test::for_each_string(u8"0179f_"sv, 5, [=](std::u8string_view const tail) {
+                  check_integer(std::u8string{prefix} + std::u8string{padding}
+                                + std::u8string{tail} + std::u8string{suffix});
+               });
+            }
+         }
+      }
+   }
+
+   SUBCASE("on long random literals") {
+      constexpr auto prefixes = std::array{u8""sv, u8"0x"sv, u8"0o"sv, u8"0b"sv};
+      constexpr auto suffixes = std::array{u8""sv, u8"u8"sv, u8"u64"sv, u8"i64"sv, u8"i128"sv,
+         u8"usize"sv, u8"f32"sv};
+      constexpr auto digits = u8"0123456789abcdefABCDEF_"sv;
+      auto engine = std::mt19937_64{0x696e7473};
+      for (auto i = 0; i < 20000; ++i) {
+         auto const base = engine() % prefixes.size();
+         auto const radix = std::array{10U, 16U, 8U, 2U}[base];
+         auto literal = std::u8string{prefixes[base]};
+         for (auto count = engine() % 48; count > 0; --count) {
+            // Mostly digits of the literal's base, with the odd `_` or out-of-range digit.
+            auto const pick = engine() % 32;
+            literal += pick == 0 ? u8'_' : pick == 1 ? digits[engine() % digits.size()]
+                                                    : digits[engine() % radix];
+         }
+         literal += suffixes[engine() % suffixes.size()];
+         check_integer(literal);
+      }
+   }
+}
+
+TEST_CASE("checks parse_float_literal agrees with the C library") {
+   SUBCASE("on every short literal") {
+      // The prefixes put the short tails after enough significant digits for eight-digit blocks
+      // to be read at once, or for digits to be truncated.
+      constexpr auto prefixes = std::array{u8"1"sv, u8"1234567"sv, u8"0.0000000"sv,
+         u8"9876543210987654321"sv};
+      constexpr auto suffixes = std::array{u8""sv, u8"f32"sv, u8"e-30"sv, u8"e300"sv};
+      for (auto const prefix : prefixes) {
+         for (auto const suffix : suffixes) {
+            lingua_test::for_each_string(u8"09_.e+"sv, 5, [=](std::u8string_view const tail) {
+               check_float(std::u8string{prefix} + std::u8string{tail} + std::u8string{suffix});
+            });
+         }
+      }
+   }
+
+   SUBCASE("on long random literals") {
+      constexpr auto suffixes = std::array{u8""sv, u8"f32"sv, u8"f64"sv};
+      auto engine = std::mt19937_64{0x666c7473};
+      auto const digits = [&engine](std::u8string& literal, std::uint64_t const count) {
+         literal += static_cast<char8_t>(u8'0' + engine() % 10);
+         for (auto i = std::uint64_t{1}; i < count; ++i) {
+            literal += engine() % 16 == 0 ? u8'_' : static_cast<char8_t>(u8'0' + engine() % 10);
+         }
+      };
+
+      for (auto i = 0; i < 20000; ++i) {
+         auto literal = std::u8string{};
+         digits(literal, 1 + engine() % 40);
+         if (engine() % 4 != 0) {
+            literal += u8'.';
+            digits(literal, 1 + engine() % 40);
+         }
+         if (engine() % 2 == 0) {
+            literal += u8'e';
+            literal += engine() % 2 == 0 ? u8"-" : u8"";
+            for (auto const c : std::to_string(engine() % 360)) {
+               literal += static_cast<char8_t>(c);
+            }
+         }
+         literal += suffixes[engine() % suffixes.size()];
+         check_float(literal);
+      }
+   }
+}
+
+TEST_CASE("checks is_xid_start and is_xid_continue agree with DerivedCoreProperties.txt") {
+   SUBCASE("on every code point") {
+      for_each_scalar_value([](std::u8string_view const text) {
+         lingua_test::check_agreement(text, classify, reference_classify);
+      });
+   }
+}
+
+TEST_CASE("checks nfc_quick_check agrees with the UCD's normalization properties") {
+   SUBCASE("on every code point") {
+      for_each_scalar_value([](std::u8string_view const text) {
+         lingua_test::check_agreement(text, quick_check, reference_quick_check);
+      });
+   }
+
+   SUBCASE("on random runs of marks") {
+      // Every code point that the quick check can't pass over on its own, and a few that it can.
+      auto marks = std::vector<std::u8string>{u8"a", u8"\u00e9", u8"\uac00", u8"\u1100"};
+      for (auto c = char32_t{0}; c <= 0x10ffff; ++c) {
+         if (ucd().combining_class[c] != 0 or ucd().quick_check[c] != 0) {
+            append_utf8(marks.emplace_back(), c);
+         }
+      }
+
+      auto const pieces = std::vector<std::u8string_view>(marks.begin(), marks.end());
+      auto engine = std::mt19937_64{0x6e666371};
+      for (auto i = 0; i < 20000; ++i) {
+         auto const text = lingua_test::random_string(engine, pieces, 6);
+         lingua_test::check_agreement(text, quick_check, reference_quick_check);
+      }
+   }
+}
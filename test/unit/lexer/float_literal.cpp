@@ -0,0 +1,241 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/float_literal.hpp"
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <doctest.h>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace {
+   using lingua::float_literal_error, lingua::float_type;
+   using namespace std::string_view_literals;
+
+   /// \brief Returns the correctly rounded value of `literal`, according to the C library.
+   ///
+   template<typename T>
+   T expected_value(std::u8string_view const literal)
+   {
+      auto text = std::string{};
+      for (auto const c : literal) {
+         if (c != u8'_') {
+            text += static_cast<char>(c);
+         }
+      }
+
+      if constexpr (std::is_same_v<T, float>) {
+         return std::strtof(text.c_str(), nullptr);
+      }
+      else {
+         return std::strtod(text.c_str(), nullptr);
+      }
+   }
+
+   void check_value(std::u8string_view const literal, double const expected,
+      float_type const type = float_type::unsuffixed)
+   {
+      auto const parsed = lingua::parse_float_literal(literal);
+      CHECK(parsed.error == float_literal_error::none);
+      CHECK(std::bit_cast<std::uint64_t>(parsed.value) == std::bit_cast<std::uint64_t>(expected));
+      CHECK(parsed.type == type);
+   }
+
+   /// \brief Checks that `literal` is converted the same way as the C library converts it.
+   ///
+   void check_error(std::u8string_view const literal, float_literal_error const error,
+      std::uint32_t const offset)
+   {
+      auto const parsed = lingua::parse_float_literal(literal);
+      CHECK(parsed.error == error);
+      CHECK(parsed.error_offset == offset);
+   }
+
+   /// \brief Checks that `literal` is converted the same way as the C library converts it, both
+   ///        unsuffixed and as an f32.
+   ///
+   void check_agrees(std::u8string_view const literal)
+   {
+      if (auto const expected = expected_value<double>(literal);
+          expected == std::numeric_limits<double>::infinity()) {
+         check_error(literal, float_literal_error::overflow, 0);
+      }
+      else {
+         check_value(literal, expected);
+      }
+
+      auto with_suffix = std::u8string{literal};
+      with_suffix += u8"f32";
+      if (auto const expected = expected_value<float>(literal);
+          expected == std::numeric_limits<float>::infinity()) {
+         check_error(with_suffix, float_literal_error::overflow, 0);
+      }
+      else {
+         check_value(with_suffix, static_cast<double>(expected), float_type::f32);
+      }
+   }
+
+   std::u8string to_literal(std::string_view const text)
+   {
+      auto literal = std::u8string{};
+      for (auto const c : text) {
+         literal += static_cast<char8_t>(c);
+      }
+      return literal;
+   }
+
+   template<typename T, typename... Args>
+   std::u8string write_literal(T const value, Args const... args)
+   {
+      auto buffer = std::array<char, 1200>{};
+      auto const end = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value,
+         args...).ptr;
+      return to_literal(std::string_view(buffer.data(), end));
+   }
+} // namespace
+
+TEST_CASE("checks float literal values") {
+   SUBCASE("in each shape") {
+      check_value(u8"0.0"sv, 0.0);
+      check_value(u8"1.5"sv, 1.5);
+      check_value(u8"1."sv, 1.0);
+      check_value(u8"1e10"sv, 1e10);
+      check_value(u8"2.5E-3"sv, 2.5e-3);
+      check_value(u8"1e+2"sv, 100.0);
+      check_value(u8"0.1"sv, 0.1);
+      check_value(u8"123456789.123456789e-5"sv, 123456789.123456789e-5);
+   }
+
+   SUBCASE("with separators") {
+      check_value(u8"1_000.000_1"sv, 1000.0001);
+      check_value(u8"1_2.3_4e1_0"sv, 12.34e10);
+      check_value(u8"1e+_5"sv, 1e5);
+      check_value(u8"12_345_678_901_234_567_890.0"sv, 12345678901234567890.0);
+   }
+
+   SUBCASE("with suffixes") {
+      check_value(u8"0.1f32"sv, static_cast<double>(0.1F), float_type::f32);
+      check_value(u8"0.1f64"sv, 0.1, float_type::f64);
+      check_value(u8"1f32"sv, 1.0, float_type::f32);
+      check_value(u8"2.5e3_f64"sv, 2500.0, float_type::f64);
+   }
+
+   SUBCASE("at the edges of each type") {
+      check_agrees(u8"1.7976931348623157e308"sv);
+      check_agrees(u8"2.2250738585072014e-308"sv);
+      check_agrees(u8"2.2250738585072011e-308"sv);
+      check_agrees(u8"4.9406564584124654e-324"sv);
+      check_agrees(u8"2.4703282292062327e-324"sv);
+      check_agrees(u8"2.4703282292062328e-324"sv);
+      check_agrees(u8"1e-400"sv);
+      check_agrees(u8"3.4028234663852886e38"sv);
+      check_agrees(u8"1.17549435e-38"sv);
+      check_agrees(u8"1.4e-45"sv);
+      check_agrees(u8"7e-46"sv);
+      check_value(u8"0e999999999999999999999"sv, 0.0);
+      check_value(u8"1e-999999999999999999999"sv, 0.0);
+   }
+
+   SUBCASE("halfway between two values") {
+      // 2^53 + 1 is halfway between 2^53 and 2^53 + 2, and ties go to the even mantissa.
+      check_agrees(u8"9007199254740993"sv);
+      check_agrees(u8"9007199254740995"sv);
+      check_agrees(u8"9007199254740993.000000000000000000000000000001"sv);
+      check_agrees(u8"9007199254740992.999999999999999999999999999999"sv);
+      check_agrees(u8"16777217"sv);
+      check_agrees(u8"16777217.00000000000000000000000000000000000001"sv);
+
+      // The exact halfway point between 1 and the next double up, and the same with a long tail.
+      check_agrees(u8"1.00000000000000011102230246251565404236316680908203125"sv);
+      check_agrees(u8"1.000000000000000111022302462515654042363166809082031250000000001"sv);
+      check_agrees(u8"1.00000000000000011102230246251565404236316680908203124999999999"sv);
+   }
+
+   SUBCASE("with many digits") {
+      auto literal = std::u8string(u8"0.");
+      literal.append(1000, u8'0');
+      literal += u8"1e1000";
+      check_agrees(literal);
+
+      // Halfway between zero and the smallest f32 subnormal is a double, so it can be written out
+      // in full, and then nudged up.
+      auto const halfway = write_literal(
+         static_cast<double>(std::numeric_limits<float>::denorm_min()) / 2,
+         std::chars_format::fixed, 200);
+      check_agrees(halfway);
+      check_agrees(halfway + u8"1");
+      check_agrees(
+         write_literal(std::numeric_limits<double>::denorm_min(), std::chars_format::fixed, 1080));
+
+      auto ones = std::u8string(900, u8'1');
+      check_agrees(ones);
+      check_agrees(ones + u8"e-1000");
+      check_agrees(ones + u8"e-1199");
+   }
+
+   SUBCASE("agrees with the C library") {
+      auto engine = std::mt19937_64{0x666c6f6174};
+      for (auto i = 0; i < 20'000; ++i) {
+         auto const bits = engine();
+         auto const value = std::bit_cast<double>(bits & ~(std::uint64_t{1} << 63U));
+         if (value == std::numeric_limits<double>::infinity() or value != value) {
+            continue;
+         }
+
+         check_agrees(write_literal(value));
+         check_agrees(write_literal(value, std::chars_format::scientific, 16 + i % 24));
+
+         auto const single = std::bit_cast<float>(static_cast<std::uint32_t>(bits & 0x7f7fffff));
+         check_agrees(write_literal(single, std::chars_format::scientific, 7 + i % 12));
+      }
+
+      // Random digit strings have no reason to be near any value's shortest form.
+      auto digits = std::uniform_int_distribution<int>{0, 9};
+      auto lengths = std::uniform_int_distribution<int>{1, 60};
+      auto exponents = std::uniform_int_distribution<int>{-380, 330};
+      for (auto i = 0; i < 20'000; ++i) {
+         auto literal = std::u8string{};
+         for (auto length = lengths(engine); length > 0; --length) {
+            literal += static_cast<char8_t>(u8'0' + digits(engine));
+         }
+         literal += u8'e';
+         literal += to_literal(std::to_string(exponents(engine)));
+         check_agrees(literal);
+      }
+   }
+}
+
+TEST_CASE("checks float literal errors") {
+   check_error(u8"1e"sv, float_literal_error::missing_exponent_digits, 1);
+   check_error(u8"1.5E+_"sv, float_literal_error::missing_exponent_digits, 3);
+   check_error(u8"1e_f32"sv, float_literal_error::missing_exponent_digits, 1);
+   check_error(u8"1.0f16"sv, float_literal_error::unknown_suffix, 3);
+   check_error(u8"2.5u8"sv, float_literal_error::unknown_suffix, 3);
+   check_error(u8"1e309"sv, float_literal_error::overflow, 0);
+   check_error(u8"1.7976931348623159e308"sv, float_literal_error::overflow, 0);
+   check_error(u8"3.5e38f32"sv, float_literal_error::overflow, 0);
+   check_error(u8"1e999999999999999999999"sv, float_literal_error::overflow, 0);
+
+   CHECK(lingua::parse_float_literal(u8"1e309"sv).value == std::numeric_limits<double>::infinity());
+   CHECK(lingua::parse_float_literal(u8"1.7976931348623158e308"sv).error
+         == float_literal_error::none);
+}
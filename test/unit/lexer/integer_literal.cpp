@@ -0,0 +1,154 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/integer_literal.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <doctest.h>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace {
+   using lingua::integer_literal_error, lingua::integer_type, lingua::uint128;
+   using namespace std::string_view_literals;
+
+   constexpr auto max_u64 = ~std::uint64_t{0};
+
+   void check_value(std::u8string_view const literal, uint128 const expected,
+      integer_type const type = integer_type::unsuffixed)
+   {
+      auto const parsed = lingua::parse_integer_literal(literal);
+      CHECK(parsed.error == integer_literal_error::none);
+      CHECK(parsed.value == expected);
+      CHECK(parsed.type == type);
+   }
+
+   void check_error(std::u8string_view const literal, integer_literal_error const error,
+      std::uint32_t const offset, bool const negated = false)
+   {
+      auto const parsed = lingua::parse_integer_literal(literal, negated);
+      CHECK(parsed.error == error);
+      CHECK(parsed.error_offset == offset);
+   }
+
+   /// \brief Writes `value` in base `radix`, with a `_` after every `separator`th digit.
+   ///
+   std::u8string write_literal(std::uint64_t const value, int const radix, std::size_t separator)
+   {
+      auto buffer = std::array<char, 64>{};
+      auto const end =
+         std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, radix).ptr;
+
+      auto literal = std::u8string{};
+      switch (radix) {
+      case 16:
+         literal = u8"0x";
+         break;
+      case 8:
+         literal = u8"0o";
+         break;
+      case 2:
+         literal = u8"0b";
+         break;
+      default:
+         break;
+      }
+
+      for (auto p = buffer.data(); p != end; ++p) {
+         literal += static_cast<char8_t>(*p);
+         if (separator != 0 and static_cast<std::size_t>(p - buffer.data()) % separator == 0) {
+            literal += u8'_';
+         }
+      }
+      return literal;
+   }
+} // namespace
+
+TEST_CASE("checks integer literal values") {
+   SUBCASE("in each base") {
+      check_value(u8"0"sv, uint128{0, 0});
+      check_value(u8"1234567890"sv, uint128{1234567890, 0});
+      check_value(u8"0xdeadBEEF"sv, uint128{0xdeadbeef, 0});
+      check_value(u8"0o755"sv, uint128{0755, 0});
+      check_value(u8"0b1011"sv, uint128{11, 0});
+   }
+
+   SUBCASE("with separators") {
+      check_value(u8"1_000_000"sv, uint128{1000000, 0});
+      check_value(u8"0x_ffff_ffff_ffff_ffff"sv, uint128{max_u64, 0});
+      check_value(u8"1__2_"sv, uint128{12, 0});
+   }
+
+   SUBCASE("with suffixes") {
+      check_value(u8"255u8"sv, uint128{255, 0}, integer_type::u8);
+      check_value(u8"0xffu8"sv, uint128{255, 0}, integer_type::u8);
+      check_value(u8"1_i32"sv, uint128{1, 0}, integer_type::i32);
+      check_value(u8"0b1usize"sv, uint128{1, 0}, integer_type::usize);
+      check_value(u8"7i128"sv, uint128{7, 0}, integer_type::i128);
+   }
+
+   SUBCASE("wider than 64 bits") {
+      check_value(u8"18446744073709551616"sv, uint128{0, 1});
+      check_value(u8"0xffffffffffffffffffffffffffffffff"sv, uint128{max_u64, max_u64});
+      check_value(u8"340282366920938463463374607431768211455"sv, uint128{max_u64, max_u64});
+      check_value(u8"0x0000000000000000000000000000000000000001"sv, uint128{1, 0});
+   }
+
+   SUBCASE("agrees with std::to_chars") {
+      auto engine = std::mt19937_64{0x6c696e677561};
+      for (auto i = 0; i < 4000; ++i) {
+         auto const value = engine() >> (engine() % 64);
+         for (auto const radix : {2, 8, 10, 16}) {
+            auto const separator = static_cast<std::size_t>(i % 5);
+            check_value(write_literal(value, radix, separator), uint128{value, 0});
+         }
+      }
+   }
+}
+
+TEST_CASE("checks integer literal overflow") {
+   check_error(u8"256u8"sv, integer_literal_error::overflow, 0);
+   check_error(u8"0x1_0000u16"sv, integer_literal_error::overflow, 0);
+   check_error(u8"4294967296u32"sv, integer_literal_error::overflow, 0);
+   check_error(u8"18446744073709551616usize"sv, integer_literal_error::overflow, 0);
+   check_error(u8"340282366920938463463374607431768211456"sv, integer_literal_error::overflow, 0);
+   check_error(u8"0x1_0000_0000_0000_0000_0000_0000_0000_0000"sv, integer_literal_error::overflow,
+      0);
+
+   SUBCASE("signed literals may reach their minimum when negated") {
+      check_value(u8"127i8"sv, uint128{127, 0}, integer_type::i8);
+      check_error(u8"128i8"sv, integer_literal_error::overflow, 0);
+      CHECK(lingua::parse_integer_literal(u8"128i8"sv, true).error == integer_literal_error::none);
+      check_error(u8"129i8"sv, integer_literal_error::overflow, 0, true);
+
+      constexpr auto i128_min = u8"170141183460469231731687303715884105728i128"sv;
+      check_error(i128_min, integer_literal_error::overflow, 0);
+      auto const parsed = lingua::parse_integer_literal(i128_min, true);
+      CHECK(parsed.error == integer_literal_error::none);
+      CHECK(parsed.value == uint128{0, std::uint64_t{1} << 63U});
+   }
+}
+
+TEST_CASE("checks integer literal errors") {
+   check_error(u8"0b102"sv, integer_literal_error::unknown_digit, 4);
+   check_error(u8"0o1234_5678_9"sv, integer_literal_error::unknown_digit, 10);
+   check_error(u8"0x"sv, integer_literal_error::missing_digits, 2);
+   check_error(u8"0b__u8"sv, integer_literal_error::missing_digits, 2);
+   check_error(u8"1u7"sv, integer_literal_error::unknown_suffix, 1);
+   check_error(u8"0b1f32"sv, integer_literal_error::unknown_suffix, 3);
+}
@@ -17,6 +17,7 @@
 
 #include <cjdb/cctype/isxdigit.hpp>
 #include <cjdb/cctype/toupper.hpp>
+#include <cstdint>
 #include <doctest.h>
 #include <fmt/format.h>
 #include <limits>
@@ -26,6 +27,7 @@
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/transform.hpp>
+#include <string_view>
 
 template<int escape_max, class F>
 void check_is_escape_common(F const& is_escape) noexcept
@@ -373,3 +375,52 @@ TEST_CASE("checks Unicode escapes are valid") {
       }
    }
 }
+
+TEST_CASE("checks Unicode escapes are decoded") {
+   using lingua::decode_unicode_escape, lingua::unicode_escape_error;
+   auto const check_decoded = [](std::u8string_view const text, char32_t const code_point,
+                                 unicode_escape_error const error, std::uint32_t const length) {
+      auto const decoded = decode_unicode_escape(text);
+      CHECK(decoded.error == error);
+      CHECK(decoded.length == length);
+      if (error == unicode_escape_error::none or error == unicode_escape_error::surrogate
+          or error == unicode_escape_error::out_of_range) {
+         CHECK(decoded.code_point == code_point);
+      }
+   };
+
+   SUBCASE("scalar values") {
+      check_decoded(u8"\\u{0}", 0, unicode_escape_error::none, 5);
+      check_decoded(u8"\\u{41}", 0x41, unicode_escape_error::none, 6);
+      check_decoded(u8"\\u{e9}", 0xe9, unicode_escape_error::none, 6);
+      check_decoded(u8"\\u{D7FF}", 0xd7ff, unicode_escape_error::none, 8);
+      check_decoded(u8"\\u{E000}", 0xe000, unicode_escape_error::none, 8);
+      check_decoded(u8"\\u{1F600}", 0x1f600, unicode_escape_error::none, 9);
+      check_decoded(u8"\\u{10FFFF}", 0x10ffff, unicode_escape_error::none, 10);
+      check_decoded(u8"\\u{00000a}", 0xa, unicode_escape_error::none, 10);
+   }
+
+   SUBCASE("followed by more text") {
+      check_decoded(u8"\\u{41}bc}\"", 0x41, unicode_escape_error::none, 6);
+   }
+
+   SUBCASE("values that aren't scalar values") {
+      check_decoded(u8"\\u{D800}", 0xd800, unicode_escape_error::surrogate, 8);
+      check_decoded(u8"\\u{dfff}", 0xdfff, unicode_escape_error::surrogate, 8);
+      check_decoded(u8"\\u{110000}", 0x110000, unicode_escape_error::out_of_range, 10);
+      check_decoded(u8"\\u{FFFFFF}", 0xffffff, unicode_escape_error::out_of_range, 10);
+
+      CHECK(lingua::is_unicode_escape(u8"\\u{D800}"));
+      CHECK(lingua::is_unicode_escape(u8"\\u{110000}"));
+   }
+
+   SUBCASE("malformed escapes") {
+      check_decoded(u8"\\u", 0, unicode_escape_error::missing_open_brace, 2);
+      check_decoded(u8"\\u41", 0, unicode_escape_error::missing_open_brace, 3);
+      check_decoded(u8"\\u{}", 0, unicode_escape_error::missing_digits, 4);
+      check_decoded(u8"\\u{4x1}", 0, unicode_escape_error::unknown_digit, 5);
+      check_decoded(u8"\\u{1_F600}", 0, unicode_escape_error::unknown_digit, 5);
+      check_decoded(u8"\\u{1234567}", 0, unicode_escape_error::too_many_digits, 10);
+      check_decoded(u8"\\u{41", 0, unicode_escape_error::missing_close_brace, 5);
+   }
+}
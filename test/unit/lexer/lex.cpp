@@ -0,0 +1,419 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/lex.hpp"
+
+#include "lingua/lexer/token.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <doctest.h>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+   using lingua::exceeded_lex_limit, lingua::lex_limit, lingua::lex_limits, lingua::lexical_error,
+      lingua::lexical_error_kind, lingua::token_kind;
+   using namespace std::string_view_literals;
+
+   /// \brief Returns the kinds of the non-trivia tokens in `source`.
+   ///
+   std::vector<token_kind> kinds(std::u8string_view const source)
+   {
+      auto result = std::vector<token_kind>{};
+      for (auto const t : lingua::lex(source).tokens) {
+         if (not lingua::is_trivia(t.kind)) {
+            result.push_back(t.kind);
+         }
+      }
+      return result;
+   }
+
+   /// \brief Returns the text of the only token in `source`, or an empty string if there are more.
+   ///
+   std::u8string_view single_token(std::u8string_view const source)
+   {
+      auto const lexed = lingua::lex(source);
+      return lexed.tokens.size() == 1 ? lexed.tokens.front().text(source) : u8""sv;
+   }
+} // namespace
+
+TEST_CASE("checks the lexer covers the whole source") {
+   constexpr auto source = u8"fn main() {\n   let x = r#\"raw\"# + 'a'; // done\n}\n"sv;
+   auto const lexed = lingua::lex(source);
+   REQUIRE(not lexed.tokens.empty());
+   CHECK(lexed.errors.empty());
+   CHECK(lexed.tokens.front().offset == 0);
+   for (auto i = std::size_t{1}; i < lexed.tokens.size(); ++i) {
+      CHECK(lexed.tokens[i - 1].offset + lexed.tokens[i - 1].length == lexed.tokens[i].offset);
+   }
+   CHECK(lexed.tokens.back().offset + lexed.tokens.back().length == source.size());
+}
+
+TEST_CASE("checks identifiers and keywords") {
+   CHECK(kinds(u8"fn main") == std::vector{token_kind::keyword, token_kind::identifier});
+   CHECK(kinds(u8"Self self _ _x") == std::vector{token_kind::keyword, token_kind::keyword,
+      token_kind::identifier, token_kind::identifier});
+   CHECK(kinds(u8"r#fn r b br") == std::vector{token_kind::raw_identifier, token_kind::identifier,
+      token_kind::identifier, token_kind::identifier});
+   CHECK(kinds(u8"'a 'static") == std::vector{token_kind::lifetime, token_kind::lifetime});
+
+   SUBCASE("outside ASCII") {
+      CHECK(single_token(u8"über_größe") == u8"über_größe");
+      CHECK(single_token(u8"_\u0301") == u8"_\u0301");
+      CHECK(single_token(u8"r#π") == u8"r#π");
+      CHECK(single_token(u8"'λ") == u8"'λ");
+      CHECK(kinds(u8"let 変数 = δ·1;") == std::vector{token_kind::keyword, token_kind::identifier,
+         token_kind::eq, token_kind::identifier, token_kind::semicolon});
+
+      // U+0301 COMBINING ACUTE ACCENT may only continue an identifier, and emoji are never a part
+      // of one.
+      CHECK(kinds(u8"\u0301x") == std::vector{token_kind::unknown, token_kind::identifier});
+      CHECK(kinds(u8"a\U0001F980") == std::vector{token_kind::identifier, token_kind::unknown});
+   }
+}
+
+TEST_CASE("checks literals") {
+   SUBCASE("numbers") {
+      CHECK(single_token(u8"0x1F_u8") == u8"0x1F_u8");
+      CHECK(single_token(u8"1_000i64") == u8"1_000i64");
+      CHECK(single_token(u8"1.5e-3f32") == u8"1.5e-3f32");
+      CHECK(single_token(u8"1.") == u8"1.");
+      CHECK(kinds(u8"1.5") == std::vector{token_kind::float_literal});
+      CHECK(kinds(u8"1e9") == std::vector{token_kind::float_literal});
+      CHECK(kinds(u8"1..2") == std::vector{token_kind::integer_literal, token_kind::dot_dot,
+         token_kind::integer_literal});
+      CHECK(kinds(u8"x.0.1") == std::vector{token_kind::identifier, token_kind::dot,
+         token_kind::float_literal});
+      CHECK(kinds(u8"1.max(2)") == std::vector{token_kind::integer_literal, token_kind::dot,
+         token_kind::identifier, token_kind::open_paren, token_kind::integer_literal,
+         token_kind::close_paren});
+   }
+
+   SUBCASE("characters") {
+      CHECK(single_token(u8"'a'") == u8"'a'");
+      CHECK(single_token(u8"'\\''") == u8"'\\''");
+      CHECK(single_token(u8"'\\u{1F600}'") == u8"'\\u{1F600}'");
+      CHECK(single_token(u8"'é'") == u8"'é'");
+      CHECK(single_token(u8"b'\\x7f'") == u8"b'\\x7f'");
+   }
+
+   SUBCASE("strings") {
+      CHECK(single_token(u8R"("hello\"world")") == u8R"("hello\"world")");
+      CHECK(single_token(u8R"(b"bytes")") == u8R"(b"bytes")");
+      CHECK(single_token(u8R"(r"C:\")") == u8R"(r"C:\")");
+      CHECK(single_token(u8R"(r##"a "# b"##)") == u8R"(r##"a "# b"##)");
+      CHECK(single_token(u8R"(br#"raw"#)") == u8R"(br#"raw"#)");
+      CHECK(kinds(u8R"(r#"a"# #)") == std::vector{token_kind::raw_string_literal, token_kind::pound});
+   }
+}
+
+TEST_CASE("checks comments nest") {
+   CHECK(single_token(u8"/* a /* b */ c */") == u8"/* a /* b */ c */");
+   CHECK(kinds(u8"// line\nx") == std::vector{token_kind::identifier});
+   CHECK(kinds(u8"/**/x") == std::vector{token_kind::identifier});
+}
+
+TEST_CASE("checks punctuation is lexed greedily") {
+   CHECK(kinds(u8"<<= >>= ..= ... :: -> => && ||") == std::vector{token_kind::shl_eq,
+      token_kind::shr_eq, token_kind::dot_dot_eq, token_kind::dot_dot_dot,
+      token_kind::path_separator, token_kind::right_arrow, token_kind::fat_arrow,
+      token_kind::ampersand_ampersand, token_kind::pipe_pipe});
+   CHECK(kinds(u8"a<<b") == std::vector{token_kind::identifier, token_kind::shl,
+      token_kind::identifier});
+}
+
+TEST_CASE("checks lexical errors") {
+   SUBCASE("unknown tokens") {
+      constexpr auto source = u8"a ` b \u00a7"sv;
+      auto const lexed = lingua::lex(source);
+      CHECK(lexed.errors == std::vector{
+         lexical_error{lexical_error_kind::unknown_token, 2, 1},
+         lexical_error{lexical_error_kind::unknown_token, 6, 2},
+      });
+   }
+
+   SUBCASE("unterminated comments and strings run to the end of the source") {
+      constexpr auto comment = u8"x /* a /* b */"sv;
+      CHECK(lingua::lex(comment).errors == std::vector{
+         lexical_error{lexical_error_kind::unterminated_comment, 2, 12},
+      });
+
+      constexpr auto string = u8R"(x "abc\")"sv;
+      CHECK(lingua::lex(string).errors == std::vector{
+         lexical_error{lexical_error_kind::unterminated_string_literal, 2, 6},
+      });
+
+      constexpr auto raw = u8R"(r#"abc"x#)"sv;
+      CHECK(lingua::lex(raw).errors == std::vector{
+         lexical_error{lexical_error_kind::unterminated_string_literal, 0, 9},
+      });
+   }
+
+   SUBCASE("unterminated character literals") {
+      constexpr auto source = u8"' x"sv;
+      auto const lexed = lingua::lex(source);
+      CHECK(lexed.errors == std::vector{
+         lexical_error{lexical_error_kind::unterminated_char_literal, 0, 1},
+      });
+      CHECK(lexed.tokens.front().kind == token_kind::unknown);
+   }
+
+   SUBCASE("prohibited raw identifiers") {
+      constexpr auto source = u8"r#crate r#foo"sv;
+      CHECK(lingua::lex(source).errors == std::vector{
+         lexical_error{lexical_error_kind::invalid_identifier, 0, 7},
+      });
+   }
+}
+
+TEST_CASE("checks lexing stops when it exceeds a limit") {
+   constexpr auto source = u8"fn f() { \"long string\" /* /* /* */ */ */ ` ~ }"sv;
+
+   auto const check_stop = [source](lex_limits const& limits, lex_limit const limit,
+                              std::uint64_t const value, std::u8string_view const rest) {
+      auto const lexed = lingua::lex(source, limits);
+      auto const offset = static_cast<std::uint32_t>(source.size() - rest.size());
+      CHECK(lexed.exceeded_limit == exceeded_lex_limit{limit, value, offset});
+
+      REQUIRE(not lexed.tokens.empty());
+      CHECK(lexed.tokens.back().kind == token_kind::unknown);
+      CHECK(lexed.tokens.back().text(source) == rest);
+      for (auto const& error : lexed.errors) {
+         CHECK(error.offset < offset);
+      }
+   };
+
+   SUBCASE("no limits are exceeded") {
+      auto const governed = lingua::lex(source, lex_limits{});
+      auto const ungoverned = lingua::lex(source);
+      CHECK(not governed.exceeded_limit);
+      CHECK(governed.tokens == ungoverned.tokens);
+      CHECK(governed.errors == ungoverned.errors);
+   }
+
+   SUBCASE("bytes") {
+      auto limits = lex_limits{};
+      limits.max_bytes = source.size() - 1;
+      check_stop(limits, lex_limit::bytes, limits.max_bytes, source);
+
+      limits.max_bytes = source.size();
+      CHECK(not lingua::lex(source, limits).exceeded_limit);
+   }
+
+   SUBCASE("tokens") {
+      auto limits = lex_limits{};
+      limits.max_tokens = 3;
+      auto const lexed = lingua::lex(source, limits);
+      CHECK(lexed.tokens.size() == 4);
+      check_stop(limits, lex_limit::tokens, 3, source.substr(4));
+   }
+
+   SUBCASE("errors") {
+      auto limits = lex_limits{};
+      limits.max_errors = 1;
+      check_stop(limits, lex_limit::errors, 1, u8"~ }"sv);
+      CHECK(lingua::lex(source, limits).errors.size() == 1);
+
+      limits.max_errors = 0;
+      check_stop(limits, lex_limit::errors, 0, u8"` ~ }"sv);
+   }
+
+   SUBCASE("literal length") {
+      auto limits = lex_limits{};
+      limits.max_literal_length = 12;
+      check_stop(limits, lex_limit::literal_length, 12, source.substr(9));
+
+      limits.max_literal_length = 13;
+      CHECK(not lingua::lex(source, limits).exceeded_limit);
+   }
+
+   SUBCASE("comment depth") {
+      auto limits = lex_limits{};
+      limits.max_comment_depth = 2;
+      check_stop(limits, lex_limit::comment_depth, 2, source.substr(23));
+
+      limits.max_comment_depth = 3;
+      CHECK(not lingua::lex(source, limits).exceeded_limit);
+   }
+
+   SUBCASE("literals stop at the same place however close they are to the limit") {
+      // Each literal's end depends on bytes after it, or runs to the end of the source.
+      constexpr auto literals = u8"1.0e10 1. 0x1f_u8 'a' b'\\n' b\"bytes\" r##\"raw\"#\"## \"open"sv;
+      auto const ungoverned = lingua::lex(literals);
+      for (auto length = std::size_t{0}; length <= literals.size(); ++length) {
+         auto limits = lex_limits{};
+         limits.max_literal_length = length;
+         auto const governed = lingua::lex(literals, limits);
+         CAPTURE(length);
+
+         auto const first_too_long = std::ranges::find_if(ungoverned.tokens, [length](auto const t) {
+            return t.kind != token_kind::whitespace and t.length > length;
+         });
+         if (first_too_long == ungoverned.tokens.end()) {
+            CHECK(not governed.exceeded_limit);
+            CHECK(governed.tokens == ungoverned.tokens);
+            continue;
+         }
+
+         auto const kept = static_cast<std::size_t>(first_too_long - ungoverned.tokens.begin());
+         CHECK(governed.exceeded_limit
+            == exceeded_lex_limit{lex_limit::literal_length, length, first_too_long->offset});
+         REQUIRE(governed.tokens.size() == kept + 1);
+         CHECK(std::ranges::equal(governed.tokens | std::views::take(kept),
+            ungoverned.tokens | std::views::take(kept)));
+      }
+   }
+
+   SUBCASE("long literals and comments are stopped before their end") {
+      constexpr auto size = std::size_t{1} << 26U;
+      auto limits = lex_limits{};
+      limits.max_literal_length = 64;
+      limits.max_comment_depth = 4;
+
+      auto literal = std::u8string{u8"x = \""};
+      literal.resize(size, u8'a');
+      CHECK(lingua::lex(literal, limits).exceeded_limit
+         == exceeded_lex_limit{lex_limit::literal_length, 64, 4});
+
+      auto comment = std::u8string{u8"/* /* /* /* /* "};
+      comment.resize(size, u8'a');
+      CHECK(lingua::lex(comment, limits).exceeded_limit
+         == exceeded_lex_limit{lex_limit::comment_depth, 4, 0});
+   }
+
+   SUBCASE("time is only checked every so often") {
+      auto limits = lex_limits{};
+      limits.max_time = std::chrono::milliseconds{-1};
+      limits.time_check_interval = 9;
+      check_stop(limits, lex_limit::time, static_cast<std::uint64_t>(-1), source.substr(9));
+
+      limits.time_check_interval = source.size();
+      CHECK(not lingua::lex(source, limits).exceeded_limit);
+
+      limits.time_check_tokens = 3;
+      check_stop(limits, lex_limit::time, static_cast<std::uint64_t>(-1), source.substr(4));
+   }
+
+   SUBCASE("time is checked between many short tokens") {
+      constexpr auto n = std::size_t{2'000'000};
+      auto delimiters = std::u8string(n, u8'(');
+      delimiters.append(n, u8']');
+
+      auto limits = lex_limits{};
+      limits.max_time = std::chrono::milliseconds{20};
+      limits.time_check_interval = lex_limits::unbounded;
+      auto const start = std::chrono::steady_clock::now();
+      auto const lexed = lingua::lex(delimiters, limits);
+      auto const elapsed = std::chrono::steady_clock::now() - start;
+      CHECK((not lexed.exceeded_limit or lexed.exceeded_limit->limit == lex_limit::time));
+      CHECK(elapsed < limits.max_time + std::chrono::milliseconds{250});
+   }
+
+   SUBCASE("unclosed delimiters are reported where lexing stops") {
+      auto limits = lex_limits{};
+      limits.max_tokens = 9;
+      auto const lexed = lingua::lex(source, limits);
+      REQUIRE(lexed.delimiters.errors().size() == 1);
+      CHECK(lexed.delimiters.errors().front().offset == 7);
+   }
+}
+
+TEST_CASE("checks a lexer can resume from any token boundary") {
+   constexpr auto source = u8"fn f() -> u32 { /* c */ 0x10 + r\"s\".len() as u32 }"sv;
+   auto const expected = lingua::lex(source).tokens;
+   for (auto i = std::size_t{0}; i < expected.size(); ++i) {
+      auto resumed = lingua::lexer{source, expected[i].offset};
+      for (auto j = i; j < expected.size(); ++j) {
+         REQUIRE(not resumed.done());
+         CHECK(resumed.next() == expected[j]);
+      }
+      CHECK(resumed.done());
+   }
+}
+
+TEST_CASE("checks a lexer can resume from a checkpoint") {
+   constexpr auto sources = std::array{
+      u8"fn f() { /* a /* nested */ comment */ \"a \\\" string\" + r##\"a \"# raw\"## }"sv,
+      u8"b\"bytes\\\\\" br#\"raw \"bytes\"# 'c' // line\n/* unterminated /* comment */"sv,
+      u8"let s = \"unterminated \\\" string"sv,
+      u8"let s = r#\"unterminated \"raw string"sv,
+   };
+
+   for (auto const source : sources) {
+      auto const expected = lingua::lex(source);
+      for (auto interval = std::size_t{1}; interval < 20; ++interval) {
+         auto const checkpoints = lingua::make_checkpoints(source, interval);
+         REQUIRE(not checkpoints.empty());
+         CHECK(checkpoints.front() == lingua::lexer_checkpoint{});
+
+         for (auto i = std::size_t{0}; i < checkpoints.size(); ++i) {
+            auto const& checkpoint = checkpoints[i];
+            if (i > 0) {
+               CHECK(checkpoints[i - 1].offset < checkpoint.offset);
+            }
+
+            REQUIRE(checkpoint.token_index < expected.tokens.size());
+            auto const& t = expected.tokens[checkpoint.token_index];
+            CHECK(t.offset == checkpoint.token_offset);
+            CHECK(checkpoint.token_offset <= checkpoint.offset);
+            CHECK(checkpoint.offset < t.offset + t.length);
+            CHECK((checkpoint.mode == lingua::lexer_mode::code)
+               == (checkpoint.offset == checkpoint.token_offset));
+
+            auto resumed = lingua::lexer{source, checkpoint};
+            for (auto j = std::size_t{checkpoint.token_index}; j < expected.tokens.size(); ++j) {
+               REQUIRE(not resumed.done());
+               CHECK(resumed.next() == expected.tokens[j]);
+            }
+            CHECK(resumed.done());
+         }
+      }
+   }
+}
+
+TEST_CASE("checks lexing a region from the nearest checkpoint") {
+   constexpr auto source =
+      u8"fn f() {\n   /* a comment */ let s = \"text\"; 'x\n   r#\"raw\"# + 1.5e3\n}"sv;
+   auto const expected = lingua::lex(source);
+   auto const checkpoints = lingua::make_checkpoints(source, 8);
+
+   for (auto begin = std::size_t{0}; begin <= source.size(); ++begin) {
+      for (auto end = begin; end <= source.size(); ++end) {
+         auto const region = lingua::lex_region(source, checkpoints, begin, end);
+
+         auto first = std::size_t{0};
+         while (first < expected.tokens.size()
+            and expected.tokens[first].offset + expected.tokens[first].length <= begin) {
+            ++first;
+         }
+         auto last = first;
+         while (begin < end and last < expected.tokens.size() and expected.tokens[last].offset < end) {
+            ++last;
+         }
+
+         CHECK(region.first_token == first);
+         REQUIRE(region.tokens.size() == last - first);
+         CHECK(std::equal(region.tokens.begin(), region.tokens.end(),
+            expected.tokens.begin() + static_cast<std::ptrdiff_t>(first)));
+         for (auto const& error : region.errors) {
+            CHECK(std::ranges::find(expected.errors, error) != expected.errors.end());
+         }
+      }
+   }
+}
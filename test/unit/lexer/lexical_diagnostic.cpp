@@ -0,0 +1,195 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/lexical_diagnostic.hpp"
+
+#include "lingua/lexer/lex.hpp"
+#include "lingua/source_coordinate.hpp"
+#include "lingua/source_coordinate_range.hpp"
+#include <doctest.h>
+#include <string>
+#include <string_view>
+#include <variant>
+
+namespace {
+   using lingua::source_coordinate, lingua::source_coordinate_range;
+   using namespace std::string_view_literals;
+
+   constexpr source_coordinate at(std::intmax_t const line, std::intmax_t const column) noexcept
+   {
+      return source_coordinate{
+         source_coordinate::line_type{line},
+         source_coordinate::column_type{column}
+      };
+   }
+} // namespace
+
+TEST_CASE("checks lexical errors become diagnostics") {
+   constexpr auto source = u8"fn f() {\n   x ` y;\n   r#self\n}\n\"abc"sv;
+   auto const lexed = lingua::lex(source);
+   auto const diagnostics = lingua::make_diagnostics(source, lexed.errors);
+   REQUIRE(diagnostics.size() == 3);
+
+   SUBCASE("checks an unknown token") {
+      auto const* const diagnostic = std::get_if<lingua::unknown_token>(&diagnostics[0]);
+      REQUIRE(diagnostic != nullptr);
+      CHECK(diagnostic->coordinates() == source_coordinate_range{at(2, 6), at(2, 7)});
+   }
+
+   SUBCASE("checks a prohibited raw identifier") {
+      auto const* const diagnostic = std::get_if<lingua::invalid_identifier>(&diagnostics[1]);
+      REQUIRE(diagnostic != nullptr);
+      CHECK(diagnostic->coordinates() == source_coordinate_range{at(3, 4), at(3, 10)});
+   }
+
+   SUBCASE("checks an unterminated string literal") {
+      auto const* const diagnostic = std::get_if<lingua::unterminated_string_literal>(&diagnostics[2]);
+      REQUIRE(diagnostic != nullptr);
+      CHECK(diagnostic->coordinates() == source_coordinate_range{at(5, 1), at(5, 5)});
+   }
+}
+
+TEST_CASE("checks unterminated literals that the diagnostics would consider terminated") {
+   SUBCASE("checks a comment whose delimiters overlap") {
+      constexpr auto source = u8"/*/"sv;
+      auto const diagnostics = lingua::make_diagnostics(source, lingua::lex(source).errors);
+      REQUIRE(diagnostics.size() == 1);
+      CHECK(std::holds_alternative<lingua::unterminated_comment>(diagnostics[0]));
+   }
+
+   SUBCASE("checks a raw string whose last quote isn't a terminator") {
+      constexpr auto source = u8R"(r#"a"b#)"sv;
+      auto const diagnostics = lingua::make_diagnostics(source, lingua::lex(source).errors);
+      REQUIRE(diagnostics.size() == 1);
+      CHECK(std::holds_alternative<lingua::unterminated_string_literal>(diagnostics[0]));
+   }
+}
+
+TEST_CASE("checks unbalanced delimiters are merged with the other errors") {
+   constexpr auto source = u8"fn f( {\n   ` ]\n}"sv;
+   auto const diagnostics = lingua::make_diagnostics(source, lingua::lex(source));
+   REQUIRE(diagnostics.size() == 3);
+
+   auto const* const unclosed = std::get_if<lingua::unbalanced_delimiter>(&diagnostics[0]);
+   REQUIRE(unclosed != nullptr);
+   CHECK(unclosed->coordinates() == source_coordinate_range{at(1, 5), at(1, 6)});
+   CHECK(unclosed->help_message() == u8"unclosed delimiter: `(`");
+
+   CHECK(std::holds_alternative<lingua::unknown_token>(diagnostics[1]));
+
+   auto const* const unexpected = std::get_if<lingua::unbalanced_delimiter>(&diagnostics[2]);
+   REQUIRE(unexpected != nullptr);
+   CHECK(unexpected->coordinates() == source_coordinate_range{at(2, 6), at(2, 7)});
+   CHECK(unexpected->help_message() == u8"unexpected closing delimiter: `]`");
+}
+
+TEST_CASE("checks a lexer that stopped early reports where it stopped") {
+   constexpr auto source = u8"fn f() {\n   ` `\n}"sv;
+   auto limits = lingua::lex_limits{};
+   limits.max_errors = 1;
+   auto const diagnostics = lingua::make_diagnostics(source, lingua::lex(source, limits));
+   REQUIRE(diagnostics.size() == 3);
+
+   CHECK(std::holds_alternative<lingua::unbalanced_delimiter>(diagnostics[0]));
+   CHECK(std::holds_alternative<lingua::unknown_token>(diagnostics[1]));
+
+   auto const* const stopped = std::get_if<lingua::lex_limit_exceeded>(&diagnostics[2]);
+   REQUIRE(stopped != nullptr);
+   CHECK(stopped->coordinates() == source_coordinate_range{at(2, 6), at(2, 6)});
+   CHECK(stopped->help_message() == u8"lexing stopped: the file has more than 1 lexical errors");
+}
+
+TEST_CASE("checks runs of identical diagnostics are collapsed") {
+   constexpr auto source = u8"` ` ` ` ~ ~ ` `"sv;
+   auto const lexed = lingua::lex(source);
+
+   auto limits = lingua::diagnostic_limits{};
+   CHECK(lingua::make_diagnostics(source, lexed, limits).size() == 8);
+
+   limits.collapse_runs_of = 3;
+   auto const diagnostics = lingua::make_diagnostics(source, lexed, limits);
+   REQUIRE(diagnostics.size() == 6);
+   CHECK(std::holds_alternative<lingua::unknown_token>(diagnostics[0]));
+
+   auto const* const repeated = std::get_if<lingua::repeated_diagnostic>(&diagnostics[1]);
+   REQUIRE(repeated != nullptr);
+   CHECK(repeated->coordinates() == source_coordinate_range{at(1, 3), at(1, 8)});
+   CHECK(repeated->help_message() == u8"the previous diagnostic is repeated 3 more times");
+
+   // Runs shorter than collapse_runs_of are left alone.
+   CHECK(std::holds_alternative<lingua::unknown_token>(diagnostics[2]));
+   CHECK(std::holds_alternative<lingua::unknown_token>(diagnostics[3]));
+   CHECK(std::holds_alternative<lingua::unknown_token>(diagnostics[4]));
+   CHECK(std::holds_alternative<lingua::unknown_token>(diagnostics[5]));
+}
+
+TEST_CASE("checks diagnostics stop at a cap") {
+   constexpr auto source = u8"` ~ ` ~ ` ~"sv;
+   auto const lexed = lingua::lex(source);
+
+   SUBCASE("for one file") {
+      auto limits = lingua::diagnostic_limits{};
+      limits.max_per_file = 2;
+      auto const diagnostics = lingua::make_diagnostics(source, lexed, limits);
+      REQUIRE(diagnostics.size() == 3);
+
+      auto const* const suppressed = std::get_if<lingua::diagnostics_suppressed>(&diagnostics[2]);
+      REQUIRE(suppressed != nullptr);
+      CHECK(suppressed->coordinates() == source_coordinate_range{at(1, 5), at(1, 5)});
+      CHECK(suppressed->help_message()
+            == u8"too many diagnostics: stopped reporting here, with 4 errors left");
+
+      limits.max_per_file = 6;
+      CHECK(lingua::make_diagnostics(source, lexed, limits).size() == 6);
+   }
+
+   SUBCASE("for every file that shares a budget") {
+      auto budget = lingua::diagnostic_budget{8};
+      auto limits = lingua::diagnostic_limits{};
+      limits.budget = &budget;
+
+      CHECK(lingua::make_diagnostics(source, lexed, limits).size() == 6);
+      auto const diagnostics = lingua::make_diagnostics(source, lexed, limits);
+      REQUIRE(diagnostics.size() == 3);
+      CHECK(std::holds_alternative<lingua::diagnostics_suppressed>(diagnostics[2]));
+      CHECK(budget.remaining() == 0);
+
+      auto const none = lingua::make_diagnostics(source, lexed, limits);
+      REQUIRE(none.size() == 1);
+      CHECK(std::holds_alternative<lingua::diagnostics_suppressed>(none[0]));
+   }
+
+   SUBCASE("a repeat counts as one diagnostic") {
+      constexpr auto repeats = u8"` ` ` ` ~"sv;
+      auto limits = lingua::diagnostic_limits{};
+      limits.collapse_runs_of = 2;
+      limits.max_per_file = 2;
+      auto const diagnostics = lingua::make_diagnostics(repeats, lingua::lex(repeats), limits);
+      REQUIRE(diagnostics.size() == 3);
+      CHECK(std::holds_alternative<lingua::repeated_diagnostic>(diagnostics[1]));
+      CHECK(std::holds_alternative<lingua::diagnostics_suppressed>(diagnostics[2]));
+   }
+}
+
+TEST_CASE("checks a binary file makes a bounded number of diagnostics") {
+   auto const source = std::u8string(100000, u8'\x80');
+   auto limits = lingua::diagnostic_limits{};
+   limits.collapse_runs_of = 2;
+   limits.max_per_file = 100;
+   auto const diagnostics = lingua::make_diagnostics(source, lingua::lex(source), limits);
+   REQUIRE(diagnostics.size() == 2);
+   CHECK(std::holds_alternative<lingua::unknown_token>(diagnostics[0]));
+   CHECK(std::holds_alternative<lingua::repeated_diagnostic>(diagnostics[1]));
+}
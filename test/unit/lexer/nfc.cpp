@@ -0,0 +1,163 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/nfc.hpp"
+
+#include <array>
+#include <cstddef>
+#include <doctest.h>
+#include <string>
+#include <string_view>
+
+namespace {
+   using lingua::nfc_quick_check_result;
+   using namespace std::string_view_literals;
+
+   void check_nfc(std::u8string_view const text, std::u8string_view const expected)
+   {
+      auto const normalized = lingua::to_nfc(text);
+      CHECK(normalized == expected);
+      CHECK(lingua::is_nfc(normalized));
+      CHECK(lingua::is_nfc(text) == (text == expected));
+      CHECK(lingua::to_nfc(normalized) == normalized);
+
+      auto buffer = std::array<char8_t, 32>{};
+      CHECK(lingua::to_nfc(text, buffer) == expected);
+   }
+
+   std::u8string encode(char32_t const c)
+   {
+      auto out = std::u8string{};
+      if (c < 0x80) {
+         out += static_cast<char8_t>(c);
+      }
+      else if (c < 0x800) {
+         out += static_cast<char8_t>(0xc0U | (c >> 6U));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else if (c < 0x10000) {
+         out += static_cast<char8_t>(0xe0U | (c >> 12U));
+         out += static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else {
+         out += static_cast<char8_t>(0xf0U | (c >> 18U));
+         out += static_cast<char8_t>(0x80U | ((c >> 12U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      return out;
+   }
+} // namespace
+
+TEST_CASE("checks the NFC quick check") {
+   CHECK(lingua::nfc_quick_check(u8""sv) == nfc_quick_check_result::yes);
+   CHECK(lingua::nfc_quick_check(u8"snake_case_42"sv) == nfc_quick_check_result::yes);
+   CHECK(lingua::nfc_quick_check(u8"gr\u00f6\u00dfe"sv) == nfc_quick_check_result::yes);
+   CHECK(lingua::nfc_quick_check(u8"\u5909\u6570"sv) == nfc_quick_check_result::yes);
+   CHECK(lingua::nfc_quick_check(u8"\uac01"sv) == nfc_quick_check_result::yes);
+
+   // A combining mark, or a Hangul vowel, might compose with what's before it.
+   CHECK(lingua::nfc_quick_check(u8"e\u0301"sv) == nfc_quick_check_result::maybe);
+   CHECK(lingua::nfc_quick_check(u8"\u1100\u1161"sv) == nfc_quick_check_result::maybe);
+
+   // Singletons, and marks that are out of order, are never in NFC.
+   CHECK(lingua::nfc_quick_check(u8"\u212b"sv) == nfc_quick_check_result::no);
+   CHECK(lingua::nfc_quick_check(u8"\u0958"sv) == nfc_quick_check_result::no);
+   CHECK(lingua::nfc_quick_check(u8"a\u0301\u0323"sv) == nfc_quick_check_result::no);
+}
+
+TEST_CASE("checks NFC normalization") {
+   SUBCASE("composition") {
+      check_nfc(u8"e\u0301"sv, u8"\u00e9"sv);
+      check_nfc(u8"A\u0301\u0301"sv, u8"\u00c1\u0301"sv);
+      check_nfc(u8"\u0b47\u0b3e"sv, u8"\u0b4b"sv);
+      check_nfc(u8"\u0301a"sv, u8"\u0301a"sv);
+   }
+
+   SUBCASE("canonical ordering") {
+      check_nfc(u8"\u1e0b\u0323"sv, u8"\u1e0d\u0307"sv);
+      check_nfc(u8"a\u0301\u0323"sv, u8"\u1ea1\u0301"sv);
+      check_nfc(u8"a\u0308\u0301\u0323"sv, u8"\u1ea1\u0308\u0301"sv);
+      check_nfc(u8"\u00c5\u0328"sv, u8"\u0104\u030a"sv);
+   }
+
+   SUBCASE("exclusions") {
+      check_nfc(u8"\u212b"sv, u8"\u00c5"sv);
+      check_nfc(u8"\u2126"sv, u8"\u03a9"sv);
+      check_nfc(u8"\u2000"sv, u8"\u2002"sv);
+      check_nfc(u8"\u0958"sv, u8"\u0915\u093c"sv);
+      check_nfc(u8"\u0915\u093c"sv, u8"\u0915\u093c"sv);
+      check_nfc(u8"\u0344"sv, u8"\u0308\u0301"sv);
+      check_nfc(u8"\u0f73"sv, u8"\u0f71\u0f72"sv);
+   }
+
+   SUBCASE("Hangul") {
+      check_nfc(u8"\u1100\u1161"sv, u8"\uac00"sv);
+      check_nfc(u8"\u1100\u1161\u11a8"sv, u8"\uac01"sv);
+      check_nfc(u8"\uac00\u11a8"sv, u8"\uac01"sv);
+      check_nfc(u8"\uac01"sv, u8"\uac01"sv);
+   }
+
+   SUBCASE("surrounded by ASCII") {
+      check_nfc(u8"cafe\u0301_au_lait"sv, u8"caf\u00e9_au_lait"sv);
+   }
+}
+
+TEST_CASE("checks NFC normalization into a buffer that's too small") {
+   auto buffer = std::array<char8_t, 2>{};
+   CHECK(lingua::to_nfc(u8"e\u0301"sv, buffer) == u8"\u00e9"sv);
+   CHECK(not lingua::to_nfc(u8"abc"sv, buffer));
+   CHECK(not lingua::to_nfc(u8"\u212b"sv, std::span{buffer}.first(1)));
+
+   // A decomposition that's too long to buffer can't be normalized, even if it would compose.
+   auto long_text = std::u8string{u8"a"};
+   for (auto i = std::size_t{0}; i < lingua::max_buffered_decomposition; ++i) {
+      long_text += u8"\u0301";
+   }
+   auto long_buffer = std::array<char8_t, 1024>{};
+   CHECK(not lingua::to_nfc(long_text, long_buffer));
+}
+
+TEST_CASE("checks NFC normalization of every code point") {
+   auto changed = std::size_t{0};
+   auto unsound = std::size_t{0};
+   auto unstable = std::size_t{0};
+   auto mismatched = std::size_t{0};
+   for (auto c = char32_t{0}; c <= 0x10ffff; ++c) {
+      if (c == 0xd800) {
+         c = 0xdfff;
+         continue;
+      }
+
+      auto const text = encode(c);
+      auto const normalized = lingua::to_nfc(text);
+      changed += normalized != text ? 1U : 0U;
+
+      // The quick check may only say `yes` when normalizing really does nothing.
+      unsound += lingua::nfc_quick_check(text) == nfc_quick_check_result::yes
+                  and normalized != text ? 1U : 0U;
+      unstable += lingua::to_nfc(normalized) != normalized ? 1U : 0U;
+
+      auto buffer = std::array<char8_t, 16>{};
+      mismatched += lingua::to_nfc(text, buffer) != normalized ? 1U : 0U;
+   }
+
+   // Exactly the code points that are NFC_Quick_Check=No change on their own.
+   CHECK(changed == 1120);
+   CHECK(unsound == 0);
+   CHECK(unstable == 0);
+   CHECK(mismatched == 0);
+}
@@ -0,0 +1,112 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/token_buffer.hpp"
+
+#include "lingua/lexer/lex.hpp"
+#include <algorithm>
+#include <doctest.h>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace {
+   using lingua::token, lingua::token_kind;
+
+   [[nodiscard]] std::vector<token> sample_tokens()
+   {
+      auto source = std::u8string{};
+      for (auto i = 0; i < 300; ++i) {
+         source += u8"fn f(x: u32) -> u32 { /* comment */ x * 42 }\n";
+      }
+      // A token whose length needs a multi-byte varint.
+      source += u8"\"" + std::u8string(100'000, u8'a') + u8"\"";
+      return lingua::lex(source).tokens;
+   }
+} // namespace
+
+static_assert(std::random_access_iterator<lingua::token_buffer::iterator>);
+static_assert(std::ranges::random_access_range<lingua::token_buffer>);
+static_assert(std::forward_iterator<lingua::compressed_token_buffer::iterator>);
+static_assert(std::ranges::forward_range<lingua::compressed_token_buffer>);
+
+TEST_CASE("checks token_buffer stores tokens as separate arrays") {
+   auto const tokens = sample_tokens();
+   auto const buffer = lingua::token_buffer{tokens};
+
+   REQUIRE(buffer.size() == tokens.size());
+   CHECK(std::ranges::equal(buffer, tokens));
+   CHECK(buffer.size_in_bytes() == tokens.size() * 9);
+
+   for (auto i = std::size_t{0}; i < tokens.size(); ++i) {
+      CHECK(buffer[i] == tokens[i]);
+      CHECK(buffer.kinds()[i] == tokens[i].kind);
+      CHECK(buffer.offsets()[i] == tokens[i].offset);
+      CHECK(buffer.lengths()[i] == tokens[i].length);
+   }
+
+   auto const middle = buffer.begin() + static_cast<std::ptrdiff_t>(tokens.size() / 2);
+   CHECK(middle - buffer.begin() == static_cast<std::ptrdiff_t>(tokens.size() / 2));
+   CHECK(*middle == tokens[tokens.size() / 2]);
+   CHECK(middle[-1] == tokens[tokens.size() / 2 - 1]);
+   CHECK(buffer.begin() < middle);
+
+   auto copy = buffer;
+   CHECK(copy == buffer);
+   copy.push_back(token{token_kind::whitespace, 0, 1});
+   CHECK(copy != buffer);
+   copy.clear();
+   CHECK(copy.empty());
+}
+
+TEST_CASE("checks compressed_token_buffer decodes what it encodes") {
+   SUBCASE("checks an empty buffer") {
+      auto const buffer = lingua::compressed_token_buffer{};
+      CHECK(buffer.empty());
+      CHECK(buffer.begin() == buffer.end());
+      CHECK(buffer.decompress().empty());
+   }
+
+   SUBCASE("checks contiguous tokens") {
+      auto const tokens = sample_tokens();
+      auto const buffer = lingua::compressed_token_buffer{tokens};
+
+      REQUIRE(buffer.size() == tokens.size());
+      CHECK(std::ranges::equal(buffer, tokens));
+      CHECK(buffer.decompress() == lingua::token_buffer{tokens});
+      for (auto i = std::size_t{0}; i < tokens.size(); ++i) {
+         CHECK(buffer[i] == tokens[i]);
+      }
+
+      // Most tokens need one byte each for their kind, distance, and length.
+      CHECK(buffer.size_in_bytes() < tokens.size() * 4);
+   }
+
+   SUBCASE("checks tokens with gaps between them") {
+      auto const all = sample_tokens();
+      auto tokens = std::vector<token>{};
+      std::ranges::copy_if(all, std::back_inserter(tokens),
+         [](token const t) { return not lingua::is_trivia(t.kind); });
+
+      auto buffer = lingua::compressed_token_buffer{lingua::token_buffer{tokens}};
+      CHECK(std::ranges::equal(buffer, tokens));
+
+      auto const last = tokens.back();
+      auto const appended = token{token_kind::semicolon, last.offset + last.length + 1'000'000, 1};
+      buffer.push_back(appended);
+      CHECK(buffer[tokens.size()] == appended);
+   }
+}
@@ -0,0 +1,112 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/token_generator.hpp"
+
+#include "lingua/lexer/lex.hpp"
+#include <algorithm>
+#include <doctest.h>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+   using lingua::token, lingua::token_kind;
+   using namespace std::string_view_literals;
+} // namespace
+
+static_assert(std::input_iterator<lingua::token_generator::iterator>);
+static_assert(std::ranges::input_range<lingua::token_generator>);
+
+TEST_CASE("checks token_generator produces the same tokens as lex") {
+   constexpr auto source = u8"use std::io;\nfn f( { ` } ]\n\"unterminated"sv;
+   auto const expected = lingua::lex(source);
+
+   SUBCASE("checks pulling tokens one at a time") {
+      auto generator = lingua::token_generator{source};
+      auto tokens = std::vector<token>{};
+      while (auto const t = generator.next()) {
+         tokens.push_back(*t);
+      }
+      CHECK(generator.done());
+      CHECK(tokens == expected.tokens);
+      CHECK(generator.count() == expected.tokens.size());
+      CHECK(std::ranges::equal(generator.errors(), expected.errors));
+      CHECK(std::ranges::equal(generator.delimiters().errors(), expected.delimiters.errors()));
+      CHECK(std::ranges::equal(generator.delimiters().partners(), expected.delimiters.partners()));
+      CHECK(not generator.next());
+   }
+
+   SUBCASE("checks pulling tokens until done") {
+      auto generator = lingua::token_generator{source};
+      auto tokens = std::vector<token>{};
+      while (not generator.done()) {
+         tokens.push_back(*generator.next());
+      }
+      CHECK(tokens == expected.tokens);
+      CHECK(std::ranges::equal(generator.errors(), expected.errors));
+      CHECK(std::ranges::equal(generator.delimiters().errors(), expected.delimiters.errors()));
+      CHECK(std::ranges::equal(generator.delimiters().partners(), expected.delimiters.partners()));
+   }
+
+   SUBCASE("checks iterating") {
+      auto generator = lingua::token_generator{source};
+      auto tokens = std::vector<token>{};
+      std::ranges::copy(generator, std::back_inserter(tokens));
+      CHECK(tokens == expected.tokens);
+      CHECK(std::ranges::equal(generator.errors(), expected.errors));
+   }
+}
+
+TEST_CASE("checks token_generator reports unclosed delimiters with the last token") {
+   constexpr auto source = u8"fn f() { ("sv;
+   auto const expected = lingua::lex(source);
+   REQUIRE(expected.delimiters.errors().size() == 2);
+
+   auto generator = lingua::token_generator{source};
+   while (not generator.done()) {
+      (void)generator.next();
+   }
+   CHECK(std::ranges::equal(generator.delimiters().errors(), expected.delimiters.errors()));
+}
+
+TEST_CASE("checks token_generator stops when the consumer stops") {
+   auto source = std::u8string{u8"#![no_std]\nuse core::fmt;\n"};
+   for (auto i = 0; i < 10'000; ++i) {
+      source += u8"fn f() -> u32 { ` 42 }\n";
+   }
+
+   auto generator = lingua::token_generator{source};
+   auto uses = 0;
+   for (auto const t : generator) {
+      auto const text = t.text(source);
+      if (t.kind == token_kind::keyword and text == u8"fn") {
+         break;
+      }
+      uses += text == u8"use" ? 1 : 0;
+   }
+
+   CHECK(uses == 1);
+   CHECK(generator.offset() < 64);
+   CHECK(generator.errors().empty());
+   CHECK(not generator.done());
+
+   // Taking a prefix only lexes the prefix.
+   auto const first = std::ranges::distance(generator | std::views::take(4));
+   CHECK(first == 4);
+   CHECK(generator.offset() < 64);
+}
@@ -0,0 +1,91 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/token_lookahead.hpp"
+
+#include "lingua/lexer/lex.hpp"
+#include "lingua/lexer/token_buffer.hpp"
+#include "lingua/lexer/token_generator.hpp"
+#include <cstddef>
+#include <doctest.h>
+#include <string_view>
+#include <vector>
+
+namespace {
+   using lingua::token, lingua::token_kind;
+   using namespace std::string_view_literals;
+
+   constexpr auto source = u8"fn main() -> i32 { let x = a::b(1, 2); x }"sv;
+
+   /// \brief Walks `tokens` with a token_lookahead<N>, checking every peek against `expected`.
+   ///
+   template<std::size_t N, typename Tokens>
+   void check_lookahead(Tokens& tokens, std::vector<token> const& expected)
+   {
+      auto lookahead = lingua::token_lookahead<N, Tokens>{tokens};
+      for (auto position = std::size_t{0}; position < expected.size(); ++position) {
+         REQUIRE(not lookahead.done());
+         for (auto i = std::size_t{0}; i < N; ++i) {
+            if (position + i < expected.size()) {
+               CHECK(lookahead.peek(i) == expected[position + i]);
+            }
+            else {
+               CHECK(not lookahead.peek(i));
+            }
+         }
+         CHECK(lookahead.advance() == expected[position]);
+      }
+      CHECK(lookahead.done());
+      CHECK(lookahead.size() == 0);
+   }
+} // namespace
+
+TEST_CASE("checks token_lookahead over a vector of tokens") {
+   auto tokens = lingua::lex(source).tokens;
+   check_lookahead<1>(tokens, tokens);
+   check_lookahead<2>(tokens, tokens);
+   check_lookahead<3>(tokens, tokens);
+   check_lookahead<4>(tokens, tokens);
+   check_lookahead<64>(tokens, tokens);
+}
+
+TEST_CASE("checks token_lookahead over a token_buffer and a compressed_token_buffer") {
+   auto const expected = lingua::lex(source).tokens;
+   auto buffer = lingua::token_buffer{expected};
+   check_lookahead<3>(buffer, expected);
+
+   auto compressed = lingua::compressed_token_buffer{expected};
+   check_lookahead<3>(compressed, expected);
+}
+
+TEST_CASE("checks token_lookahead over a token_generator") {
+   auto const expected = lingua::lex(source).tokens;
+   {
+      auto generator = lingua::token_generator{source};
+      check_lookahead<2>(generator, expected);
+   }
+
+   // Only the buffered tokens are pulled from the generator.
+   auto generator = lingua::token_generator{source};
+   auto lookahead = lingua::token_lookahead<4, lingua::token_generator>{generator};
+   CHECK(generator.count() == 4);
+   CHECK(lookahead.next_is(token_kind::keyword));
+   CHECK(lookahead.next_is(token_kind::identifier, 2));
+   CHECK(lookahead.next_is(token_kind::open_paren, 3));
+   CHECK(not lookahead.next_is(token_kind::close_paren, 3));
+   lookahead.advance();
+   CHECK(generator.count() == 5);
+   CHECK(lookahead.next_is(token_kind::close_paren, 3));
+}
@@ -0,0 +1,180 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/token_stream.hpp"
+
+#include "lingua/lexer/lex.hpp"
+#include "lingua/source_buffer.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <doctest.h>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+   using lingua::text_edit;
+   using namespace std::string_view_literals;
+
+   /// \brief Applies `edit` to `source`, and checks that relexing agrees with lexing from scratch.
+   ///
+   lingua::relexed_range
+   apply(lingua::token_stream& stream, std::u8string& source, std::uint32_t const offset,
+      std::uint32_t const removed, std::u8string_view const inserted)
+   {
+      source.replace(offset, removed, inserted);
+      auto const changed = stream.relex(source,
+         text_edit{offset, removed, static_cast<std::uint32_t>(inserted.size())});
+
+      auto const expected = lingua::lex(source);
+      CHECK(stream.size() == expected.tokens.size());
+      CHECK(stream.tokens() == expected.tokens);
+      CHECK(std::ranges::equal(stream.errors(), expected.errors));
+      return changed;
+   }
+} // namespace
+
+TEST_CASE("checks relexing matches lexing from scratch") {
+   auto source = std::u8string{u8"fn main() {\n   let x = 1 + 2;\n   println!(\"{}\", x);\n}\n"};
+   auto stream = lingua::token_stream{source};
+
+   SUBCASE("checks an edit inside a token") {
+      auto const offset = static_cast<std::uint32_t>(source.find(u8'1'));
+      apply(stream, source, offset, 1, u8"100");
+   }
+
+   SUBCASE("checks an edit that merges tokens") {
+      auto const offset = static_cast<std::uint32_t>(source.find(u8" + "));
+      apply(stream, source, offset, 3, u8"");
+   }
+
+   SUBCASE("checks an edit at each end") {
+      apply(stream, source, 0, 0, u8"// header\n");
+      apply(stream, source, static_cast<std::uint32_t>(source.size()), 0, u8"fn g() {}");
+   }
+
+   SUBCASE("checks opening and closing a comment") {
+      apply(stream, source, 0, 0, u8"/*");
+      CHECK(stream.size() == 1);
+      CHECK(stream.errors().size() == 1);
+      apply(stream, source, static_cast<std::uint32_t>(source.size()), 0, u8"*/");
+      CHECK(stream.errors().empty());
+      apply(stream, source, 0, 2, u8"");
+   }
+
+   SUBCASE("checks opening and closing a raw string") {
+      auto const offset = static_cast<std::uint32_t>(source.find(u8"let"));
+      apply(stream, source, offset, 0, u8"r#\"");
+      apply(stream, source, static_cast<std::uint32_t>(source.find(u8"x);")), 0, u8"\"#");
+      apply(stream, source, offset + 1, 1, u8"");
+   }
+
+   SUBCASE("checks the same source can be replaced wholesale") {
+      apply(stream, source, 0, static_cast<std::uint32_t>(source.size()), u8"'a' b\"c");
+   }
+}
+
+TEST_CASE("checks relexing only touches the tokens near an edit") {
+   auto source = std::u8string{};
+   for (auto i = 0; i < 2'000; ++i) {
+      source += u8"let value = compute(value, 42);\n";
+   }
+   auto stream = lingua::token_stream{source};
+   auto const tokens_before = stream.size();
+
+   // Relexing starts at most max_lookahead bytes in front of the edit, and every token is at least
+   // one byte long.
+   auto const offset = static_cast<std::uint32_t>(source.size() / 2);
+   auto const changed = apply(stream, source, offset, 0, u8"x");
+   CHECK(changed.removed <= lingua::max_lookahead + 1);
+   CHECK(changed.inserted <= lingua::max_lookahead + 1);
+   CHECK(stream.size() + changed.removed == tokens_before + changed.inserted);
+
+   SUBCASE("checks a deletion that's longer than the text in front of it") {
+      constexpr auto removed = std::uint32_t{3'000};
+      auto const deleted = apply(stream, source, 1'100, removed, u8"");
+      CHECK(deleted.removed <= removed + lingua::max_lookahead + 1);
+      CHECK(deleted.inserted <= lingua::max_lookahead + 1);
+   }
+}
+
+TEST_CASE("checks relexing random edits") {
+   constexpr auto fragments = std::array{
+      u8"fn"sv, u8" "sv, u8"\n"sv, u8"x"sv, u8"r"sv, u8"#"sv, u8"\""sv, u8"'"sv, u8"/*"sv,
+      u8"*/"sv, u8"//"sv, u8"1"sv, u8"."sv, u8"e"sv, u8"\\"sv, u8"b"sv, u8"<"sv, u8"="sv,
+      u8"{"sv, u8"}"sv, u8"`"sv, u8"é"sv,
+   };
+   auto engine = std::mt19937{42};
+   auto pick = [&engine](std::size_t const bound) {
+      return std::uniform_int_distribution<std::size_t>{0, bound}(engine);
+   };
+
+   auto source = std::u8string{};
+   for (auto i = 0; i < 200; ++i) {
+      source += fragments[pick(fragments.size() - 1)];
+   }
+   auto stream = lingua::token_stream{source};
+
+   for (auto i = 0; i < 500; ++i) {
+      auto const offset = pick(source.size());
+      auto const removed = std::min(pick(4), source.size() - offset);
+      auto inserted = std::u8string{};
+      for (auto n = pick(3); n > 0; --n) {
+         inserted += fragments[pick(fragments.size() - 1)];
+      }
+      apply(stream, source, static_cast<std::uint32_t>(offset), static_cast<std::uint32_t>(removed),
+         inserted);
+   }
+}
+
+TEST_CASE("checks relexing from a source_buffer") {
+   auto source = std::u8string{};
+   for (auto i = 0; i < 500; ++i) {
+      source += u8"let value = compute(value, 42); // note\n";
+   }
+   auto buffer = lingua::source_buffer{source};
+   auto stream = lingua::token_stream{buffer};
+   CHECK(stream.tokens() == lingua::lex(source).tokens);
+
+   auto check_edit = [&](std::size_t const offset, std::size_t const removed,
+      std::u8string_view const inserted) {
+      source.replace(offset, removed, inserted);
+      stream.relex(buffer, buffer.replace(offset, removed, inserted));
+
+      auto const expected = lingua::lex(source);
+      CHECK(stream.tokens() == expected.tokens);
+      CHECK(std::ranges::equal(stream.errors(), expected.errors));
+   };
+
+   SUBCASE("checks an edit inside a token") {
+      check_edit(source.find(u8"42"), 2, u8"1000");
+   }
+
+   SUBCASE("checks a token that spans chunks") {
+      // The comment is longer than the lexer's window, so the window has to grow to hold it.
+      check_edit(source.find(u8"let"), 0, u8"/*");
+      CHECK(stream.size() == 1);
+      check_edit(source.size(), 0, u8"*/");
+      CHECK(stream.errors().empty());
+   }
+
+   SUBCASE("checks typing at the end") {
+      for (auto const c : std::u8string_view{u8"fn f() { \"text\" }"}) {
+         check_edit(source.size(), 0, std::u8string(1, c));
+      }
+   }
+}
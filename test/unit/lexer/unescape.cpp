@@ -0,0 +1,165 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/unescape.hpp"
+
+#include "lingua_test/for_each_simd_level.hpp"
+#include <doctest.h>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace {
+   using lingua::token_kind, lingua::unescape_error;
+   using namespace std::string_view_literals;
+
+   void check_value(token_kind const kind, std::u8string_view const literal,
+      std::u8string_view const expected)
+   {
+      auto arena = lingua::string_arena{};
+      auto const unescaped = lingua::unescape_literal(kind, literal, arena);
+      CHECK(unescaped.error == unescape_error::none);
+      CHECK(unescaped.value == expected);
+      CHECK(arena.bytes_used() == unescaped.value.size());
+   }
+
+   void check_error(token_kind const kind, std::u8string_view const literal,
+      unescape_error const error, std::uint32_t const offset, std::uint32_t const length)
+   {
+      auto arena = lingua::string_arena{};
+      auto const unescaped = lingua::unescape_literal(kind, literal, arena);
+      CHECK(unescaped.error == error);
+      CHECK(unescaped.error_offset == offset);
+      CHECK(unescaped.error_length == length);
+      CHECK(unescaped.value.empty());
+      CHECK(arena.bytes_used() == 0);
+   }
+
+   /// \brief Checks that a literal without escapes is viewed rather than copied.
+   ///
+   void check_view(token_kind const kind, std::u8string_view const literal,
+      std::u8string_view const expected)
+   {
+      auto arena = lingua::string_arena{};
+      auto const unescaped = lingua::unescape_literal(kind, literal, arena);
+      CHECK(unescaped.error == unescape_error::none);
+      CHECK(unescaped.value == expected);
+      CHECK(arena.bytes_used() == 0);
+      CHECK(std::less_equal<>{}(literal.data(), unescaped.value.data()));
+      CHECK(std::less_equal<>{}(unescaped.value.data() + unescaped.value.size(),
+         literal.data() + literal.size()));
+   }
+} // namespace
+
+TEST_CASE("checks literals without escapes are views of the source") {
+   check_view(token_kind::string_literal, u8R"("")"sv, u8""sv);
+   check_view(token_kind::string_literal, u8R"("hello, world")"sv, u8"hello, world"sv);
+   check_view(token_kind::string_literal,
+      u8"\"héllo wörld, this string is over thirty-two bytes\""sv,
+      u8"héllo wörld, this string is over thirty-two bytes"sv);
+   check_view(token_kind::byte_string_literal, u8R"(b"bytes")"sv, u8"bytes"sv);
+   check_view(token_kind::char_literal, u8"'é'"sv, u8"é"sv);
+   check_view(token_kind::byte_literal, u8"b'a'"sv, u8"a"sv);
+   check_view(token_kind::raw_string_literal, u8R"(r"\n")"sv, u8R"(\n)"sv);
+   check_view(token_kind::raw_string_literal, u8R"--(r##"a "# b"##)--"sv, u8R"(a "# b)"sv);
+   check_view(token_kind::raw_byte_string_literal, u8R"(br#"\x"#)"sv, u8R"(\x)"sv);
+}
+
+TEST_CASE("checks escapes are decoded") {
+   SUBCASE("in string literals") {
+      check_value(token_kind::string_literal, u8R"("a\nb\rc\td\\e\0f\'g\"h")"sv,
+         u8"a\nb\rc\td\\e\0f'g\"h"sv);
+      check_value(token_kind::string_literal, u8R"("\x41\x7f")"sv, u8"A\x7f"sv);
+      check_value(token_kind::string_literal, u8R"("\u{48}\u{e9}\u{20AC}\u{1F600}")"sv,
+         u8"Hé€😀"sv);
+      check_value(token_kind::string_literal, u8R"("\u{01F600}\u{00000a}")"sv, u8"😀\n"sv);
+   }
+
+   SUBCASE("after a long run without escapes") {
+      auto const run = std::u8string(100, u8'r');
+      check_value(token_kind::string_literal, u8'"' + run + u8R"(\t)" + run + u8'"',
+         run + u8'\t' + run);
+   }
+
+   SUBCASE("in byte literals") {
+      check_value(token_kind::byte_string_literal, u8R"(b"\x00\xff\n")"sv, u8"\x00\xff\n"sv);
+      check_value(token_kind::byte_literal, u8R"(b'\x80')"sv, u8"\x80"sv);
+      check_value(token_kind::byte_literal, u8R"(b'\'')"sv, u8"'"sv);
+   }
+
+   SUBCASE("in char literals") {
+      check_value(token_kind::char_literal, u8R"('\n')"sv, u8"\n"sv);
+      check_value(token_kind::char_literal, u8R"('\u{10FFFF}')"sv, u8"\U0010ffff"sv);
+   }
+
+   SUBCASE("across line continuations") {
+      check_value(token_kind::string_literal, u8"\"one \\\n     two\""sv, u8"one two"sv);
+      check_value(token_kind::string_literal, u8"\"one \\\r\n\t\n  two\""sv, u8"one two"sv);
+      check_value(token_kind::byte_string_literal, u8"b\"a\\\n b\""sv, u8"ab"sv);
+   }
+}
+
+TEST_CASE("checks escapes and bytes outside ASCII are found at every offset") {
+   lingua_test::for_each_simd_level([] {
+      for (auto offset = std::size_t{0}; offset < 150; ++offset) {
+         auto const run = std::u8string(offset, u8'r');
+         check_value(token_kind::string_literal, u8'"' + run + u8R"(\t)" + run + u8'"',
+            run + u8'\t' + run);
+         check_error(token_kind::byte_string_literal, u8"b\"" + run + u8"\xff\"",
+            unescape_error::non_ascii_byte, static_cast<std::uint32_t>(offset + 2), 1);
+      }
+   });
+}
+
+TEST_CASE("checks bad escapes are reported") {
+   check_error(token_kind::string_literal, u8R"("ab\qcd")"sv, unescape_error::unknown_ascii_escape,
+      3, 2);
+   check_error(token_kind::string_literal, u8R"("\x80")"sv, unescape_error::unknown_ascii_escape,
+      1, 4);
+   check_error(token_kind::string_literal, u8R"("\x4")"sv, unescape_error::unknown_ascii_escape, 1,
+      3);
+   check_error(token_kind::byte_string_literal, u8R"(b"\xgg")"sv,
+      unescape_error::unknown_byte_escape, 2, 4);
+   check_error(token_kind::byte_string_literal, u8R"(b"\u{41}")"sv,
+      unescape_error::unknown_byte_escape, 2, 6);
+   check_error(token_kind::char_literal, u8"'\\\n'"sv, unescape_error::unknown_ascii_escape, 1, 2);
+   check_error(token_kind::string_literal, u8"\"\\\rx\""sv, unescape_error::unknown_ascii_escape, 1,
+      2);
+
+   SUBCASE("for unicode escapes") {
+      check_error(token_kind::string_literal, u8R"("\u{D800}")"sv,
+         unescape_error::surrogate_unicode_escape, 1, 8);
+      check_error(token_kind::char_literal, u8R"('\u{110000}')"sv,
+         unescape_error::out_of_range_unicode_escape, 1, 10);
+      check_error(token_kind::string_literal, u8R"("\u{1234567}")"sv,
+         unescape_error::unknown_unicode_escape, 1, 10);
+      check_error(token_kind::string_literal, u8R"("\u{}")"sv,
+         unescape_error::unknown_unicode_escape, 1, 4);
+      check_error(token_kind::string_literal, u8R"("\u{1_F600}")"sv,
+         unescape_error::unknown_unicode_escape, 1, 5);
+      check_error(token_kind::string_literal, u8R"("\u41")"sv,
+         unescape_error::unknown_unicode_escape, 1, 3);
+   }
+
+   SUBCASE("for bytes outside ASCII") {
+      check_error(token_kind::byte_string_literal, u8"b\"abcé\""sv, unescape_error::non_ascii_byte,
+         5, 1);
+      check_error(token_kind::byte_literal, u8"b'é'"sv, unescape_error::non_ascii_byte, 2, 1);
+      check_error(token_kind::raw_byte_string_literal, u8"br\"\\é\""sv,
+         unescape_error::non_ascii_byte, 4, 1);
+      check_error(token_kind::byte_string_literal,
+         u8"b\"" + std::u8string(40, u8'a') + u8"\\n\xff\"", unescape_error::non_ascii_byte, 44, 1);
+   }
+}
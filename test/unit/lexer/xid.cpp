@@ -0,0 +1,85 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/lexer/xid.hpp"
+
+#include <cstddef>
+#include <doctest.h>
+
+TEST_CASE("checks XID_Start") {
+   CHECK(lingua::is_xid_start(U'a'));
+   CHECK(lingua::is_xid_start(U'Z'));
+   CHECK(not lingua::is_xid_start(U'_'));
+   CHECK(not lingua::is_xid_start(U'0'));
+   CHECK(not lingua::is_xid_start(U'$'));
+   CHECK(not lingua::is_xid_start(U'@'));
+   CHECK(not lingua::is_xid_start(U'['));
+
+   CHECK(lingua::is_xid_start(U'é'));
+   CHECK(lingua::is_xid_start(U'π'));
+   CHECK(lingua::is_xid_start(U'я'));
+   CHECK(lingua::is_xid_start(U'字'));
+   CHECK(lingua::is_xid_start(U'℘')); // SCRIPT CAPITAL P, by Other_ID_Start
+   CHECK(lingua::is_xid_start(U'\U0003134a')); // the last CJK Extension G ideograph
+   CHECK(not lingua::is_xid_start(U'·')); // MIDDLE DOT is only XID_Continue
+   CHECK(not lingua::is_xid_start(U'\u037a')); // GREEK YPOGEGRAMMENI isn't closed under NFKC
+   CHECK(not lingua::is_xid_start(U'٠')); // ARABIC-INDIC DIGIT ZERO
+   CHECK(not lingua::is_xid_start(U'§'));
+   CHECK(not lingua::is_xid_start(U'\U0001f967')); // emoji aren't identifiers
+   CHECK(not lingua::is_xid_start(U'\U0003134b'));
+   CHECK(not lingua::is_xid_start(U'\U000e0100'));
+   CHECK(not lingua::is_xid_start(U'\U0010ffff'));
+}
+
+TEST_CASE("checks XID_Continue") {
+   CHECK(lingua::is_xid_continue(U'a'));
+   CHECK(lingua::is_xid_continue(U'_'));
+   CHECK(lingua::is_xid_continue(U'9'));
+   CHECK(not lingua::is_xid_continue(U'-'));
+   CHECK(not lingua::is_xid_continue(U'`'));
+   CHECK(not lingua::is_xid_continue(U'{'));
+
+   CHECK(lingua::is_xid_continue(U'·'));
+   CHECK(lingua::is_xid_continue(U'\u0301')); // COMBINING ACUTE ACCENT
+   CHECK(lingua::is_xid_continue(U'٠'));
+   CHECK(lingua::is_xid_continue(U'‿')); // UNDERTIE, a connector punctuation
+   CHECK(lingua::is_xid_continue(U'\U000e0100')); // the first and last variation selectors
+   CHECK(lingua::is_xid_continue(U'\U000e01ef'));
+   CHECK(not lingua::is_xid_continue(U'\U000e00ff'));
+   CHECK(not lingua::is_xid_continue(U'\U000e01f0'));
+   CHECK(not lingua::is_xid_continue(U'\u200b')); // ZERO WIDTH SPACE
+   CHECK(not lingua::is_xid_continue(U'\u037a'));
+   CHECK(not lingua::is_xid_continue(U'\U0010ffff'));
+}
+
+TEST_CASE("checks every code point against the Unicode 14.0 totals") {
+   auto starts = std::size_t{0};
+   auto continues = std::size_t{0};
+   auto starts_only = std::size_t{0};
+   for (auto c = char32_t{0}; c <= 0x10ffff; ++c) {
+      auto const start = lingua::is_xid_start(c);
+      auto const continue_ = lingua::is_xid_continue(c);
+      starts += start ? 1 : 0;
+      continues += continue_ ? 1 : 0;
+      starts_only += start and not continue_ ? 1 : 0;
+   }
+
+   // The totals that DerivedCoreProperties.txt lists for each property.
+   CHECK(starts == 131974);
+   CHECK(continues == 135053);
+
+   // Every character that can begin an identifier can also continue one.
+   CHECK(starts_only == 0);
+}
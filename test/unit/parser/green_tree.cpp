@@ -0,0 +1,187 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/parser/green_tree.hpp"
+
+#include "lingua/lexer/lex.hpp"
+#include "lingua/parser/parse.hpp"
+#include <doctest.h>
+#include <string>
+#include <string_view>
+
+namespace {
+   using lingua::green_interner, lingua::green_node, lingua::source_span, lingua::syntax_cursor,
+      lingua::syntax_kind, lingua::token_kind;
+   using namespace std::string_view_literals;
+
+   green_node const& build(std::u8string_view const source, green_interner& interner)
+   {
+      auto const lexed = lingua::lex(source);
+      auto const tree = lingua::parse(source, lexed.tokens);
+      return lingua::build_green_tree(source, lexed.tokens, tree, interner);
+   }
+} // namespace
+
+TEST_CASE("checks that a green tree keeps all of the source") {
+   auto interner = green_interner{};
+
+   SUBCASE("trivia") {
+      constexpr auto source = u8"  // leading\nfn /* name */ main() {\n   let x = 1; // x\n}\n"sv;
+      auto const& root = build(source, interner);
+      CHECK(root.kind() == syntax_kind::source_file);
+      CHECK(root.text() == source);
+   }
+
+   SUBCASE("a `>>` that closes two lists of generic arguments") {
+      constexpr auto source = u8"type T = Vec<Vec<u8>>;"sv;
+      CHECK(build(source, interner).text() == source);
+   }
+
+   SUBCASE("syntax errors") {
+      constexpr auto source = u8"fn f( { let } struct S; 42 /* unterminated"sv;
+      CHECK(build(source, interner).text() == source);
+   }
+
+   SUBCASE("an empty source") {
+      auto const& root = build(u8""sv, interner);
+      CHECK(root.kind() == syntax_kind::source_file);
+      CHECK(root.children().empty());
+      CHECK(root.text_length() == 0);
+   }
+}
+
+TEST_CASE("checks that green trees share identical subtrees") {
+   auto interner = green_interner{};
+   constexpr auto item = u8"fn answer() -> i32 { 42 }\n"sv;
+
+   SUBCASE("in the same file") {
+      auto const source = std::u8string{item} + std::u8string{item};
+      auto const& root = build(source, interner);
+      REQUIRE(root.children().size() == 4);
+      CHECK(root.children()[0] == root.children()[2]);
+      CHECK(root.children()[1] == root.children()[3]);
+   }
+
+   SUBCASE("in different files") {
+      auto const& first = build(item, interner);
+      auto const nodes = interner.node_count();
+      auto const tokens = interner.token_count();
+
+      auto const& second = build(item, interner);
+      CHECK(&first == &second);
+      CHECK(interner.node_count() == nodes);
+      CHECK(interner.token_count() == tokens);
+   }
+}
+
+TEST_CASE("checks that identifiers are named by their NFC form") {
+   auto interner = green_interner{};
+   auto const& precomposed = interner.token(token_kind::identifier, u8"caf\u00e9"sv);
+   auto const& decomposed = interner.token(token_kind::identifier, u8"cafe\u0301"sv);
+   CHECK(&precomposed != &decomposed);
+   CHECK(precomposed.name() == u8"caf\u00e9"sv);
+   CHECK(precomposed.name().data() == decomposed.name().data());
+
+   auto const& raw = interner.token(token_kind::raw_identifier, u8"r#cafe\u0301"sv);
+   CHECK(raw.name().data() == precomposed.name().data());
+
+   auto const& lifetime = interner.token(token_kind::lifetime, u8"'cafe\u0301"sv);
+   CHECK(lifetime.name() == u8"'caf\u00e9"sv);
+
+   auto const& literal = interner.token(token_kind::string_literal, u8"\"cafe\u0301\""sv);
+   CHECK(literal.name() == literal.text());
+}
+
+TEST_CASE("checks syntax_cursor") {
+   auto interner = green_interner{};
+   constexpr auto source = u8"struct S { x: i32 }\nfn f() { g(1, 2) }\n"sv;
+   auto const& root = build(source, interner);
+
+   SUBCASE("finds tokens and their ancestors") {
+      auto cursor = syntax_cursor{root};
+      REQUIRE(cursor.goto_token_at(static_cast<std::uint32_t>(source.find(u8"2)"))));
+      CHECK(cursor.current().token().kind() == token_kind::integer_literal);
+      CHECK(cursor.span().text(source) == u8"2");
+
+      REQUIRE(cursor.goto_parent());
+      CHECK(cursor.current().node().kind() == syntax_kind::literal);
+      REQUIRE(cursor.goto_parent());
+      CHECK(cursor.current().node().kind() == syntax_kind::call);
+      CHECK(cursor.span().text(source) == u8"g(1, 2)");
+
+      while (cursor.goto_parent()) {}
+      CHECK(cursor.depth() == 0);
+      CHECK(cursor.current() == root);
+      CHECK(not cursor.goto_token_at(static_cast<std::uint32_t>(source.size())));
+   }
+
+   SUBCASE("walks between siblings") {
+      auto cursor = syntax_cursor{root};
+      REQUIRE(cursor.goto_first_child());
+      CHECK(cursor.current().node().kind() == syntax_kind::structure);
+      CHECK(cursor.span() == source_span{0, 19});
+      CHECK(not cursor.goto_previous_sibling());
+
+      REQUIRE(cursor.goto_next_sibling());
+      CHECK(cursor.current().token().kind() == token_kind::whitespace);
+      REQUIRE(cursor.goto_next_sibling());
+      CHECK(cursor.current().node().kind() == syntax_kind::function);
+      CHECK(cursor.span().text(source) == u8"fn f() { g(1, 2) }");
+
+      REQUIRE(cursor.goto_previous_sibling());
+      CHECK(cursor.span() == source_span{19, 1});
+   }
+
+   SUBCASE("spans match the syntax_tree's") {
+      auto const lexed = lingua::lex(source);
+      auto const tree = lingua::parse(source, lexed.tokens);
+      auto const function = tree.children(tree.root())[1];
+
+      auto cursor = syntax_cursor{root};
+      REQUIRE(cursor.goto_token_at(tree.span(function).offset));
+      while (cursor.current() != root and cursor.current().node().kind() != syntax_kind::function)
+      {
+         cursor.goto_parent();
+      }
+      CHECK(cursor.span() == tree.span(function));
+   }
+}
+
+TEST_CASE("checks that an edit only makes the nodes on the path to the root") {
+   auto interner = green_interner{};
+   constexpr auto source = u8"fn f() { 1 }\nfn g() { 2 + 3 }\n"sv;
+   auto const& root = build(source, interner);
+   auto const nodes = interner.node_count();
+
+   auto cursor = syntax_cursor{root};
+   REQUIRE(cursor.goto_token_at(static_cast<std::uint32_t>(source.find(u8'3'))));
+   auto const depth = cursor.depth();
+
+   auto const& edited = cursor.replace(interner.token(token_kind::integer_literal, u8"30"),
+      interner);
+   CHECK(edited.text() == u8"fn f() { 1 }\nfn g() { 2 + 30 }\n");
+   CHECK(interner.node_count() == nodes + depth);
+
+   REQUIRE(edited.children().size() == root.children().size());
+   CHECK(edited.children()[0] == root.children()[0]);
+   CHECK(edited.children()[1] == root.children()[1]);
+   CHECK(edited.children()[2] != root.children()[2]);
+
+   SUBCASE("undoing the edit gives back the original tree") {
+      auto undo = syntax_cursor{edited};
+      REQUIRE(undo.goto_token_at(static_cast<std::uint32_t>(source.find(u8'3'))));
+      CHECK(&undo.replace(interner.token(token_kind::integer_literal, u8"3"), interner) == &root);
+   }
+}
@@ -0,0 +1,393 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/parser/parse.hpp"
+
+#include "lingua/lexer/lex.hpp"
+#include <cstddef>
+#include <doctest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+   using lingua::no_syntax_node, lingua::syntax_error_kind, lingua::syntax_kind,
+      lingua::syntax_node, lingua::syntax_tree;
+   using namespace std::string_view_literals;
+
+   /// \brief Writes an expression as an s-expression, so that its shape can be checked at a
+   ///        glance: `a + b * c` is written as `(+ a (* b c))`.
+   ///
+   std::u8string sexpr(syntax_tree const& tree, std::u8string_view const source,
+      syntax_node const n)
+   {
+      if (n == no_syntax_node) {
+         return u8"_";
+      }
+
+      auto head = std::u8string{};
+      switch (tree.kind(n)) {
+      case syntax_kind::literal:
+      case syntax_kind::path:
+         return std::u8string{tree.span(n).text(source)};
+      case syntax_kind::call:
+         head = u8"call";
+         break;
+      case syntax_kind::index:
+         head = u8"index";
+         break;
+      case syntax_kind::group:
+         head = u8"group";
+         break;
+      case syntax_kind::tuple:
+         head = u8"tuple";
+         break;
+      case syntax_kind::block:
+         head = u8"block";
+         break;
+      case syntax_kind::expression_statement:
+         head = u8"statement";
+         break;
+      case syntax_kind::struct_expression:
+         head = u8"struct";
+         break;
+      case syntax_kind::field_initialiser:
+         head = tree.main_token(n).text(source);
+         break;
+      case syntax_kind::method_call:
+      case syntax_kind::field_access:
+         head = u8".";
+         head += tree.main_token(n).text(source);
+         break;
+      default:
+         head = tree.main_token(n).text(source);
+         break;
+      }
+
+      for (auto const child : tree.children(n)) {
+         head += u8' ';
+         head += sexpr(tree, source, child);
+      }
+      return u8"(" + head + u8")";
+   }
+
+   /// \brief Parses `source` as the value of a constant, and writes it as an s-expression.
+   ///
+   std::u8string expression(std::u8string_view const text)
+   {
+      auto const source = u8"const X: T = " + std::u8string{text} + u8";";
+      auto const tree = lingua::parse(source);
+      CHECK(tree.errors().empty());
+
+      auto const items = tree.children(tree.root());
+      if (items.size() != 1 or tree.kind(items[0]) != syntax_kind::constant) {
+         return u8"not an expression";
+      }
+      return sexpr(tree, source, tree.child(items[0], 3));
+   }
+
+   /// \brief Returns the kinds of the items in `source`.
+   ///
+   std::vector<syntax_kind> item_kinds(syntax_tree const& tree)
+   {
+      auto kinds = std::vector<syntax_kind>{};
+      for (auto const item : tree.children(tree.root())) {
+         kinds.push_back(tree.kind(item));
+      }
+      return kinds;
+   }
+} // namespace
+
+TEST_CASE("checks operator precedence and associativity") {
+   CHECK(expression(u8"a + b * c") == u8"(+ a (* b c))");
+   CHECK(expression(u8"a * b + c") == u8"(+ (* a b) c)");
+   CHECK(expression(u8"a - b - c") == u8"(- (- a b) c)");
+   CHECK(expression(u8"a = b = c") == u8"(= a (= b c))");
+   CHECK(expression(u8"a || b && c == d") == u8"(|| a (&& b (== c d)))");
+   CHECK(expression(u8"a | b ^ c & d << e") == u8"(| a (^ b (& c (<< d e))))");
+   CHECK(expression(u8"-a * b") == u8"(* (- a) b)");
+   CHECK(expression(u8"-a.b()") == u8"(- (.b a _))");
+   CHECK(expression(u8"!a as u8 + 1") == u8"(+ (as (! a) u8) 1)");
+   CHECK(expression(u8"&mut a[i]?") == u8"(& (? (index a i)))");
+   CHECK(expression(u8"a..b + 1") == u8"(.. a (+ b 1))");
+   CHECK(expression(u8"..=b") == u8"(..= _ b)");
+   CHECK(expression(u8"a..") == u8"(.. a _)");
+   CHECK(expression(u8"(a + b) * c") == u8"(* (group (+ a b)) c)");
+   CHECK(expression(u8"(a, b,)") == u8"(tuple a b)");
+   CHECK(expression(u8"f(a, b)(c)") == u8"(call (call f a b) c)");
+   CHECK(expression(u8"x.0.len()") == u8"(.len (.0 x) _)");
+   CHECK(expression(u8"v.iter().collect::<Vec<_>>()")
+      == u8"(.collect (.iter v _) (< Vec<_>))");
+   CHECK(expression(u8"Vec::<u8>::new()") == u8"(call Vec::<u8>::new)");
+   CHECK(expression(u8"Point { x: 1, y }") == u8"(struct Point (x 1) (y _))");
+   CHECK(expression(u8"&&x") == u8"(&& (&& x))");
+}
+
+TEST_CASE("checks block-like expressions") {
+   CHECK(expression(u8"if a == B { 1 } else if c { 2 } else { 3 }")
+      == u8"(if (== a B) (block 1) (if c (block 2) (block 3)))");
+   CHECK(expression(u8"match x { Some(y) if y > 0 => y, _ => { 0 } }")
+      == u8"(match x (Some (Some Some (y)) (> y 0) y) (_ (_) _ (block 0)))");
+   CHECK(expression(u8"while let Some(x) = it.next() { f(x); }")
+      == u8"(while (let (Some Some (x)) (.next it _)) (block (statement _ (call f x))))");
+   CHECK(expression(u8"for i in 0..n { }") == u8"(for (i) (.. 0 n) (block))");
+   CHECK(expression(u8"'outer: loop { break 'outer; }")
+      == u8"(loop (block (statement _ (break _))))");
+   CHECK(expression(u8"|a, b: u8| a + b") == u8"(| (| (a (a) _) (b (b) u8)) _ (+ a b))");
+   CHECK(expression(u8"move || -> u8 { 1 }") == u8"(move (||) u8 (block 1))");
+
+   CHECK(expression(u8"{ let S { a, b: c } = s; a }")
+      == u8"(block (let _ (S S (a _) (b (c))) _ s _) a)");
+   CHECK(expression(u8"match x { S { a, .. } => 1, }") == u8"(match x (S (S S (a _) (..)) _ 1))");
+
+   CHECK(expression(u8"match s { [a, rest @ ..] => 1, ref mut whole @ [] => 0 }")
+      == u8"(match s ([ ([ (a) (rest (..))) _ 1) (ref (whole ([)) _ 0))");
+
+   CHECK(expression(u8"{ let Some(x) = y else { return; }; x }")
+      == u8"(block (let _ (Some Some (x)) _ y (block (statement _ (return _)))) x)");
+
+   // A block-like expression ends a statement, so `*y` is a dereference rather than a product.
+   CHECK(expression(u8"{ if a {} *y = 1 }")
+      == u8"(block (statement _ (if a (block) _)) (= (* y) 1))");
+}
+
+TEST_CASE("checks a long chain of `else if`s isn't mistaken for deep nesting") {
+   auto source = std::u8string{u8"fn f() { if a {}"};
+   for (auto i = 0; i < 1000; ++i) {
+      source += u8" else if a {}";
+   }
+   source += u8" else {} }";
+
+   auto const tree = lingua::parse(source);
+   CHECK(tree.errors().empty());
+
+   auto const body = tree.child(tree.child(tree.root(), 0), 6);
+   auto chain = tree.child(body, 0);
+   auto links = 0;
+   for (; tree.kind(chain) == syntax_kind::if_expression; chain = tree.child(chain, 2)) {
+      CHECK(tree.span(chain).offset + tree.span(chain).length == source.size() - 2);
+      ++links;
+   }
+   CHECK(links == 1001);
+   CHECK(tree.kind(chain) == syntax_kind::block);
+}
+
+TEST_CASE("checks items") {
+   constexpr auto source = u8R"(
+      #![no_std]
+      use std::{io::{self, Read}, fmt::*, collections::HashMap as Map};
+
+      /// Documentation is trivia.
+      #[derive(Debug)]
+      pub(crate) struct Point<T: Copy + 'static> { pub x: T, y: T }
+      struct Unit;
+      struct Pair(pub i32, (u8, u8));
+      enum Shape { Circle { r: f64 }, Square(f64), Nothing = 3 }
+      mod inner { fn f() {} }
+      mod outer;
+      const MAX: usize = 1 << 10;
+      static mut COUNT: &'static str = "";
+      type Map<K> = std::collections::HashMap<K, Vec<Vec<u8>>>;
+      impl<T> Display for Point<T> where T: Copy {
+         fn fmt(&self, f: &mut Formatter<'_>) -> Result { write!(f, "{}", self.x) }
+      }
+      pub unsafe trait Shape: Debug { type Output: Clone; fn area(&self) -> f64; }
+      macro_rules! square { ($x:expr) => { $x * $x }; }
+      pub const unsafe fn f<'a>(x: &'a [u8; 4], (a, _): (i32, i32)) -> ! { loop {} }
+   )"sv;
+
+   auto const tree = lingua::parse(source);
+   CHECK(tree.errors().empty());
+   CHECK(item_kinds(tree) == std::vector{
+      syntax_kind::attribute,
+      syntax_kind::use_declaration,
+      syntax_kind::structure,
+      syntax_kind::structure,
+      syntax_kind::structure,
+      syntax_kind::enumeration,
+      syntax_kind::module,
+      syntax_kind::module,
+      syntax_kind::constant,
+      syntax_kind::static_variable,
+      syntax_kind::type_alias,
+      syntax_kind::implementation,
+      syntax_kind::trait_declaration,
+      syntax_kind::macro_item,
+      syntax_kind::function,
+   });
+
+   SUBCASE("checks a structure's layout and spans") {
+      auto const point = tree.child(tree.root(), 2);
+      CHECK(tree.main_token(point).text(source) == u8"Point");
+      CHECK(tree.span(point).text(source).starts_with(u8"#[derive(Debug)]"));
+      CHECK(tree.span(point).text(source).ends_with(u8"y: T }"));
+
+      auto const children = tree.children(point);
+      REQUIRE(children.size() == 5);
+      CHECK(tree.kind(children[0]) == syntax_kind::attribute_list);
+      CHECK(tree.kind(children[1]) == syntax_kind::visibility);
+      CHECK(tree.span(children[1]).text(source) == u8"pub(crate)");
+      CHECK(tree.kind(children[2]) == syntax_kind::generic_parameters);
+      CHECK(children[3] == no_syntax_node);
+      CHECK(tree.kind(children[4]) == syntax_kind::field_list);
+      CHECK(tree.children(children[4]).size() == 2);
+   }
+
+   SUBCASE("checks a use tree") {
+      auto const use = tree.child(tree.root(), 1);
+      auto const top = tree.child(use, 2);
+      CHECK(tree.span(tree.child(top, 0)).text(source) == u8"std");
+      auto const list = tree.child(top, 1);
+      REQUIRE(tree.kind(list) == syntax_kind::use_tree_list);
+      REQUIRE(tree.children(list).size() == 3);
+
+      auto const renamed = tree.child(list, 2);
+      CHECK(tree.span(tree.child(renamed, 0)).text(source) == u8"collections::HashMap");
+      CHECK(tree.kind(tree.child(renamed, 1)) == syntax_kind::use_rename);
+      CHECK(tree.main_token(tree.child(renamed, 1)).text(source) == u8"Map");
+      CHECK(tree.kind(tree.child(tree.child(list, 1), 1)) == syntax_kind::use_glob);
+   }
+
+   SUBCASE("checks that `>>` is split between generic argument lists") {
+      auto const alias = tree.child(tree.root(), 10);
+      CHECK(tree.span(tree.child(alias, 4)).text(source)
+         == u8"std::collections::HashMap<K, Vec<Vec<u8>>>");
+   }
+
+   SUBCASE("checks a function's layout") {
+      auto const f = tree.child(tree.root(), 14);
+      auto const parameters = tree.child(f, 3);
+      REQUIRE(tree.children(parameters).size() == 2);
+      CHECK(tree.kind(tree.child(tree.child(parameters, 0), 1)) == syntax_kind::reference_type);
+      CHECK(tree.kind(tree.child(tree.child(parameters, 1), 0)) == syntax_kind::tuple_pattern);
+      CHECK(tree.kind(tree.child(f, 4)) == syntax_kind::never_type);
+      CHECK(tree.kind(tree.child(f, 6)) == syntax_kind::block);
+   }
+}
+
+TEST_CASE("checks pointers, function types, qualified paths, and extern items") {
+   constexpr auto source = u8R"(
+      extern crate alloc;
+      extern crate std as core;
+      extern "C" { fn abs(x: i32) -> i32; static errno: i32; }
+      type Callback = unsafe extern "C" fn(*const u8, len: usize, ...) -> *mut u8;
+      fn f<T: Iterator>(x: <T as Iterator>::Item) -> fn(u8) -> u8 { g }
+   )"sv;
+
+   auto const tree = lingua::parse(source);
+   CHECK(tree.errors().empty());
+   CHECK(item_kinds(tree) == std::vector{
+      syntax_kind::extern_crate,
+      syntax_kind::extern_crate,
+      syntax_kind::extern_block,
+      syntax_kind::type_alias,
+      syntax_kind::function,
+   });
+
+   auto const renamed = tree.child(tree.root(), 1);
+   CHECK(tree.main_token(renamed).text(source) == u8"std");
+   CHECK(tree.main_token(tree.child(renamed, 2)).text(source) == u8"core");
+   CHECK(tree.children(tree.child(tree.child(tree.root(), 2), 2)).size() == 2);
+
+   auto const callback = tree.child(tree.child(tree.root(), 3), 4);
+   CHECK(tree.kind(callback) == syntax_kind::function_type);
+   CHECK(sexpr(tree, source, callback) == u8"(fn (* u8) (* u8) usize)");
+
+   auto const f = tree.child(tree.root(), 4);
+   auto const parameter_type = tree.child(tree.child(tree.child(f, 3), 0), 1);
+   REQUIRE(tree.kind(parameter_type) == syntax_kind::path);
+   CHECK(tree.kind(tree.child(parameter_type, 0)) == syntax_kind::qualified_type);
+   CHECK(tree.span(tree.child(parameter_type, 0)).text(source) == u8"<T as Iterator>");
+   CHECK(sexpr(tree, source, tree.child(f, 4)) == u8"(fn u8 u8)");
+
+   CHECK(expression(u8"<Vec<u8>>::new()") == u8"(call <Vec<u8>>::new)");
+}
+
+TEST_CASE("checks recovery from syntax errors") {
+   SUBCASE("a broken item doesn't hide the ones after it") {
+      constexpr auto source = u8"fn f( { let } struct S; 42 fn g() {}"sv;
+      auto const tree = lingua::parse(source);
+      CHECK(not tree.errors().empty());
+
+      auto const kinds = item_kinds(tree);
+      REQUIRE(kinds.size() >= 3);
+      CHECK(kinds.back() == syntax_kind::function);
+      CHECK(tree.main_token(tree.children(tree.root()).back()).text(source) == u8"g");
+      CHECK(std::ranges::find(kinds, syntax_kind::structure) != kinds.end());
+   }
+
+   SUBCASE("a missing semicolon") {
+      constexpr auto source = u8"fn f() { let x = 1 let y = 2; }"sv;
+      auto const tree = lingua::parse(source);
+      REQUIRE(tree.errors().size() == 1);
+      CHECK(tree.errors()[0].kind == syntax_error_kind::expected_token);
+      CHECK(tree.errors()[0].expected == lingua::token_kind::semicolon);
+      CHECK(tree.errors()[0].text(source) == u8"let");
+   }
+
+   SUBCASE("errors at the end of the source") {
+      constexpr auto source = u8"fn f() { 1 +"sv;
+      auto const tree = lingua::parse(source);
+      REQUIRE(not tree.errors().empty());
+      CHECK(tree.errors()[0].kind == syntax_error_kind::expected_expression);
+      CHECK(tree.errors()[0].offset == source.size());
+   }
+
+   SUBCASE("nesting too deeply") {
+      auto source = std::u8string{u8"const X: u8 = "};
+      source.append(100'000, u8'(');
+      auto const tree = lingua::parse(source);
+      REQUIRE(not tree.errors().empty());
+      CHECK(tree.errors()[0].kind == syntax_error_kind::too_deeply_nested);
+
+      auto ifs = std::u8string{u8"fn f() { "};
+      for (auto i = 0; i < 300; ++i) {
+         ifs += u8"if ";
+      }
+      ifs += u8"x";
+      for (auto i = 0; i < 300; ++i) {
+         ifs += u8" {}";
+      }
+      ifs += u8" }";
+      auto const nested_ifs = lingua::parse(ifs);
+      REQUIRE(not nested_ifs.errors().empty());
+      CHECK(nested_ifs.errors()[0].kind == syntax_error_kind::too_deeply_nested);
+
+      auto uses = std::u8string{u8"use "};
+      for (auto i = 0; i < 300; ++i) {
+         uses += u8"{";
+      }
+      auto const nested_uses = lingua::parse(uses);
+      REQUIRE(not nested_uses.errors().empty());
+      CHECK(nested_uses.errors()[0].kind == syntax_error_kind::too_deeply_nested);
+   }
+
+   SUBCASE("an empty source") {
+      auto const tree = lingua::parse(u8"");
+      CHECK(tree.errors().empty());
+      CHECK(tree.size() == 1);
+      CHECK(tree.children(tree.root()).empty());
+   }
+}
+
+TEST_CASE("checks that parsing from tokens skips trivia") {
+   constexpr auto source = u8"fn /* name */ main() {\n   // body\n}\n"sv;
+   auto const lexed = lingua::lex(source);
+   auto const tree = lingua::parse(source, lexed.tokens);
+   CHECK(tree.errors().empty());
+   CHECK(tree.tokens().size() == 6);
+   CHECK(tree.main_token(tree.child(tree.root(), 0)).text(source) == u8"main");
+   CHECK(tree.size_in_bytes() > 0);
+}
@@ -0,0 +1,164 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/source_buffer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <doctest.h>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace {
+   using lingua::source_coordinate;
+
+   [[nodiscard]] source_coordinate make_coordinate(std::size_t const line, std::size_t const column)
+   {
+      return source_coordinate{
+         source_coordinate::line_type{static_cast<source_coordinate::value_type>(line)},
+         source_coordinate::column_type{static_cast<source_coordinate::value_type>(column)}
+      };
+   }
+
+   /// \brief Checks that `buffer` holds `expected`, and that its line table agrees with one
+   ///        computed by scanning `expected`.
+   ///
+   void check_equal(lingua::source_buffer const& buffer, std::u8string_view const expected)
+   {
+      REQUIRE(buffer.size() == expected.size());
+      CHECK(buffer.str() == expected);
+      CHECK(buffer.line_count()
+         == static_cast<std::size_t>(std::ranges::count(expected, u8'\n')) + 1);
+
+      auto line = std::size_t{1};
+      auto column = std::size_t{1};
+      for (auto offset = std::size_t{0}; offset <= expected.size(); ++offset) {
+         if (column == 1) {
+            CHECK(buffer.line_begin(line) == offset);
+         }
+         CHECK(buffer.coordinate_of(offset) == make_coordinate(line, column));
+         CHECK(buffer.offset_of(make_coordinate(line, column)) == offset);
+
+         if (offset < expected.size()) {
+            CHECK(buffer[offset] == expected[offset]);
+            auto const [text, begin] = buffer.chunk_at(offset);
+            CHECK(begin <= offset);
+            CHECK(offset < begin + text.size());
+            CHECK(text.size() <= lingua::source_buffer::max_chunk_size);
+            CHECK(expected.substr(begin, text.size()) == text);
+
+            if (expected[offset] == u8'\n') {
+               ++line;
+               column = 1;
+            }
+            else {
+               ++column;
+            }
+         }
+      }
+   }
+} // namespace
+
+TEST_CASE("checks source_buffer is constructed correctly") {
+   SUBCASE("checks an empty buffer") {
+      auto const buffer = lingua::source_buffer{};
+      CHECK(buffer.empty());
+      CHECK(buffer.line_count() == 1);
+      CHECK(buffer.line_begin(1) == 0);
+      CHECK(buffer.coordinate_of(0) == source_coordinate{});
+      check_equal(buffer, u8"");
+   }
+
+   SUBCASE("checks a small buffer") {
+      constexpr auto text = std::u8string_view{u8"fn main() {\n   let x = 0;\n}\n"};
+      auto const buffer = lingua::source_buffer{text};
+      CHECK(buffer.line_count() == 4);
+      CHECK(buffer.coordinate_of(text.find(u8'x')) == make_coordinate(2, 8));
+      check_equal(buffer, text);
+   }
+
+   SUBCASE("checks a buffer larger than a chunk") {
+      auto text = std::u8string{};
+      for (auto i = 0; i < 1'000; ++i) {
+         text += u8"let value = compute(value);\n";
+      }
+      auto const buffer = lingua::source_buffer{text};
+      CHECK(buffer.line_count() == 1'001);
+      CHECK(buffer.substr(28, 28) == text.substr(28, 28));
+      CHECK(buffer.substr(text.size() - 3, 100) == text.substr(text.size() - 3));
+      check_equal(buffer, text);
+   }
+}
+
+TEST_CASE("checks source_buffer edits") {
+   auto model = std::u8string{u8"first\nsecond\nthird"};
+   auto buffer = lingua::source_buffer{model};
+
+   SUBCASE("checks insert") {
+      CHECK(buffer.insert(6, u8"middle\n") == lingua::text_edit{6, 0, 7});
+      model.insert(6, u8"middle\n");
+      check_equal(buffer, model);
+   }
+
+   SUBCASE("checks erase") {
+      CHECK(buffer.erase(5, 7) == lingua::text_edit{5, 7, 0});
+      model.erase(5, 7);
+      check_equal(buffer, model);
+   }
+
+   SUBCASE("checks replace") {
+      CHECK(buffer.replace(0, 5, u8"zeroth") == lingua::text_edit{0, 5, 6});
+      model.replace(0, 5, u8"zeroth");
+      check_equal(buffer, model);
+   }
+
+   SUBCASE("checks erasing everything") {
+      buffer.erase(0, model.size());
+      check_equal(buffer, u8"");
+      buffer.insert(0, u8"\n\n");
+      check_equal(buffer, u8"\n\n");
+   }
+}
+
+TEST_CASE("checks source_buffer agrees with a string under random edits") {
+   auto engine = std::mt19937{42};
+   auto pick = [&engine](std::size_t const bound) {
+      return std::uniform_int_distribution<std::size_t>{0, bound}(engine);
+   };
+   auto random_text = [&pick](std::size_t const length) {
+      auto text = std::u8string(length, u8'x');
+      std::ranges::generate(text, [&pick] { return pick(7) == 0 ? u8'\n' : u8'a'; });
+      return text;
+   };
+
+   auto model = random_text(20'000);
+   auto buffer = lingua::source_buffer{model};
+   for (auto i = 0; i < 300; ++i) {
+      auto const offset = pick(model.size());
+      auto const removed = std::min(pick(i % 10 == 0 ? 10'000 : 8), model.size() - offset);
+      auto const inserted = random_text(pick(i % 10 == 5 ? 10'000 : 8));
+
+      buffer.replace(offset, removed, inserted);
+      model.replace(offset, removed, inserted);
+
+      REQUIRE(buffer.size() == model.size());
+      REQUIRE(buffer.line_count()
+         == static_cast<std::size_t>(std::ranges::count(model, u8'\n')) + 1);
+      auto const probe = pick(model.size());
+      CHECK(buffer.substr(probe, 64) == model.substr(probe, 64));
+   }
+   check_equal(buffer, model);
+}
@@ -0,0 +1,186 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/hash_source.hpp"
+
+#include "lingua_test/differential.hpp"
+#include "lingua_test/for_each_simd_level.hpp"
+#include <algorithm>
+#include <array>
+#include <doctest.h>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace {
+   std::u8string make_source(std::size_t const size)
+   {
+      auto result = std::u8string{};
+      result.reserve(size);
+      for (auto i = std::size_t{0}; result.size() < size; ++i) {
+         result += static_cast<char8_t>(u8'a' + (i * 7) % 26);
+         if (i % 61 == 0 and result.size() < size) {
+            result += u8'\n';
+         }
+      }
+      return result;
+   }
+
+   /// \brief Returns the digest and newline count of `source`, with kernels dispatching on
+   ///        `level` while they're computed.
+   ///
+   std::pair<lingua::source_digest, std::size_t>
+   hash_at_level(lingua::simd_level const level, std::u8string_view const source)
+   {
+      auto const previous = lingua::set_simd_level(level);
+      auto const result = lingua::hash_and_count_lines(source);
+      lingua::set_simd_level(previous);
+      return {result.digest, result.newlines};
+   }
+
+   void check_hash(std::u8string_view const source)
+   {
+      lingua_test::check_agreement(source,
+         [](std::u8string_view const x) { return hash_at_level(lingua::active_simd_level(), x); },
+         [](std::u8string_view const x) { return hash_at_level(lingua::simd_level::scalar, x); });
+   }
+} // namespace
+
+TEST_CASE("checks hash_source is stable") {
+   // These values must never change: they're persisted by token_cache, and other machines must
+   // compute the same digests, whichever instructions they have.
+   using lingua::hash_source, lingua::source_digest;
+   lingua_test::for_each_simd_level([] {
+      CHECK(hash_source(u8"") == source_digest{0x73c103e553ff2531, 0x092247d21313cc6d});
+      CHECK(hash_source(u8"a") == source_digest{0x4f2c4cb0979f055a, 0xd53b249770d33560});
+      CHECK(hash_source(u8"fn main() {}\n")
+         == source_digest{0xed5e10fc007181ed, 0x2d72102ffaf25975});
+      CHECK(hash_source(make_source(5082))
+         == source_digest{0x38fd67bcff900de0, 0x8d146077e5d8fc80});
+   });
+}
+
+TEST_CASE("checks hash_source distinguishes sources") {
+   auto digests = std::set<std::pair<std::uint64_t, std::uint64_t>>{};
+   auto const source = make_source(3000);
+   auto total = 0;
+   for (auto size = std::size_t{0}; size <= source.size(); size += 7, ++total) {
+      auto const digest = lingua::hash_source(std::u8string_view{source}.substr(0, size));
+      digests.emplace(digest.low, digest.high);
+   }
+
+   // flipping any single bit changes the digest
+   auto flipped = source.substr(0, 200);
+   for (auto i = std::size_t{0}; i < flipped.size(); ++i, ++total) {
+      for (auto bit = 0U; bit < 8U; bit += 3) {
+         flipped[i] = static_cast<char8_t>(flipped[i] ^ (1U << bit));
+         auto const digest = lingua::hash_source(flipped);
+         digests.emplace(digest.low, digest.high);
+         flipped[i] = static_cast<char8_t>(flipped[i] ^ (1U << bit));
+      }
+   }
+
+   // trailing zeroes aren't confused with padding
+   auto const zero = std::u8string(1, u8'\0');
+   CHECK(lingua::hash_source(u8"a") != lingua::hash_source(u8"a" + zero));
+   CHECK(digests.size() == static_cast<std::size_t>(total) + 200 * 2);
+}
+
+TEST_CASE("checks source_hasher doesn't depend on how the source is split") {
+   auto const source = make_source(4000);
+   auto const expected = lingua::hash_source(source);
+
+   for (auto const piece : {1, 3, 63, 64, 65, 500, 1024, 4000}) {
+      auto hasher = lingua::source_hasher{};
+      auto rest = std::u8string_view{source};
+      while (not rest.empty()) {
+         auto const size = std::min(rest.size(), static_cast<std::size_t>(piece));
+         hasher.update(rest.substr(0, size));
+         rest.remove_prefix(size);
+      }
+      CHECK(hasher.digest() == expected);
+   }
+
+   auto hasher = lingua::source_hasher{};
+   CHECK(hasher.digest() == lingua::hash_source(u8""));
+}
+
+TEST_CASE("checks hash_and_count_lines") {
+   lingua_test::for_each_simd_level([] {
+      for (auto const size : {0, 1, 63, 64, 65, 1000, 5082}) {
+         auto const source = make_source(static_cast<std::size_t>(size));
+         auto const result = lingua::hash_and_count_lines(source);
+         CHECK(result.digest == lingua::hash_source(source));
+         CHECK(result.newlines == static_cast<std::size_t>(std::ranges::count(source, u8'\n')));
+      }
+   });
+}
+
+TEST_CASE("checks hash_and_count_lines agrees with the scalar kernel") {
+   using namespace std::string_view_literals;
+   SUBCASE("on every short source") {
+      lingua_test::for_each_simd_level([] {
+         lingua_test::for_each_string(u8"a\n\0\xff"sv, 5, check_hash);
+      });
+   }
+
+   SUBCASE("on long random sources") {
+      lingua_test::for_each_simd_level([] {
+         // Long enough to cross the 1024-byte blocks after which the accumulators are scrambled.
+         constexpr auto pieces = std::array{u8"a"sv, u8"\n"sv, u8"\0"sv, u8"\xff"sv,
+            u8"fn main() {}\n"sv, u8"let x = \"hello, world\";\n"sv, u8"\n\n\n\n\n\n\n\n"sv};
+         auto engine = std::mt19937_64{0x68617368};
+         for (auto i = 0; i < 300; ++i) {
+            check_hash(lingua_test::random_string(engine, pieces, 400));
+         }
+      });
+   }
+}
+
+TEST_CASE("checks chunk_source finds the regions that changed") {
+   auto const original = make_source(64 * 1024);
+   auto const options = lingua::chunking_options{};
+   auto const chunks = lingua::chunk_source(original, options);
+
+   SUBCASE("chunks cover the source") {
+      auto offset = std::size_t{0};
+      for (auto const& chunk : chunks) {
+         CHECK(chunk.offset == offset);
+         CHECK(chunk.size <= options.max_size);
+         offset += chunk.size;
+      }
+      CHECK(offset == original.size());
+      CHECK(chunks.size() > 16);
+   }
+
+   SUBCASE("an edit only disturbs nearby chunks") {
+      auto edited = original;
+      edited.insert(edited.size() / 2, u8"let x = 0;");
+      auto const edited_chunks = lingua::chunk_source(edited, options);
+
+      auto const unchanged = std::ranges::count_if(edited_chunks, [&chunks](auto const& chunk) {
+         return std::ranges::any_of(chunks, [&chunk](auto const& c) {
+            return c.digest == chunk.digest and c.size == chunk.size;
+         });
+      });
+      CHECK(static_cast<std::size_t>(unchanged) + 3 >= edited_chunks.size());
+   }
+
+   SUBCASE("empty source") {
+      CHECK(lingua::chunk_source(u8"").empty());
+   }
+}
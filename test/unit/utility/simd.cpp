@@ -0,0 +1,65 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/simd.hpp"
+
+#include "lingua_test/for_each_simd_level.hpp"
+#include <cstddef>
+#include <doctest.h>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+   using lingua::simd_level;
+   using namespace std::string_view_literals;
+} // namespace
+
+TEST_CASE("checks simd_level names") {
+   for (auto i = std::size_t{0}; i < lingua::simd_level_count; ++i) {
+      auto const level = static_cast<simd_level>(i);
+      CHECK(lingua::parse_simd_level(lingua::simd_level_name(level)) == level);
+   }
+
+   CHECK(lingua::simd_level_name(simd_level::sse4_2) == "sse4.2"sv);
+   CHECK(not lingua::parse_simd_level(""sv));
+   CHECK(not lingua::parse_simd_level("sse4_2"sv));
+   CHECK(not lingua::parse_simd_level("AVX2"sv));
+   CHECK(not lingua::parse_simd_level("avx512f"sv));
+}
+
+TEST_CASE("checks that the active simd_level can be lowered and restored") {
+   auto const supported = lingua::supported_simd_level();
+   auto const original = lingua::active_simd_level();
+   CHECK(original <= supported);
+
+   CHECK(lingua::set_simd_level(simd_level::scalar) == original);
+   CHECK(lingua::active_simd_level() == simd_level::scalar);
+   CHECK(lingua::set_simd_level(supported) == simd_level::scalar);
+   CHECK(lingua::active_simd_level() == supported);
+   lingua::set_simd_level(original);
+}
+
+TEST_CASE("checks for_each_simd_level restores the simd_level when it's left by an exception") {
+   auto const original = lingua::active_simd_level();
+   auto levels = std::size_t{0};
+   auto const fail_on_first_level = [&levels] {
+      ++levels;
+      throw std::runtime_error{"failed"};
+   };
+
+   CHECK_THROWS_AS(lingua_test::for_each_simd_level(fail_on_first_level), std::runtime_error);
+   CHECK(levels == 1);
+   CHECK(lingua::active_simd_level() == original);
+}
@@ -0,0 +1,52 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/string_arena.hpp"
+
+#include <doctest.h>
+#include <string>
+#include <string_view>
+
+TEST_CASE("checks string_arena hands out stable storage") {
+   auto arena = lingua::string_arena{64};
+   auto const first = arena.store(u8"hello");
+   auto const second = arena.store(std::u8string(40, u8'x'));
+   auto const third = arena.store(std::u8string(40, u8'y'));
+
+   CHECK(first == u8"hello");
+   CHECK(second == std::u8string(40, u8'x'));
+   CHECK(third == std::u8string(40, u8'y'));
+   CHECK(arena.bytes_used() == 85);
+
+   // Requests larger than a block get a block of their own.
+   auto const big = arena.store(std::u8string(1000, u8'z'));
+   CHECK(big == std::u8string(1000, u8'z'));
+   CHECK(first == u8"hello");
+   CHECK(arena.bytes_used() == 1085);
+}
+
+TEST_CASE("checks string_arena::shrink gives back the end of the last allocation") {
+   auto arena = lingua::string_arena{64};
+   auto const storage = arena.allocate(10);
+   arena.shrink(6);
+   CHECK(arena.bytes_used() == 4);
+
+   auto const next = arena.allocate(4);
+   CHECK(next.data() == storage.data() + 4);
+
+   static_cast<void>(arena.allocate(100));
+   arena.shrink(100);
+   CHECK(arena.bytes_used() == 8);
+}
@@ -0,0 +1,255 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/transcode.hpp"
+
+#include "lingua_test/differential.hpp"
+#include "lingua_test/for_each_simd_level.hpp"
+#include "lingua/utility/validate_utf8.hpp"
+#include <array>
+#include <cstddef>
+#include <doctest.h>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace {
+   using lingua::source_encoding, lingua::transcode_to_utf8;
+   using namespace std::string_view_literals;
+
+   void append_utf8(std::u8string& out, char32_t const c)
+   {
+      if (c < 0x80) {
+         out += static_cast<char8_t>(c);
+      }
+      else if (c < 0x800) {
+         out += static_cast<char8_t>(0xc0U | (c >> 6U));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else if (c < 0x10000) {
+         out += static_cast<char8_t>(0xe0U | (c >> 12U));
+         out += static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else {
+         out += static_cast<char8_t>(0xf0U | (c >> 18U));
+         out += static_cast<char8_t>(0x80U | ((c >> 12U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+   }
+
+   void append_unit(std::u8string& out, char32_t const unit, bool const little_endian)
+   {
+      auto const high = static_cast<char8_t>(unit >> 8U);
+      auto const low = static_cast<char8_t>(unit & 0xffU);
+      out += little_endian ? low : high;
+      out += little_endian ? high : low;
+   }
+
+   void append_utf16(std::u8string& out, char32_t const c, bool const little_endian)
+   {
+      if (c < 0x10000) {
+         append_unit(out, c, little_endian);
+         return;
+      }
+      append_unit(out, 0xd800 + ((c - 0x10000) >> 10U), little_endian);
+      append_unit(out, 0xdc00 + ((c - 0x10000) & 0x3ffU), little_endian);
+   }
+
+   /// \brief Returns a character that's ASCII, or needs two, three, or four UTF-8 bytes, or is a
+   ///        lone low surrogate, with the mix weighted towards `ascii_weight`.
+   ///
+   char32_t random_character(std::mt19937& engine, std::mt19937::result_type const ascii_weight)
+   {
+      auto const between = [&engine](char32_t const low, char32_t const high) {
+         return static_cast<char32_t>(low + engine() % (high - low));
+      };
+
+      switch (engine() % (ascii_weight + 4)) {
+      case 0:
+         return between(0x80, 0x800);
+      case 1:
+         return between(0x800, 0xd800);
+      case 2:
+         return between(0x10000, 0x110000);
+      case 3:
+         return between(0xdc00, 0xe000);
+      default:
+         return between(0, 0x80);
+      }
+   }
+
+   /// \brief Transcodes `bytes` a unit at a time, following the rules that transcode_to_utf8
+   ///        documents for byte order marks and ill-formed UTF-16.
+   ///
+   std::u8string reference_transcode(std::u8string_view bytes, source_encoding const encoding)
+   {
+      auto result = std::u8string{};
+      if (encoding == source_encoding::latin1) {
+         for (auto const c : bytes) {
+            append_utf8(result, c);
+         }
+         return result;
+      }
+
+      auto const little_endian = encoding == source_encoding::utf16_le;
+      if (bytes.starts_with(little_endian ? u8"\xff\xfe"sv : u8"\xfe\xff"sv)) {
+         bytes.remove_prefix(2);
+      }
+
+      auto const unit = [bytes, little_endian](std::size_t const i) {
+         auto const first = char32_t{bytes[2 * i]};
+         auto const second = char32_t{bytes[2 * i + 1]};
+         return little_endian ? first | (second << 8U) : (first << 8U) | second;
+      };
+      auto const units = bytes.size() / 2;
+      for (auto i = std::size_t{0}; i < units; ++i) {
+         auto const u = unit(i);
+         if (0xd800 <= u and u < 0xdc00 and i + 1 < units and 0xdc00 <= unit(i + 1)
+             and unit(i + 1) < 0xe000) {
+            append_utf8(result, 0x10000 + ((u - 0xd800) << 10U) + (unit(i + 1) - 0xdc00));
+            ++i;
+         }
+         else {
+            append_utf8(result, u);
+         }
+      }
+      if (bytes.size() % 2 != 0) {
+         result += u8'\xff';
+      }
+      return result;
+   }
+
+   void check_transcode(std::u8string_view const bytes)
+   {
+      for (auto const encoding :
+           {source_encoding::latin1, source_encoding::utf16_le, source_encoding::utf16_be}) {
+         lingua_test::check_agreement(bytes,
+            [encoding](std::u8string_view const x) { return transcode_to_utf8(x, encoding); },
+            [encoding](std::u8string_view const x) { return reference_transcode(x, encoding); });
+      }
+   }
+} // namespace
+
+TEST_CASE("checks that the encoding is detected from the byte order mark") {
+   CHECK(lingua::detect_encoding(u8"\xff\xfe" u8"f\0"sv) == source_encoding::utf16_le);
+   CHECK(lingua::detect_encoding(u8"\xfe\xff" u8"\0f"sv) == source_encoding::utf16_be);
+   CHECK(lingua::detect_encoding(u8"\xef\xbb\xbf" u8"fn"sv) == source_encoding::utf8);
+   CHECK(lingua::detect_encoding(u8"fn main() {}"sv) == source_encoding::utf8);
+   CHECK(lingua::detect_encoding(u8"\xff"sv) == source_encoding::utf8);
+   CHECK(lingua::detect_encoding(u8""sv) == source_encoding::utf8);
+}
+
+TEST_CASE("checks Latin-1 is transcoded to UTF-8") {
+   CHECK(transcode_to_utf8(u8""sv, source_encoding::latin1).empty());
+   CHECK(transcode_to_utf8(u8"caf\xe9"sv, source_encoding::latin1) == u8"café");
+   CHECK(transcode_to_utf8(u8"\x80\xff"sv, source_encoding::latin1) == u8"\u0080ÿ");
+
+   lingua_test::for_each_simd_level([] {
+      auto engine = std::mt19937{0x6c61746e};
+      for (auto i = 0; i < 2000; ++i) {
+         auto const length = engine() % 100;
+         auto const ascii_weight = engine() % 8;
+         auto latin1 = std::u8string{};
+         auto expected = std::u8string{};
+         for (auto k = 0U; k < length; ++k) {
+            auto const latin1_only = engine() % (ascii_weight + 1) == 0;
+            auto const c = static_cast<char8_t>(latin1_only ? engine() % 256 : engine() % 128);
+            latin1 += c;
+            append_utf8(expected, c);
+         }
+         CHECK(transcode_to_utf8(latin1, source_encoding::latin1) == expected);
+      }
+   });
+}
+
+TEST_CASE("checks UTF-16 is transcoded to UTF-8") {
+   SUBCASE("the byte order mark is dropped") {
+      CHECK(transcode_to_utf8(u8"\xff\xfe" u8"f\0n\0"sv, source_encoding::utf16_le) == u8"fn");
+      CHECK(transcode_to_utf8(u8"\xfe\xff" u8"\0f\0n"sv, source_encoding::utf16_be) == u8"fn");
+      CHECK(transcode_to_utf8(u8"f\0n\0"sv, source_encoding::utf16_le) == u8"fn");
+      CHECK(transcode_to_utf8(u8"\xff\xfe"sv, source_encoding::utf16_le).empty());
+   }
+
+   SUBCASE("surrogate pairs") {
+      CHECK(transcode_to_utf8(u8"\x3d\xd8\x00\xde"sv, source_encoding::utf16_le) == u8"\U0001f600");
+      CHECK(transcode_to_utf8(u8"\xd8\x3d\xde\x00"sv, source_encoding::utf16_be) == u8"\U0001f600");
+   }
+
+   SUBCASE("ill-formed UTF-16 is still ill-formed afterwards") {
+      auto const lone = transcode_to_utf8(u8"a\0\x00\xd8" u8"b\0"sv, source_encoding::utf16_le);
+      CHECK(lone == u8"a\xed\xa0\x80" u8"b");
+      CHECK(lingua::validate_utf8(lone) == lingua::utf8_validation{1, 1});
+
+      auto const odd = transcode_to_utf8(u8"a\0b"sv, source_encoding::utf16_le);
+      CHECK(odd == u8"a\xff");
+      CHECK(lingua::validate_utf8(odd) == lingua::utf8_validation{1, 1});
+   }
+
+   SUBCASE("agrees with a character-at-a-time transcoder") {
+      lingua_test::for_each_simd_level([] {
+         auto engine = std::mt19937{0x75746631};
+         for (auto i = 0; i < 4000; ++i) {
+            auto const little_endian = i % 2 == 0;
+            auto const length = engine() % 100;
+            auto const ascii_weight = engine() % 64;
+            auto utf16 = std::u8string{};
+            auto expected = std::u8string{};
+            for (auto k = 0U; k < length; ++k) {
+               auto const c = random_character(engine, ascii_weight);
+               append_utf16(utf16, c, little_endian);
+               append_utf8(expected, c);
+            }
+
+            auto const encoding =
+               little_endian ? source_encoding::utf16_le : source_encoding::utf16_be;
+            CHECK(transcode_to_utf8(utf16, encoding) == expected);
+         }
+      });
+   }
+}
+
+TEST_CASE("checks transcode_to_utf8 agrees with transcoding a unit at a time") {
+   SUBCASE("on every short input") {
+      lingua_test::for_each_simd_level([] {
+         // The padding pushes the short tails across the boundaries of eight-unit blocks, at both
+         // an even and an odd offset.
+         constexpr auto paddings = std::array{u8""sv, u8"a\0b\0c\0d\0e\0f\0g"sv,
+            u8"a\0b\0c\0d\0e\0f\0g\0"sv};
+         for (auto const padding : paddings) {
+            lingua_test::for_each_string(u8"a\0\x07\x80\xd8\xdc\xfe\xff"sv, 4,
+               [padding](std::u8string_view const tail) {
+                  check_transcode(std::u8string{padding} + std::u8string{tail});
+               });
+         }
+      });
+   }
+
+   SUBCASE("on long random inputs") {
+      lingua_test::for_each_simd_level([] {
+         // Each piece is a character in one byte order or the other, a lone surrogate, a byte
+         // order mark, or a stray byte.
+         constexpr auto pieces = std::array{u8"a\0"sv, u8"\0a"sv, u8"fn main() {}\0"sv,
+            u8"\xe9\0"sv, u8"\0\xe9"sv, u8"\xac\x20"sv, u8"\x20\xac"sv, u8"\x3d\xd8\x00\xde"sv,
+            u8"\xd8\x3d\xde\x00"sv, u8"\x00\xd8"sv, u8"\xdc\x00"sv, u8"\xff\xfe"sv, u8"\xfe\xff"sv,
+            u8"z"sv};
+         auto engine = std::mt19937_64{0x7472616e};
+         for (auto i = 0; i < 3000; ++i) {
+            check_transcode(lingua_test::random_string(engine, pieces, 60));
+         }
+      });
+   }
+}
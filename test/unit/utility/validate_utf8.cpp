@@ -0,0 +1,244 @@
+//
+//  Copyright 2019 Christopher Di Bella
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "lingua/utility/validate_utf8.hpp"
+
+#include "lingua_test/differential.hpp"
+#include "lingua_test/for_each_simd_level.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <doctest.h>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace {
+   using lingua::utf8_validation;
+   using namespace std::string_view_literals;
+
+   void append_utf8(std::u8string& out, char32_t const c)
+   {
+      if (c < 0x80) {
+         out += static_cast<char8_t>(c);
+      }
+      else if (c < 0x800) {
+         out += static_cast<char8_t>(0xc0U | (c >> 6U));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else if (c < 0x10000) {
+         out += static_cast<char8_t>(0xe0U | (c >> 12U));
+         out += static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+      else {
+         out += static_cast<char8_t>(0xf0U | (c >> 18U));
+         out += static_cast<char8_t>(0x80U | ((c >> 12U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | ((c >> 6U) & 0x3fU));
+         out += static_cast<char8_t>(0x80U | (c & 0x3fU));
+      }
+   }
+
+   /// \brief Returns the length of the sequence that `lead` claims to start, or zero if it claims
+   ///        nothing. Leads of overlong and out-of-range sequences are deliberately accepted here.
+   ///
+   std::size_t claimed_length(char8_t const lead)
+   {
+      if (lead < 0x80) {
+         return 1;
+      }
+      if (lead < 0xc0) {
+         return 0;
+      }
+      return lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : lead < 0xf8 ? 4 : 0;
+   }
+
+   /// \brief Returns whether some scalar value's encoding begins with `prefix`, by working out the
+   ///        smallest and largest values that `prefix` could be finished into.
+   ///
+   bool is_valid_prefix(std::u8string_view const prefix)
+   {
+      auto const length = claimed_length(prefix[0]);
+      if (length == 0) {
+         return false;
+      }
+
+      auto low = std::uint32_t{prefix[0]} & (length == 1 ? 0x7fU : 0x7fU >> length);
+      auto high = low;
+      for (auto k = std::size_t{1}; k < length; ++k) {
+         if (k < prefix.size()) {
+            if ((prefix[k] & 0xc0U) != 0x80U) {
+               return false;
+            }
+            low = (low << 6U) | (prefix[k] & 0x3fU);
+            high = (high << 6U) | (prefix[k] & 0x3fU);
+         }
+         else {
+            low <<= 6U;
+            high = (high << 6U) | 0x3fU;
+         }
+      }
+
+      constexpr auto minimums = std::array<std::uint32_t, 5>{0, 0, 0x80, 0x800, 0x10000};
+      constexpr auto maximums = std::array<std::uint32_t, 5>{0, 0x7f, 0x7ff, 0xffff, 0x10ffff};
+      low = std::max(low, minimums[length]);
+      high = std::min(high, maximums[length]);
+      return low <= high and not (low >= 0xd800 and high <= 0xdfff);
+   }
+
+   /// \brief Validates `source` from the definition of a maximal subpart, independently of the
+   ///        library's decoder.
+   ///
+   utf8_validation reference_validate(std::u8string_view const source)
+   {
+      auto i = std::size_t{0};
+      while (i < source.size()) {
+         auto const length = claimed_length(source[i]);
+         auto valid = std::size_t{0};
+         while (valid < std::max(length, std::size_t{1}) and i + valid < source.size()
+                and is_valid_prefix(source.substr(i, valid + 1))) {
+            ++valid;
+         }
+
+         if (length == 0 or valid != length) {
+            return utf8_validation{i, static_cast<std::uint8_t>(std::max(valid, std::size_t{1}))};
+         }
+         i += length;
+      }
+      return utf8_validation{};
+   }
+
+   void check_invalid(std::u8string_view const source, std::size_t const offset,
+      std::uint8_t const length)
+   {
+      auto const validation = lingua::validate_utf8(source);
+      CHECK(not validation.valid());
+      CHECK(validation.error_offset == offset);
+      CHECK(validation.error_length == length);
+   }
+} // namespace
+
+TEST_CASE("checks valid UTF-8") {
+   CHECK(lingua::validate_utf8(u8""sv).valid());
+   CHECK(lingua::validate_utf8(u8"fn main() { println!(\"hello\"); }"sv).valid());
+   CHECK(lingua::validate_utf8(u8"let π = 3.14; // ≈ 🥧"sv).valid());
+
+   SUBCASE("every scalar value") {
+      auto source = std::u8string{};
+      for (auto c = char32_t{0}; c <= 0x10ffff; ++c) {
+         if (c < 0xd800 or c > 0xdfff) {
+            append_utf8(source, c);
+         }
+      }
+      CHECK(lingua::validate_utf8(source) == utf8_validation{});
+   }
+}
+
+TEST_CASE("checks invalid UTF-8") {
+   SUBCASE("bytes that can't begin a sequence") {
+      check_invalid(u8"\x80"sv, 0, 1);
+      check_invalid(u8"ab\xbf"sv, 2, 1);
+      check_invalid(u8"\xc0\xaf"sv, 0, 1);
+      check_invalid(u8"\xc1\xbf"sv, 0, 1);
+      check_invalid(u8"\xf5\x80\x80\x80"sv, 0, 1);
+      check_invalid(u8"\xff"sv, 0, 1);
+   }
+
+   SUBCASE("overlong encodings, surrogates, and values above U+10FFFF") {
+      check_invalid(u8"\xe0\x80\xaf"sv, 0, 1);
+      check_invalid(u8"\xe0\x9f\xbf"sv, 0, 1);
+      check_invalid(u8"\xf0\x8f\xbf\xbf"sv, 0, 1);
+      check_invalid(u8"\xed\xa0\x80"sv, 0, 1);
+      check_invalid(u8"\xed\xbf\xbf"sv, 0, 1);
+      check_invalid(u8"\xf4\x90\x80\x80"sv, 0, 1);
+   }
+
+   SUBCASE("missing continuations") {
+      check_invalid(u8"\xc3"sv, 0, 1);
+      check_invalid(u8"\xe2\x82"sv, 0, 2);
+      check_invalid(u8"\xe2\x82x"sv, 0, 2);
+      check_invalid(u8"\xf0\x9f\x98"sv, 0, 3);
+      check_invalid(u8"\xf0\x9f\x98\xf0\x9f\x98\x80"sv, 0, 3);
+   }
+
+   SUBCASE("too many continuations") {
+      check_invalid(u8"\xc3\xa9\xa9"sv, 2, 1);
+      check_invalid(u8"\xf0\x9f\x98\x80\x80"sv, 4, 1);
+   }
+
+   SUBCASE("only the first error is reported") {
+      check_invalid(u8"a\xff" u8"b\xff"sv, 1, 1);
+   }
+}
+
+TEST_CASE("checks errors are found at every offset") {
+   lingua_test::for_each_simd_level([] {
+      // Errors are placed either side of every block boundary, after both ASCII and multibyte text.
+      constexpr auto errors = std::array{u8"\xff"sv, u8"\xe2\x82"sv, u8"\xed\xa0\x80"sv,
+         u8"\xf0\x9f\x98"sv, u8"\xc3\xa9\xa9"sv};
+      for (auto const filler : {u8"a"sv, u8"é"sv, u8"€"sv, u8"🥧"sv}) {
+         for (auto const error : errors) {
+            for (auto count = std::size_t{0}; count < 70; ++count) {
+               auto prefix = std::u8string{};
+               for (auto i = std::size_t{0}; i < count; ++i) {
+                  prefix += filler;
+               }
+
+               auto const expected = lingua::validate_utf8(error);
+               for (auto const suffix : {u8""sv, u8"x"sv, u8"a tail of ASCII, a block or two"sv}) {
+                  auto const source = prefix + std::u8string{error} + std::u8string{suffix};
+                  auto const validation = lingua::validate_utf8(source);
+                  CHECK(validation.error_offset == prefix.size() + expected.error_offset);
+                  CHECK(validation.error_length == expected.error_length);
+               }
+            }
+         }
+      }
+   });
+}
+
+TEST_CASE("checks validation agrees with a brute-force decoder") {
+   lingua_test::for_each_simd_level([] {
+      auto engine = std::mt19937_64{0x75746638};
+      auto source = std::u8string{};
+      for (auto i = 0; i < 2000; ++i) {
+         source.clear();
+         auto const characters = engine() % 80;
+         for (auto k = std::uint64_t{0}; k < characters; ++k) {
+            switch (engine() % 4) {
+            case 0:
+               append_utf8(source, static_cast<char32_t>(engine() % 0x80));
+               break;
+            case 1:
+               append_utf8(source, static_cast<char32_t>(0x80 + engine() % (0x800 - 0x80)));
+               break;
+            case 2:
+               append_utf8(source, static_cast<char32_t>(0xe000 + engine() % (0x10000 - 0xe000)));
+               break;
+            default:
+               append_utf8(source,
+                  static_cast<char32_t>(0x10000 + engine() % (0x110000 - 0x10000)));
+               break;
+            }
+         }
+
+         if (not source.empty() and i % 4 != 0) {
+            source[engine() % source.size()] = static_cast<char8_t>(engine());
+         }
+         lingua_test::check_agreement(source, lingua::validate_utf8, reference_validate);
+      }
+   });
+}